@@ -21,6 +21,8 @@
 #include "software/exceptions/TsInitializationException.hh"
 #include "simulation/hs/TsHsMsg.hh"
 #include "GunnsFluidHeatExchanger.hh"
+#include "core/GunnsCheckpoint.hh"
+#include <typeinfo>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  name                  (--)  Name of object.
@@ -282,6 +284,56 @@ void GunnsFluidHeatExchanger::restartModel()
     mDeltaTemperature = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the overall & segment degradation malfunctions, the segment temperatures and the
+///           temperature override to the conductor state.  The segment heat transfer coefficients &
+///           energy gains are found again on the next step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidHeatExchanger::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsFluidConductor::saveCheckpoint(writer);
+    writer.write(mMalfHxDegradeFlag);
+    writer.write(mMalfHxDegradeValue);
+    for (int i = 0; i < mNumSegs; ++i) {
+        writer.write(mMalfSegDegradeFlag[i]);
+    }
+    writer.write(mMalfSegDegradeValue, mNumSegs);
+    writer.write(mSegTemperature, mNumSegs);
+    writer.write(mTemperatureOverride);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidHeatExchanger::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsFluidConductor::loadCheckpoint(reader);
+    reader.read(mMalfHxDegradeFlag);
+    reader.read(mMalfHxDegradeValue);
+    for (int i = 0; i < mNumSegs; ++i) {
+        reader.read(mMalfSegDegradeFlag[i]);
+    }
+    reader.read(mMalfSegDegradeValue, mNumSegs);
+    reader.read(mSegTemperature, mNumSegs);
+    reader.read(mTemperatureOverride);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsFluidHeatExchanger.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidHeatExchanger::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsFluidHeatExchanger);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  dt        (s)     Time step.
 /// @param[in]  flowRate  (kg/s)  Mass flow rate.
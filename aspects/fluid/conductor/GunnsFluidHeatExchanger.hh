@@ -139,6 +139,15 @@ class GunnsFluidHeatExchanger : public  GunnsFluidConductor
         /// @brief Sets Temperature Override.
         void setTemperatureOverride(const double value = 0.0);
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         int     mNumSegs;                 /**< *o (--)  trick_chkpnt_io(**) Number of segment for this Heat Exchanger */
         double* mSegHtcDefault;           /**<    (W/K) trick_chkpnt_io(**) Default segment heat transfer coefficients */
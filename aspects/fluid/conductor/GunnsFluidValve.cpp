@@ -26,6 +26,8 @@ PROGRAMMERS:
 #include "software/exceptions/TsInitializationException.hh"
 
 #include "GunnsFluidValve.hh"
+#include "core/GunnsCheckpoint.hh"
+#include <typeinfo>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  name                 (--)    Name of object.
@@ -249,6 +251,53 @@ void GunnsFluidValve::restartModel()
     GunnsFluidConductor::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the valve position, the leak-thru malfunction and leak state, and the wall
+///           temperature & heat flux to the conductor state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidValve::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsFluidConductor::saveCheckpoint(writer);
+    writer.write(mMalfLeakThruFlag);
+    writer.write(mMalfLeakThruValue);
+    writer.write(mWallTemperature);
+    writer.write(mWallHeatFlux);
+    writer.write(mPosition);
+    writer.write(mPreviousLeakRate);
+    writer.write(mLeakConductivity);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidValve::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsFluidConductor::loadCheckpoint(reader);
+    reader.read(mMalfLeakThruFlag);
+    reader.read(mMalfLeakThruValue);
+    reader.read(mWallTemperature);
+    reader.read(mWallHeatFlux);
+    reader.read(mPosition);
+    reader.read(mPreviousLeakRate);
+    reader.read(mLeakConductivity);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsFluidValve.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidValve::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsFluidValve);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s)  Time step (not used).
 ///
@@ -136,6 +136,12 @@ class GunnsFluidValve : public  GunnsFluidConductor
         void   setThermalSurfaceArea(const double value);
         /// @brief    Sets the wall temperature of this Valve.
         void   setWallTemperature(const double value);
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
     protected:
         double      mThermalDiameter;       /**< (m)    trick_chkpnt_io(**) Tube inner diameter for thermal convection           */
         double      mThermalSurfaceArea;    /**< (m2)   trick_chkpnt_io(**) Tube inner surface area for thermal convection       */
@@ -7,6 +7,7 @@
 ***************************************************************************************************/
 
 #include "software/exceptions/TsInitializationException.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "strings/UtResult.hh"
 
 #include "UtGunnsFluidHeatExchanger.hh"
@@ -617,5 +618,58 @@ void UtGunnsFluidHeatExchanger::testRestart()
     CPPUNIT_ASSERT(0.0 == mArticle->mTotalEnergyGain);
     CPPUNIT_ASSERT(0.0 == mArticle->mDeltaTemperature);
 
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Fluid Heat Exchanger link model native checkpoint save & load.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidHeatExchanger::testCheckpoint()
+{
+    UT_RESULT;
+
+    mArticle->initialize(*mConfigData, *mInputData, mLinks, mPort0, mPort1);
+
+    /// - Set the malfunctions, segment temperatures & override, and save the state.
+    mArticle->setMalfHxDegrade(true, 0.5);
+    mArticle->setMalfSegDegrade(1, true, 0.25);
+    mArticle->setTemperatureOverride(300.0);
+    for (int i = 0; i < mArticle->mNumSegs; ++i) {
+        mArticle->setSegmentTemp(i, 280.0 + i);
+    }
+    std::vector<unsigned char> buffer;
+    GunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&buffer);
+    mArticle->saveCheckpoint(writer);
+    writer.close();
+
+    /// - Change the malfunctions, segment temperatures & override.
+    mArticle->setMalfHxDegrade();
+    mArticle->setMalfSegDegrade(1);
+    mArticle->setTemperatureOverride();
+    for (int i = 0; i < mArticle->mNumSegs; ++i) {
+        mArticle->setSegmentTemp(i, 290.0);
+    }
+
+    /// @test    The loaded state is the state that was saved.
+    GunnsCheckpointReader reader("reader");
+    reader.openBuffer(&buffer);
+    mArticle->loadCheckpoint(reader);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+    CPPUNIT_ASSERT(mArticle->mMalfHxDegradeFlag);
+    CPPUNIT_ASSERT(0.5   == mArticle->mMalfHxDegradeValue);
+    CPPUNIT_ASSERT(mArticle->mMalfSegDegradeFlag[1]);
+    CPPUNIT_ASSERT(0.25  == mArticle->mMalfSegDegradeValue[1]);
+    CPPUNIT_ASSERT(300.0 == mArticle->mTemperatureOverride);
+    for (int i = 0; i < mArticle->mNumSegs; ++i) {
+        CPPUNIT_ASSERT(280.0 + i == mArticle->mSegTemperature[i]);
+    }
+
+    /// @test    The heat exchanger opts in to native checkpoints, but a type derived from it
+    ///          doesn't.
+    GunnsFluidHeatExchanger article;
+    CPPUNIT_ASSERT(article.isCheckpointable());
+    CPPUNIT_ASSERT(not mArticle->isCheckpointable());
+
     UT_PASS_LAST;
 }
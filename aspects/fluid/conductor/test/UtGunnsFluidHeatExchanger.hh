@@ -91,6 +91,8 @@ class UtGunnsFluidHeatExchanger: public CppUnit::TestFixture {
         void testInitializationExceptions();
         /// @brief    Tests restart method.
         void testRestart();
+        /// @brief    Tests native checkpoint save & load.
+        void testCheckpoint();
 
     private:
         CPPUNIT_TEST_SUITE(UtGunnsFluidHeatExchanger);
@@ -105,6 +107,7 @@ class UtGunnsFluidHeatExchanger: public CppUnit::TestFixture {
         CPPUNIT_TEST(testHtc);
         CPPUNIT_TEST(testInitializationExceptions);
         CPPUNIT_TEST(testRestart);
+        CPPUNIT_TEST(testCheckpoint);
         CPPUNIT_TEST_SUITE_END();
         ///  @brief   Enumeration for the number of nodes and fluid constituents.
         enum {N_NODES = 2, N_FLUIDS = 1};
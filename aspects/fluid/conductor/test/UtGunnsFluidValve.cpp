@@ -7,6 +7,7 @@
 ***************************************************************************************************/
 
 #include "core/GunnsFluidUtils.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "strings/UtResult.hh"
 
@@ -814,5 +815,53 @@ void UtGunnsFluidValve::testInitializationExceptions()
     CPPUNIT_ASSERT_THROW(article.initialize(*mConfigData, *mInputData, mLinks, mPort0, mPort1),
                          TsInitializationException);
 
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Fluid Valve link model native checkpoint save & load.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidValve::testCheckpoint()
+{
+    UT_RESULT;
+
+    /// - Initialize default test article with nominal initialization data, and step it with a
+    ///   leak-thru malfunction and a new position.
+    mArticle->initialize(*mConfigData, *mInputData, mLinks, mPort0, mPort1);
+    mArticle->setPosition(0.25);
+    mArticle->setMalfLeakThru(true, 0.5 * mMalfLeakThruValue);
+    mArticle->step(mTimeStep);
+    mArticle->mWallHeatFlux = 10.0;
+    const double leakConductivity = mArticle->mLeakConductivity;
+    std::vector<unsigned char> buffer;
+    GunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&buffer);
+    mArticle->saveCheckpoint(writer);
+    writer.close();
+
+    /// - Change the position, malfunction & wall state and step again.
+    mArticle->setPosition(0.75);
+    mArticle->setMalfLeakThru();
+    mArticle->mWallTemperature = 2.0 * mWallTemperature;
+    mArticle->step(mTimeStep);
+    mArticle->mWallHeatFlux = 0.0;
+
+    /// @test    The loaded state is the state that was saved.
+    GunnsCheckpointReader reader("reader");
+    reader.openBuffer(&buffer);
+    mArticle->loadCheckpoint(reader);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+    CPPUNIT_ASSERT(0.25                     == mArticle->getPosition());
+    CPPUNIT_ASSERT(mArticle->mMalfLeakThruFlag);
+    CPPUNIT_ASSERT(0.5 * mMalfLeakThruValue == mArticle->mMalfLeakThruValue);
+    CPPUNIT_ASSERT(mWallTemperature         == mArticle->mWallTemperature);
+    CPPUNIT_ASSERT(10.0                     == mArticle->mWallHeatFlux);
+    CPPUNIT_ASSERT(leakConductivity         == mArticle->mLeakConductivity);
+
+    /// @test    The valve opts in to native checkpoints, but a type derived from it doesn't.
+    GunnsFluidValve article;
+    CPPUNIT_ASSERT(article.isCheckpointable());
+    CPPUNIT_ASSERT(not mArticle->isCheckpointable());
+
     UT_PASS_LAST;
 }
@@ -73,6 +73,8 @@ class UtGunnsFluidValve: public CppUnit::TestFixture
         void testUpdateFluid();
         /// @brief    Tests initialize method exceptions.
         void testInitializationExceptions();
+        /// @brief    Tests native checkpoint save & load.
+        void testCheckpoint();
     private:
         CPPUNIT_TEST_SUITE(UtGunnsFluidValve);
         CPPUNIT_TEST(testConfig);
@@ -86,6 +88,7 @@ class UtGunnsFluidValve: public CppUnit::TestFixture
         CPPUNIT_TEST(testUpdateStateMalfunction);
         CPPUNIT_TEST(testUpdateFluid);
         CPPUNIT_TEST(testInitializationExceptions);
+        CPPUNIT_TEST(testCheckpoint);
         CPPUNIT_TEST_SUITE_END();
         ///  @brief   Enumeration for the number of nodes and fluid constituents.
         enum {N_NODES = 2, N_FLUIDS = 2};
@@ -15,7 +15,8 @@ ASSUMPTIONS AND LIMITATIONS:
    ()
 
 LIBRARY DEPENDENCY:
-   ((common/sensors/TsNoise.o))
+   ((common/sensors/TsNoise.o)
+    (core/GunnsCheckpoint.o))
 
 PROGRAMMERS:
    ((Jason Harvey) (L-3 Communications) (Install) (2012-07))
@@ -23,6 +24,7 @@ PROGRAMMERS:
 
 #include "GunnsPumpCavitation.hh"
 #include "common/sensors/TsNoise.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "core/GunnsFluidUtils.hh"
 #include "core/GunnsBasicNode.hh"
 
@@ -204,3 +206,47 @@ void GunnsPumpCavitation::setMalfPartialCavitation(const bool   flag,
     mMalfPartialCavitationDuration  = duration;
     mMalfPartialCavitationAmplitude = amplitude;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Writes the malfunctions, the auto-cavitation enable and the state of the active
+///           cavitation event, for the owning pump's native checkpoint.  The auto-cavitation
+///           duration & amplitude are config data and aren't written.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsPumpCavitation::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    writer.write(mMalfFullCavitationFlag);
+    writer.write(mMalfFullCavitationDuration);
+    writer.write(mMalfPartialCavitationFlag);
+    writer.write(mMalfPartialCavitationDuration);
+    writer.write(mMalfPartialCavitationAmplitude);
+    writer.write(mEnableAutoCavitation);
+    writer.write(mCavitationElapsedTime);
+    writer.write(mInletVaporPressure);
+    writer.write(mDuration);
+    writer.write(mCavitationFraction);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsPumpCavitation::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    reader.read(mMalfFullCavitationFlag);
+    reader.read(mMalfFullCavitationDuration);
+    reader.read(mMalfPartialCavitationFlag);
+    reader.read(mMalfPartialCavitationDuration);
+    reader.read(mMalfPartialCavitationAmplitude);
+    reader.read(mEnableAutoCavitation);
+    reader.read(mCavitationElapsedTime);
+    reader.read(mInletVaporPressure);
+    reader.read(mDuration);
+    reader.read(mCavitationFraction);
+}
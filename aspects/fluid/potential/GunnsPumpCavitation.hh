@@ -30,6 +30,8 @@ PROGRAMMERS:
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "properties/FluidProperties.hh"
 class GunnsBasicNode;
+class GunnsCheckpointReader;
+class GunnsCheckpointWriter;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Pump Cavitation Model
@@ -71,6 +73,10 @@ class GunnsPumpCavitation
         void setMalfPartialCavitation(const bool   flag      = false,
                                       const double duration  = 0.0,
                                       const double amplitude = 0.0);
+        /// @brief  Writes the cavitation state to a native checkpoint stream.
+        void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+        /// @brief  Reads the cavitation state from a native checkpoint stream.
+        void loadCheckpoint(GunnsCheckpointReader& reader);
 
     protected:
         double mAutoCavitationDuration;         /**< (s)  trick_chkpnt_io(**) Duration of auto-cavitation effect      */
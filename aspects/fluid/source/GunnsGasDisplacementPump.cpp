@@ -25,6 +25,8 @@ PROGRAMMERS:
 #include "software/exceptions/TsInitializationException.hh"
 #include "core/GunnsFluidUtils.hh"
 #include "GunnsGasDisplacementPump.hh"
+#include "core/GunnsCheckpoint.hh"
+#include <typeinfo>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]     name             (--) Name of object.
@@ -281,6 +283,52 @@ void GunnsGasDisplacementPump::restartModel()
     mImpellerPower = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the motor speed, wall temperature & heat flux, impeller torque and check valve
+///           state to the source state.  The impeller speed & power are reset by restart and found
+///           again on the next step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsGasDisplacementPump::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsFluidSource::saveCheckpoint(writer);
+    writer.write(mMotorSpeed);
+    writer.write(mWallTemperature);
+    writer.write(mWallHeatFlux);
+    writer.write(mImpellerTorque);
+    writer.write(mCheckValveActive);
+    writer.write(mCheckValvePosition);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsGasDisplacementPump::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsFluidSource::loadCheckpoint(reader);
+    reader.read(mMotorSpeed);
+    reader.read(mWallTemperature);
+    reader.read(mWallHeatFlux);
+    reader.read(mImpellerTorque);
+    reader.read(mCheckValveActive);
+    reader.read(mCheckValvePosition);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsGasDisplacementPump.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsGasDisplacementPump::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsGasDisplacementPump);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Time step.
 ///
@@ -139,6 +139,15 @@ class GunnsGasDisplacementPump : public GunnsFluidSource
         /// @brief    Turn on or off the check valve functionality
         void   setCheckValveFlag(const bool value);
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         double mCycleVolume;        /**< (m3)             trick_chkpnt_io(**) Volume of fluid displaced per cycle            */
         double mDriveRatio;         /**< (--)             trick_chkpnt_io(**) Gear ratio of motor to impeller cycles         */
@@ -22,8 +22,10 @@ PROGRAMMERS:
 **************************************************************************************************/
 
 #include "GunnsLiquidDisplacementPump.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
+#include <typeinfo>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]     name                    (--)   Name of object.
@@ -238,6 +240,40 @@ void GunnsLiquidDisplacementPump::restartModel()
     GunnsGasDisplacementPump::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the cavitation model state to the gas pump state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsLiquidDisplacementPump::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsGasDisplacementPump::saveCheckpoint(writer);
+    mCavitation.saveCheckpoint(writer);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsLiquidDisplacementPump::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsGasDisplacementPump::loadCheckpoint(reader);
+    mCavitation.loadCheckpoint(reader);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsLiquidDisplacementPump.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsLiquidDisplacementPump::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsLiquidDisplacementPump);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Time step.
 ///
@@ -130,6 +130,15 @@ class GunnsLiquidDisplacementPump : public GunnsGasDisplacementPump
                         const int                               port0,
                         const int                               port1);
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         FluidProperties::FluidType mLiquidType; /**< *o (--) trick_chkpnt_io(**) Type of the operating liquid   */
         /// @brief    Validates the initialization inputs of this Liquid Displacement Pump model.
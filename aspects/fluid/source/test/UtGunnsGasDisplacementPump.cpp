@@ -7,6 +7,7 @@
 ***************************************************************************************************/
 
 #include "software/exceptions/TsInitializationException.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "strings/UtResult.hh"
 
 #include "UtGunnsGasDisplacementPump.hh"
@@ -661,6 +662,53 @@ void UtGunnsGasDisplacementPump::testComputeFlows()
     CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tArticle->mVolFlowRate,   DBL_EPSILON);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, tArticle->mPower,         DBL_EPSILON);
 
-    UT_PASS_LAST;
+    UT_PASS;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Gas Displacement Pump link model native checkpoint save & load.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsGasDisplacementPump::testCheckpoint()
+{
+    UT_RESULT;
+
+    /// - Initialize default test article with nominal initialization data, step it and save the
+    ///   state.
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0, tPort1);
+    tArticle->mMotorSpeed = 0.5 * tMotorSpeed;
+    tArticle->step(tTimeStep);
+    tArticle->mWallHeatFlux = 10.0;
+    const double torque             = tArticle->mImpellerTorque;
+    const double checkValvePosition = tArticle->mCheckValvePosition;
+    std::vector<unsigned char> buffer;
+    GunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&buffer);
+    tArticle->saveCheckpoint(writer);
+    writer.close();
+
+    /// - Change the motor speed, wall state & check valve and step again.
+    tArticle->mMotorSpeed         = tMotorSpeed;
+    tArticle->mWallTemperature    = 2.0 * tWallTemperature;
+    tArticle->step(tTimeStep);
+    tArticle->mWallHeatFlux       = 0.0;
+    tArticle->mImpellerTorque     = torque + 1.0;
+    tArticle->mCheckValvePosition = checkValvePosition + 1.0;
+
+    /// @test    The loaded state is the state that was saved.
+    GunnsCheckpointReader reader("reader");
+    reader.openBuffer(&buffer);
+    tArticle->loadCheckpoint(reader);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+    CPPUNIT_ASSERT(0.5 * tMotorSpeed  == tArticle->mMotorSpeed);
+    CPPUNIT_ASSERT(tWallTemperature   == tArticle->mWallTemperature);
+    CPPUNIT_ASSERT(10.0               == tArticle->mWallHeatFlux);
+    CPPUNIT_ASSERT(torque             == tArticle->mImpellerTorque);
+    CPPUNIT_ASSERT(checkValvePosition == tArticle->mCheckValvePosition);
+
+    /// @test    The pump opts in to native checkpoints, but a type derived from it doesn't.
+    GunnsGasDisplacementPump article;
+    CPPUNIT_ASSERT(article.isCheckpointable());
+    CPPUNIT_ASSERT(not tArticle->isCheckpointable());
+
+    UT_PASS_LAST;
+}
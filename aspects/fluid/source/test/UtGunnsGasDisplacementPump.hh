@@ -71,6 +71,8 @@ class UtGunnsGasDisplacementPump: public CppUnit::TestFixture
         void testUpdateFluid();
         /// @brief    Tests compute flows method.
         void testComputeFlows();
+        /// @brief    Tests native checkpoint save & load.
+        void testCheckpoint();
     private:
         CPPUNIT_TEST_SUITE(UtGunnsGasDisplacementPump);
         CPPUNIT_TEST(testConfig);
@@ -83,6 +85,7 @@ class UtGunnsGasDisplacementPump: public CppUnit::TestFixture
         CPPUNIT_TEST(testUpdateState);
         CPPUNIT_TEST(testUpdateFluid);
         CPPUNIT_TEST(testComputeFlows);
+        CPPUNIT_TEST(testCheckpoint);
         CPPUNIT_TEST_SUITE_END();
         ///  @brief   Enumeration for the number of nodes and fluid constituents.
         enum {N_NODES = 2, N_FLUIDS = 2};
@@ -7,6 +7,7 @@
 ***************************************************************************************************/
 
 #include "core/GunnsFluidUtils.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "strings/UtResult.hh"
 
@@ -378,5 +379,50 @@ void UtGunnsLiquidDisplacementPump::testUpdateState()
     tArticle->updateState(tTimeStep);
     CPPUNIT_ASSERT(-nominalFlowRate < tArticle->mVolFlowRate);
 
+    UT_PASS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for GUNNS Liquid Displacement Pump link model native checkpoint save & load.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsLiquidDisplacementPump::testCheckpoint()
+{
+    UT_RESULT;
+
+    /// - Initialize default test article with nominal initialization data, give it cavitation
+    ///   malfunctions, step it and save the state.
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0, tPort1);
+    tArticle->mCavitation.setMalfFullCavitation(true, 2.0);
+    tArticle->mCavitation.setMalfPartialCavitation(true, 3.0, 0.5);
+    tArticle->updateState(tTimeStep);
+    std::vector<unsigned char> buffer;
+    GunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&buffer);
+    tArticle->saveCheckpoint(writer);
+    writer.close();
+
+    /// - Remove the malfunctions, change the motor speed and step again.
+    tArticle->mCavitation.setMalfFullCavitation();
+    tArticle->mCavitation.setMalfPartialCavitation();
+    tArticle->mMotorSpeed = 0.5 * tMotorSpeed;
+    tArticle->updateState(tTimeStep);
+
+    /// @test    The loaded state is the state that was saved, including the cavitation state.
+    GunnsCheckpointReader reader("reader");
+    reader.openBuffer(&buffer);
+    tArticle->loadCheckpoint(reader);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+    CPPUNIT_ASSERT(tMotorSpeed == tArticle->mMotorSpeed);
+    CPPUNIT_ASSERT(tArticle->mCavitation.mMalfFullCavitationFlag);
+    CPPUNIT_ASSERT(2.0         == tArticle->mCavitation.mMalfFullCavitationDuration);
+    CPPUNIT_ASSERT(tArticle->mCavitation.mMalfPartialCavitationFlag);
+    CPPUNIT_ASSERT(3.0         == tArticle->mCavitation.mMalfPartialCavitationDuration);
+    CPPUNIT_ASSERT(0.5         == tArticle->mCavitation.mMalfPartialCavitationAmplitude);
+
+    /// @test    The pump opts in to native checkpoints, but a type derived from it doesn't.
+    GunnsLiquidDisplacementPump article;
+    CPPUNIT_ASSERT(article.isCheckpointable());
+    CPPUNIT_ASSERT(not tArticle->isCheckpointable());
+
     UT_PASS_LAST;
 }
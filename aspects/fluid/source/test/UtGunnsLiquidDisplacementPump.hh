@@ -67,6 +67,8 @@ class UtGunnsLiquidDisplacementPump: public CppUnit::TestFixture
         void testModifiers();
         /// @brief    Tests update state method.
         void testUpdateState();
+        /// @brief    Tests native checkpoint save & load.
+        void testCheckpoint();
     private:
         CPPUNIT_TEST_SUITE(UtGunnsLiquidDisplacementPump);
         CPPUNIT_TEST(testConfig);
@@ -77,6 +79,7 @@ class UtGunnsLiquidDisplacementPump: public CppUnit::TestFixture
         CPPUNIT_TEST(testAccessors);
         CPPUNIT_TEST(testModifiers);
         CPPUNIT_TEST(testUpdateState);
+        CPPUNIT_TEST(testCheckpoint);
         CPPUNIT_TEST_SUITE_END();
         ///  @brief   Enumeration for the number of nodes and fluid constituents.
         enum {N_NODES = 2, N_FLUIDS = 2};
@@ -8,10 +8,12 @@ LIBRARY DEPENDENCY:
     )
 **************************************************************************************************/
 #include "GunnsThermalCapacitor.hh"
+#include "core/GunnsCheckpoint.hh"
 #include <cfloat>    //needed for DBL_EPSILON in updateState()
 #include "aspects/thermal/PtcsMacros.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
+#include <typeinfo>
 
 /// @details GUNNS Thermal Capacitor Constants
 const double GunnsThermalCapacitorInputData::DEFAULT_TEMPERATURE  =  294.261;
@@ -200,6 +202,41 @@ void GunnsThermalCapacitor::restartModel()
     mSumExternalHeatFluxes = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the temperature to the capacitor state.  The external heat fluxes are inputs that
+///           restart clears, so they aren't written.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalCapacitor::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsBasicCapacitor::saveCheckpoint(writer);
+    writer.write(mTemperature);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalCapacitor::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsBasicCapacitor::loadCheckpoint(reader);
+    reader.read(mTemperature);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsThermalCapacitor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalCapacitor::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsThermalCapacitor);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]    dt   (s)  Integration time step (not used)
 ///
@@ -282,3 +319,16 @@ void GunnsThermalCapacitor::setExternalHeatFlux(const unsigned int index, const
             "argument out of range", "Input index greater than max allowed.");
     mExternalHeatFlux[index] = flux;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Returns the external heat flux at the given index.  An exception is thrown if the
+///           index is out of range.
+///
+/// @throws   TsOutOfBoundsException
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsThermalCapacitor::getExternalHeatFlux(const unsigned int index) const
+{
+    TS_PTCS_IF_ERREX(index >= NUM_EXT_HEATFLUXES, TsOutOfBoundsException,
+            "argument out of range", "Input index greater than max allowed.");
+    return mExternalHeatFlux[index];
+}
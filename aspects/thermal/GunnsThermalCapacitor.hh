@@ -158,10 +158,22 @@ class GunnsThermalCapacitor : public GunnsBasicCapacitor
         /// @brief   Sets an external heat flux.
         void   setExternalHeatFlux(const unsigned int index, const double flux);
 
+        /// @brief   Returns an external heat flux.
+        double getExternalHeatFlux(const unsigned int index) const;
+
         /// @brief   Overwrites a base-class method that executes right after GUNNS updates every
         ///          link's mPotentialVector. Used here to update mTemperature.
         virtual void processOutputs();
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         int     mEditCapacitanceGroup;            /**< (--) trick_chkpnt_io(**) Identifier for capacitance edit grouping */
         double  mTemperature;                     /**< (K)                      Temperature of link's non-vacuum node (port0) */
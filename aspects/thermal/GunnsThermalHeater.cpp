@@ -8,8 +8,10 @@ LIBRARY DEPENDENCY:
    )
 ***************************************************************************************************/
 #include "GunnsThermalHeater.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "aspects/thermal/PtcsMacros.hh"
+#include <typeinfo>
 /**************************************************************************************************/
 /* ConfigData class */
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -147,6 +149,37 @@ void GunnsThermalHeater::restartModel()
     GunnsThermalSource::restartModel();
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the electrical power to the source state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalHeater::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsThermalSource::saveCheckpoint(writer);
+    writer.write(mPowerElectrical);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalHeater::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsThermalSource::loadCheckpoint(reader);
+    reader.read(mPowerElectrical);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsThermalHeater.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalHeater::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsThermalHeater);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]    dt  (s)  Integration time step [not used]
 ///
 /// @details  Updates the state of the GunnsThermalHeater. If this heater is attached to a heater
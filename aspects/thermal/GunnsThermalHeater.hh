@@ -127,6 +127,15 @@ class GunnsThermalHeater: public GunnsThermalSource
         /// @brief  Updates the state of the link.
         virtual void updateState(const double dt);
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         /**< (W)  Electrical power, set by the electrical aspect via the simbus. */
         double mPowerElectrical; /**< (W)  Electrical power actually consumed by the heater. */
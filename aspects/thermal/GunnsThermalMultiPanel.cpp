@@ -7,8 +7,10 @@ LIBRARY DEPENDENCY:
 */
 
 #include "GunnsThermalMultiPanel.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "aspects/thermal/PtcsMacros.hh"
 #include "math/MsMath.hh" //needed for MsMath::isInRange() in validate()
+#include <typeinfo>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] name                      (--) Name of given ThermalSource object.
@@ -227,6 +229,42 @@ void GunnsThermalMultiPanel::restartModel()
     GunnsThermalSource::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the view scalar and incident flux of each radiant source to the source state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalMultiPanel::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsThermalSource::saveCheckpoint(writer);
+    writer.write(mViewScalar, 5);
+    writer.write(mIncidentFlux, 5);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalMultiPanel::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsThermalSource::loadCheckpoint(reader);
+    reader.read(mViewScalar, 5);
+    reader.read(mIncidentFlux, 5);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsThermalMultiPanel.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalMultiPanel::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsThermalMultiPanel);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]   dt  (s)  Integration time step (not used)
 ///
@@ -154,6 +154,14 @@ class GunnsThermalMultiPanel : public GunnsThermalSource
         /// @brief  Get incident flux with index.
         virtual double getIncidentFlux(const int index) const;
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
 
     protected:
         double mAbsorptivity[5]; /**< (--)   trick_chkpnt_io(**) Absorptivity (0-1) of exterior panel to each radiant source */
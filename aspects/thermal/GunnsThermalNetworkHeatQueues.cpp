@@ -0,0 +1,289 @@
+/**
+@file      GunnsThermalNetworkHeatQueues.cpp
+@brief     GUNNS Thermal Network Heat Queues Spotter implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((core/GunnsNetworkSpotter.o)
+   (simulation/hs/TsHsMsg.o)
+   (software/exceptions/TsInitializationException.o)
+   (aspects/thermal/GunnsThermalCapacitor.o))
+*/
+
+#include "GunnsThermalNetworkHeatQueues.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <cstring>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name       (--)  Instance name for self-identification in messages.
+/// @param[in]  fluxIndex  (--)  Index of the capacitors' external heat flux the queued heat is
+///                              given to.
+///
+/// @details  Default constructs this GUNNS Thermal Network Heat Queues Spotter configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalNetworkHeatQueuesConfigData::GunnsThermalNetworkHeatQueuesConfigData(
+        const std::string& name, const unsigned int fluxIndex)
+    :
+    GunnsNetworkSpotterConfigData(name),
+    mFluxIndex(fluxIndex)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Thermal Network Heat Queues Spotter configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalNetworkHeatQueuesConfigData::~GunnsThermalNetworkHeatQueuesConfigData()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this GUNNS Thermal Network Heat Queues Spotter input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalNetworkHeatQueuesInputData::GunnsThermalNetworkHeatQueuesInputData()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Thermal Network Heat Queues Spotter input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalNetworkHeatQueuesInputData::~GunnsThermalNetworkHeatQueuesInputData()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  nodeList  (--)  Reference to the network node list.
+/// @param[in]  links     (--)  Reference to the network links.
+///
+/// @details Default constructs this GUNNS Thermal Network Heat Queues Spotter.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalNetworkHeatQueues::GunnsThermalNetworkHeatQueues(GunnsNodeList&                nodeList,
+                                                             std::vector<GunnsBasicLink*>& links)
+    :
+    GunnsNetworkSpotter(),
+    mNodeList(nodeList),
+    mLinks(links),
+    mFluxIndex(0),
+    mCapacitors(),
+    mEnergy(),
+    mBaseFlux(),
+    mLastFlux()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Thermal Network Heat Queues Spotter.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalNetworkHeatQueues::~GunnsThermalNetworkHeatQueues()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  configData  (--)  Instance configuration data.
+/// @param[in]  inputData   (--)  Instance input data.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Initializes this GUNNS Thermal Network Heat Queues Spotter with its configuration and
+///           input data, finds the capacitor link on each node and empties the queues.  The
+///           network's links must be initialized first.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalNetworkHeatQueues::initialize(const GunnsNetworkSpotterConfigData* configData,
+                                               const GunnsNetworkSpotterInputData*  inputData)
+{
+    /// - Initialize the base class.
+    GunnsNetworkSpotter::initialize(configData, inputData);
+
+    /// - Reset the init flag.
+    mInitFlag = false;
+
+    /// - Validate config & input data.
+    const GunnsThermalNetworkHeatQueuesConfigData* config = validateConfig(configData);
+    validateInput(inputData);
+    mFluxIndex = config->mFluxIndex;
+
+    /// - Find the first capacitor link on each node.
+    const int numNodes = mNodeList.mNumNodes;
+    mCapacitors.assign(numNodes, static_cast<GunnsThermalCapacitor*>(0));
+    for (unsigned int i = 0; i < mLinks.size(); ++i) {
+        GunnsThermalCapacitor* capacitor = dynamic_cast<GunnsThermalCapacitor*>(mLinks[i]);
+        if (capacitor) {
+            const int node = capacitor->getNodeMap()[0];
+            if (node >= 0 and node < numNodes and not mCapacitors[node]) {
+                mCapacitors[node] = capacitor;
+            }
+        }
+    }
+
+    /// - Empty the queues.  Zero bits are a zero energy.
+    mEnergy.assign(numNodes, 0);
+
+    /// - Any flux already on the capacitors differs from the zero last set, so it's taken as the
+    ///   base on the first step.
+    mBaseFlux.assign(numNodes, 0.0);
+    mLastFlux.assign(numNodes, 0.0);
+
+    /// - Set the init flag.
+    mInitFlag = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  configData  (--)  Instance configuration data.
+///
+/// @returns  GunnsThermalNetworkHeatQueuesConfigData (--) Type-casted and validated config data pointer.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Type-casts the base config data class pointer to this spotter's config data type,
+///           checks for valid type-cast and validates contained data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const GunnsThermalNetworkHeatQueuesConfigData* GunnsThermalNetworkHeatQueues::validateConfig(const GunnsNetworkSpotterConfigData* config)
+{
+    const GunnsThermalNetworkHeatQueuesConfigData* result = dynamic_cast<const GunnsThermalNetworkHeatQueuesConfigData*>(config);
+    if (!result) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "Bad config data pointer type.");
+    }
+    if (result->mFluxIndex >= GunnsThermalCapacitor::NUM_EXT_HEATFLUXES) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "External heat flux index is out of range.");
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  inputData  (--)  Instance input data.
+///
+/// @returns  GunnsThermalNetworkHeatQueuesInputData (--) Type-casted and validated input data pointer.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Type-casts the base input data class pointer to this spotter's input data type,
+///           checks for valid type-cast and validates contained data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const GunnsThermalNetworkHeatQueuesInputData* GunnsThermalNetworkHeatQueues::validateInput(const GunnsNetworkSpotterInputData* input)
+{
+    const GunnsThermalNetworkHeatQueuesInputData* result = dynamic_cast<const GunnsThermalNetworkHeatQueuesInputData*>(input);
+    if (!result) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Input Data",
+                    "Bad input data pointer type.");
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Execution time step.
+///
+/// @details  Drains every node's queue in one pass, and adds the average heat over the step to
+///           the external heat flux of each node's capacitor.  A flux that isn't the one this
+///           spotter last set was written by another model since, and becomes the base for the
+///           queued heat.  Capacitors whose queues are empty are left with the base.  Nothing is
+///           drained on a zero step, so the heat carries over to the next step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalNetworkHeatQueues::stepPreSolver(const double dt)
+{
+    if (dt <= 0.0) {
+        return;
+    }
+
+    const int numNodes = static_cast<int>(mCapacitors.size());
+    for (int node = 0; node < numNodes; ++node) {
+        GunnsThermalCapacitor* capacitor = mCapacitors[node];
+        if (capacitor) {
+            const double flux = capacitor->getExternalHeatFlux(mFluxIndex);
+            if (flux != mLastFlux[node]) {
+                mBaseFlux[node] = flux;
+            }
+            mLastFlux[node] = mBaseFlux[node] + drainEnergy(node) / dt;
+            capacitor->setExternalHeatFlux(mFluxIndex, mLastFlux[node]);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Execution time step (not used).
+///
+/// @details  Nothing to do after the solver step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalNetworkHeatQueues::stepPostSolver(const double dt __attribute__((unused)))
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  node    (--)  Index of the node in the network.
+/// @param[in]  energy  (J)   Energy into the node.
+///
+/// @returns  bool  (--)  True if the energy was queued, false if the node has no capacitor link or
+///                       is out of range.
+///
+/// @details  Adds the energy to the node's queued sum with a compare-and-swap of the sum's bits,
+///           retried if another writer or the drain changed the sum in between.  This can be called
+///           from any thread, and never blocks.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalNetworkHeatQueues::addEnergy(const int node, const double energy)
+{
+    if (not getCapacitor(node)) {
+        return false;
+    }
+
+    volatile unsigned long long* queue = &mEnergy[node];
+    for (;;) {
+        const unsigned long long oldBits = *queue;
+        double sum;
+        std::memcpy(&sum, &oldBits, sizeof(sum));
+        sum += energy;
+        unsigned long long newBits;
+        std::memcpy(&newBits, &sum, sizeof(newBits));
+        if (__sync_bool_compare_and_swap(queue, oldBits, newBits)) {
+            return true;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  node  (--)  Index of the node in the network.
+///
+/// @returns  double  (J)  Energy queued to the node since the last step, or zero if the node has no
+///                        capacitor link or is out of range.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsThermalNetworkHeatQueues::getQueuedEnergy(const int node) const
+{
+    double result = 0.0;
+    if (getCapacitor(node)) {
+        const unsigned long long bits = *static_cast<const volatile unsigned long long*>(&mEnergy[node]);
+        std::memcpy(&result, &bits, sizeof(result));
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  node  (--)  Index of the node in the network.
+///
+/// @returns  double  (J)  Energy that was queued to the node.
+///
+/// @details  Swaps the node's queued sum for zero, so energy added by a writer during the drain
+///           lands either in this step or the next, and is never lost.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsThermalNetworkHeatQueues::drainEnergy(const int node)
+{
+    volatile unsigned long long* queue = &mEnergy[node];
+    unsigned long long bits = *queue;
+    for (;;) {
+        const unsigned long long oldBits = __sync_val_compare_and_swap(queue, bits, 0ULL);
+        if (oldBits == bits) {
+            break;
+        }
+        bits = oldBits;
+    }
+    double result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
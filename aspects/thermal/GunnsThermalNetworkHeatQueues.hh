@@ -0,0 +1,181 @@
+#ifndef GunnsThermalNetworkHeatQueues_EXISTS
+#define GunnsThermalNetworkHeatQueues_EXISTS
+
+/**
+@file      GunnsThermalNetworkHeatQueues.hh
+@brief     GUNNS Thermal Network Heat Queues Spotter declarations
+
+@defgroup  TSM_GUNNS_THERMAL_NETWORK_HEAT_QUEUES   GUNNS Thermal Network Heat Queues Spotter
+@ingroup   TSM_GUNNS_THERMAL
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:   (Provides the classes for the GUNNS Thermal Network Heat Queues Spotter.  This spotter
+            queues heat for every thermal capacitor in a network at once, as the GUNNS Thermal
+            Capacitor Heat Queues Spotter does for one capacitor: other models write heat into it
+            by node from their own threads and at their own rates, and it gives each node's
+            capacitor the heat queued over the step.)
+
+@details
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The queues use the GCC __sync atomic builtins on 64-bit values, since this code is C++98.)
+- (Heat queued to a node is only given to the first capacitor link on that node, and heat can't be
+   queued to nodes without a capacitor link.)
+- (The queued heat is added to the capacitor's external heat flux at the configured index.  Other
+   models may also set that flux, before this spotter steps: a value they write is kept and the
+   queued heat is added on top of it.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsThermalNetworkHeatQueues.o))
+
+PROGRAMMERS:
+- ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+
+@{
+*/
+
+#include <vector>
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include "core/GunnsBasicNode.hh"
+#include "aspects/thermal/GunnsThermalCapacitor.hh"
+#include "core/GunnsNetworkSpotter.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Thermal Network Heat Queues Spotter Configuration Data
+///
+/// @details  This class provides a data structure for the Thermal Network Heat Queues Spotter
+///           configuration data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThermalNetworkHeatQueuesConfigData : public GunnsNetworkSpotterConfigData
+{
+    public:
+        unsigned int mFluxIndex; /**< (--) trick_chkpnt_io(**) Index of the capacitors' external heat flux the queued heat is given to. */
+        /// @brief  Default constructs this GUNNS Thermal Network Heat Queues Spotter configuration data.
+        GunnsThermalNetworkHeatQueuesConfigData(const std::string& name, const unsigned int fluxIndex = 0);
+        /// @brief  Default destructs this GUNNS Thermal Network Heat Queues Spotter configuration data.
+        virtual ~GunnsThermalNetworkHeatQueuesConfigData();
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsThermalNetworkHeatQueuesConfigData(const GunnsThermalNetworkHeatQueuesConfigData& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsThermalNetworkHeatQueuesConfigData& operator =(const GunnsThermalNetworkHeatQueuesConfigData& that);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Thermal Network Heat Queues Spotter Input Data
+///
+/// @details  This class provides a data structure for the Thermal Network Heat Queues Spotter
+///           input data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThermalNetworkHeatQueuesInputData : public GunnsNetworkSpotterInputData
+{
+    public:
+        /// @brief  Default constructs this GUNNS Thermal Network Heat Queues Spotter input data.
+        GunnsThermalNetworkHeatQueuesInputData();
+        /// @brief  Default destructs this GUNNS Thermal Network Heat Queues Spotter input data.
+        virtual ~GunnsThermalNetworkHeatQueuesInputData();
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsThermalNetworkHeatQueuesInputData(const GunnsThermalNetworkHeatQueuesInputData& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsThermalNetworkHeatQueuesInputData& operator =(const GunnsThermalNetworkHeatQueuesInputData& that);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Thermal Network Heat Queues Spotter Class.
+///
+/// @details  This spotter queues heat for all the thermal capacitors of a network, by node.  Other
+///           models add energy to a node's queue with addEnergy or addHeat, from any thread and at
+///           any rate, without locks.  Each node's queue is a running sum of the energy added to
+///           it, so the queue can't overflow.
+///
+///           Before each network step the queues are drained in one pass over the nodes, and the
+///           energy queued to each node over the step, divided by the step, is added to its
+///           capacitor's external heat flux at the configured index, on top of any flux other
+///           models set there.  Heat is conserved, whatever the writers' rates.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThermalNetworkHeatQueues : public GunnsNetworkSpotter
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsThermalNetworkHeatQueues);
+    public:
+        /// @brief  Default Constructor
+        GunnsThermalNetworkHeatQueues(GunnsNodeList& nodeList, std::vector<GunnsBasicLink*>& links);
+        /// @brief   Default destructor.
+        virtual     ~GunnsThermalNetworkHeatQueues();
+        /// @brief   Initializes the GUNNS Thermal Network Heat Queues Spotter with configuration and
+        ///          input data.
+        virtual void initialize(const GunnsNetworkSpotterConfigData* configData,
+                                const GunnsNetworkSpotterInputData*  inputData);
+        /// @brief   Gives the queued heat to the capacitors prior to the GUNNS solver step.
+        virtual void stepPreSolver(const double dt);
+        /// @brief   Steps the GUNNS Thermal Network Heat Queues Spotter after the GUNNS solver step.
+        virtual void stepPostSolver(const double dt);
+        /// @brief   Adds energy to the node's queue.
+        bool         addEnergy(const int node, const double energy);
+        /// @brief   Adds a heat applied over a time step to the node's queue.
+        bool         addHeat(const int node, const double heat, const double dt);
+        /// @brief   Returns the energy queued to the node since the last step.
+        double       getQueuedEnergy(const int node) const;
+        /// @brief   Returns the capacitor link that the node's queued heat is given to.
+        GunnsThermalCapacitor* getCapacitor(const int node) const;
+
+    protected:
+        GunnsNodeList&                      mNodeList;   /**< *o (1)  trick_chkpnt_io(**) Reference to the network node list. */
+        std::vector<GunnsBasicLink*>&       mLinks;      /**< *o (1)  trick_chkpnt_io(**) Reference to the network links. */
+        unsigned int                        mFluxIndex;  /**< *o (1)  trick_chkpnt_io(**) Index of the capacitors' external heat flux the queued heat is given to. */
+        std::vector<GunnsThermalCapacitor*> mCapacitors; /**< ** (1)  trick_chkpnt_io(**) The capacitor link on each node, or null. */
+        std::vector<unsigned long long>     mEnergy;     /**< ** (1)  trick_chkpnt_io(**) Bits of the energy queued to each node. */
+        std::vector<double>                 mBaseFlux;   /**< ** (W)  trick_chkpnt_io(**) External heat flux set by other models on each node's capacitor. */
+        std::vector<double>                 mLastFlux;   /**< ** (W)  trick_chkpnt_io(**) External heat flux this spotter last set on each node's capacitor. */
+        /// @brief   Validates the supplied configuration data.
+        const GunnsThermalNetworkHeatQueuesConfigData* validateConfig(const GunnsNetworkSpotterConfigData* config);
+        /// @brief   Validates the supplied input data.
+        const GunnsThermalNetworkHeatQueuesInputData*  validateInput (const GunnsNetworkSpotterInputData* input);
+        /// @brief   Takes the energy queued to the node, leaving its queue empty.
+        double       drainEnergy(const int node);
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsThermalNetworkHeatQueues(const GunnsThermalNetworkHeatQueues& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsThermalNetworkHeatQueues& operator =(const GunnsThermalNetworkHeatQueues& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  node  (--)  Index of the node in the network.
+/// @param[in]  heat  (W)   Heat into the node.
+/// @param[in]  dt    (s)   Time step the writer applied the heat over.
+///
+/// @returns  bool  (--)  True if the heat was queued.
+///
+/// @details  Queues the energy of the heat over the writer's own step.  This can be called from any
+///           thread.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsThermalNetworkHeatQueues::addHeat(const int node, const double heat, const double dt)
+{
+    return addEnergy(node, heat * dt);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  node  (--)  Index of the node in the network.
+///
+/// @returns  GunnsThermalCapacitor*  (--)  The capacitor link on the node, or null if there isn't
+///                                         one or the node is out of range.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline GunnsThermalCapacitor* GunnsThermalNetworkHeatQueues::getCapacitor(const int node) const
+{
+    if (node < 0 or node >= static_cast<int>(mCapacitors.size())) {
+        return 0;
+    }
+    return mCapacitors[node];
+}
+
+#endif
@@ -6,8 +6,10 @@ LIBRARY DEPENDENCY:
      (GunnsThermalSource.o)
 ***************************************************************************************************/
 #include "GunnsThermalPanel.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "aspects/thermal/PtcsMacros.hh"
 #include "math/MsMath.hh" //needed for MsMath::isInRange() in validate()
+#include <typeinfo>
 /**************************************************************************************************/
 /* ConfigData class */
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -181,6 +183,37 @@ void GunnsThermalPanel::restartModel()
     GunnsThermalSource::restartModel();
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the incident flux to the source state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalPanel::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsThermalSource::saveCheckpoint(writer);
+    writer.write(mIncidentHeatFluxPerArea);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalPanel::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsThermalSource::loadCheckpoint(reader);
+    reader.read(mIncidentHeatFluxPerArea);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsThermalPanel.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalPanel::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsThermalPanel);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]   dt  (s)  Integration time step (not used)
 ///
 /// @details  This updates the link during a calculation frame, creating a fixed flux onto one or
@@ -155,6 +155,15 @@ class GunnsThermalPanel : public GunnsThermalSource
         /// @brief  Returns the incident flux
         double getIncidentFlux() const;
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         double mIncidentHeatFluxPerArea; /**< (W/m2)                     incident flux, calculated by ENV, set by bus */
         double mAbsorptivity;            /**< (--)   trick_chkpnt_io(**) absorptivity (0-1) of exterior panel */
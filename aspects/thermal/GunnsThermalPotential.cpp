@@ -8,8 +8,10 @@ LIBRARY DEPENDENCY:
    )
 **************************************************************************************************/
 #include "GunnsThermalPotential.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "simulation/hs/TsHsMsg.hh"
 #include "aspects/thermal/PtcsMacros.hh"
+#include <typeinfo>
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]    name                 --  Link name
 /// @param[in]    nodes                --  Network nodes array
@@ -140,6 +142,40 @@ void GunnsThermalPotential::restartModel()
     GunnsBasicPotential::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the heat flux into the node to the potential state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalPotential::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsBasicPotential::saveCheckpoint(writer);
+    writer.write(mHeatFluxIntoNode);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalPotential::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsBasicPotential::loadCheckpoint(reader);
+    reader.read(mHeatFluxIntoNode);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsThermalPotential.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalPotential::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsThermalPotential);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] port  (--) The port to be assigned
 /// @param[in] node  (--) The desired node to assign the port to
@@ -127,6 +127,15 @@ class GunnsThermalPotential : public GunnsBasicPotential
         ///         a method in GunnsBasicLink.
         virtual bool checkSpecificPortRules(const int port, const int node) const;
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         /// @brief Virtual method for derived links to perform their restart functions.
         virtual void restartModel();
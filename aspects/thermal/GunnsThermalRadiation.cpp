@@ -21,6 +21,7 @@ ASSUMPTIONS AND LIMITATIONS:
 LIBRARY_DEPENDENCY:
   (
    (core/GunnsBasicConductor.o)
+   (aspects/thermal/GunnsThermalRadiationBlock.o)
   )
 
  PROGRAMMERS:
@@ -30,7 +31,9 @@ LIBRARY_DEPENDENCY:
   )
 **************************************************************************************************/
 #include "GunnsThermalRadiation.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "math/MsMath.hh" // Needed for pow and DBL_EPSILON
+#include <typeinfo>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] name                (--) Link name
@@ -113,7 +116,9 @@ GunnsThermalRadiationInputData::~GunnsThermalRadiationInputData()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 GunnsThermalRadiation::GunnsThermalRadiation():
     GunnsBasicConductor(),
-    mViewScalar(1.0)
+    mViewScalar(1.0),
+    mBlock(0),
+    mBlockIndex(0)
 {
     // Nothing to do
 }
@@ -163,6 +168,58 @@ void GunnsThermalRadiation::restartModel()
     GunnsBasicConductor::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the view scalar to the conductor state.  A radiation block picks up the restored
+///           value when the link next steps.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiation::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsBasicConductor::saveCheckpoint(writer);
+    writer.write(mViewScalar);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiation::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsBasicConductor::loadCheckpoint(reader);
+    reader.read(mViewScalar);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsThermalRadiation.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalRadiation::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsThermalRadiation);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] block  (--) Radiation block to attach to, or null to detach.
+/// @param[in] index  (--) Index of this link in the block.
+///
+/// @details  Hands this link's view scalar and default conductivity to the block, which keeps its
+///           own copies for its batched update.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiation::setBlock(GunnsThermalRadiationBlock* block, const int index)
+{
+    mBlock      = block;
+    mBlockIndex = index;
+    if (mBlock) {
+        mBlock->setViewScalar(mBlockIndex, mViewScalar);
+        mBlock->setDefaultConductivity(mBlockIndex, mDefaultConductivity);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  dt  (s)  Integration time step
 ///
@@ -193,6 +250,19 @@ void GunnsThermalRadiation::updateState(const double dt __attribute__((unused)))
 ///           Potential analog for the thermal aspect.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    /// - Use the block's result when it was made from this link's current inputs.  Otherwise,
+    ///   e.g. after the view scalar or default conductivity was written directly, or the port
+    ///   potentials were overridden, compute it here and refresh the block's copies.
+    if (mBlock) {
+        if (mBlock->isCurrent(mBlockIndex, mPotentialVector[0], mPotentialVector[1],
+                              mViewScalar, mDefaultConductivity)) {
+            mEffectiveConductivity = mBlock->getEffectiveConductivity(mBlockIndex);
+            return;
+        }
+        mBlock->setViewScalar(mBlockIndex, mViewScalar);
+        mBlock->setDefaultConductivity(mBlockIndex, mDefaultConductivity);
+    }
+
     /// - Conditional Statement to ensure a division by zero does not take place. DBL_EPSILON is
     ///   used for tolerance comparison.
     if (fabs(mPotentialVector[0] - mPotentialVector[1]) > DBL_EPSILON)
@@ -42,6 +42,7 @@ PROGRAMMERS:
 
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "core/GunnsBasicConductor.hh"
+#include "aspects/thermal/GunnsThermalRadiationBlock.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    GunnsThermalRadiation Configuration Data
@@ -107,7 +108,8 @@ class GunnsThermalRadiationInputData : public GunnsBasicConductorInputData
 ///
 /// @details  The purpose of this class is to create the thermal radiation effect, where heat flux
 ///           is a function of T^4. The updateState method is overridden from GunnsBasicConductor
-///           to compute the linearized admittance.
+///           to compute the linearized admittance, or to take it from a GunnsThermalRadiationBlock
+///           that has already evaluated it for this link's inputs.
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 class GunnsThermalRadiation : public GunnsBasicConductor
 {
@@ -134,9 +136,23 @@ class GunnsThermalRadiation : public GunnsBasicConductor
         /// @brief   Returns the mViewScalar value
         double getViewScalar() const;
 
+        /// @brief   Attaches the link to a radiation block, or detaches it with a null block.
+        void   setBlock(GunnsThermalRadiationBlock* block, const int index);
+
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         double mViewScalar; /**< (--) view scalar, which scales mEffectiveConductivity;
                                       used to simulate operations like radiator retraction */
+        GunnsThermalRadiationBlock* mBlock; /**< ** (--) trick_chkpnt_io(**) Radiation block this link is in, if any */
+        int    mBlockIndex; /**< *o (--) trick_chkpnt_io(**) Index of this link in mBlock */
 
         /// @brief   Calculates the Admittance for the Radiation Link
         virtual void updateState(const double dt);
@@ -157,11 +173,14 @@ class GunnsThermalRadiation : public GunnsBasicConductor
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return   double  (--)  Value to scale the effective conductivity by.
 ///
-/// @details  Sets the mViewScalar value.
+/// @details  Sets the mViewScalar value, and the block's copy of it if the link is in a block.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 inline void GunnsThermalRadiation::setViewScalar(const double scalar)
 {
     mViewScalar = scalar;
+    if (mBlock) {
+        mBlock->setViewScalar(mBlockIndex, scalar);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,162 @@
+/************************** TRICK HEADER **********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+  (Evaluates the linearized conductivity of a whole array of GunnsThermalRadiation links in one
+   pass.)
+
+REFERENCE:
+  ()
+
+ASSUMPTIONS AND LIMITATIONS:
+  ()
+
+LIBRARY_DEPENDENCY:
+  (
+   (aspects/thermal/GunnsThermalRadiation.o)
+   (core/GunnsBasicNode.o)
+  )
+
+PROGRAMMERS:
+  ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+**************************************************************************************************/
+#include "GunnsThermalRadiationBlock.hh"
+#include "GunnsThermalRadiation.hh"
+#include "core/GunnsBasicNode.hh"
+#include "core/GunnsMacros.hh"
+#include "math/MsMath.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <limits>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name  (--)  Name of the block for messages.
+///
+/// @details  Constructs the block, empty.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationBlock::GunnsThermalRadiationBlock(const std::string& name)
+    :
+    mName(name),
+    mNodeList(0),
+    mNumLinks(0),
+    mPort0(),
+    mPort1(),
+    mViewScalar(),
+    mDefaultConductivity(),
+    mEffectiveConductivity(),
+    mNodeTemperature(),
+    mNodeT4()
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default Destructor
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationBlock::~GunnsThermalRadiationBlock()
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]     nodeList  (--)  Network nodes the links' ports refer to.
+/// @param[in,out] links     (--)  Array of initialized radiation links.
+/// @param[in]     numLinks  (--)  Number of links in the array.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Copies each link's ports into the block arrays and attaches the link to the block,
+///           which hands over its view scalar and default conductivity. The node temperatures start
+///           as NaN, so the links compute their own conductivity until the first update.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBlock::initialize(GunnsNodeList&         nodeList,
+                                            GunnsThermalRadiation* links,
+                                            const int              numLinks)
+{
+    /// - Validate the link array.
+    if (numLinks < 0 or (numLinks > 0 and not links)) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "links array is missing or its size is negative.");
+    }
+
+    mNodeList = &nodeList;
+    mNumLinks = numLinks;
+    mPort0.resize(numLinks);
+    mPort1.resize(numLinks);
+    mViewScalar.resize(numLinks);
+    mDefaultConductivity.resize(numLinks);
+    mEffectiveConductivity.resize(numLinks);
+    mNodeTemperature.assign(nodeList.mNumNodes, std::numeric_limits<double>::quiet_NaN());
+    mNodeT4.assign(nodeList.mNumNodes, 0.0);
+
+    /// - Gather the links and attach them, checking that their ports are in the node list.
+    for (int i = 0; i < numLinks; ++i) {
+        const int* map = links[i].getNodeMap();
+        if (not map or map[0] < 0 or map[1] < 0
+                or map[0] >= nodeList.mNumNodes or map[1] >= nodeList.mNumNodes) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "link " + std::string(links[i].getName())
+                        + " is uninitialized or not in the node list.");
+        }
+        mPort0[i] = map[0];
+        mPort1[i] = map[1];
+        links[i].setBlock(this, i);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Computes the effective conductivity of every link, as in
+///           GunnsThermalRadiation::updateState: C * view * (T0^4 - T1^4) / (T0 - T1), or just the
+///           default conductivity when the port temperatures are equal. The 4th powers are taken
+///           once per node and the link loop only reads the contiguous block arrays, with the
+///           operations in the same order as the link's so the results are identical.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBlock::update()
+{
+    if (0 == mNumLinks) {
+        return;
+    }
+
+    /// - Raise each node's temperature to the 4th power.
+    const int numNodes = static_cast<int>(mNodeTemperature.size());
+    for (int node = 0; node < numNodes; ++node) {
+        const double t = mNodeList->mNodes[node].getPotential();
+        mNodeTemperature[node] = t;
+        mNodeT4[node]          = t * t * t * t;
+    }
+
+    /// - Linearize every link's radiative flux about its port temperatures.
+    const int*    port0  = &mPort0[0];
+    const int*    port1  = &mPort1[0];
+    const double* view   = &mViewScalar[0];
+    const double* cond   = &mDefaultConductivity[0];
+    const double* temp   = &mNodeTemperature[0];
+    const double* temp4  = &mNodeT4[0];
+    double*       result = &mEffectiveConductivity[0];
+    for (int i = 0; i < mNumLinks; ++i) {
+        const double dT = temp[port0[i]] - temp[port1[i]];
+        if (fabs(dT) > DBL_EPSILON) {
+            result[i] = view[i] * cond[i] * (temp4[port0[i]] - temp4[port1[i]]) / dT;
+        } else {
+            result[i] = cond[i];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] index  (--)  Index of the link in the block.
+///
+/// @details  Evaluates the link the same way as update, for a link whose view scalar or default
+///           conductivity changed since then.  Before the first update this is the default
+///           conductivity, since the NaN temperatures fail the comparison.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationBlock::refresh(const int index)
+{
+    const double dT = mNodeTemperature[mPort0[index]] - mNodeTemperature[mPort1[index]];
+    if (fabs(dT) > DBL_EPSILON) {
+        mEffectiveConductivity[index] = mViewScalar[index] * mDefaultConductivity[index]
+                                      * (mNodeT4[mPort0[index]] - mNodeT4[mPort1[index]]) / dT;
+    } else {
+        mEffectiveConductivity[index] = mDefaultConductivity[index];
+    }
+}
@@ -0,0 +1,184 @@
+#ifndef GunnsThermalRadiationBlock_EXISTS
+#define GunnsThermalRadiationBlock_EXISTS
+
+/********************** TRICK HEADER **************************************************************
+@defgroup  TSM_GUNNS_THERMAL_RADIATION_BLOCK    GUNNS Thermal Radiation Block
+@ingroup   TSM_GUNNS_THERMAL
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+  (Evaluates the linearized conductivity of a whole array of GunnsThermalRadiation links in one
+   pass. The block keeps the links' port node indices, view scalars and default conductivities in
+   contiguous arrays, raises each node's temperature to the 4th power once, and then computes every
+   link's effective conductivity from those. Each attached link picks up its result in its own
+   updateState, instead of computing its own T^4 terms.)
+
+REFERENCE:
+  ()
+
+ASSUMPTIONS AND LIMITATIONS:
+  (The block is updated after the node potentials of the last solution and before the links are
+   stepped.)
+  (A link only uses the block's result when the block's inputs match the link's own potentials,
+   view scalar and default conductivity, so the links give the same answer with or without the
+   block. Otherwise, as in DUMMY solver mode or with a port potential override, the link computes
+   its own.)
+
+LIBRARY DEPENDENCY:
+  (
+   (GunnsThermalRadiationBlock.o)
+  )
+
+PROGRAMMERS:
+  ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+
+@{
+**************************************************************************************************/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <string>
+#include <vector>
+
+class  GunnsThermalRadiation;
+struct GunnsNodeList;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GunnsThermalRadiationBlock Class
+///
+/// @details  Structure-of-arrays form of the GunnsThermalRadiation links of a network. Link i of
+///           the block is the i'th link of the array given to initialize, and its inputs are
+///           element i of each link array. The node arrays are indexed by the network node number.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThermalRadiationBlock
+{
+        TS_MAKE_SIM_COMPATIBLE(GunnsThermalRadiationBlock);
+
+    public:
+        /// @brief   Default Constructor
+        GunnsThermalRadiationBlock(const std::string& name = "");
+
+        /// @brief   Default Destructor
+        virtual ~GunnsThermalRadiationBlock();
+
+        /// @brief   Gathers the links into the block and attaches them to it.
+        void initialize(GunnsNodeList&         nodeList,
+                        GunnsThermalRadiation* links,
+                        const int              numLinks);
+
+        /// @brief   Computes the effective conductivity of every link from the node potentials.
+        void update();
+
+        /// @brief   Returns true if the block's result for the link was made from the given inputs.
+        bool isCurrent(const int    index,
+                       const double potential0,
+                       const double potential1,
+                       const double viewScalar,
+                       const double defaultConductivity) const;
+
+        /// @brief   Returns the block's effective conductivity of the link.
+        double getEffectiveConductivity(const int index) const;
+
+        /// @brief   Sets the link's view scalar and re-evaluates its conductivity.
+        void   setViewScalar(const int index, const double scalar);
+
+        /// @brief   Sets the link's default conductivity and re-evaluates its conductivity.
+        void   setDefaultConductivity(const int index, const double conductivity);
+
+        /// @brief   Returns the number of links in the block.
+        int    getNumLinks() const;
+
+    protected:
+        std::string         mName;                  /**< ** (--)  trick_chkpnt_io(**) Name of the block for messages. */
+        GunnsNodeList*      mNodeList;              /**< ** (--)  trick_chkpnt_io(**) Network nodes the ports refer to. */
+        int                 mNumLinks;              /**< *o (--)  trick_chkpnt_io(**) Number of links in the block. */
+        std::vector<int>    mPort0;                 /**< ** (--)  trick_chkpnt_io(**) Port 0 node number of each link. */
+        std::vector<int>    mPort1;                 /**< ** (--)  trick_chkpnt_io(**) Port 1 node number of each link. */
+        std::vector<double> mViewScalar;            /**< ** (--)  trick_chkpnt_io(**) View scalar of each link. */
+        std::vector<double> mDefaultConductivity;   /**< ** (W/K) trick_chkpnt_io(**) Default conductivity of each link. */
+        std::vector<double> mEffectiveConductivity; /**< ** (W/K) trick_chkpnt_io(**) Linearized conductivity of each link from the last update. */
+        std::vector<double> mNodeTemperature;       /**< ** (K)   trick_chkpnt_io(**) Node potentials used in the last update. */
+        std::vector<double> mNodeT4;                /**< ** (K4)  trick_chkpnt_io(**) Node potentials to the 4th power. */
+        /// @brief   Re-evaluates one link's effective conductivity from the last node temperatures.
+        void refresh(const int index);
+
+    private:
+        /// @brief   Copy constructor unavailable since declared private and not implemented.
+        GunnsThermalRadiationBlock(const GunnsThermalRadiationBlock& that);
+
+        /// @brief   Assignment operator unavailable since declared private and not implemented.
+        GunnsThermalRadiationBlock& operator = (const GunnsThermalRadiationBlock& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] index               (--)  Index of the link in the block.
+/// @param[in] potential0          (K)   The link's port 0 potential.
+/// @param[in] potential1          (K)   The link's port 1 potential.
+/// @param[in] viewScalar          (--)  The link's view scalar.
+/// @param[in] defaultConductivity (W/K) The link's default conductivity.
+///
+/// @return   bool  (--)  True if the last update used exactly these inputs for the link.
+///
+/// @details  Before the first update the node temperatures are NaN, so no link is current.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsThermalRadiationBlock::isCurrent(const int    index,
+                                                  const double potential0,
+                                                  const double potential1,
+                                                  const double viewScalar,
+                                                  const double defaultConductivity) const
+{
+    return potential0          == mNodeTemperature[mPort0[index]]
+       and potential1          == mNodeTemperature[mPort1[index]]
+       and viewScalar          == mViewScalar[index]
+       and defaultConductivity == mDefaultConductivity[index];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] index  (--)  Index of the link in the block.
+///
+/// @return   double  (W/K)  The link's effective conductivity from the last update.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsThermalRadiationBlock::getEffectiveConductivity(const int index) const
+{
+    return mEffectiveConductivity[index];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] index   (--)  Index of the link in the block.
+/// @param[in] scalar  (--)  View scalar of the link.
+///
+/// @details  The link's result is re-evaluated, so it stays consistent with the inputs isCurrent
+///           compares.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsThermalRadiationBlock::setViewScalar(const int index, const double scalar)
+{
+    mViewScalar[index] = scalar;
+    refresh(index);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] index         (--)   Index of the link in the block.
+/// @param[in] conductivity  (W/K)  Default conductivity of the link.
+///
+/// @details  The link's result is re-evaluated, as for setViewScalar.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsThermalRadiationBlock::setDefaultConductivity(const int    index,
+                                                               const double conductivity)
+{
+    mDefaultConductivity[index] = conductivity;
+    refresh(index);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   int  (--)  Number of links in the block.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsThermalRadiationBlock::getNumLinks() const
+{
+    return mNumLinks;
+}
+
+#endif
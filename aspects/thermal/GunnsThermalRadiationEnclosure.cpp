@@ -0,0 +1,325 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+ (
+  (core/GunnsBasicLink.o)
+  (math/UnitConversion.o)
+ )
+***************************************************************************************************/
+#include "GunnsThermalRadiationEnclosure.hh"
+#include "aspects/thermal/PtcsMacros.hh"
+#include "math/MsMath.hh"
+#include "math/UnitConversion.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+/**************************************************************************************************/
+/* ConfigData class */
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name               (--)  Name of the link
+/// @param[in]  nodes              (--)  Pointer to the network nodes the link connects to
+/// @param[in]  surfaceAreas       (m2)  Pointer to the vector of port surface areas
+/// @param[in]  exchangeFactors    (--)  Pointer to the row-major exchange factor matrix
+///
+/// @details  Constructs this GunnsThermalRadiationEnclosure ConfigData.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosureConfigData::GunnsThermalRadiationEnclosureConfigData(
+        const std::string&   name,
+        GunnsNodeList*       nodes,
+        std::vector<double>* surfaceAreas,
+        std::vector<double>* exchangeFactors)
+    :
+    GunnsBasicLinkConfigData(name, nodes),
+    cSurfaceAreas(),
+    cExchangeFactors()
+{
+    /// - Copy the vectors if given.
+    if (surfaceAreas) {
+        cSurfaceAreas = *surfaceAreas;
+    }
+    if (exchangeFactors) {
+        cExchangeFactors = *exchangeFactors;
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  that  (--)  Object to copy
+///
+/// @details  Copy constructs this GunnsThermalRadiationEnclosure ConfigData.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosureConfigData::GunnsThermalRadiationEnclosureConfigData(
+        const GunnsThermalRadiationEnclosureConfigData& that)
+    :
+    GunnsBasicLinkConfigData(that),
+    cSurfaceAreas(that.cSurfaceAreas),
+    cExchangeFactors(that.cExchangeFactors)
+{
+    // nothing to do
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Destructs this GunnsThermalRadiationEnclosure ConfigData.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosureConfigData::~GunnsThermalRadiationEnclosureConfigData()
+{
+    // nothing to do
+}
+/**************************************************************************************************/
+/* InputData class */
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  malfBlockageFlag   (--)  Blockage malfunction flag
+/// @param[in]  malfBlockageValue  (--)  Blockage malfunction fractional value (0-1)
+///
+/// @details  Default constructs this GunnsThermalRadiationEnclosure InputData.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosureInputData::GunnsThermalRadiationEnclosureInputData(
+        const bool   malfBlockageFlag,
+        const double malfBlockageValue)
+    :
+    GunnsBasicLinkInputData(malfBlockageFlag, malfBlockageValue)
+{
+    // nothing to do
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  that  (--)  Object to copy
+///
+/// @details  Copy constructs this GunnsThermalRadiationEnclosure InputData.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosureInputData::GunnsThermalRadiationEnclosureInputData(
+        const GunnsThermalRadiationEnclosureInputData& that)
+    :
+    GunnsBasicLinkInputData(that)
+{
+    // nothing to do
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Destructs this GunnsThermalRadiationEnclosure InputData.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosureInputData::~GunnsThermalRadiationEnclosureInputData()
+{
+    // nothing to do
+}
+/**************************************************************************************************/
+/* GunnsThermalRadiationEnclosure class */
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Constructs the GunnsThermalRadiationEnclosure with default values.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosure::GunnsThermalRadiationEnclosure()
+    :
+    GunnsBasicLink(1),            //  give one port as default; more will be added in initialize()
+    mExchangeConductance(0),
+    mEmissionConductance(0),
+    mHeatFlux(0)
+{
+    // nothing to do
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Destructs the GunnsThermalRadiationEnclosure.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsThermalRadiationEnclosure::~GunnsThermalRadiationEnclosure()
+{
+    cleanup();
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes the dynamic arrays, so initialize can be repeated.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationEnclosure::cleanup()
+{
+    TS_DELETE_ARRAY(mHeatFlux);
+    TS_DELETE_ARRAY(mEmissionConductance);
+    TS_DELETE_ARRAY(mExchangeConductance);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]      configData    (--)  Enclosure configuration data
+/// @param[in]      inputData     (--)  Enclosure input data
+/// @param[in,out]  networkLinks  (--)  Network link vector
+/// @param[in]      portsVector   (--)  Vector of the node numbers of each surface
+///
+/// @throw    TsInitializationException
+///
+/// @details  Initializes the link with one port per surface and builds its exchange conductances.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationEnclosure::initialize(
+        const GunnsThermalRadiationEnclosureConfigData& configData,
+        const GunnsThermalRadiationEnclosureInputData&  inputData,
+        std::vector<GunnsBasicLink*>&                   networkLinks,
+        std::vector<int>*                               portsVector)
+{
+    /// - Set the number of ports from the ports vector and initialize the base class.
+    mNumPorts = static_cast<int>(portsVector->size());
+    GunnsBasicLink::initialize(configData, inputData, networkLinks, &portsVector->front());
+
+    /// - Reset init flag.
+    mInitFlag = false;
+
+    /// - Validate config data specific to this link.
+    validate(configData);
+
+    /// - Allocate the per-port arrays.
+    cleanup();
+    TS_NEW_PRIM_ARRAY_EXT(mExchangeConductance, mNumPorts * mNumPorts, double, std::string(mName) + ".mExchangeConductance");
+    TS_NEW_PRIM_ARRAY_EXT(mEmissionConductance, mNumPorts,             double, std::string(mName) + ".mEmissionConductance");
+    TS_NEW_PRIM_ARRAY_EXT(mHeatFlux,            mNumPorts,             double, std::string(mName) + ".mHeatFlux");
+    for (int i = 0; i < mNumPorts * mNumPorts; ++i) {
+        mExchangeConductance[i] = 0.0;
+    }
+    for (int i = 0; i < mNumPorts; ++i) {
+        mEmissionConductance[i] = 0.0;
+        mHeatFlux[i]            = 0.0;
+    }
+
+    /// - Build the exchange conductances.
+    buildExchange(configData);
+
+    /// - Set init flag on successful validation.
+    mInitFlag = true;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  configData  (--)  Enclosure configuration data
+///
+/// @throw   TsInitializationException
+///
+/// @details  Validates the initialization of this GunnsThermalRadiationEnclosure.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationEnclosure::validate(
+        const GunnsThermalRadiationEnclosureConfigData& configData) const
+{
+    /// - Throw exception if there aren't at least two surfaces to exchange between.
+    TS_PTCS_IF_ERREX(mNumPorts < 2, TsInitializationException,
+            "invalid config data", "enclosure has less than 2 ports.");
+
+    /// - Throw exception if the areas and exchange factors don't match the number of ports.
+    TS_PTCS_IF_ERREX(mNumPorts != static_cast<int>(configData.cSurfaceAreas.size()),
+            TsInitializationException,
+            "invalid config data", "size of surface areas vector != numPorts.");
+    TS_PTCS_IF_ERREX(mNumPorts * mNumPorts != static_cast<int>(configData.cExchangeFactors.size()),
+            TsInitializationException,
+            "invalid config data", "size of exchange factors matrix != numPorts^2.");
+
+    /// - Throw exception on non-positive areas or exchange factors out of range.
+    for (int i = 0; i < mNumPorts; ++i) {
+        TS_PTCS_IF_ERREX(configData.cSurfaceAreas[i] <= 0.0, TsInitializationException,
+                "invalid config data", "surface area not greater than zero.");
+    }
+    for (int i = 0; i < mNumPorts * mNumPorts; ++i) {
+        TS_PTCS_IF_ERREX(not MsMath::isInRange(0.0, configData.cExchangeFactors[i], 1.0),
+                TsInitializationException,
+                "invalid config data", "exchange factor out of range (0-1).");
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  configData  (--)  Enclosure configuration data
+///
+/// @details  Forms the reciprocal exchange matrix K[i][j] = A_i F_ij, averaged with its transpose
+///           and with a zero diagonal, since a surface doesn't exchange net heat with itself.  The
+///           exchange conductance of each pair is K[i][j] times sigma, and the emission conductances
+///           are their row sums.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationEnclosure::buildExchange(
+        const GunnsThermalRadiationEnclosureConfigData& configData)
+{
+    const int    n     = mNumPorts;
+    const double sigma = UnitConversion::STEFAN_BOLTZMANN_CONST_SI;
+
+    /// - Build the symmetric exchange conductances, counting pairs that weren't reciprocal to 1%.
+    int nonReciprocal = 0;
+    for (int i = 0; i < n; ++i) {
+        for (int j = i + 1; j < n; ++j) {
+            const double kij = configData.cSurfaceAreas[i] * configData.cExchangeFactors[i*n + j];
+            const double kji = configData.cSurfaceAreas[j] * configData.cExchangeFactors[j*n + i];
+            if (fabs(kij - kji) > 0.01 * std::max(kij, kji)) {
+                ++nonReciprocal;
+            }
+            const double conductance = sigma * 0.5 * (kij + kji);
+            mExchangeConductance[i*n + j] = conductance;
+            mExchangeConductance[j*n + i] = conductance;
+            mEmissionConductance[i]      += conductance;
+            mEmissionConductance[j]      += conductance;
+        }
+    }
+    if (nonReciprocal > 0) {
+        TS_PTCS_WARNING("averaged " << nonReciprocal << " non-reciprocal exchange factor pairs.");
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Derived classes should call their base class implementation too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationEnclosure::restartModel()
+{
+    /// - Reset the base class.
+    GunnsBasicLink::restartModel();
+
+    /// - Reset non-config & non-checkpointed class attributes.  The exchange conductances are
+    ///   config.
+    for (int i = 0; i < mNumPorts; ++i) {
+        mHeatFlux[i] = 0.0;
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Integration time step [not used]
+///
+/// @details  Linearizes the exchange between each pair of surfaces about their current
+///           temperatures, as in GunnsThermalRadiation:
+///
+///               G_ij (T_j^4 - T_i^4)  =  G_ij (T_i^2 + T_j^2)(T_i + T_j) (T_j - T_i)
+///
+///           where G_ij is their exchange conductance, and loads the resulting conductances into
+///           the admittance matrix like a conductor between every pair.  There is no source term,
+///           so the whole coupling is solved implicitly by the network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationEnclosure::step(const double dt __attribute__((unused)))
+{
+    /// - Process user commands to dynamically re-map ports.
+    processUserPortCommand();
+
+    /// - If blockage malfunction is active, scale the exchange by one minus the blockage value.
+    double scale = 1.0;
+    if (mMalfBlockageFlag) {
+        scale -= mMalfBlockageValue;
+    }
+
+    /// - Build the admittance matrix from the linearized pair conductances.
+    const int n = mNumPorts;
+    for (int i = 0; i < n; ++i) {
+        const double ti       = mPotentialVector[i];
+        double       diagonal = 0.0;
+        for (int j = 0; j < n; ++j) {
+            if (j != i) {
+                const double tj          = mPotentialVector[j];
+                const double conductance = scale * mExchangeConductance[i*n + j]
+                                         * (ti * ti + tj * tj) * (ti + tj);
+                diagonal += conductance;
+                if (-conductance != mAdmittanceMatrix[i*n + j]) {
+                    mAdmittanceMatrix[i*n + j] = -conductance;
+                    mAdmittanceUpdate          = true;
+                }
+            }
+        }
+        if (diagonal != mAdmittanceMatrix[i*n + i]) {
+            mAdmittanceMatrix[i*n + i] = diagonal;
+            mAdmittanceUpdate          = true;
+        }
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dt  (s)  Integration time step [not used]
+///
+/// @details  Finds the net heat absorbed by each surface at the new temperatures, and transports it
+///           to or from the port's node.  The total absorbed by all surfaces is the link's flux.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalRadiationEnclosure::computeFlows(const double dt __attribute__((unused)))
+{
+    const int n = mNumPorts;
+    mFlux = 0.0;
+    for (int i = 0; i < n; ++i) {
+        mHeatFlux[i] = 0.0;
+        for (int j = 0; j < n; ++j) {
+            mHeatFlux[i] -= mAdmittanceMatrix[i*n + j] * mPotentialVector[j];
+        }
+        if (mHeatFlux[i] > 0.0) {
+            mNodes[i]->collectInflux(mHeatFlux[i]);
+            mFlux += mHeatFlux[i];
+        } else {
+            mNodes[i]->collectOutflux(-mHeatFlux[i]);
+        }
+    }
+}
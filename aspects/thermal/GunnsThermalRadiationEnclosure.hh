@@ -0,0 +1,174 @@
+#ifndef GunnsThermalRadiationEnclosure_EXISTS
+#define GunnsThermalRadiationEnclosure_EXISTS
+/********************************** TRICK HEADER ***************************************************
+@defgroup  TSM_GUNNS_THERMAL_RADIATION_ENCLOSURE    Gunns Thermal Radiation Enclosure Link
+@ingroup   TSM_GUNNS_THERMAL
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+   (The GunnsThermalRadiationEnclosure models the radiation exchange among all the surfaces of an
+    enclosure in one multi-port link, in place of a GunnsThermalRadiation link between every pair
+    of surfaces.  It is configured with the surface areas and the enclosure's Gebhart (script-F)
+    exchange factor matrix, as exported from Thermal Desktop.  The net heat absorbed by surface i
+    is:
+
+        q_i = sigma * sum_j (A_i F_ij) (T_j^4 - T_i^4)
+
+    This is an exact, dense enclosure: every pair of surfaces exchanges heat through its own term
+    of the reciprocal exchange matrix A_i F_ij, with no approximation of the matrix.  Each step
+    loads a dense n x n block into the network admittance matrix, so its cost is O(n^2) in the
+    number of surfaces, the same as the pairwise GunnsThermalRadiation links it replaces.
+
+    Each pair's exchange is linearized as in GunnsThermalRadiation, with the conductance
+    sigma A_i F_ij (T_i^2 + T_j^2)(T_i + T_j) between them, and all of it goes in the network
+    admittance matrix.  So the coupling is solved implicitly with the rest of the network, and
+    stays stable for surfaces with small or no thermal capacitance.)
+
+REQUIREMENTS:
+    ()
+
+REFERENCE:
+    (Gebhart, B., Heat Transfer, 2nd ed., McGraw-Hill, 1971, chapter 5)
+
+ASSUMPTIONS AND LIMITATIONS:
+    (The exchange factors are constant, so the enclosure geometry and surface properties don't
+     change during the run.)
+    (The linearized conductances lag the network solution by one step, as in
+     GunnsThermalRadiation.)
+    (Exchange factors that aren't reciprocal (A_i F_ij != A_j F_ji) are averaged to make them so,
+     so the link conserves energy.)
+    (A port may be on the ground node, to represent the part of the enclosure open to space.)
+
+LIBRARY DEPENDENCY:
+    ((GunnsThermalRadiationEnclosure.o))
+
+PROGRAMMERS:
+    ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+@{
+***************************************************************************************************/
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include "core/GunnsBasicLink.hh"
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Thermal Radiation Enclosure Configuration Data
+///
+/// @details  This class provides a data structure for the Thermal Radiation Enclosure ConfigData.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThermalRadiationEnclosureConfigData: public GunnsBasicLinkConfigData
+{
+    public:
+        /// @details  Vector of variable size, one area per port.
+        std::vector<double> cSurfaceAreas;      /**< (m2) trick_chkpnt_io(**) Radiating area of each port's surface */
+
+        /// @details  Row-major n x n matrix, element [i][j] is the fraction of surface i's emission
+        ///           absorbed by surface j, including the surface's emissivity.
+        std::vector<double> cExchangeFactors;   /**< (--) trick_chkpnt_io(**) Gebhart (script-F) exchange factor matrix */
+
+        /// @brief  Default constructs this Thermal Radiation Enclosure configuration data.
+        GunnsThermalRadiationEnclosureConfigData(const std::string&   name            = "unnamed enclosure",
+                                                 GunnsNodeList*       nodes           = 0,
+                                                 std::vector<double>* surfaceAreas    = 0,
+                                                 std::vector<double>* exchangeFactors = 0);
+
+        /// @brief  Default destructs this Thermal Radiation Enclosure ConfigData.
+        virtual ~GunnsThermalRadiationEnclosureConfigData();
+        /// @brief  Copy constructs this Thermal Radiation Enclosure ConfigData.
+        GunnsThermalRadiationEnclosureConfigData(const GunnsThermalRadiationEnclosureConfigData& that);
+
+    private:
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        GunnsThermalRadiationEnclosureConfigData& operator=(const GunnsThermalRadiationEnclosureConfigData&);
+};
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Thermal Radiation Enclosure Input Data
+///
+/// @details  This class provides a data structure for the Thermal Radiation Enclosure InputData.
+///           The blockage malfunction scales the exchange between all surfaces.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThermalRadiationEnclosureInputData: public GunnsBasicLinkInputData
+{
+    public:
+        /// @brief   Default constructs this Thermal Radiation Enclosure InputData.
+        GunnsThermalRadiationEnclosureInputData(const bool   malfBlockageFlag  = false,
+                                                const double malfBlockageValue = 0.0);
+
+        /// @brief   Default destructs this Thermal Radiation Enclosure InputData.
+        virtual ~GunnsThermalRadiationEnclosureInputData();
+        /// @brief   Copy constructs this Thermal Radiation Enclosure InputData.
+        GunnsThermalRadiationEnclosureInputData(const GunnsThermalRadiationEnclosureInputData& that);
+
+    private:
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        GunnsThermalRadiationEnclosureInputData& operator=(const GunnsThermalRadiationEnclosureInputData&);
+};
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Thermal Radiation Enclosure class compatible in a GUNNS thermal network.
+///
+/// @details  mExchangeConductance is the reciprocal exchange matrix, with the Stefan-Boltzmann
+///           constant, and mEmissionConductance[i] is its row i sum.  The matrix is symmetric, so
+///           the heat each surface emits equals the heat the others absorb from it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsThermalRadiationEnclosure: public GunnsBasicLink
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsThermalRadiationEnclosure);
+
+    public:
+        /// @brief  Default Constructor.
+        GunnsThermalRadiationEnclosure();
+        /// @brief  Default Destructor.
+        virtual ~GunnsThermalRadiationEnclosure();
+
+        /// @brief  Initializes the link with Config and Input data
+        void initialize(const GunnsThermalRadiationEnclosureConfigData& configData,
+                        const GunnsThermalRadiationEnclosureInputData&  inputData,
+                        std::vector<GunnsBasicLink*>&                   networkLinks,
+                        std::vector<int>*                               portsVector);
+
+        /// @brief  Step method for updating the link.
+        virtual void step(const double dt);
+
+        /// @brief  Method for computing the flows across the link.
+        virtual void computeFlows(const double dt);
+
+        /// @brief  Returns the net radiation absorbed by a port's surface in the last step.
+        double getHeatFlux(const int port) const;
+
+    protected:
+        double* mExchangeConductance;  /**< ** (W/K4) trick_chkpnt_io(**) Reciprocal exchange matrix times sigma, row-major n x n */
+        double* mEmissionConductance;  /**< ** (W/K4) trick_chkpnt_io(**) Exchange matrix row sum of each surface, times sigma */
+        double* mHeatFlux;             /**< ** (W)    trick_chkpnt_io(**) Net radiation absorbed by each port's surface */
+
+        /// @brief  Validates the Thermal Radiation Enclosure Config data.
+        void validate(const GunnsThermalRadiationEnclosureConfigData& configData) const;
+
+        /// @brief  Builds the exchange conductances from the exchange factors.
+        void buildExchange(const GunnsThermalRadiationEnclosureConfigData& configData);
+
+        /// @brief  Virtual method for derived links to perform their restart functions.
+        virtual void restartModel();
+
+    private:
+        /// @brief  Deletes the dynamic arrays.
+        void cleanup();
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsThermalRadiationEnclosure(const GunnsThermalRadiationEnclosure& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsThermalRadiationEnclosure& operator=(const GunnsThermalRadiationEnclosure& that);
+};
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  port  (--)  The port index.
+///
+/// @return   double  (W)  Net radiation absorbed by the port's surface, negative when it loses heat.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsThermalRadiationEnclosure::getHeatFlux(const int port) const
+{
+    return mHeatFlux[port];
+}
+
+#endif
@@ -8,9 +8,11 @@ LIBRARY DEPENDENCY:
  )
 ***************************************************************************************************/
 #include "GunnsThermalSource.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "math/MsMath.hh" //needed for MsMath::isInRange() in validate()
 #include "aspects/thermal/PtcsMacros.hh"
+#include <typeinfo>
 /**************************************************************************************************/
 /* ConfigData class */
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -288,6 +290,50 @@ void GunnsThermalSource::restartModel()
     GunnsBasicLink::restartModel();
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the flux & temperature overrides, the demanded flux, the tuning scalar and the
+///           average port temperature to the base link state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalSource::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsBasicLink::saveCheckpoint(writer);
+    writer.write(mMalfFluxOverrideFlag);
+    writer.write(mMalfFluxOverrideValue);
+    writer.write(mTemperatureOverrideFlag);
+    writer.write(mTemperatureOverrideValue);
+    writer.write(mDemandedFlux);
+    writer.write(mTuningScalar);
+    writer.write(mAvgPortTemperature);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsThermalSource::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsBasicLink::loadCheckpoint(reader);
+    reader.read(mMalfFluxOverrideFlag);
+    reader.read(mMalfFluxOverrideValue);
+    reader.read(mTemperatureOverrideFlag);
+    reader.read(mTemperatureOverrideValue);
+    reader.read(mDemandedFlux);
+    reader.read(mTuningScalar);
+    reader.read(mAvgPortTemperature);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsThermalSource.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsThermalSource::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsThermalSource);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
 /// @details This updates the link during a calculation frame.
@@ -150,6 +150,15 @@ class GunnsThermalSource: public GunnsBasicLink
         /// @brief Sets and resets the flux override malfunction.
         void setMalfFluxOverride(const bool flag = false, const double value = 0.0);
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         static const double FRACTION_TOLERANCE; /**< (--) trick_chkpnt_io(**) Fraction normalization threshold */
 
@@ -4,6 +4,8 @@
 
 LIBRARY DEPENDENCY:
    (
+    (aspects/thermal/network/ThermNameIndex.o)
+    (aspects/thermal/network/ThermXmlStream.o)
     (parsing/ParseTool.o)
     (parsing/tinyxml/tinyxml.o)
     (software/exceptions/TsInitializationException.o)
@@ -11,17 +13,20 @@ LIBRARY DEPENDENCY:
    )
 
 PROGRAMMERS:
-   ((Joe Valerioti) (L3) (Dec 2012)))
+   (
+    (Joe Valerioti) (L3) (Dec 2012)
+    (GUNNS Development Team) (CACI) (October 2026) (single-pass streaming reader)
+                                    (October 2026) (hashed node & cap-edit group name index)
+   )
 ***************************************************************************************************/
 #include "ThermFileParser.hh"
 #include "parsing/ParseTool.hh" //needed to check file accessibility in openFile
 #include "software/exceptions/TsParseException.hh"
 #include "aspects/thermal/PtcsMacros.hh"
 #include "math/MsMath.hh" //needed for fabs() and FLT_EPSILON in confirmNodeBuild()
-#include <algorithm> //needed for find() function in getCapEditGroupId()
 #include <iostream>
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details  Integer used to designate a node name that is not yet registered in the Node map.
+/// @details  Integer used to designate a node name that is not yet registered in the node index.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 const int ThermFileParser::NOT_FOUND  = -99;
 /**************************************************************************************************/
@@ -33,6 +38,7 @@ ThermFileParser::ThermFileParser(const std::string name)
     :
     areNodesRegistered(false),
     mName(name),
+    mStream(name),
     mNodeFile(),
     mCondFile(),
     mRadFile(),
@@ -43,14 +49,16 @@ ThermFileParser::ThermFileParser(const std::string name)
     mThermInputFileRad(),
     numNodes(0),
     vNodeNames(0),
-    mNodeMap(),
+    mNodeIndex(),
     vCapEditGroupList(0),
+    mCapEditGroupIndex(),
     numLinksCap(0),
     vCapNames(0),
     vCapPorts(0),
     vCapTemperatures(0),
     vCapCapacitances(0),
     vCapEditGroupIdentifiers(0),
+    vCapEditGroupNames(0),
     numLinksCond(0),
     vCondNames(0),
     vCondPorts0(0),
@@ -106,14 +114,32 @@ ThermFileParser::~ThermFileParser()
 ///        counting nodes again.
 ///
 /// @note  Since this function is intended to be called prior to initialization, H&S errors thrown
-///        from the call to readFile won't have an instance name.
+///        from the stream won't have an instance name.
+///
+/// @details  Only the record tags are scanned; no node record is built into an XML element.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void ThermFileParser::preCountNodes()
 {
     /// - Reset number of nodes for a fresh count.
     numNodes = 0;
-    /// - Cause the node file to be parsed and node elements counted in numNodes.
-    readFile(mNodeFile, "node", &ThermFileParser::countNode);
+    try
+    {
+        /// - Sweep the node file, counting the <node> records in numNodes.
+        mStream.open(mNodeFile, "list");
+        while (mStream.nextRecord())
+        {
+            if ("node" == mStream.getTag())
+            {
+                numNodes++;
+            }
+        }
+        mStream.close();
+
+    } catch(TsParseException& e)
+    {
+        /// - Re-throw.
+        TS_PTCS_ERREX(TsParseException, "XML file error", mNodeFile)
+    }
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  name  (--)  Name of object, usually the same as the associated ThermalNetwork.
@@ -193,11 +219,13 @@ void ThermFileParser::readNodeFile()
     /// - Every instance of this class must use a node-file.
     TS_PTCS_IF_ERREX(mNodeFile.empty(), TsParseException, "parsing error", "Null ptr to node-file.")
 
-    /// -
-    readFile(mNodeFile, "capEditing", &ThermFileParser::registerCapEditGroups);
+    /// - Read the XML file in one sweep, calling the specifics needed for Nodes & Capacitance Links
+    ///   and for the cap-edit groups.
+    readFile(mNodeFile, "node", &ThermFileParser::registerNode,
+                        "capEditing", &ThermFileParser::registerCapEditGroups);
 
-    /// - Read the XML file, calling the specifics needed for Nodes & Capacitance Links.
-    readFile(mNodeFile, "node", &ThermFileParser::registerNode);
+    /// - The cap-edit groups may follow the nodes that use them, so they're resolved afterwards.
+    resolveCapEditGroups();
 
     /// - At the file's conclusion, make sure the last node is the space/ground/vacuum node.
     confirmNodeBuild();
@@ -350,11 +378,9 @@ void ThermFileParser::readHtrFile()
         return;
     }
 
-    /// - Read the XML file, calling the specifics needed for Heater links.
-    readFile(mHtrFile, "heater", &ThermFileParser::registerHtr);
-
-    /// - Read the XML file, calling the specifics needed for Source Links.
-    readFile(mHtrFile, "source", &ThermFileParser::registerSrc);
+    /// - Read the XML file, calling the specifics needed for Heater and Source links.
+    readFile(mHtrFile, "heater", &ThermFileParser::registerHtr,
+                       "source", &ThermFileParser::registerSrc);
 
     /// - If a file was read, make sure relevant data was actually included.
     confirmDataFound(numLinksHtr || numLinksSrc, "htr-file", mHtrFile);
@@ -517,48 +543,135 @@ void ThermFileParser::readThermInputFileRad()
     }
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]  xmlFile       (--)  XML file path and name
-/// @param[in]  linkTag       (--)  XML tag which contains the thermal link data
-/// @param[in]  registerLink  (--)  A pointer to a void function that takes a TiXmlElement pointer;
-///                                 used to represent one of the seven registerXxx() methods
+/// @param[in]  xmlFile        (--)  XML file path and name
+/// @param[in]  linkTag        (--)  XML tag which contains the thermal link data
+/// @param[in]  registerLink   (--)  A pointer to a void function that takes a TiXmlElement pointer;
+///                                  used to represent one of the seven registerXxx() methods
+/// @param[in]  linkTag2       (--)  Optional second XML tag handled in the same sweep
+/// @param[in]  registerLink2  (--)  The registerXxx() method for linkTag2
 ///
 /// @throw    TsParseException if error found during parsing of XML-file.
 ///
-/// @details  Private method used to generically read any of the thermal XML files. Opens the file
-///           and accesses the <list> of thermal link data. Loops through every element in
-///           the list and calls the register() method given by the function pointer argument.
-////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermFileParser::readFile(std::string& xmlFile, const char* linkTag,
-        void (ThermFileParser::*registerLink)(TiXmlElement*))
+/// @details  Private method used to generically read any of the thermal XML files. Streams the
+///           file's <list> of thermal link data in a single sweep, building each element of
+///           interest on its own and calling the register() method given by the function pointer
+///           argument for its tag. Other elements are skipped without being built. At the first
+///           element of each tag, the data vectors are reserved for as many more as the file could
+///           hold, so they don't regrow during the sweep. The parse time and peak buffer memory are
+///           reported when the file is done.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermFileParser::readFile(std::string& xmlFile,
+        const char* linkTag,  void (ThermFileParser::*registerLink)(TiXmlElement*),
+        const char* linkTag2, void (ThermFileParser::*registerLink2)(TiXmlElement*))
 {
     try
     {
-        /// - Instantiate a TiXmlDocument for loading data from the file.
-        TiXmlDocument doc;
-
-        /// - Validate file accessibility and load XML data.
-        openFile(doc, xmlFile);
+        /// - Validate file accessibility and find the <list> tag. Raise an error if not found.
+        mStream.open(xmlFile, "list");
 
-        /// - Get the element data from the <list> tag. Raise an error if not found.
-        TiXmlElement* list = getElement(&doc, "list", true);
-        /// - Get the element data from the <linkTag> tag. Don't raise an error if not found.
-        TiXmlElement* elem = getElement(list, linkTag, false);
+        int count  = 0;
+        int count2 = 0;
 
-        /// - Loop through all relevant elements listed in the XML file.
-        while (0 != elem)
+        /// - Loop through all elements listed in the XML file.
+        while (mStream.nextRecord())
         {
-            /// - Call given register() function to populate data vectors.
-            (this->*registerLink)(elem);
-
-            /// - Advance to the next element.
-            elem = elem->NextSiblingElement(linkTag);
+            const std::string& tag = mStream.getTag();
+            if (linkTag == tag)
+            {
+                /// - Call given register() function to populate data vectors.
+                if (0 == count++)
+                {
+                    reserveLinks(tag, static_cast<int>(mStream.getFileSize() / mStream.getRecord().size()));
+                }
+                (this->*registerLink)(mStream.getElement());
+
+            } else if (0 != linkTag2 and linkTag2 == tag)
+            {
+                if (0 == count2++)
+                {
+                    reserveLinks(tag, static_cast<int>(mStream.getFileSize() / mStream.getRecord().size()));
+                }
+                (this->*registerLink2)(mStream.getElement());
+            }
         }
+        mStream.close();
 
     } catch(TsParseException& e)
     {
         /// - Re-throw.
         TS_PTCS_ERREX(TsParseException, "XML file error", xmlFile)
     }
+
+    /// - Report the sweep.
+    TS_PTCS_INFO("parsed " << xmlFile << ": " << mStream.getNumRecords() << " elements, "
+                 << mStream.getBytesRead() << " bytes in " << mStream.getElapsedTime()
+                 << " s, peak buffer memory " << mStream.getPeakBytes() << " bytes.");
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  linkTag  (--)  XML tag of the link elements about to be registered
+/// @param[in]  size     (--)  Estimated number of link elements
+///
+/// @details  Reserves space in the data vectors that are filled by the given link tag. The estimate
+///           is an upper bound from the file size, so is limited to the size of a tag's element.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermFileParser::reserveLinks(const std::string& linkTag, const int size)
+{
+    if ("node" == linkTag)
+    {
+        mNodeIndex.reserve(size);
+        vNodeNames.reserve(size);
+        vCapNames.reserve(size);
+        vCapPorts.reserve(size);
+        vCapTemperatures.reserve(size);
+        vCapCapacitances.reserve(size);
+        vCapEditGroupIdentifiers.reserve(size);
+        vCapEditGroupNames.reserve(size);
+
+    } else if ("conduction" == linkTag)
+    {
+        vCondNames.reserve(size);
+        vCondPorts0.reserve(size);
+        vCondPorts1.reserve(size);
+        vCondConductivities.reserve(size);
+
+    } else if ("radiation" == linkTag)
+    {
+        vRadNames.reserve(size);
+        vRadPorts0.reserve(size);
+        vRadPorts1.reserve(size);
+        vRadCoefficients.reserve(size);
+        vRadViewScalars.reserve(size);
+
+    } else if ("heater" == linkTag)
+    {
+        vHtrNames.reserve(size);
+        vHtrScalars.reserve(size);
+        vHtrPorts.reserve(size);
+        vHtrFracs.reserve(size);
+
+    } else if ("panel" == linkTag)
+    {
+        vPanNames.reserve(size);
+        vPanAreas.reserve(size);
+        vPanAbsorptivities.reserve(size);
+        vPanPorts.reserve(size);
+        vPanFracs.reserve(size);
+
+    } else if ("potential" == linkTag)
+    {
+        vPotNames.reserve(size);
+        vPotPorts.reserve(size);
+        vPotTemperatures.reserve(size);
+        vPotConductivities.reserve(size);
+
+    } else if ("source" == linkTag)
+    {
+        vSrcNames.reserve(size);
+        vSrcInits.reserve(size);
+        vSrcScalars.reserve(size);
+        vSrcPorts.reserve(size);
+        vSrcFracs.reserve(size);
+    }
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in,out]  doc      (--) TiXmlDocument object to load XML file data into
@@ -597,7 +710,9 @@ void ThermFileParser::clearNode()
 {
     /// - Clear any Node data.
     vNodeNames.clear();
-    mNodeMap.clear();
+    mNodeIndex.clear();
+    vCapEditGroupList.clear();
+    mCapEditGroupIndex.clear();
     /// - Clear the number of nodes.
     numNodes = 0;
 }
@@ -612,6 +727,8 @@ void ThermFileParser::clearCap()
     vCapPorts.clear();
     vCapTemperatures.clear();
     vCapCapacitances.clear();
+    vCapEditGroupIdentifiers.clear();
+    vCapEditGroupNames.clear();
     /// - Clear the number of capacitance links.
     numLinksCap = 0;
 }
@@ -716,29 +833,25 @@ void ThermFileParser::registerCapEditGroups(TiXmlElement* capEditing)
     /// - Loop through all relevant elements listed in the XML file.
     while (0 != elem)
     {
-        /// - Read text from <group> tag.
+        /// - Read text from <group> tag. A repeated group is ignored, so that its nodes all resolve
+        ///   to the identifier of its first listing.
         std::string group = getText(elem, 0);
-        vCapEditGroupList.push_back(group);
+        if (mCapEditGroupIndex.insert(group))
+        {
+            vCapEditGroupList.push_back(group);
+        } else
+        {
+            TS_PTCS_WARNING("ignored repeated cap-edit group: " << group);
+        }
 
         /// - Advance to the next element.
         elem = elem->NextSiblingElement("group");
     }
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]  node  (--)  TiXmlElement pointer to a set of <node> data, not used.
-///
-/// @details  This increments the node count each time this is called.  The node argument isn't used
-///           here but provides the function signature needed to be used as a function pointer in
-///           the readFile method.
-////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermFileParser::countNode(TiXmlElement* node __attribute__((unused)))
-{
-    numNodes++;
-}
-////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  node  (--)  TiXmlElement pointer to a set of <node> data
 ///
-/// @details  Adds the node name to the map key, assigning to it the value of the numNodes count,
+/// @details  Adds the node name to the name index, assigning to it the value of the numNodes count,
 ///           which is later incremented. Also pushes the node onto the node names vector.
 ///           Populates Capacitance link vectors with the strings stored in the tags
 ///           from the node-file. The Capacitance links count is then incremented as well.
@@ -750,17 +863,21 @@ void ThermFileParser::registerNode(TiXmlElement* node)
 
     try
     {
-        /// - Get node name and validate.
+        /// - Get node name, which can't be blank.
         nodeName = getText(node, "name");
-        validateNode( nodeName );
+        TS_PTCS_IF_ERREX(nodeName.empty(), TsParseException, "blank/repeated node name,", nodeName);
 
         /// - Get data.
         const double temperature = ParseTool::convertToDouble( getText(node, "temperature"), TS_HS_PTCS,
                                                                "Thermal cap link: " + nodeName + ".");
         const double capacitance = ParseTool::convertToDouble( getText(node, "capacitance"), TS_HS_PTCS,
                                                                "Thermal cap link: " + nodeName + ".");
-        /// - Get cap-edit-group identifier.
-        const int groupId = getCapEditGroupId(node);
+        /// - Get cap-edit-group name, to be resolved to an identifier at the end of the file.
+        const char* editGroup = getText(node, "editGroup", false);
+
+        /// - Add the name to the index with the next port number, which also rejects a repeat.
+        TS_PTCS_IF_ERREX(not mNodeIndex.insert(nodeName), TsParseException,
+                "blank/repeated node name,", nodeName);
 
         /// - If everything above was successful, store
         ///   Node/Capacitance Link data into their corresponding vectors.
@@ -769,10 +886,10 @@ void ThermFileParser::registerNode(TiXmlElement* node)
         vCapPorts.push_back(numNodes);
         vCapTemperatures.push_back(temperature);
         vCapCapacitances.push_back(capacitance);
-        vCapEditGroupIdentifiers.push_back(groupId);
+        vCapEditGroupIdentifiers.push_back(NOT_FOUND);
+        vCapEditGroupNames.push_back(editGroup ? editGroup : "");
 
-        /// - Populate the NodeMap and increment the counts.
-        mNodeMap[nodeName] = numNodes;
+        /// - Increment the counts.
         numNodes++;
         numLinksCap++;
 
@@ -1255,34 +1372,41 @@ int ThermFileParser::countElement(TiXmlNode* parent, const char* tag)
     return count;
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]  node  (--)  TiXmlElement pointer to a set of <node> config data
+/// @param[in]  editGroup  (--)  cap-edit-group name given in a <node>'s <editGroup> tag
 ///
 /// @return   groupId (--)  integer identifying the capacitance-edit-group identifier
 ///
 /// @details  Private method used to determine the index of a cap-edit-group name within the
 ///           vCapEditGroupList vector.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-int ThermFileParser::getCapEditGroupId(TiXmlElement* node)
+int ThermFileParser::getCapEditGroupId(const std::string& editGroup)
 {
-    /// - Get editGroup text from XML if provided.
-    const char* editGroup = getText(node, "editGroup", false);
-
-    if (0 == editGroup)
-    {
-        return NOT_FOUND;
-    }
-
     /// - Find the index of the cap-edit-group.
-    std::vector<std::string>::iterator iter = std::find(vCapEditGroupList.begin(), vCapEditGroupList.end(), editGroup);
+    const int groupId = mCapEditGroupIndex.find(editGroup);
 
-    if ( vCapEditGroupList.end() == iter)
+    if (ThermNameIndex::NOT_FOUND == groupId)
     {
         /// - Name not obtained.
         TS_PTCS_ERROR("- '" << editGroup << "' not previously defined in <capEditing>.");
         return NOT_FOUND;
     }
 
-    return std::distance(vCapEditGroupList.begin(), iter);
+    return groupId;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Resolves each cap link's edit group name, if any, to its identifier once all of the
+///           node-file's <capEditing> groups are known. The names are then released.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermFileParser::resolveCapEditGroups()
+{
+    for (unsigned int i = 0; i < vCapEditGroupNames.size(); ++i)
+    {
+        if (not vCapEditGroupNames[i].empty())
+        {
+            vCapEditGroupIdentifiers[i] = getCapEditGroupId(vCapEditGroupNames[i]);
+        }
+    }
+    std::vector<std::string>().swap(vCapEditGroupNames);
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in,out]  vectorInt    (--)  pointer to vector<int> holding port numbers for a multi-port link
@@ -1333,7 +1457,7 @@ void ThermFileParser::buildMultiPortVectors(
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  nodeName  (--)  name of node in question
 ///
-/// @return     The index of the node within the node map object. If the node is not valid,
+/// @return     The index of the node within the node name index. If the node is not valid,
 ///             an exception is thrown.
 ///
 /// @throw      TsParseException on a node that is not valid.
@@ -1360,7 +1484,7 @@ int ThermFileParser::validateNode(const std::string& nodeString)
                 "blank/repeated node name,", nodeString);
 
     /// - If nodes are already registered, then the links may only call a node which is
-    ///   already in the NodeMap.
+    ///   already in the node name index.
     } else if (NOT_FOUND == nodeIndex)
     {
         /// - Throw exception.
@@ -1372,27 +1496,26 @@ int ThermFileParser::validateNode(const std::string& nodeString)
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  nodeName  (--)  the name of a node (e.g. "LAB_STRUCT_1")
 ///
-/// @return     The value of the node name within the node map object. If the node is not found,
+/// @return     The value of the node name within the node name index. If the node is not found,
 ///             the method returns a NOT_FOUND.
 ///
-/// @details    Returns the location of the node within the node map. This method is used to
+/// @details    Returns the location of the node within the node name index. This method is used to
 ///             determine the nodes that a Gunns link connects to. Thermal Desktop describes
 ///             a node with a string, and Gunns needs to reference that node with an integer.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 int ThermFileParser::getMapLocation(const std::string& nodeName)
 {
-    /// - Use the find() function in the map to return the iterator number.
-    std::map<const std::string, int>::iterator iter = mNodeMap.find(nodeName);
+    /// - Look up the node's port number in the index.
+    const int nodeIndex = mNodeIndex.find(nodeName);
 
-    /// - If the iterator gets to the end without matching the string, then the node is not found.
-    if ( iter == mNodeMap.end() )
+    /// - If the name isn't in the index, then the node is not found.
+    if (ThermNameIndex::NOT_FOUND == nodeIndex)
     {
-        /// - Return a NOT_FOUND to indicate the node is not in the map key.
+        /// - Return a NOT_FOUND to indicate the node is not in the index.
         return NOT_FOUND;
     }
 
-    /// - If the string did have a match, return the iterator value converted to an int.
-    return iter->second;
+    return nodeIndex;
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @throw    TsParseException if the capacitance vector is empty
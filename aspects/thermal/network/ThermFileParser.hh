@@ -20,26 +20,34 @@ PURPOSE:
           - etc-file:  et.cetera; Other link types, namely <potential> and <source>
     ThermalNetwork calls the ThermFileParser's initialize() method, which parses each file's
     specific XML tag structure, and stores the relevant data into its link-specific vectors.
-    ThermalNetwork accesses these vectors and uses their data to construct a GUNNS network.)
+    ThermalNetwork accesses these vectors and uses their data to construct a GUNNS network.
+    Each file is read in a single streaming sweep by a ThermXmlStream, one record at a time.)
 
 REFERENCE:
    ()
 
 ASSUMPTIONS AND LIMITATIONS:
    (This class utilizes tinyxml, hence is limited to take in only XML files.)
+   (Cap-edit groups may be listed anywhere in the node-file; nodes refer to them by name, and the
+    names are resolved once the whole file has been read.)
 
 LIBRARY DEPENDENCY:
    (ThermFileParser.o)
 
 PROGRAMMERS:
-   ((Joe Valerioti) (L3) (Dec 2012)))
+   (
+    (Joe Valerioti) (L3) (Dec 2012)
+    (GUNNS Development Team) (CACI) (October 2026) (single-pass streaming reader)
+                                    (October 2026) (hashed node & cap-edit group name index)
+   )
 @{
 ***************************************************************************************************/
+#include "aspects/thermal/network/ThermNameIndex.hh"
+#include "aspects/thermal/network/ThermXmlStream.hh"
 #include "parsing/tinyxml/tinyxml.hh"
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include <string>
 #include <vector>
-#include <map>
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Parses the ThermalNetwork config-files and stores the data into vectors.
 ///
@@ -54,6 +62,8 @@ class ThermFileParser
 
     /// - ThermalNetwork needs access to ThermFileParser's data vectors.
     friend class ThermalNetwork;
+    /// - ThermNetworkCache compiles and restores the data vectors.
+    friend class ThermNetworkCache;
 
     public:
         /// @brief  Default constructor for the ThermFileParser xml reader.
@@ -65,6 +75,7 @@ class ThermFileParser
         static const int                   NOT_FOUND;                /**<    (--)  trick_chkpnt_io(**) result for a node not registered in the Node map */
         bool                               areNodesRegistered;       /**<    (--)                      True if Nodes file successfully parsed. */
         std::string                        mName;                    /**<    (--)  trick_chkpnt_io(**) Parser name. */
+        ThermXmlStream                     mStream;                  /**< ** (--)  trick_chkpnt_io(**) Streaming reader for the config-files. */
 
         // File names /////////////////////////////////////////////////////////////////////////////////
         std::string                        mNodeFile;                /**<    (--)  trick_chkpnt_io(**) xml file with node & capacitance link data */
@@ -80,8 +91,9 @@ class ThermFileParser
         // Node attributes ////////////////////////////////////////////////////////////////////////////
         int                                numNodes;                 /**<    (--)                      number of nodes in the network */
         std::vector<std::string>           vNodeNames;               /**<    (--)                      vector of node name strings */
-        std::map<const std::string, int>   mNodeMap;                 /**<    (--)                      Node Map. key: node name, value: port number.*/
+        ThermNameIndex                     mNodeIndex;               /**< ** (--)  trick_chkpnt_io(**) Node name index. key: node name, value: port number.*/
         std::vector<std::string>           vCapEditGroupList;        /**< ** (--)                      vector of non-repeating cap-edit group names*/
+        ThermNameIndex                     mCapEditGroupIndex;       /**< ** (--)  trick_chkpnt_io(**) Cap-edit group name index. key: group name, value: identifier.*/
 
         // Capacitance Link attributes ////////////////////////////////////////////////////////////////
         int                                numLinksCap;              /**<    (--)                      number of capacitance links in the network */
@@ -90,6 +102,7 @@ class ThermFileParser
         std::vector<double>                vCapTemperatures;         /**< ** (K)                       vector of cap-link temperature values */
         std::vector<double>                vCapCapacitances;         /**< ** (J/K)                     vector of cap-link capacitance values */
         std::vector<int>                   vCapEditGroupIdentifiers; /**< ** (--)                      vector of cap-link edit group identifiers */
+        std::vector<std::string>           vCapEditGroupNames;       /**< ** (--)  trick_chkpnt_io(**) cap-link edit group names, pending resolution to identifiers */
 
         // Conduction Link attributes //////////////////////////////////////////////////////////////////////////////
         int                                numLinksCond;             /**<    (--)                      number of conduction links in the network */
@@ -161,8 +174,12 @@ class ThermFileParser
         /// @brief  Edits existing link data by reading overrides described in the ThermInput file.
         void readThermInputFileRad();
 
-        /// @brief  Private method used to generically ready any of the thermal XML files.
-        void readFile(std::string& xmlFile, const char* linkTag, void (ThermFileParser::*registerLink)(TiXmlElement*));
+        /// @brief  Private method used to generically read any of the thermal XML files.
+        void readFile(std::string& xmlFile,
+                      const char* linkTag,  void (ThermFileParser::*registerLink)(TiXmlElement*),
+                      const char* linkTag2 = 0, void (ThermFileParser::*registerLink2)(TiXmlElement*) = 0);
+        /// @brief  Reserves space in the data vectors for the estimated number of links.
+        void reserveLinks(const std::string& linkTag, const int size);
         /// @brief  Private method used to validate file accessibility and set doc member.
         void openFile(TiXmlDocument& doc, std::string& xmlFile);
 
@@ -185,8 +202,6 @@ class ThermFileParser
 
         /// @brief  Populates vector of cap-edit group names.
         void registerCapEditGroups(TiXmlElement* capEditing);
-        /// @brief  Counts the nodes.
-        void countNode(TiXmlElement* node);
         /// @brief  Populates Node & Capacitance link data vectors.
         void registerNode(TiXmlElement* node);
         /// @brief  Populates Conduction link data vectors.
@@ -218,7 +233,9 @@ class ThermFileParser
         /// @brief  Private method used to count elements.
         int countElement(TiXmlNode* parent, const char* tag);
         /// @brief  Get cap-edit group identifier based on editGroup name provided in XML.
-        int getCapEditGroupId(TiXmlElement* node);
+        int getCapEditGroupId(const std::string& editGroup);
+        /// @brief  Resolves the cap-link edit group names to identifiers.
+        void resolveCapEditGroups();
 
         /// @brief  Builds ports and fractions vectors for multi-port links.
         void buildMultiPortVectors(
@@ -0,0 +1,163 @@
+/****************************** TRICK HEADER ******************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   ()
+
+PROGRAMMERS:
+   ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+***************************************************************************************************/
+#include "ThermNameIndex.hh"
+#include <cstring>
+
+/// @details  Defined here as well as initialized in the class, since it is odr-used by callers.
+const int ThermNameIndex::NOT_FOUND;
+const int ThermNameIndex::EMPTY;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs the ThermNameIndex, empty.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+ThermNameIndex::ThermNameIndex()
+    :
+    mPool(),
+    mOffsets(1, 0),
+    mHashes(),
+    mSlots()
+{
+    // nothing to do
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs the ThermNameIndex.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+ThermNameIndex::~ThermNameIndex()
+{
+    // nothing to do
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name  (--)  Name to add.
+///
+/// @return   bool  (--)  True if the name was added, false if it was already present.
+///
+/// @details  Adds the name with index size(), growing the slot table if it would be over half full.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool ThermNameIndex::insert(const std::string& name)
+{
+    if (2 * (size() + 1) > static_cast<int>(mSlots.size())) {
+        rehash(static_cast<int>(mSlots.size()) * 2);
+    }
+    const int          length = static_cast<int>(name.size());
+    const unsigned int code   = hash(name.data(), length);
+    const int          slot   = probe(name.data(), length, code);
+    if (EMPTY != mSlots[slot]) {
+        return false;
+    }
+    mSlots[slot] = size();
+    mHashes.push_back(code);
+    mPool.insert(mPool.end(), name.begin(), name.end());
+    mOffsets.push_back(static_cast<int>(mPool.size()));
+    return true;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name  (--)  Name to look up.
+///
+/// @return   int  (--)  The index the name was inserted with, or NOT_FOUND.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int ThermNameIndex::find(const std::string& name) const
+{
+    if (mSlots.empty()) {
+        return NOT_FOUND;
+    }
+    const int length = static_cast<int>(name.size());
+    const int entry  = mSlots[probe(name.data(), length, hash(name.data(), length))];
+    return (EMPTY == entry) ? NOT_FOUND : entry;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Removes all names, keeping the allocated storage for reuse.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNameIndex::clear()
+{
+    mPool.clear();
+    mOffsets.assign(1, 0);
+    mHashes.clear();
+    mSlots.assign(mSlots.size(), EMPTY);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  size  (--)  Expected number of names.
+///
+/// @details  Reserves the entry storage and sizes the slot table for the given number of names.
+///           The pool is reserved for names averaging 16 characters, and grows as needed beyond.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNameIndex::reserve(const int size)
+{
+    if (size <= 0) {
+        return;
+    }
+    mHashes.reserve(size);
+    mOffsets.reserve(size + 1);
+    mPool.reserve(16 * size);
+    if (2 * size > static_cast<int>(mSlots.size())) {
+        rehash(2 * size);
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name    (--)  Characters of the name.
+/// @param[in]  length  (--)  Number of characters.
+///
+/// @return   unsigned int  (--)  32-bit FNV-1a hash of the name.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int ThermNameIndex::hash(const char* name, const int length)
+{
+    unsigned int code = 2166136261u;
+    for (int i = 0; i < length; ++i) {
+        code = (code ^ static_cast<unsigned char>(name[i])) * 16777619u;
+    }
+    return code;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name    (--)  Characters of the name.
+/// @param[in]  length  (--)  Number of characters.
+/// @param[in]  code    (--)  Hash of the name.
+///
+/// @return   int  (--)  Slot holding the name's entry, or the first empty slot of its probe sequence.
+///
+/// @details  Linear probing from the hash's home slot. The stored hash is compared before the
+///           characters, so a probe past other names rarely touches the pool.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int ThermNameIndex::probe(const char* name, const int length, const unsigned int code) const
+{
+    const unsigned int mask = static_cast<unsigned int>(mSlots.size()) - 1;
+    unsigned int slot = code & mask;
+    for (;;) {
+        const int entry = mSlots[slot];
+        if (EMPTY == entry) {
+            return static_cast<int>(slot);
+        }
+        if (code == mHashes[entry] and length == mOffsets[entry + 1] - mOffsets[entry]
+                and (0 == length or 0 == memcmp(&mPool[mOffsets[entry]], name, length))) {
+            return static_cast<int>(slot);
+        }
+        slot = (slot + 1) & mask;
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  numSlots  (--)  Minimum number of slots, rounded up to a power of two.
+///
+/// @details  Rebuilds the slot table from the stored hashes, without rehashing the names.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNameIndex::rehash(const int numSlots)
+{
+    int slots = 16;
+    while (slots < numSlots) {
+        slots *= 2;
+    }
+    mSlots.assign(slots, EMPTY);
+    const unsigned int mask = static_cast<unsigned int>(slots) - 1;
+    for (int entry = 0; entry < size(); ++entry) {
+        unsigned int slot = mHashes[entry] & mask;
+        while (EMPTY != mSlots[slot]) {
+            slot = (slot + 1) & mask;
+        }
+        mSlots[slot] = entry;
+    }
+}
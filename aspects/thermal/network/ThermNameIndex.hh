@@ -0,0 +1,95 @@
+#ifndef ThermNameIndex_EXISTS
+#define ThermNameIndex_EXISTS
+/************************************** TRICK HEADER ***********************************************
+@defgroup TSM_GUNNS_THERMAL_NETWORK_ThermNameIndex Thermal network name index
+@ingroup  TSM_GUNNS_THERMAL_NETWORK
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+   (The ThermNameIndex maps the names of a ThermFileParser's nodes or cap-edit groups to their
+    indices, in the order they were registered. Each name is copied once into a contiguous pool,
+    and found through an open-addressing hash table of the indices, so that resolving the port
+    names of every link costs a hash and usually a single string compare. Inserting a name that
+    is already present is refused, so registration and duplicate detection are one lookup.)
+
+REFERENCE:
+   ()
+
+ASSUMPTIONS AND LIMITATIONS:
+   (Names can only be added, or all cleared; an index is never reassigned.)
+   (Names are compared exactly, including case and whitespace.)
+
+LIBRARY DEPENDENCY:
+   (ThermNameIndex.o)
+
+PROGRAMMERS:
+   ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+@{
+***************************************************************************************************/
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Hashed index of interned thermal node or group names.
+///
+/// @details  Entry i holds the i'th inserted name: its characters start at mOffsets[i] in mPool
+///           and end at mOffsets[i+1], and mHashes[i] holds its hash. The slot table has a power of
+///           two size, at least twice the number of entries, and holds entry indices or EMPTY.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class ThermNameIndex
+{
+    TS_MAKE_SIM_COMPATIBLE(ThermNameIndex);
+
+    public:
+        /// @brief  Result of find for a name that isn't in the index.
+        static const int NOT_FOUND = -1;
+        /// @brief  Default constructs the ThermNameIndex.
+        ThermNameIndex();
+        /// @brief  Default destructs the ThermNameIndex.
+        virtual ~ThermNameIndex();
+        /// @brief  Adds a name with the next index, unless it is already present.
+        bool insert(const std::string& name);
+        /// @brief  Returns the index of a name, or NOT_FOUND.
+        int  find(const std::string& name) const;
+        /// @brief  Returns the number of names in the index.
+        int  size() const;
+        /// @brief  Removes all names from the index.
+        void clear();
+        /// @brief  Sizes the index to hold the given number of names without growing.
+        void reserve(const int size);
+
+    protected:
+        /// @brief  Marks an unused slot.
+        static const int EMPTY = -1;
+        std::vector<char>         mPool;    /**< ** (--) trick_chkpnt_io(**) Characters of all the names, end to end. */
+        std::vector<int>          mOffsets; /**< ** (--) trick_chkpnt_io(**) Start of each name in the pool, and the end of the last. */
+        std::vector<unsigned int> mHashes;  /**< ** (--) trick_chkpnt_io(**) Hash of each name. */
+        std::vector<int>          mSlots;   /**< ** (--) trick_chkpnt_io(**) Hash table of entry indices. */
+        /// @brief  Returns the hash of a name.
+        static unsigned int hash(const char* name, const int length);
+        /// @brief  Returns the slot holding the name, or the empty slot where it belongs.
+        int  probe(const char* name, const int length, const unsigned int hash) const;
+        /// @brief  Resizes the slot table and re-slots the entries.
+        void rehash(const int numSlots);
+
+    private:
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ThermNameIndex(const ThermNameIndex&);
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ThermNameIndex& operator=(const ThermNameIndex&);
+};
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   int  (--)  The number of names in the index.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int ThermNameIndex::size() const
+{
+    return static_cast<int>(mHashes.size());
+}
+
+#endif
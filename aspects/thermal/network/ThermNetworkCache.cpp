@@ -0,0 +1,712 @@
+/****************************** TRICK HEADER ******************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   (
+    (aspects/thermal/network/ThermFileParser.o)
+    (software/exceptions/TsParseException.o)
+   )
+
+PROGRAMMERS:
+   ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+***************************************************************************************************/
+#include "ThermNetworkCache.hh"
+#include "aspects/thermal/PtcsMacros.hh"
+#include "aspects/thermal/network/ThermFileParser.hh"
+#include "software/exceptions/TsParseException.hh"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Increment whenever the image layout or the parser data it holds changes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const unsigned int ThermNetworkCache::VERSION = 1;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Image file magic number, the first 8 bytes of the header.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static const char THERM_CACHE_MAGIC[8] = {'G', 'U', 'N', 'N', 'S', 'T', 'N', 'C'};
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Byte-order mark, which reads back differently on a host of the other byte order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static const unsigned int THERM_CACHE_BOM = 0x01020304;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Size marking an input file that is named but can't be read.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static const unsigned int THERM_CACHE_MISSING = 0xFFFFFFFF;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name  (--)  Instance name for messages.
+///
+/// @details  Default constructs the ThermNetworkCache.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+ThermNetworkCache::ThermNetworkCache(const std::string& name)
+    :
+    mName(name),
+    mInputsHashed(false),
+    mLoaded(false),
+    mImage(),
+    mBase(0),
+    mSize(0)
+{
+    for (int i = 0; i < NUM_INPUTS; ++i) {
+        mInputHash[i] = 0;
+        mInputSize[i] = 0;
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs the ThermNetworkCache.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+ThermNetworkCache::~ThermNetworkCache()
+{
+    // nothing to do
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]      cacheFile  (--)  Path and name of the cache file, or empty for no cache.
+/// @param[in,out]  parser     (--)  Parser, with its XML file names set, to load the data into.
+///
+/// @return   bool  (--)  True if the parser's data was loaded from the cache.
+///
+/// @details  Hashes the parser's XML input files and, if the cache file was compiled from the same
+///           contents, maps it and loads the parser's data vectors from it. Otherwise, returns false
+///           for the caller to parse the XML files instead: a missing or stale cache is expected and
+///           only noted, while a cache that is malformed is warned about. No exceptions are thrown.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool ThermNetworkCache::load(const std::string& cacheFile, ThermFileParser& parser)
+{
+    mLoaded       = false;
+    mInputsHashed = false;
+    if (cacheFile.empty()) {
+        return false;
+    }
+    hashInputs(parser);
+
+    const int fd = open(cacheFile.c_str(), O_RDONLY);
+    if (fd < 0) {
+        TS_PTCS_INFO("no compiled network cache " << cacheFile << ", reading the XML config-files.");
+        return false;
+    }
+
+    /// - Map the whole image read-only.  Anything too small for the header is rejected here.
+    struct stat status;
+    void* image = MAP_FAILED;
+    if (0 == fstat(fd, &status) and status.st_size >= static_cast<off_t>(HEADER_WORDS * 4)
+            and status.st_size < static_cast<off_t>(THERM_CACHE_MISSING)) {
+        mSize = static_cast<unsigned int>(status.st_size);
+        image = mmap(0, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (MAP_FAILED == image) {
+        TS_PTCS_WARNING("ignoring unreadable network cache " << cacheFile << ".");
+        return false;
+    }
+    mBase = static_cast<const unsigned char*>(image);
+
+    try {
+        mLoaded = loadImage(parser);
+        if (not mLoaded) {
+            TS_PTCS_INFO("network cache " << cacheFile << " is stale, reading the XML config-files.");
+        }
+    } catch (TsParseException& e) {
+        TS_PTCS_WARNING("ignoring malformed network cache " << cacheFile << ".");
+    }
+
+    munmap(image, mSize);
+    mBase = 0;
+    mSize = 0;
+    return mLoaded;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  cacheFile  (--)  Path and name of the cache file, or empty for no cache.
+/// @param[in]  parser     (--)  Parser holding the data parsed from its XML files.
+///
+/// @details  Compiles the parser's data into an image and writes it to the cache file, through a
+///           temporary file that is renamed over it so a reader never maps a partial image. Write
+///           failures are warned about, since the XML files can always be parsed instead. The input
+///           hashes taken by a preceding load are reused, so that an XML file edited while it was
+///           being parsed leaves the cache stale rather than holding the old data under a new hash.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::save(const std::string& cacheFile, const ThermFileParser& parser)
+{
+    if (cacheFile.empty()) {
+        return;
+    }
+    if (not mInputsHashed) {
+        hashInputs(parser);
+    }
+
+    /// - Header.
+    mImage.assign(HEADER_WORDS * 4, 0);
+    memcpy(&mImage[0], THERM_CACHE_MAGIC, sizeof(THERM_CACHE_MAGIC));
+    headerWord(VERSION_WORD)  = VERSION;
+    headerWord(ORDER_MARK)    = THERM_CACHE_BOM;
+    headerWord(SECTION_COUNT) = NUM_SECTIONS;
+    for (int i = 0; i < NUM_INPUTS; ++i) {
+        headerWord(INPUT_HASHES + i) = mInputHash[i];
+        headerWord(INPUT_SIZES  + i) = mInputSize[i];
+    }
+
+    /// - Sections, in the order of the parser's data vectors.
+    std::vector<int> counts(NUM_COUNTS, 0);
+    counts[NUM_NODES]      = parser.numNodes;
+    counts[NUM_CAP]        = parser.numLinksCap;
+    counts[NUM_COND]       = parser.numLinksCond;
+    counts[NUM_RAD]        = parser.numLinksRad;
+    counts[NUM_RAD_INPUTS] = parser.numInputEntriesRad;
+    counts[NUM_HTR]        = parser.numLinksHtr;
+    counts[NUM_PAN]        = parser.numLinksPan;
+    counts[NUM_POT]        = parser.numLinksPot;
+    counts[NUM_SRC]        = parser.numLinksSrc;
+    putInts       (COUNTS,              counts);
+    putStrings    (NODE_NAMES,          parser.vNodeNames);
+    putStrings    (CAP_EDIT_GROUPS,     parser.vCapEditGroupList);
+    putStrings    (CAP_NAMES,           parser.vCapNames);
+    putInts       (CAP_PORTS,           parser.vCapPorts);
+    putDoubles    (CAP_TEMPERATURES,    parser.vCapTemperatures);
+    putDoubles    (CAP_CAPACITANCES,    parser.vCapCapacitances);
+    putInts       (CAP_EDIT_GROUP_IDS,  parser.vCapEditGroupIdentifiers);
+    putStrings    (COND_NAMES,          parser.vCondNames);
+    putInts       (COND_PORTS0,         parser.vCondPorts0);
+    putInts       (COND_PORTS1,         parser.vCondPorts1);
+    putDoubles    (COND_CONDUCTIVITIES, parser.vCondConductivities);
+    putStrings    (RAD_NAMES,           parser.vRadNames);
+    putInts       (RAD_PORTS0,          parser.vRadPorts0);
+    putInts       (RAD_PORTS1,          parser.vRadPorts1);
+    putDoubles    (RAD_COEFFICIENTS,    parser.vRadCoefficients);
+    putDoubles    (RAD_VIEW_SCALARS,    parser.vRadViewScalars);
+    putStrings    (HTR_NAMES,           parser.vHtrNames);
+    putDoubles    (HTR_SCALARS,         parser.vHtrScalars);
+    putIntLists   (HTR_PORTS,           parser.vHtrPorts);
+    putDoubleLists(HTR_FRACS,           parser.vHtrFracs);
+    putStrings    (PAN_NAMES,           parser.vPanNames);
+    putDoubles    (PAN_AREAS,           parser.vPanAreas);
+    putDoubles    (PAN_ABSORPTIVITIES,  parser.vPanAbsorptivities);
+    putIntLists   (PAN_PORTS,           parser.vPanPorts);
+    putDoubleLists(PAN_FRACS,           parser.vPanFracs);
+    putStrings    (POT_NAMES,           parser.vPotNames);
+    putInts       (POT_PORTS,           parser.vPotPorts);
+    putDoubles    (POT_TEMPERATURES,    parser.vPotTemperatures);
+    putDoubles    (POT_CONDUCTIVITIES,  parser.vPotConductivities);
+    putStrings    (SRC_NAMES,           parser.vSrcNames);
+    putDoubles    (SRC_INITS,           parser.vSrcInits);
+    putDoubles    (SRC_SCALARS,         parser.vSrcScalars);
+    putIntLists   (SRC_PORTS,           parser.vSrcPorts);
+    putDoubleLists(SRC_FRACS,           parser.vSrcFracs);
+    headerWord(IMAGE_SIZE) = static_cast<unsigned int>(mImage.size());
+
+    /// - Write the temporary file and move it into place.
+    const std::string tempFile = cacheFile + ".tmp";
+    FILE* file = fopen(tempFile.c_str(), "wb");
+    bool written = false;
+    if (0 != file) {
+        written = (mImage.size() == fwrite(&mImage[0], 1, mImage.size(), file));
+        written = (0 == fclose(file)) and written;
+        written = written and (0 == rename(tempFile.c_str(), cacheFile.c_str()));
+    }
+    if (not written) {
+        remove(tempFile.c_str());
+        TS_PTCS_WARNING("could not write network cache " << cacheFile << ": " << strerror(errno));
+    }
+    std::vector<unsigned char>().swap(mImage);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  parser  (--)  Parser with its XML file names set.
+///
+/// @details  Hashes each of the parser's XML input files, including the ThermInput override files
+///           since their edits are compiled into the data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::hashInputs(const ThermFileParser& parser)
+{
+    hashFile(parser.mNodeFile,          mInputHash[NODE_FILE],      mInputSize[NODE_FILE]);
+    hashFile(parser.mCondFile,          mInputHash[COND_FILE],      mInputSize[COND_FILE]);
+    hashFile(parser.mRadFile,           mInputHash[RAD_FILE],       mInputSize[RAD_FILE]);
+    hashFile(parser.mHtrFile,           mInputHash[HTR_FILE],       mInputSize[HTR_FILE]);
+    hashFile(parser.mPanFile,           mInputHash[PAN_FILE],       mInputSize[PAN_FILE]);
+    hashFile(parser.mEtcFile,           mInputHash[ETC_FILE],       mInputSize[ETC_FILE]);
+    hashFile(parser.mThermInputFile,    mInputHash[INPUT_FILE],     mInputSize[INPUT_FILE]);
+    hashFile(parser.mThermInputFileRad, mInputHash[INPUT_RAD_FILE], mInputSize[INPUT_RAD_FILE]);
+    mInputsHashed = true;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]   fileName  (--)  Path and name of the file, or empty for none.
+/// @param[out]  hash      (--)  FNV-1a hash of the file contents, or zero for none.
+/// @param[out]  size      (--)  Size of the file, zero for none, or THERM_CACHE_MISSING if the
+///                              file can't be read.
+///
+/// @details  Hashes one file's contents.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::hashFile(const std::string& fileName, unsigned int& hash, unsigned int& size)
+{
+    hash = 0;
+    size = 0;
+    if (fileName.empty()) {
+        return;
+    }
+    FILE* file = fopen(fileName.c_str(), "rb");
+    if (0 == file) {
+        size = THERM_CACHE_MISSING;
+        return;
+    }
+    hash = 2166136261u;
+    unsigned char buffer[65536];
+    size_t count = 0;
+    while (0 < (count = fread(buffer, 1, sizeof(buffer), file))) {
+        for (size_t i = 0; i < count; ++i) {
+            hash = (hash ^ buffer[i]) * 16777619u;
+        }
+        size += static_cast<unsigned int>(count);
+    }
+    fclose(file);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  parser  (--)  Parser to load the data into.
+///
+/// @return   bool  (--)  False if the image was compiled from different input files.
+///
+/// @throw    TsParseException if the image is malformed, of another version or byte order.
+///
+/// @details  Checks the mapped image's header against this host and the current input hashes, then
+///           copies each section into the parser's data vectors, checking that the sizes agree and
+///           that every port refers to a node. The name indexes are rebuilt from the names.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool ThermNetworkCache::loadImage(ThermFileParser& parser)
+{
+    unsigned int header[HEADER_WORDS];
+    memcpy(header, mBase, sizeof(header));
+    TS_PTCS_IF_ERREX(0 != memcmp(mBase, THERM_CACHE_MAGIC, sizeof(THERM_CACHE_MAGIC)),
+                     TsParseException, "invalid network cache,", "not a network cache.");
+    TS_PTCS_IF_ERREX(THERM_CACHE_BOM != header[ORDER_MARK] or VERSION != header[VERSION_WORD]
+                     or NUM_SECTIONS != header[SECTION_COUNT] or mSize != header[IMAGE_SIZE],
+                     TsParseException, "invalid network cache,", "foreign version or byte order.");
+    for (int i = 0; i < NUM_INPUTS; ++i) {
+        if (mInputHash[i] != header[INPUT_HASHES + i] or mInputSize[i] != header[INPUT_SIZES + i]) {
+            return false;
+        }
+    }
+
+    std::vector<int> counts;
+    getInts(COUNTS, counts);
+    checkSize(counts.size(), NUM_COUNTS);
+    parser.numNodes           = counts[NUM_NODES];
+    parser.numLinksCap        = counts[NUM_CAP];
+    parser.numLinksCond       = counts[NUM_COND];
+    parser.numLinksRad        = counts[NUM_RAD];
+    parser.numInputEntriesRad = counts[NUM_RAD_INPUTS];
+    parser.numLinksHtr        = counts[NUM_HTR];
+    parser.numLinksPan        = counts[NUM_PAN];
+    parser.numLinksPot        = counts[NUM_POT];
+    parser.numLinksSrc        = counts[NUM_SRC];
+    const int numNodes = parser.numNodes;
+
+    /// - Nodes & capacitance links.  There is a cap port & group id for every node, though the
+    ///   space node has no cap link.
+    getStrings    (NODE_NAMES,          parser.vNodeNames);
+    getStrings    (CAP_EDIT_GROUPS,     parser.vCapEditGroupList);
+    getStrings    (CAP_NAMES,           parser.vCapNames);
+    getInts       (CAP_PORTS,           parser.vCapPorts);
+    getDoubles    (CAP_TEMPERATURES,    parser.vCapTemperatures);
+    getDoubles    (CAP_CAPACITANCES,    parser.vCapCapacitances);
+    getInts       (CAP_EDIT_GROUP_IDS,  parser.vCapEditGroupIdentifiers);
+    checkSize(parser.vNodeNames.size(),               numNodes);
+    checkSize(parser.vCapNames.size(),                parser.numLinksCap);
+    checkSize(parser.vCapPorts.size(),                numNodes);
+    checkSize(parser.vCapTemperatures.size(),         parser.numLinksCap);
+    checkSize(parser.vCapCapacitances.size(),         parser.numLinksCap);
+    checkSize(parser.vCapEditGroupIdentifiers.size(), numNodes);
+    checkPorts(parser.vCapPorts, numNodes);
+
+    /// - Conduction & radiation links.
+    getStrings    (COND_NAMES,          parser.vCondNames);
+    getInts       (COND_PORTS0,         parser.vCondPorts0);
+    getInts       (COND_PORTS1,         parser.vCondPorts1);
+    getDoubles    (COND_CONDUCTIVITIES, parser.vCondConductivities);
+    checkSize(parser.vCondNames.size(),          parser.numLinksCond);
+    checkSize(parser.vCondPorts0.size(),         parser.numLinksCond);
+    checkSize(parser.vCondPorts1.size(),         parser.numLinksCond);
+    checkSize(parser.vCondConductivities.size(), parser.numLinksCond);
+    checkPorts(parser.vCondPorts0, numNodes);
+    checkPorts(parser.vCondPorts1, numNodes);
+    getStrings    (RAD_NAMES,           parser.vRadNames);
+    getInts       (RAD_PORTS0,          parser.vRadPorts0);
+    getInts       (RAD_PORTS1,          parser.vRadPorts1);
+    getDoubles    (RAD_COEFFICIENTS,    parser.vRadCoefficients);
+    getDoubles    (RAD_VIEW_SCALARS,    parser.vRadViewScalars);
+    checkSize(parser.vRadNames.size(),        parser.numLinksRad);
+    checkSize(parser.vRadPorts0.size(),       parser.numLinksRad);
+    checkSize(parser.vRadPorts1.size(),       parser.numLinksRad);
+    checkSize(parser.vRadCoefficients.size(), parser.numLinksRad);
+    checkSize(parser.vRadViewScalars.size(),  parser.numInputEntriesRad);
+    checkPorts(parser.vRadPorts0, numNodes);
+    checkPorts(parser.vRadPorts1, numNodes);
+
+    /// - Multi-port links.
+    getStrings    (HTR_NAMES,           parser.vHtrNames);
+    getDoubles    (HTR_SCALARS,         parser.vHtrScalars);
+    getIntLists   (HTR_PORTS,           parser.vHtrPorts);
+    getDoubleLists(HTR_FRACS,           parser.vHtrFracs);
+    getStrings    (PAN_NAMES,           parser.vPanNames);
+    getDoubles    (PAN_AREAS,           parser.vPanAreas);
+    getDoubles    (PAN_ABSORPTIVITIES,  parser.vPanAbsorptivities);
+    getIntLists   (PAN_PORTS,           parser.vPanPorts);
+    getDoubleLists(PAN_FRACS,           parser.vPanFracs);
+    getStrings    (SRC_NAMES,           parser.vSrcNames);
+    getDoubles    (SRC_INITS,           parser.vSrcInits);
+    getDoubles    (SRC_SCALARS,         parser.vSrcScalars);
+    getIntLists   (SRC_PORTS,           parser.vSrcPorts);
+    getDoubleLists(SRC_FRACS,           parser.vSrcFracs);
+    checkSize(parser.vHtrNames.size(),          parser.numLinksHtr);
+    checkSize(parser.vHtrScalars.size(),        parser.numLinksHtr);
+    checkSize(parser.vHtrPorts.size(),          parser.numLinksHtr);
+    checkSize(parser.vHtrFracs.size(),          parser.numLinksHtr);
+    checkSize(parser.vPanNames.size(),          parser.numLinksPan);
+    checkSize(parser.vPanAreas.size(),          parser.numLinksPan);
+    checkSize(parser.vPanAbsorptivities.size(), parser.numLinksPan);
+    checkSize(parser.vPanPorts.size(),          parser.numLinksPan);
+    checkSize(parser.vPanFracs.size(),          parser.numLinksPan);
+    checkSize(parser.vSrcNames.size(),          parser.numLinksSrc);
+    checkSize(parser.vSrcInits.size(),          parser.numLinksSrc);
+    checkSize(parser.vSrcScalars.size(),        parser.numLinksSrc);
+    checkSize(parser.vSrcPorts.size(),          parser.numLinksSrc);
+    checkSize(parser.vSrcFracs.size(),          parser.numLinksSrc);
+    for (int i = 0; i < parser.numLinksHtr; ++i) {
+        checkPorts(parser.vHtrPorts[i], numNodes);
+        checkSize(parser.vHtrFracs[i].size(), parser.vHtrPorts[i].size());
+    }
+    for (int i = 0; i < parser.numLinksPan; ++i) {
+        checkPorts(parser.vPanPorts[i], numNodes);
+        checkSize(parser.vPanFracs[i].size(), parser.vPanPorts[i].size());
+    }
+    for (int i = 0; i < parser.numLinksSrc; ++i) {
+        checkPorts(parser.vSrcPorts[i], numNodes);
+        checkSize(parser.vSrcFracs[i].size(), parser.vSrcPorts[i].size());
+    }
+
+    /// - Potential links.
+    getStrings    (POT_NAMES,           parser.vPotNames);
+    getInts       (POT_PORTS,           parser.vPotPorts);
+    getDoubles    (POT_TEMPERATURES,    parser.vPotTemperatures);
+    getDoubles    (POT_CONDUCTIVITIES,  parser.vPotConductivities);
+    checkSize(parser.vPotNames.size(),          parser.numLinksPot);
+    checkSize(parser.vPotPorts.size(),          parser.numLinksPot);
+    checkSize(parser.vPotTemperatures.size(),   parser.numLinksPot);
+    checkSize(parser.vPotConductivities.size(), parser.numLinksPot);
+    checkPorts(parser.vPotPorts, numNodes);
+
+    /// - Rebuild the name indexes and mark the nodes registered, as parsing the node-file would
+    ///   have.  The names were unique when compiled, so any repeat means a corrupt image.
+    parser.mNodeIndex.clear();
+    parser.mNodeIndex.reserve(numNodes);
+    for (int i = 0; i < numNodes; ++i) {
+        TS_PTCS_IF_ERREX(not parser.mNodeIndex.insert(parser.vNodeNames[i]),
+                         TsParseException, "invalid network cache,", "repeated node name.");
+    }
+    parser.mCapEditGroupIndex.clear();
+    for (unsigned int i = 0; i < parser.vCapEditGroupList.size(); ++i) {
+        TS_PTCS_IF_ERREX(not parser.mCapEditGroupIndex.insert(parser.vCapEditGroupList[i]),
+                         TsParseException, "invalid network cache,", "repeated cap-edit group.");
+    }
+    parser.areNodesRegistered = true;
+    return true;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  word  (--)  Index of the header word.
+///
+/// @return   unsigned int&  (--)  The header word of the image being compiled.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int& ThermNetworkCache::headerWord(const int word)
+{
+    return reinterpret_cast<unsigned int*>(&mImage[0])[word];
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  data   (--)  Bytes to append.
+/// @param[in]  size   (--)  Number of bytes.
+/// @param[in]  align  (--)  Pad the image to a multiple of 8 bytes first.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::append(const void* data, const unsigned int size, const bool align)
+{
+    if (align) {
+        mImage.resize((mImage.size() + 7) & ~static_cast<size_t>(7), 0);
+    }
+    if (size > 0) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        mImage.insert(mImage.end(), bytes, bytes + size);
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  section  (--)  Section index.
+/// @param[in]  count    (--)  Number of items in the section.
+/// @param[in]  aux      (--)  Character or flat count for strings and lists, else zero.
+///
+/// @details  Aligns the image, records the section's offset in the header and appends the counts.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::beginSection(const int section, const unsigned int count,
+                                     const unsigned int aux)
+{
+    append(0, 0, true);
+    headerWord(SECTION_OFFSETS + section) = static_cast<unsigned int>(mImage.size());
+    append(&count, 4);
+    append(&aux,   4);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  section  (--)  Section index.
+/// @param[in]  values   (--)  Values to append.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::putInts(const int section, const std::vector<int>& values)
+{
+    const unsigned int count = static_cast<unsigned int>(values.size());
+    beginSection(section, count, 0);
+    if (count > 0) {
+        append(&values[0], count * sizeof(int));
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  section  (--)  Section index.
+/// @param[in]  values   (--)  Values to append.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::putDoubles(const int section, const std::vector<double>& values)
+{
+    const unsigned int count = static_cast<unsigned int>(values.size());
+    beginSection(section, count, 0);
+    if (count > 0) {
+        append(&values[0], count * sizeof(double));
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  section  (--)  Section index.
+/// @param[in]  values   (--)  Strings to append.
+///
+/// @details  The strings are stored end to end, with the offset of each into the characters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::putStrings(const int section, const std::vector<std::string>& values)
+{
+    const unsigned int count = static_cast<unsigned int>(values.size());
+    std::vector<int> offsets(count + 1, 0);
+    for (unsigned int i = 0; i < count; ++i) {
+        offsets[i + 1] = offsets[i] + static_cast<int>(values[i].size());
+    }
+    beginSection(section, count, offsets[count]);
+    append(&offsets[0], (count + 1) * sizeof(int));
+    for (unsigned int i = 0; i < count; ++i) {
+        append(values[i].data(), static_cast<unsigned int>(values[i].size()));
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  section  (--)  Section index.
+/// @param[in]  values   (--)  Lists to append.
+///
+/// @details  The lists are stored end to end, with the offset of each into the flat values.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::putIntLists(const int section,
+                                    const std::vector< std::vector<int> >& values)
+{
+    const unsigned int count = static_cast<unsigned int>(values.size());
+    std::vector<int> offsets(count + 1, 0);
+    for (unsigned int i = 0; i < count; ++i) {
+        offsets[i + 1] = offsets[i] + static_cast<int>(values[i].size());
+    }
+    beginSection(section, count, offsets[count]);
+    append(&offsets[0], (count + 1) * sizeof(int));
+    append(0, 0, true);
+    for (unsigned int i = 0; i < count; ++i) {
+        if (not values[i].empty()) {
+            append(&values[i][0], static_cast<unsigned int>(values[i].size() * sizeof(int)));
+        }
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  section  (--)  Section index.
+/// @param[in]  values   (--)  Lists to append.
+///
+/// @details  The lists are stored end to end, with the offset of each into the flat values.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::putDoubleLists(const int section,
+                                       const std::vector< std::vector<double> >& values)
+{
+    const unsigned int count = static_cast<unsigned int>(values.size());
+    std::vector<int> offsets(count + 1, 0);
+    for (unsigned int i = 0; i < count; ++i) {
+        offsets[i + 1] = offsets[i] + static_cast<int>(values[i].size());
+    }
+    beginSection(section, count, offsets[count]);
+    append(&offsets[0], (count + 1) * sizeof(int));
+    append(0, 0, true);
+    for (unsigned int i = 0; i < count; ++i) {
+        if (not values[i].empty()) {
+            append(&values[i][0], static_cast<unsigned int>(values[i].size() * sizeof(double)));
+        }
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  data  (--)  Start of the range in the mapped image.
+/// @param[in]  size  (--)  Size of the range in bytes.
+///
+/// @throw    TsParseException if the range runs past the end of the image.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::checkRange(const unsigned char* data, const unsigned long size) const
+{
+    const unsigned long start = static_cast<unsigned long>(data - mBase);
+    TS_PTCS_IF_ERREX(data < mBase or start > mSize or size > mSize - start,
+                     TsParseException, "invalid network cache,", "section runs past the end.");
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]   section  (--)  Section index.
+/// @param[out]  count    (--)  Number of items in the section.
+/// @param[out]  aux      (--)  Character or flat count for strings and lists.
+///
+/// @return   const unsigned char*  (--)  Start of the section's data, after the counts.
+///
+/// @throw    TsParseException if the section's offset is misaligned or out of the image.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const unsigned char* ThermNetworkCache::getSection(const int section, unsigned int& count,
+                                                   unsigned int& aux) const
+{
+    unsigned int offset = 0;
+    memcpy(&offset, mBase + 4 * (SECTION_OFFSETS + section), 4);
+    TS_PTCS_IF_ERREX(0 != offset % 8 or offset < HEADER_WORDS * 4,
+                     TsParseException, "invalid network cache,", "misaligned section.");
+    checkRange(mBase + offset, 8);
+    memcpy(&count, mBase + offset,     4);
+    memcpy(&aux,   mBase + offset + 4, 4);
+    return mBase + offset + 8;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]   section  (--)  Section index.
+/// @param[out]  values   (--)  Values read from the section.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::getInts(const int section, std::vector<int>& values) const
+{
+    unsigned int count = 0;
+    unsigned int aux   = 0;
+    const unsigned char* data = getSection(section, count, aux);
+    checkRange(data, static_cast<unsigned long>(count) * sizeof(int));
+    values.resize(count);
+    if (count > 0) {
+        memcpy(&values[0], data, count * sizeof(int));
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]   section  (--)  Section index.
+/// @param[out]  values   (--)  Values read from the section.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::getDoubles(const int section, std::vector<double>& values) const
+{
+    unsigned int count = 0;
+    unsigned int aux   = 0;
+    const unsigned char* data = getSection(section, count, aux);
+    checkRange(data, static_cast<unsigned long>(count) * sizeof(double));
+    values.resize(count);
+    if (count > 0) {
+        memcpy(&values[0], data, count * sizeof(double));
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]   section  (--)  Section index.
+/// @param[out]  count    (--)  Number of items in the section.
+/// @param[out]  flat     (--)  Number of characters or flat values in the section.
+/// @param[out]  data     (--)  Start of the characters or flat values, unaligned.
+///
+/// @return   const int*  (--)  The count + 1 offsets of the items into the flat data.
+///
+/// @throw    TsParseException if the offsets don't run in order from zero to the flat count.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const int* ThermNetworkCache::getOffsets(const int section, unsigned int& count,
+                                         unsigned int& flat, const unsigned char*& data) const
+{
+    const unsigned char* start = getSection(section, count, flat);
+    checkRange(start, (static_cast<unsigned long>(count) + 1) * sizeof(int));
+    const int* offsets = reinterpret_cast<const int*>(start);
+    bool ordered = (0 == offsets[0]) and (static_cast<int>(flat) == offsets[count]);
+    for (unsigned int i = 0; ordered and i < count; ++i) {
+        ordered = offsets[i] <= offsets[i + 1];
+    }
+    TS_PTCS_IF_ERREX(not ordered, TsParseException, "invalid network cache,", "bad list offsets.");
+    data = start + (count + 1) * sizeof(int);
+    return offsets;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]   section  (--)  Section index.
+/// @param[out]  values   (--)  Strings read from the section.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::getStrings(const int section, std::vector<std::string>& values) const
+{
+    unsigned int count = 0;
+    unsigned int flat  = 0;
+    const unsigned char* data = 0;
+    const int* offsets = getOffsets(section, count, flat, data);
+    checkRange(data, flat);
+    const char* chars = reinterpret_cast<const char*>(data);
+    values.resize(count);
+    for (unsigned int i = 0; i < count; ++i) {
+        values[i].assign(chars + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]   section  (--)  Section index.
+/// @param[out]  values   (--)  Lists read from the section.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::getIntLists(const int section,
+                                    std::vector< std::vector<int> >& values) const
+{
+    unsigned int count = 0;
+    unsigned int flat  = 0;
+    const unsigned char* data = 0;
+    const int* offsets = getOffsets(section, count, flat, data);
+    data = mBase + ((data - mBase + 7) & ~7);
+    checkRange(data, static_cast<unsigned long>(flat) * sizeof(int));
+    values.resize(count);
+    for (unsigned int i = 0; i < count; ++i) {
+        values[i].resize(offsets[i + 1] - offsets[i]);
+        if (not values[i].empty()) {
+            memcpy(&values[i][0], data + offsets[i] * sizeof(int), values[i].size() * sizeof(int));
+        }
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]   section  (--)  Section index.
+/// @param[out]  values   (--)  Lists read from the section.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::getDoubleLists(const int section,
+                                       std::vector< std::vector<double> >& values) const
+{
+    unsigned int count = 0;
+    unsigned int flat  = 0;
+    const unsigned char* data = 0;
+    const int* offsets = getOffsets(section, count, flat, data);
+    data = mBase + ((data - mBase + 7) & ~7);
+    checkRange(data, static_cast<unsigned long>(flat) * sizeof(double));
+    values.resize(count);
+    for (unsigned int i = 0; i < count; ++i) {
+        values[i].resize(offsets[i + 1] - offsets[i]);
+        if (not values[i].empty()) {
+            memcpy(&values[i][0], data + offsets[i] * sizeof(double),
+                   values[i].size() * sizeof(double));
+        }
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  ports     (--)  Port node indices.
+/// @param[in]  numNodes  (--)  Number of nodes in the network.
+///
+/// @throw    TsParseException if a port doesn't refer to a node.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::checkPorts(const std::vector<int>& ports, const int numNodes) const
+{
+    for (unsigned int i = 0; i < ports.size(); ++i) {
+        TS_PTCS_IF_ERREX(ports[i] < 0 or ports[i] >= numNodes,
+                         TsParseException, "invalid network cache,", "port out of range.");
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  size      (--)  Size of a vector read from the image.
+/// @param[in]  expected  (--)  Size it should have.
+///
+/// @throw    TsParseException if the sizes differ.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermNetworkCache::checkSize(const unsigned int size, const int expected) const
+{
+    TS_PTCS_IF_ERREX(expected < 0 or size != static_cast<unsigned int>(expected),
+                     TsParseException, "invalid network cache,", "section size mismatch.");
+}
@@ -0,0 +1,172 @@
+#ifndef ThermNetworkCache_EXISTS
+#define ThermNetworkCache_EXISTS
+/************************************** TRICK HEADER ***********************************************
+@defgroup TSM_GUNNS_THERMAL_NETWORK_ThermNetworkCache Thermal network compiled binary cache
+@ingroup  TSM_GUNNS_THERMAL_NETWORK
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+   (The ThermNetworkCache compiles the validated data of a ThermFileParser into a versioned binary
+    image file: the node table, the link tables with their resolved port indices, and the
+    capacitance-edit groups. On later runs, the image is memory-mapped and copied straight into
+    the parser's data vectors, skipping the XML parsing, number conversion and node name
+    resolution. The image records a hash of each XML input file it was compiled from, and is only
+    used while all of them still match.)
+
+REFERENCE:
+   ()
+
+ASSUMPTIONS AND LIMITATIONS:
+   (The image is in the host's native byte order and is only loaded on a host of the same byte
+    order and format version; any other image is ignored and rebuilt.)
+   (The input hash is a 32-bit FNV-1a of each file's contents, plus its size. It detects edits, it
+    does not defend against deliberate collisions.)
+
+LIBRARY DEPENDENCY:
+   (ThermNetworkCache.o)
+
+PROGRAMMERS:
+   ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+@{
+***************************************************************************************************/
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <string>
+#include <vector>
+
+class ThermFileParser;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Compiled binary image of a thermal network's parsed configuration.
+///
+/// @details  The image layout is a header of 32-bit words, then one section per parser vector, each
+///           starting on an 8-byte boundary:
+///           \verbatim
+///             header:   "GUNNSTNC", version, byte-order mark, image size, section count,
+///                       the hash & size of each of the 8 input files, then each section's offset
+///             numbers:  32-bit count, 32-bit zero, then the int32 or float64 values
+///             strings:  32-bit count, 32-bit character count, count+1 int32 offsets, characters
+///             lists:    32-bit count, 32-bit flat count, count+1 int32 offsets, padding,
+///                       then the flat int32 or float64 values
+///           \endverbatim
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class ThermNetworkCache
+{
+    TS_MAKE_SIM_COMPATIBLE(ThermNetworkCache);
+
+    public:
+        /// @brief  Image format version.
+        static const unsigned int VERSION;
+        /// @brief  Default constructs the ThermNetworkCache.
+        ThermNetworkCache(const std::string& name = "");
+        /// @brief  Default destructs the ThermNetworkCache.
+        virtual ~ThermNetworkCache();
+        /// @brief  Loads the parser's data from the cache file, if it is current.
+        bool load(const std::string& cacheFile, ThermFileParser& parser);
+        /// @brief  Compiles the parser's data into the cache file.
+        void save(const std::string& cacheFile, const ThermFileParser& parser);
+        /// @brief  Returns whether the last load was from the cache file.
+        bool isLoaded() const;
+
+    protected:
+        /// @brief  Enumeration of the XML input files hashed into the image.
+        enum Input {
+            NODE_FILE = 0, COND_FILE, RAD_FILE, HTR_FILE, PAN_FILE, ETC_FILE, INPUT_FILE,
+            INPUT_RAD_FILE, NUM_INPUTS
+        };
+        /// @brief  Enumeration of the image sections, one per parser vector.
+        enum Section {
+            COUNTS = 0, NODE_NAMES, CAP_EDIT_GROUPS,
+            CAP_NAMES, CAP_PORTS, CAP_TEMPERATURES, CAP_CAPACITANCES, CAP_EDIT_GROUP_IDS,
+            COND_NAMES, COND_PORTS0, COND_PORTS1, COND_CONDUCTIVITIES,
+            RAD_NAMES, RAD_PORTS0, RAD_PORTS1, RAD_COEFFICIENTS, RAD_VIEW_SCALARS,
+            HTR_NAMES, HTR_SCALARS, HTR_PORTS, HTR_FRACS,
+            PAN_NAMES, PAN_AREAS, PAN_ABSORPTIVITIES, PAN_PORTS, PAN_FRACS,
+            POT_NAMES, POT_PORTS, POT_TEMPERATURES, POT_CONDUCTIVITIES,
+            SRC_NAMES, SRC_INITS, SRC_SCALARS, SRC_PORTS, SRC_FRACS,
+            NUM_SECTIONS
+        };
+        /// @brief  Enumeration of the link & node counts in the COUNTS section.
+        enum Count {
+            NUM_NODES = 0, NUM_CAP, NUM_COND, NUM_RAD, NUM_RAD_INPUTS, NUM_HTR, NUM_PAN, NUM_POT,
+            NUM_SRC, NUM_COUNTS
+        };
+        /// @brief  Enumeration of the header words.
+        enum HeaderWord {
+            MAGIC = 0, VERSION_WORD = 2, ORDER_MARK, IMAGE_SIZE, SECTION_COUNT,
+            INPUT_HASHES, INPUT_SIZES = INPUT_HASHES + NUM_INPUTS,
+            SECTION_OFFSETS = INPUT_SIZES + NUM_INPUTS,
+            HEADER_WORDS = SECTION_OFFSETS + NUM_SECTIONS + (NUM_SECTIONS % 2)
+        };
+        std::string                mName;                  /**< ** (--) trick_chkpnt_io(**) Instance name for messages. */
+        unsigned int               mInputHash[NUM_INPUTS]; /**< ** (--) trick_chkpnt_io(**) Hash of each XML input file. */
+        unsigned int               mInputSize[NUM_INPUTS]; /**< ** (--) trick_chkpnt_io(**) Size of each XML input file. */
+        bool                       mInputsHashed;          /**< ** (--) trick_chkpnt_io(**) The input hashes are current. */
+        bool                       mLoaded;                /**< ** (--) trick_chkpnt_io(**) The last load was from the cache. */
+        std::vector<unsigned char> mImage;                 /**< ** (--) trick_chkpnt_io(**) Image being compiled. */
+        const unsigned char*       mBase;                  /**< ** (--) trick_chkpnt_io(**) Mapped image being loaded. */
+        unsigned int               mSize;                  /**< ** (--) trick_chkpnt_io(**) Size of the mapped image. */
+        /// @brief  Hashes the parser's XML input files.
+        void hashInputs(const ThermFileParser& parser);
+        /// @brief  Hashes one file's contents.
+        static void hashFile(const std::string& fileName, unsigned int& hash, unsigned int& size);
+        /// @brief  Checks the mapped image and copies it into the parser.
+        bool loadImage(ThermFileParser& parser);
+        /// @brief  Appends a section of ints to the image.
+        void putInts(const int section, const std::vector<int>& values);
+        /// @brief  Appends a section of doubles to the image.
+        void putDoubles(const int section, const std::vector<double>& values);
+        /// @brief  Appends a section of strings to the image.
+        void putStrings(const int section, const std::vector<std::string>& values);
+        /// @brief  Appends a section of int lists to the image.
+        void putIntLists(const int section, const std::vector< std::vector<int> >& values);
+        /// @brief  Appends a section of double lists to the image.
+        void putDoubleLists(const int section, const std::vector< std::vector<double> >& values);
+        /// @brief  Starts a section in the image.
+        void beginSection(const int section, const unsigned int count, const unsigned int aux);
+        /// @brief  Appends raw bytes to the image, optionally first padding it to 8 bytes.
+        void append(const void* data, const unsigned int size, const bool align = false);
+        /// @brief  Returns a header word of the image being compiled.
+        unsigned int& headerWord(const int word);
+        /// @brief  Locates a section in the mapped image, checking that it fits.
+        const unsigned char* getSection(const int section, unsigned int& count,
+                                        unsigned int& aux) const;
+        /// @brief  Checks that a range of the mapped image lies within it.
+        void checkRange(const unsigned char* data, const unsigned long size) const;
+        /// @brief  Gets a section of ints from the mapped image.
+        void getInts(const int section, std::vector<int>& values) const;
+        /// @brief  Gets a section of doubles from the mapped image.
+        void getDoubles(const int section, std::vector<double>& values) const;
+        /// @brief  Gets a section of strings from the mapped image.
+        void getStrings(const int section, std::vector<std::string>& values) const;
+        /// @brief  Gets a section of int lists from the mapped image.
+        void getIntLists(const int section, std::vector< std::vector<int> >& values) const;
+        /// @brief  Gets a section of double lists from the mapped image.
+        void getDoubleLists(const int section, std::vector< std::vector<double> >& values) const;
+        /// @brief  Gets the list offsets of a strings or lists section from the mapped image.
+        const int* getOffsets(const int section, unsigned int& count, unsigned int& flat,
+                              const unsigned char*& data) const;
+        /// @brief  Checks that port indices refer to nodes.
+        void checkPorts(const std::vector<int>& ports, const int numNodes) const;
+        /// @brief  Checks that a vector has the expected size.
+        void checkSize(const unsigned int size, const int expected) const;
+
+    private:
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ThermNetworkCache(const ThermNetworkCache&);
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ThermNetworkCache& operator=(const ThermNetworkCache&);
+};
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   bool  (--)  True if the last load was from the cache file.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool ThermNetworkCache::isLoaded() const
+{
+    return mLoaded;
+}
+
+#endif
@@ -0,0 +1,410 @@
+/****************************** TRICK HEADER ******************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   (
+    (parsing/tinyxml/tinyxml.o)
+    (software/exceptions/TsParseException.o)
+   )
+
+PROGRAMMERS:
+   ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+***************************************************************************************************/
+#include "ThermXmlStream.hh"
+#include "aspects/thermal/PtcsMacros.hh"
+#include "software/exceptions/TsParseException.hh"
+#include <cstring>
+#include <ctime>
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Large enough that a file is read in a few system calls, small enough to stay in cache.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const unsigned int ThermXmlStream::CHUNK_SIZE = 65536;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name  (--)  Instance name for messages.
+///
+/// @details  Default constructs the ThermXmlStream.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+ThermXmlStream::ThermXmlStream(const std::string& name)
+    :
+    mName(name),
+    mFileName(),
+    mFile(0),
+    mChunk(),
+    mChunkUsed(0),
+    mChunkPos(0),
+    mRecord(),
+    mTag(),
+    mCapturing(false),
+    mRootClosed(false),
+    mDepth(0),
+    mDoc(),
+    mFileSize(0),
+    mBytesRead(0),
+    mNumRecords(0),
+    mPeakBytes(0),
+    mStartTime(0.0),
+    mElapsedTime(0.0)
+{
+    // nothing to do
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs the ThermXmlStream, closing any open file.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+ThermXmlStream::~ThermXmlStream()
+{
+    close();
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   (s)  Monotonic clock time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double ThermXmlStream::now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1.0e-9 * time.tv_nsec;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  xmlFile  (--)  Path and name of the XML file.
+/// @param[in]  rootTag  (--)  Expected tag of the file's root element.
+///
+/// @throw    TsParseException if the file can't be opened, or its root element isn't rootTag.
+///
+/// @details  Opens the file and reads up to the start of the root element's contents, leaving the
+///           stream ready for the first call to nextRecord().
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermXmlStream::open(const std::string& xmlFile, const char* rootTag)
+{
+    close();
+    mFileName   = xmlFile;
+    mStartTime  = now();
+    mChunkUsed  = 0;
+    mChunkPos   = 0;
+    mRecord.clear();
+    mTag.clear();
+    mCapturing  = false;
+    mRootClosed = false;
+    mDepth      = 0;
+    mFileSize   = 0;
+    mBytesRead  = 0;
+    mNumRecords = 0;
+    mElapsedTime = 0.0;
+
+    mFile = fopen(xmlFile.c_str(), "rb");
+    if (0 == mFile) {
+        raiseError("file accessibility error", "Cannot open file for parsing.");
+    }
+
+    /// - The file size lets the caller estimate the number of records from the first one.
+    if (0 == fseek(mFile, 0, SEEK_END)) {
+        const long size = ftell(mFile);
+        mFileSize = (size > 0) ? static_cast<unsigned long>(size) : 0;
+    }
+    rewind(mFile);
+    mChunk.resize(CHUNK_SIZE);
+    mPeakBytes = mChunk.capacity();
+
+    /// - Scan for the first start tag, which must be the root.  The contents of anything else
+    ///   before it (declaration, comments, a BOM) are skipped.
+    std::string name;
+    char c;
+    while (getChar(c)) {
+        if ('<' != c) {
+            continue;
+        }
+        if (not getChar(c)) {
+            break;
+        }
+        if ('?' == c or '!' == c) {
+            skipMarkup(c);
+        } else if ('/' == c) {
+            break;
+        } else {
+            const bool empty = readTag(name, c);
+            if (name != rootTag) {
+                break;
+            }
+            mRootClosed = empty;
+            mDepth      = 1;
+            return;
+        }
+    }
+    raiseError("XML tag not found,", rootTag);
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   bool  (--)  True if a record was found, false at the end of the root element.
+///
+/// @throw    TsParseException if the file ends inside an element or a tag is malformed.
+///
+/// @details  Scans forward to the end of the next element directly under the root, saving its text
+///           and tag. Text, comments and other markup between records are skipped.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool ThermXmlStream::nextRecord()
+{
+    if (0 == mFile) {
+        raiseError("invalid state,", "stream is not open.");
+    }
+    if (mRootClosed) {
+        return false;
+    }
+    mRecord.clear();
+    mTag.clear();
+    mCapturing = false;
+
+    std::string name;
+    char c;
+    while (getChar(c)) {
+        if ('<' != c) {
+            continue;
+        }
+
+        /// - Start capturing at the '<' that opens a record.
+        if (1 == mDepth) {
+            mRecord    = "<";
+            mCapturing = true;
+        }
+        if (not getChar(c)) {
+            break;
+        }
+
+        if ('?' == c or '!' == c) {
+            skipMarkup(c);
+        } else if ('/' == c) {
+            readEndTag(name);
+            --mDepth;
+            if (0 == mDepth) {
+                mRecord.clear();
+                mCapturing  = false;
+                mRootClosed = true;
+                return false;
+            } else if (1 == mDepth) {
+                break;
+            }
+        } else {
+            const bool empty = readTag(name, c);
+            if (1 == mDepth) {
+                mTag = name;
+                if (empty) {
+                    break;
+                }
+            }
+            if (not empty) {
+                ++mDepth;
+            }
+        }
+
+        /// - Markup between records isn't part of any record.
+        if (1 == mDepth) {
+            mRecord.clear();
+            mCapturing = false;
+        }
+    }
+
+    if (mTag.empty() or 1 != mDepth) {
+        raiseError("unexpected end of XML file,", "before the end of the root element.");
+    }
+    mCapturing = false;
+    ++mNumRecords;
+    const unsigned long held = mChunk.capacity() + mRecord.capacity();
+    if (held > mPeakBytes) {
+        mPeakBytes = held;
+    }
+    return true;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   TiXmlElement*  (--)  The current record's element, valid until the next record.
+///
+/// @throw    TsParseException if there is no current record, or TinyXML can't parse it.
+///
+/// @details  Parses just the current record's text into a TinyXML element.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TiXmlElement* ThermXmlStream::getElement()
+{
+    if (mTag.empty()) {
+        raiseError("invalid state,", "no current record.");
+    }
+    mDoc.Clear();
+    mDoc.ClearError();
+    mDoc.Parse(mRecord.c_str());
+    TiXmlElement* element = mDoc.RootElement();
+    if (mDoc.Error() or 0 == element) {
+        raiseError("invalid XML format", mFileName + ": " + mDoc.ErrorDesc());
+    }
+    return element;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Closes the file, if open, and releases the buffers.  The statistics are kept, and the
+///           elapsed time stops.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermXmlStream::close()
+{
+    if (0 != mFile) {
+        mElapsedTime = now() - mStartTime;
+        fclose(mFile);
+        mFile = 0;
+    }
+    std::vector<char>().swap(mChunk);
+    std::string().swap(mRecord);
+    mDoc.Clear();
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   double  (s)  Time elapsed since the file was opened, until it was closed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double ThermXmlStream::getElapsedTime() const
+{
+    if (0 != mFile) {
+        return now() - mStartTime;
+    }
+    return mElapsedTime;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  c  (--)  The next character.
+///
+/// @return   bool  (--)  False at the end of the file.
+///
+/// @details  Returns the next character from the current chunk, reading the next chunk as needed,
+///           and appends it to the record while capturing.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool ThermXmlStream::getChar(char& c)
+{
+    if (mChunkPos >= mChunkUsed) {
+        mChunkUsed = static_cast<unsigned int>(fread(&mChunk[0], 1, mChunk.size(), mFile));
+        mChunkPos  = 0;
+        mBytesRead += mChunkUsed;
+        if (0 == mChunkUsed) {
+            return false;
+        }
+    }
+    c = mChunk[mChunkPos++];
+    if (mCapturing) {
+        mRecord += c;
+    }
+    return true;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  first  (--)  Character following the '<', either '?' or '!'.
+///
+/// @throw    TsParseException if the file ends inside the markup.
+///
+/// @details  Skips a processing instruction or declaration, comment, CDATA section or DOCTYPE.
+///           Of these, only comments and CDATA may hold a bare '>' inside.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermXmlStream::skipMarkup(char first)
+{
+    char c = 0;
+    if ('?' == first) {
+        skipPast("?>");
+    } else if (not getChar(c)) {
+        raiseError("unexpected end of XML file,", "inside markup.");
+    } else if ('-' == c) {
+        skipPast("-->");
+    } else if ('[' == c) {
+        skipPast("]]>");
+    } else if ('>' != c) {
+        skipPast(">");
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  terminator  (--)  String that ends the section being skipped.
+///
+/// @throw    TsParseException if the file ends before the terminator.
+///
+/// @details  Reads through the end of the terminator.  A terminator that begins with a repeated
+///           character ("-->", "]]>") stays matched through extra repeats of it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermXmlStream::skipPast(const char* terminator)
+{
+    const unsigned int length = static_cast<unsigned int>(strlen(terminator));
+    unsigned int matched = 0;
+    char c;
+    while (matched < length) {
+        if (not getChar(c)) {
+            raiseError("unexpected end of XML file,", std::string("missing ") + terminator);
+        }
+        if (c == terminator[matched]) {
+            ++matched;
+        } else if (c == terminator[0]) {
+            if (matched < 2 or terminator[1] != terminator[0]) {
+                matched = 1;
+            }
+        } else {
+            matched = 0;
+        }
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  name   (--)  Name of the tag.
+/// @param[in]   first  (--)  First character of the name, already read.
+///
+/// @return   bool  (--)  True if the element is self-closing (<tag/>).
+///
+/// @throw    TsParseException if the file ends inside the tag.
+///
+/// @details  Reads the rest of a start tag through its closing '>', skipping quoted attribute
+///           values so a '>' inside them doesn't end the tag early.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool ThermXmlStream::readTag(std::string& name, char first)
+{
+    name = first;
+    char c     = first;
+    char last  = first;
+    char quote = 0;
+    bool inName = true;
+    for (;;) {
+        if (not getChar(c)) {
+            raiseError("unexpected end of XML file,", "inside tag <" + name + ">.");
+        }
+        if (0 != quote) {
+            if (c == quote) {
+                quote = 0;
+            }
+        } else if ('>' == c) {
+            return '/' == last;
+        } else if ('"' == c or '\'' == c) {
+            quote = c;
+        } else if (inName and (' ' == c or '\t' == c or '\r' == c or '\n' == c or '/' == c)) {
+            inName = false;
+        } else if (inName) {
+            name += c;
+        }
+        if (' ' != c and '\t' != c and '\r' != c and '\n' != c) {
+            last = c;
+        }
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  name  (--)  Name of the tag.
+///
+/// @throw    TsParseException if the file ends inside the tag.
+///
+/// @details  Reads the rest of an end tag through its closing '>'.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermXmlStream::readEndTag(std::string& name)
+{
+    name.clear();
+    char c;
+    for (;;) {
+        if (not getChar(c)) {
+            raiseError("unexpected end of XML file,", "inside end tag </" + name + ">.");
+        }
+        if ('>' == c) {
+            return;
+        } else if (' ' != c and '\t' != c and '\r' != c and '\n' != c) {
+            name += c;
+        }
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  subtype  (--)  Exception subtype.
+/// @param[in]  cause    (--)  Exception cause.
+///
+/// @throw    TsParseException always.
+///
+/// @details  Closes the file and throws, naming the file in the message.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermXmlStream::raiseError(const std::string& subtype, const std::string& cause)
+{
+    const std::string file = mFileName;
+    close();
+    TS_PTCS_ERREX(TsParseException, subtype, file + ": " + cause);
+}
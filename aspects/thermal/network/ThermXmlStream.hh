@@ -0,0 +1,171 @@
+#ifndef ThermXmlStream_EXISTS
+#define ThermXmlStream_EXISTS
+/************************************** TRICK HEADER ***********************************************
+@defgroup TSM_GUNNS_THERMAL_NETWORK_ThermXmlStream Thermal config-file streaming XML reader
+@ingroup  TSM_GUNNS_THERMAL_NETWORK
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+   (The ThermXmlStream reads a thermal XML config-file front to back in fixed-size chunks, and hands
+    its caller one record at a time: each direct child element of the file's root <list>. Only the
+    current record is ever held in memory, and it is only built into a TinyXML element on request,
+    so a file of any size is read in a single sweep with small, bounded memory.)
+
+REFERENCE:
+   ()
+
+ASSUMPTIONS AND LIMITATIONS:
+   (The structure scanner only tracks element nesting, skipping the XML declaration, comments,
+    CDATA and DOCTYPE sections. Everything else about a record's well-formedness is checked by
+    TinyXML when the record is parsed.)
+
+LIBRARY DEPENDENCY:
+   (ThermXmlStream.o)
+
+PROGRAMMERS:
+   ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+@{
+***************************************************************************************************/
+#include "parsing/tinyxml/tinyxml.hh"
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Single-pass record reader for the thermal XML config-files.
+///
+/// @details  The caller opens a file, then loops on nextRecord() until it returns false. Each call
+///           scans forward to the end of the next record under the root element and returns its
+///           tag. The caller may then get the record as a TinyXML element with getElement(), or
+///           just skip it. The stream keeps statistics on the sweep for reporting: bytes read,
+///           records found, the peak bytes held in its buffers, and the elapsed time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class ThermXmlStream
+{
+    TS_MAKE_SIM_COMPATIBLE(ThermXmlStream);
+
+    public:
+        /// @brief  Size of the file read chunks.
+        static const unsigned int CHUNK_SIZE;
+        /// @brief  Default constructs the ThermXmlStream.
+        ThermXmlStream(const std::string& name = "");
+        /// @brief  Default destructs the ThermXmlStream.
+        virtual ~ThermXmlStream();
+        /// @brief  Opens the file and finds its root element.
+        void          open(const std::string& xmlFile, const char* rootTag);
+        /// @brief  Advances to the next record under the root element.
+        bool          nextRecord();
+        /// @brief  Returns the current record as a TinyXML element.
+        TiXmlElement* getElement();
+        /// @brief  Closes the file.
+        void          close();
+        /// @brief  Returns the tag of the current record.
+        const std::string& getTag() const;
+        /// @brief  Returns the text of the current record.
+        const std::string& getRecord() const;
+        /// @brief  Returns the size of the open file.
+        unsigned long getFileSize() const;
+        /// @brief  Returns the number of file bytes read so far.
+        unsigned long getBytesRead() const;
+        /// @brief  Returns the number of records found so far.
+        int           getNumRecords() const;
+        /// @brief  Returns the peak number of bytes held in the stream's buffers.
+        unsigned long getPeakBytes() const;
+        /// @brief  Returns the time the file has been open.
+        double        getElapsedTime() const;
+
+    protected:
+        std::string       mName;         /**< ** (--) trick_chkpnt_io(**) Instance name for messages. */
+        std::string       mFileName;     /**< ** (--) trick_chkpnt_io(**) Name of the open file. */
+        FILE*             mFile;         /**< ** (--) trick_chkpnt_io(**) The open file, or 0. */
+        std::vector<char> mChunk;        /**< ** (--) trick_chkpnt_io(**) Current chunk of the file. */
+        unsigned int      mChunkUsed;    /**< ** (--) trick_chkpnt_io(**) Bytes in the current chunk. */
+        unsigned int      mChunkPos;     /**< ** (--) trick_chkpnt_io(**) Read position in the current chunk. */
+        std::string       mRecord;       /**< ** (--) trick_chkpnt_io(**) Text of the current record. */
+        std::string       mTag;          /**< ** (--) trick_chkpnt_io(**) Tag of the current record. */
+        bool              mCapturing;    /**< ** (--) trick_chkpnt_io(**) Characters read are appended to the record. */
+        bool              mRootClosed;   /**< ** (--) trick_chkpnt_io(**) The end of the root element was reached. */
+        int               mDepth;        /**< ** (--) trick_chkpnt_io(**) Element nesting depth at the read position. */
+        TiXmlDocument     mDoc;          /**< ** (--) trick_chkpnt_io(**) Holds the parsed current record. */
+        unsigned long     mFileSize;     /**< ** (--) trick_chkpnt_io(**) Size of the open file. */
+        unsigned long     mBytesRead;    /**< ** (--) trick_chkpnt_io(**) File bytes read so far. */
+        int               mNumRecords;   /**< ** (--) trick_chkpnt_io(**) Records found so far. */
+        unsigned long     mPeakBytes;    /**< ** (--) trick_chkpnt_io(**) Peak bytes held in the buffers. */
+        double            mStartTime;    /**< ** (s)  trick_chkpnt_io(**) Clock time the file was opened. */
+        double            mElapsedTime;  /**< ** (s)  trick_chkpnt_io(**) Time the file was open, once closed. */
+        /// @brief  Gets the next character from the file.
+        bool getChar(char& c);
+        /// @brief  Skips a declaration, comment, CDATA section or DOCTYPE.
+        void skipMarkup(char first);
+        /// @brief  Skips past the given terminator string.
+        void skipPast(const char* terminator);
+        /// @brief  Reads the name and remainder of a tag, returning whether it is self-closing.
+        bool readTag(std::string& name, char first);
+        /// @brief  Reads the name of an end tag.
+        void readEndTag(std::string& name);
+        /// @brief  Throws a parse exception for the open file.
+        void raiseError(const std::string& subtype, const std::string& cause);
+        /// @brief  Returns the monotonic clock time.
+        static double now();
+
+    private:
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        ThermXmlStream(const ThermXmlStream&);
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        ThermXmlStream& operator=(const ThermXmlStream&);
+};
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   (--)  Tag of the current record.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const std::string& ThermXmlStream::getTag() const
+{
+    return mTag;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   (--)  Text of the current record, from its start tag through its end tag.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const std::string& ThermXmlStream::getRecord() const
+{
+    return mRecord;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   (--)  Size of the open file in bytes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long ThermXmlStream::getFileSize() const
+{
+    return mFileSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   (--)  Number of file bytes read so far.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long ThermXmlStream::getBytesRead() const
+{
+    return mBytesRead;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   (--)  Number of records found so far.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int ThermXmlStream::getNumRecords() const
+{
+    return mNumRecords;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   (--)  Peak number of bytes held in the chunk and record buffers.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long ThermXmlStream::getPeakBytes() const
+{
+    return mPeakBytes;
+}
+
+#endif
@@ -5,12 +5,14 @@
 LIBRARY DEPENDENCY:
 (
     (ThermFileParser.o)
+    (ThermNetworkCache.o)
     (core/Gunns.o)
     (core/GunnsBasicNode.o)
     (aspects/thermal/GunnsThermalCapacitor.o)
     (core/GunnsBasicConductor.o)
     (aspects/thermal/GunnsThermalRadiation.o)
     (aspects/thermal/GunnsThermalHeater.o)
+    (aspects/thermal/GunnsThermalNetworkHeatQueues.o)
     (aspects/thermal/GunnsThermalPanel.o)
     (aspects/thermal/GunnsThermalPotential.o)
     (aspects/thermal/GunnsThermalSource.o)
@@ -24,6 +26,51 @@ LIBRARY DEPENDENCY:
 #include "math/UnitConversion.hh"
 #include "aspects/thermal/PtcsMacros.hh"
 #include "math/MsMath.hh" //needed for MsMath::isInRange() in setHeaterPowers()
+#include <algorithm>
+#include <pthread.h>
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    A contiguous chunk of one link type's links, initialized together on one thread.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct ThermalNetworkLinkChunk
+{
+    ThermalNetwork*              mNetwork;    /**< (--) network owning the links */
+    void (ThermalNetwork::*mInitialize) (int, std::vector<GunnsBasicLink*>&); /**< (--) link initialize sub-function */
+    int                          mBegin;      /**< (--) index of the first link in the chunk */
+    int                          mEnd;        /**< (--) index past the last link in the chunk */
+    std::vector<GunnsBasicLink*> mLinks;      /**< (--) links in the order they registered */
+    std::vector<int>             mFailed;     /**< (--) indexes of the links that failed to initialize */
+    bool                         mAborted;    /**< (--) an unexpected exception stopped the chunk */
+
+    ThermalNetworkLinkChunk()
+        : mNetwork(0), mInitialize(0), mBegin(0), mEnd(0), mLinks(), mFailed(), mAborted(false) {}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  arg  (--)  pointer to the ThermalNetworkLinkChunk to initialize
+///
+/// @return   void*  (--)  always null
+///
+/// @details  Thread function that initializes each link in a chunk.  Link initialization failures
+///           are flagged for the network to report.  Nothing can be thrown out of a thread, so any
+///           other exception stops the chunk.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void* buildLinkChunk(void* arg)
+{
+    ThermalNetworkLinkChunk* chunk = static_cast<ThermalNetworkLinkChunk*>(arg);
+    try {
+        for (int i = chunk->mBegin; i < chunk->mEnd; ++i) {
+            try {
+                (chunk->mNetwork->*chunk->mInitialize)(i, chunk->mLinks);
+            } catch (TsInitializationException&) {
+                chunk->mFailed.push_back(i);
+            }
+        }
+    } catch (...) {
+        chunk->mAborted = true;
+    }
+    return 0;
+}
+
 /**************************************************************************************************/
 /* ConfigData class */
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +80,9 @@ LIBRARY DEPENDENCY:
 /// @param[in]  htrFile   (--)  xml file with heater link data
 /// @param[in]  panFile   (--)  xml file with thermal-panel data
 /// @param[in]  etcFile   (--)  xml file with other thermal link data (potentials, sources, etc)
+/// @param[in]  cacheFile (--)  compiled network cache file, or empty to always parse the xml files
+/// @param[in]  initThreads            (--)  number of threads that initialize the links
+/// @param[in]  heatQueueFluxIndex     (--)  capacitor external heat flux index given the queued heat, -1 for none
 ///
 /// @details    Constructs this ThermalNetwork configuration data.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -42,14 +92,20 @@ ThermalNetworkConfigData::ThermalNetworkConfigData(
         std::string radFile,
         std::string htrFile,
         std::string panFile,
-        std::string etcFile)
+        std::string etcFile,
+        std::string cacheFile,
+        const int    initThreads,
+        const int    heatQueueFluxIndex)
     :
     cNodeFile(nodeFile),
     cCondFile(condFile),
     cRadFile(radFile),
     cHtrFile(htrFile),
     cPanFile(panFile),
-    cEtcFile(etcFile)
+    cEtcFile(etcFile),
+    cCacheFile(cacheFile),
+    cInitThreads(initThreads),
+    cHeatQueueFluxIndex(heatQueueFluxIndex)
 {
     // nothing to do
 }
@@ -65,7 +121,10 @@ ThermalNetworkConfigData::ThermalNetworkConfigData(const ThermalNetworkConfigDat
     cRadFile(that.cRadFile),
     cHtrFile(that.cHtrFile),
     cPanFile(that.cPanFile),
-    cEtcFile(that.cEtcFile)
+    cEtcFile(that.cEtcFile),
+    cCacheFile(that.cCacheFile),
+    cInitThreads(that.cInitThreads),
+    cHeatQueueFluxIndex(that.cHeatQueueFluxIndex)
 {
     // nothing to do
 }
@@ -137,10 +196,15 @@ ThermalNetwork::ThermalNetwork(const std::string& name)
     mMalfHtrIndexValue(0),
     mHtrPowerElectrical(0),
     parser(name + ".parser"),
+    cache(name + ".cache"),
+    mRadiationBlock(name + ".mRadiationBlock"),
+    mHeatQueues(netNodeList, netLinks),
     netIslandAnalyzer(netNodeList),
     numCapEditGroups(0),
     mCapEditScaleFactor(0),
     mCapEditScalePrev(0),
+    mCapEditGroupStart(),
+    mCapEditGroupLinks(),
     pNodes(0),
     indexSpaceNode(0),
     numLinksCap(0),
@@ -204,8 +268,12 @@ void ThermalNetwork::initNodes(const std::string& name)
     parser.mThermInputFile    = mInput.iThermInputFile;
     parser.mThermInputFileRad = mInput.iInputRadFile;
 
-    /// - Populate the parser's C++ vectors with data from the config-files.
-    parser.initialize(mName + ".parser");
+    /// - Populate the parser's C++ vectors from the compiled cache if it is current, otherwise
+    ///   with data from the config-files, then compile them into the cache for the next run.
+    if (not cache.load(mConfig.cCacheFile, parser)) {
+        parser.initialize(mName + ".parser");
+        cache.save(mConfig.cCacheFile, parser);
+    }
 
     /// - Set the number of capacitance-edit groups.
     numCapEditGroups = parser.vCapEditGroupList.size();
@@ -232,11 +300,25 @@ void ThermalNetwork::initNetwork()
     /// - Initialize the link objects at their ports with correct config/input data.
     buildLinks();
 
+    /// - Gather the radiation links into the block that evaluates their conductivities together.
+    mRadiationBlock.initialize(netNodeList, mRadiationLinks, numLinksRad);
+
+    /// - List the capacitor links in each edit group, so edits only visit their own group.
+    buildCapacitanceGroups();
+
     /// - Initialize the island analyzer spotter.
     GunnsBasicIslandAnalyzerConfigData config(mName + ".netIslandAnalyzer");
     GunnsBasicIslandAnalyzerInputData input;
     netIslandAnalyzer.initialize(&config, &input);
 
+    /// - Initialize the heat queues spotter, if enabled, now that the capacitor links are built.
+    if (mConfig.cHeatQueueFluxIndex >= 0) {
+        GunnsThermalNetworkHeatQueuesConfigData queuesConfig(mName + ".mHeatQueues",
+                                                             mConfig.cHeatQueueFluxIndex);
+        GunnsThermalNetworkHeatQueuesInputData  queuesInput;
+        mHeatQueues.initialize(&queuesConfig, &queuesInput);
+    }
+
     if (not netIsSubNetwork) {
         /// - Construct the Gunns network config.
         GunnsConfigData NetworkConfig(mName, // network name
@@ -299,7 +381,7 @@ void ThermalNetwork::restart()
 /// @param[in]  timeStep  (s)  integration time step
 ///
 /// @details    Updates the pre-solution functions including heater power, capacitor group edits,
-///             and spotters.
+///             queued heat, radiation conductivities and spotters.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void ThermalNetwork::stepSpottersPre(const double timeStep)
 {
@@ -309,6 +391,15 @@ void ThermalNetwork::stepSpottersPre(const double timeStep)
     /// - Perform capacitor group edits.
     editCapacitanceGroups();
 
+    /// - Give the heat queued by other models to the capacitor links.
+    if (mHeatQueues.isInitialized()) {
+        mHeatQueues.stepPreSolver(timeStep);
+    }
+
+    /// - Evaluate the radiation links' conductivities from the last solution, for the links to
+    ///   pick up when the solver steps them.
+    mRadiationBlock.update();
+
     /// - Call the island analyzer pre-solultion update.
     netIslandAnalyzer.stepPreSolver(timeStep);
 }
@@ -825,39 +916,79 @@ void ThermalNetwork::buildLinks()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  linkType  (--)  name of the given link-type
 /// @param[in]  total     (--)  total number of links in the network of the given type
-/// @param[in]  pf        (--)  A pointer to a void function that takes an int. Used to represent
-///                             one of the seven initializeLink() methods.
+/// @param[in]  pf        (--)  A pointer to a void function that takes an int and a links list.
+///                             Used to represent one of the seven initializeLink() methods.
+///
+/// @throws   TsInitializationException
 ///
-/// @details  Uses a function pointer to call the initialize sub-function for each link type.
+/// @details  Uses a function pointer to call the initialize sub-function for each link type, in two
+///           phases.  First the links are split into cInitThreads contiguous chunks, and each chunk
+///           is initialized on its own thread into the preallocated link array.  Each link adds
+///           itself to its chunk's own list rather than netLinks, and failures are only flagged.
+///
+///           Then the chunks' lists are appended to netLinks and the failures are reported in chunk
+///           order on this thread, so the network's links and warnings are in the same order as if
+///           the links were initialized one after another.  A chunk whose thread can't be started
+///           is initialized on this thread.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void ThermalNetwork::buildLinkType(const char* linkType,             // name of link type
                                    const int total,                  // number of links of this type
-                                   void (ThermalNetwork::*pf) (int)  // pointer to member function
+                                   void (ThermalNetwork::*pf) (int, std::vector<GunnsBasicLink*>&)
                                   )
 {
-    /// - Loop through the given number of links.
-    for(int i = 0; i < total; ++i)
-    {
-        try
-        {
-            /// - Call the method provided by the function-pointer "pf".
-            ///   This function is of the form: void initialize________Link(int i).
-            (this->*pf)(i);
+    if (total < 1) {
+        return;
+    }
 
-        } catch (TsInitializationException& e)
-        {
-            /// - Send warning report on link initialization failure.
-            TS_PTCS_WARNING(linkType << " link " << i << ": Exception while initializing.");
+    /// - Split the links into contiguous chunks, one per thread.
+    const int numChunks = std::max(1, std::min(mConfig.cInitThreads, total));
+    std::vector<ThermalNetworkLinkChunk> chunks(numChunks);
+    for (int chunk = 0; chunk < numChunks; ++chunk) {
+        chunks[chunk].mNetwork    = this;
+        chunks[chunk].mInitialize = pf;
+        chunks[chunk].mBegin      = chunk * total / numChunks;
+        chunks[chunk].mEnd        = (chunk + 1) * total / numChunks;
+    }
+
+    /// - Initialize the other chunks on their own threads, and the first chunk on this thread.
+    std::vector<pthread_t> threads(numChunks);
+    std::vector<int>       started(numChunks, 0);
+    for (int chunk = 1; chunk < numChunks; ++chunk) {
+        started[chunk] = (0 == pthread_create(&threads[chunk], 0, buildLinkChunk, &chunks[chunk]));
+    }
+    for (int chunk = 0; chunk < numChunks; ++chunk) {
+        if (not started[chunk]) {
+            buildLinkChunk(&chunks[chunk]);
+        }
+    }
+    for (int chunk = 1; chunk < numChunks; ++chunk) {
+        if (started[chunk]) {
+            pthread_join(threads[chunk], 0);
+        }
+    }
+
+    /// - Register the links and send warning reports on link initialization failures, in order.
+    bool aborted = false;
+    for (int chunk = 0; chunk < numChunks; ++chunk) {
+        netLinks.insert(netLinks.end(), chunks[chunk].mLinks.begin(), chunks[chunk].mLinks.end());
+        for (unsigned int j = 0; j < chunks[chunk].mFailed.size(); ++j) {
+            TS_PTCS_WARNING(linkType << " link " << chunks[chunk].mFailed[j]
+                                     << ": Exception while initializing.");
         }
+        aborted = aborted or chunks[chunk].mAborted;
     }
 
+    /// - Throw an exception if a link stopped its chunk with an unexpected exception.
+    TS_PTCS_IF_ERREX(aborted, TsInitializationException,
+            "invalid init data,", std::string(linkType) + " link initialization aborted.");
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]  i  (--)  index of specific link within Capacitance arrays
+/// @param[in]      i      (--)  index of specific link within Capacitance arrays
+/// @param[in,out]  links  (--)  list the link adds itself to
 ///
 /// @details  Sub-function to initialize a specific Capacitance link
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermalNetwork::initializeCap(int i)
+void ThermalNetwork::initializeCap(int i, std::vector<GunnsBasicLink*>& links)
 {
     /// - Get the node number of the link's port0.
     const int port0 = parser.vCapPorts.at(i) + netSuperNodesOffset;
@@ -868,16 +999,17 @@ void ThermalNetwork::initializeCap(int i)
     /// - Initialize the link with its corresponding data.
     mCapacitanceLinks[i].initialize(*mCapacitanceConfigData[i],
                                     *mCapacitanceInputData[i],
-                                    netLinks,
+                                    links,
                                     port0,
                                     port1);
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]  i  (--)  index of specific link within Conduction arrays
+/// @param[in]      i      (--)  index of specific link within Conduction arrays
+/// @param[in,out]  links  (--)  list the link adds itself to
 ///
 /// @details  Sub-function to initialize a specific Conduction link
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermalNetwork::initializeCond(int i)
+void ThermalNetwork::initializeCond(int i, std::vector<GunnsBasicLink*>& links)
 {
     /// - Get the node number of the link's port0 and port1.
     const int port0 = parser.vCondPorts0.at(i) + netSuperNodesOffset;
@@ -886,16 +1018,17 @@ void ThermalNetwork::initializeCond(int i)
     /// - Initialize the link with its corresponding data.
     mConductionLinks[i].initialize(*mConductionConfigData[i],
                                    *mConductionInputData[i],
-                                   netLinks,
+                                   links,
                                    port0,
                                    port1);
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]  i  (--)  index of specific link within Radiation arrays
+/// @param[in]      i      (--)  index of specific link within Radiation arrays
+/// @param[in,out]  links  (--)  list the link adds itself to
 ///
 /// @details  Sub-function to initialize a specific Radiation link
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermalNetwork::initializeRad(int i)
+void ThermalNetwork::initializeRad(int i, std::vector<GunnsBasicLink*>& links)
 {
     /// - Get the node number of the link's port0 and port1.
     const int port0 = parser.vRadPorts0.at(i) + netSuperNodesOffset;
@@ -904,19 +1037,20 @@ void ThermalNetwork::initializeRad(int i)
     /// - Initialize the link with its corresponding data.
     mRadiationLinks[i].initialize(*mRadiationConfigData[i],
                                   *mRadiationInputData[i],
-                                  netLinks,
+                                  links,
                                   port0,
                                   port1);
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]  i  (--)  index of specific link within Heater arrays
+/// @param[in]      i      (--)  index of specific link within Heater arrays
+/// @param[in,out]  links  (--)  list the link adds itself to
 ///
 /// @details  Sub-function to initialize a specific Heater link. As an argument to its initialize()
 ///           method, a GunnsThermalHeater takes a pointer to a vector of ints. This vector should
 ///           contain the numbers of all the nodes to which the heater is connected. The size of
 ///           the vector should match the size of the power-draw fraction loaded into config data.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermalNetwork::initializeHtr(int i)
+void ThermalNetwork::initializeHtr(int i, std::vector<GunnsBasicLink*>& links)
 {
     /// - Create a temporary ports vector from the heater port numbers at index i.
     std::vector<int>* ports = &parser.vHtrPorts.at(i);
@@ -927,15 +1061,16 @@ void ThermalNetwork::initializeHtr(int i)
     /// -Initialize the link with its corresponding data.
     mHeaters[i].initialize(*mHeaterConfigData[i],
                            *mHeaterInputData[i],
-                           netLinks,
+                           links,
                            ports);
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]  i  (--)  index of specific link within Panel arrays
+/// @param[in]      i      (--)  index of specific link within Panel arrays
+/// @param[in,out]  links  (--)  list the link adds itself to
 ///
 /// @details  Sub-function to initialize a specific Panel link
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermalNetwork::initializePan(int i)
+void ThermalNetwork::initializePan(int i, std::vector<GunnsBasicLink*>& links)
 {
     /// - Create a temporary ports vector from the panel port numbers at index i.
     std::vector<int>* ports = &parser.vPanPorts.at(i);
@@ -946,15 +1081,16 @@ void ThermalNetwork::initializePan(int i)
     /// - Initialize the link with its corresponding data.
     mPanels[i].initialize(*mPanelConfigData[i],
                           *mPanelInputData[i],
-                          netLinks,
+                          links,
                           ports);
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]  i  (--)  index of specific link within Potential arrays
+/// @param[in]      i      (--)  index of specific link within Potential arrays
+/// @param[in,out]  links  (--)  list the link adds itself to
 ///
 /// @details  Sub-function to initialize a specific Potential link
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermalNetwork::initializePot(int i)
+void ThermalNetwork::initializePot(int i, std::vector<GunnsBasicLink*>& links)
 {
     /// - Potential links have a port0 always at SPACE (the very last node).
     const int port0 = indexSpaceNode;
@@ -965,16 +1101,17 @@ void ThermalNetwork::initializePot(int i)
     /// - Initialize the link with its corresponding data.
     mPotentialLinks[i].initialize(*mPotentialConfigData[i],
                                   *mPotentialInputData[i],
-                                  netLinks,
+                                  links,
                                   port0,
                                   port1);
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @param[in]  i  (--)  index of specific link within Source arrays
+/// @param[in]      i      (--)  index of specific link within Source arrays
+/// @param[in,out]  links  (--)  list the link adds itself to
 ///
 /// @details  Sub-function to initialize a specific Source link
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void ThermalNetwork::initializeSrc(int i)
+void ThermalNetwork::initializeSrc(int i, std::vector<GunnsBasicLink*>& links)
 {
     /// - Create a temporary ports vector from the heater port numbers at index i.
     std::vector<int>* ports = &parser.vSrcPorts.at(i);
@@ -985,7 +1122,7 @@ void ThermalNetwork::initializeSrc(int i)
     /// - Initialize the link with its corresponding data.
     mSources[i].initialize(*mSourceConfigData[i],
                            *mSourceInputData[i],
-                           netLinks,
+                           links,
                            ports);
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1010,10 +1147,23 @@ void ThermalNetwork::validate()
     /// - Throw an exception if numCapEditGroups is not >= 0.
     TS_PTCS_IF_ERREX(numCapEditGroups < 0, TsInitializationException,
             "invalid init data,", "numCapEditGroups < 0.");
+
+    /// - Throw an exception if there are no link initialization threads.
+    TS_PTCS_IF_ERREX(mConfig.cInitThreads < 1, TsInitializationException,
+            "invalid config data,", "cInitThreads < 1.");
+
+    /// - Throw an exception on a heat queue flux index out of the capacitors' range.
+    TS_PTCS_IF_ERREX(mConfig.cHeatQueueFluxIndex >= GunnsThermalCapacitor::NUM_EXT_HEATFLUXES,
+            TsInitializationException, "invalid config data,",
+            "cHeatQueueFluxIndex >= GunnsThermalCapacitor::NUM_EXT_HEATFLUXES.");
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Loops through each heater, setting its electrical power. If the HtrMiswire malf is
 ///           active, a heater might receive power from the incorrect electrical circuit.
+///
+///           The power is compared with the heater's own power, and only differing powers are set,
+///           so the heater objects aren't written while their power is steady.  A power written
+///           directly to the heater, e.g. by the sim bus, is still overridden on the next step.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void ThermalNetwork::setHeaterPowers()
 {
@@ -1038,8 +1188,12 @@ void ThermalNetwork::setHeaterPowers()
                 mMalfHtrIndexValue[i] = i;
             }
         }
-        /// - Set the heater's electrical power.
-        mHeaters[i].setPowerElectrical( mHtrPowerElectrical[index] );
+        /// - Set the heater's electrical power if it changed.
+        const double power = mHtrPowerElectrical[index];
+        if (power != mHeaters[i].getPowerElectrical())
+        {
+            mHeaters[i].setPowerElectrical(power);
+        }
     }
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1101,14 +1255,49 @@ void ThermalNetwork::restartCapacitanceGroups()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void ThermalNetwork::applyCapacitanceGroups(int group, double ratio)
 {
-        for (int i = 0; i < numLinksCap; ++i)
+        /// - Only the links listed in the group are visited.  Their new capacitance changes their
+        ///   admittance on their next step, which flags the solver to rebuild.
+        for (int k = mCapEditGroupStart[group]; k < mCapEditGroupStart[group + 1]; ++k)
         {
-            if (mCapacitanceLinks[i].getEditCapacitanceGroup() == group)
-            {
-                /// - Apply ratio to capacitance
-                mCapacitanceLinks[i].setCapacitance(ratio * mCapacitanceLinks[i].getCapacitance());
-            }
+            const int i = mCapEditGroupLinks[k];
+
+            /// - Apply ratio to capacitance
+            mCapacitanceLinks[i].setCapacitance(ratio * mCapacitanceLinks[i].getCapacitance());
+        }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Lists the capacitor links in each capacitance edit group, in link order, as one array
+///           of link indexes with the start of each group's list in another.  Links not in a valid
+///           group aren't listed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void ThermalNetwork::buildCapacitanceGroups()
+{
+    /// - Count the links in each group.
+    mCapEditGroupStart.assign(numCapEditGroups + 1, 0);
+    for (int i = 0; i < numLinksCap; ++i)
+    {
+        const int group = mCapacitanceLinks[i].getEditCapacitanceGroup();
+        if (MsMath::isInRange(0, group, numCapEditGroups-1))
+        {
+            ++mCapEditGroupStart[group + 1];
         }
+    }
+    for (int group = 0; group < numCapEditGroups; ++group)
+    {
+        mCapEditGroupStart[group + 1] += mCapEditGroupStart[group];
+    }
+
+    /// - Fill in the lists.
+    mCapEditGroupLinks.resize(mCapEditGroupStart[numCapEditGroups]);
+    std::vector<int> next(mCapEditGroupStart.begin(), mCapEditGroupStart.end() - 1);
+    for (int i = 0; i < numLinksCap; ++i)
+    {
+        const int group = mCapacitanceLinks[i].getEditCapacitanceGroup();
+        if (MsMath::isInRange(0, group, numCapEditGroups-1))
+        {
+            mCapEditGroupLinks[next[group]++] = i;
+        }
+    }
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Deletes allocated arrays and config/input objects
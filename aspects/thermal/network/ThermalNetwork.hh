@@ -35,6 +35,10 @@ REFERENCE:
 ASSUMPTIONS AND LIMITATIONS:
     (The paths of the config-files must be given relative to the location of the actual
     executable, usually in the same directory as the S_define.)
+    (With cInitThreads > 1 the links of each type are initialized on that many threads, so the
+    link types' initialize methods must only modify their own link.)
+    (With cHeatQueueFluxIndex >= 0, the network heat queues add the heat queued by other models to
+    that external heat flux of the capacitor links, before each solver step.)
 
 LIBRARY DEPENDENCY:
     ((ThermalNetwork.o))
@@ -52,12 +56,14 @@ PROGRAMMERS:
 ***************************************************************************************************/
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "aspects/thermal/network/ThermFileParser.hh"
+#include "aspects/thermal/network/ThermNetworkCache.hh"
 #include "core/Gunns.hh"
 #include "core/GunnsBasicNode.hh"
 #include "aspects/thermal/GunnsThermalCapacitor.hh"
 #include "core/GunnsBasicConductor.hh"
 #include "aspects/thermal/GunnsThermalRadiation.hh"
 #include "aspects/thermal/GunnsThermalHeater.hh"
+#include "aspects/thermal/GunnsThermalNetworkHeatQueues.hh"
 #include "aspects/thermal/GunnsThermalPanel.hh"
 #include "aspects/thermal/GunnsThermalPotential.hh"
 #include "aspects/thermal/GunnsThermalSource.hh"
@@ -75,12 +81,15 @@ class ThermalNetworkWingMan;
 class ThermalNetworkConfigData
 {
     public:
-        std::string  cNodeFile; /**< (--) trick_chkpnt_io(**) name of xml file with node & capacitance link data */
-        std::string  cCondFile; /**< (--) trick_chkpnt_io(**) name of xml file with conduction link data */
-        std::string  cRadFile;  /**< (--) trick_chkpnt_io(**) name of xml file with radiation link data */
-        std::string  cHtrFile;  /**< (--) trick_chkpnt_io(**) name of xml file with heater/source link data */
-        std::string  cPanFile;  /**< (--) trick_chkpnt_io(**) name of xml file with thermal-panel data */
-        std::string  cEtcFile;  /**< (--) trick_chkpnt_io(**) name of xml file with other thermal link data */
+        std::string  cNodeFile;  /**< (--) trick_chkpnt_io(**) name of xml file with node & capacitance link data */
+        std::string  cCondFile;  /**< (--) trick_chkpnt_io(**) name of xml file with conduction link data */
+        std::string  cRadFile;   /**< (--) trick_chkpnt_io(**) name of xml file with radiation link data */
+        std::string  cHtrFile;   /**< (--) trick_chkpnt_io(**) name of xml file with heater/source link data */
+        std::string  cPanFile;   /**< (--) trick_chkpnt_io(**) name of xml file with thermal-panel data */
+        std::string  cEtcFile;   /**< (--) trick_chkpnt_io(**) name of xml file with other thermal link data */
+        std::string  cCacheFile; /**< (--) trick_chkpnt_io(**) name of compiled network cache file, empty for none */
+        int          cInitThreads;            /**< (--) trick_chkpnt_io(**) number of threads that initialize the links, 1 to initialize them serially */
+        int          cHeatQueueFluxIndex;     /**< (--) trick_chkpnt_io(**) capacitor external heat flux index the network heat queues give their heat to, -1 for no heat queues */
 
         /// @brief   Default constructs this ThermalNetwork configuration data.
         ThermalNetworkConfigData(std::string nodeFile = "",
@@ -88,7 +97,10 @@ class ThermalNetworkConfigData
                                  std::string radFile = "",
                                  std::string htrFile = "",
                                  std::string panFile = "",
-                                 std::string etcFile = "");
+                                 std::string etcFile = "",
+                                 std::string cacheFile = "",
+                                 const int    initThreads            = 1,
+                                 const int    heatQueueFluxIndex     = -1);
         /// @brief   Default destructs this ThermalNetwork configuration data.
         ~ThermalNetworkConfigData();
         /// @brief   Copy constructs this ThermalNetwork configuration data.
@@ -197,6 +209,8 @@ class ThermalNetwork : public GunnsNetworkBase
         void setIslandMode(const Gunns::IslandMode mode);
         /// @brief Sets and resets the heater miswire malfunction.
         void setMalfHtrMiswire(const bool flag = false, const int* index = 0);
+        /// @brief Returns the heat queues that other models queue heat into the network with.
+        GunnsThermalNetworkHeatQueues& getHeatQueues();
 
    protected:
         /// @details  The mHtrPowerElectrical array will be set by the simbus with values from EPS.
@@ -205,6 +219,9 @@ class ThermalNetwork : public GunnsNetworkBase
         ThermFileParser parser;              /**< ** (--) trick_chkpnt_io(**) Parser object with methods to read XML config-files;
                                                                               Stores GUNNS link configuration data into
                                                                               vectors that ThermalNetwork can access.*/
+        ThermNetworkCache cache;             /**< ** (--) trick_chkpnt_io(**) Compiled binary cache of the parser's data. */
+        GunnsThermalRadiationBlock mRadiationBlock; /**< ** (--) trick_chkpnt_io(**) Batched conductivity of the radiation links. */
+        GunnsThermalNetworkHeatQueues mHeatQueues;  /**< ** (--) trick_chkpnt_io(**) Heat queued into the capacitor links by other models. */
 
         GunnsBasicIslandAnalyzer netIslandAnalyzer; /**< (--)                 Island analyzer for debugging */
 
@@ -213,6 +230,8 @@ class ThermalNetwork : public GunnsNetworkBase
         int     numCapEditGroups;            /**< *o (--) trick_chkpnt_io(**) Number of capacitor link capacitance edit groups    */
         double* mCapEditScaleFactor;         /**<    (--) trick_chkpnt_io(**) Capacitance edit scale factor control by edit group */
         double* mCapEditScalePrev;           /**<    (--) trick_chkpnt_io(**) Previous capacitance edit scale factor control      */
+        std::vector<int> mCapEditGroupStart; /**< ** (--) trick_chkpnt_io(**) Start of each edit group in mCapEditGroupLinks   */
+        std::vector<int> mCapEditGroupLinks; /**< ** (--) trick_chkpnt_io(**) Capacitor link indexes in each edit group        */
 
         /// - GUNNS core network objects
         /////////////////////////////////////////////////////////////////////////////////////////////
@@ -262,22 +281,23 @@ class ThermalNetwork : public GunnsNetworkBase
         /// @brief  Initializes arrays for links of each type.
         void buildLinks();
         /// @brief  Uses a function pointer to call the initialize sub-function for each link type
-        void buildLinkType(const char* linkType, const int total, void (ThermalNetwork::*pf) (int) );
+        void buildLinkType(const char* linkType, const int total,
+                           void (ThermalNetwork::*pf) (int, std::vector<GunnsBasicLink*>&) );
 
         /// @brief  Sub-function to initialize a specific Capacitance link
-        void initializeCap(int i);
+        void initializeCap(int i, std::vector<GunnsBasicLink*>& links);
         /// @brief  Sub-function to initialize a specific Conduction link
-        void initializeCond(int i);
+        void initializeCond(int i, std::vector<GunnsBasicLink*>& links);
         /// @brief  Sub-function to initialize a specific Radiation link
-        void initializeRad(int i);
+        void initializeRad(int i, std::vector<GunnsBasicLink*>& links);
         /// @brief  Sub-function to initialize a specific Heater link
-        void initializeHtr(int i);
+        void initializeHtr(int i, std::vector<GunnsBasicLink*>& links);
         /// @brief  Sub-function to initialize a specific Panel link
-        void initializePan(int i);
+        void initializePan(int i, std::vector<GunnsBasicLink*>& links);
         /// @brief  Sub-function to initialize a specific Potential link
-        void initializePot(int i);
+        void initializePot(int i, std::vector<GunnsBasicLink*>& links);
         /// @brief  Sub-function to initialize a specific Source link
-        void initializeSrc(int i);
+        void initializeSrc(int i, std::vector<GunnsBasicLink*>& links);
 
         /// @brief  Loops through each heater, setting its electrical power.
         void setHeaterPowers();
@@ -289,6 +309,8 @@ class ThermalNetwork : public GunnsNetworkBase
         void restartCapacitanceGroups();
         /// @brief  Applies link capacitance scales.
         void applyCapacitanceGroups(int group, double ratio);
+        /// @brief  Lists the capacitor links in each capacitance edit group.
+        void buildCapacitanceGroups();
         /// @brief  Deletes allocated arrays and config/input objects.
         void cleanUp();
 
@@ -332,4 +354,16 @@ inline void ThermalNetwork::setIslandMode(const Gunns::IslandMode mode)
     netSolver.setIslandMode(mode);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  GunnsThermalNetworkHeatQueues&  (--)  The network's heat queues.
+///
+/// @details  Heat is queued by the node's index in the solver's node list, which for a sub-network
+///           includes its offset in the super-network.  The queues only accept heat when
+///           mConfig.cHeatQueueFluxIndex enables them.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline GunnsThermalNetworkHeatQueues& ThermalNetwork::getHeatQueues()
+{
+    return mHeatQueues;
+}
+
 #endif // ThermalNetwork_EXISTS
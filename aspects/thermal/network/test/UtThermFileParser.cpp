@@ -8,6 +8,9 @@
 #include "UtThermFileParser.hh"
 #include "software/exceptions/TsParseException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
+#include <cstdio>
+#include <ctime>
+#include <fstream>
 #include <iostream>
 #include <string>
 
@@ -273,7 +276,7 @@ void UtThermFileParser::testConstruction()
     /// @test  Node data
     CPPUNIT_ASSERT_EQUAL_MESSAGE("numNodes",   0, article.numNodes );
     CPPUNIT_ASSERT_EQUAL_MESSAGE("vNodeNames", 0, static_cast<int>(article.vNodeNames.size()) );
-    CPPUNIT_ASSERT_EQUAL_MESSAGE("mNodeMap",   0, static_cast<int>(article.mNodeMap.size()) );
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("mNodeIndex", 0, article.mNodeIndex.size() );
 
     /// @test  Capacitance link data
     CPPUNIT_ASSERT_EQUAL_MESSAGE("numLinksCap", 0, article.numLinksCap );
@@ -623,3 +626,110 @@ void UtThermFileParser::testThermInput()
 
     std::cout << " Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests node & cap-edit group name resolution on a synthetic 10k-node/100k-link model,
+///           including the warnings for repeated node and group names, and reports the parse time
+///           and the time to resolve every link port name again.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermFileParser::testLargeModel()
+{
+    std::cout << "\n ThermFileParser 13: Testing large model ........................";
+
+    const int         numNodes  = 10000;
+    const int         numGroups = 100;
+    const int         numLinks  = 50000;
+    const std::string nodeFile  = "UtThermFileParser_nodes.xml";
+    const std::string condFile  = "UtThermFileParser_cond.xml";
+    const std::string radFile   = "UtThermFileParser_rad.xml";
+
+    /// - Node-file with a repeated node and group, which are skipped, and the space node last.
+    std::ofstream nodes(nodeFile.c_str());
+    nodes << "<list>\n<capEditing>\n";
+    for (int i = 0; i < numGroups; ++i) {
+        nodes << "<group>GROUP_" << i << "</group>\n";
+    }
+    nodes << "<group>GROUP_0</group>\n</capEditing>\n";
+    for (int i = 0; i < numNodes - 1; ++i) {
+        nodes << "<node><name>STRUCT_" << i << "</name><temperature>300</temperature>"
+              << "<capacitance>" << 100 + i << "</capacitance><editGroup>GROUP_" << i % numGroups
+              << "</editGroup></node>\n";
+    }
+    nodes << "<node><name>STRUCT_7</name><temperature>300</temperature>"
+          << "<capacitance>1</capacitance></node>\n";
+    nodes << "<node><name>SPACE</name><temperature>3</temperature>"
+          << "<capacitance>0</capacitance></node>\n</list>\n";
+    nodes.close();
+
+    /// - Cond & rad files, each link between pseudo-random nodes.
+    std::ofstream cond(condFile.c_str());
+    std::ofstream rad(radFile.c_str());
+    cond << "<list>\n";
+    rad  << "<list>\n";
+    unsigned int seed = 1;
+    for (int i = 0; i < numLinks; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        const int node0 = (seed >> 8) % (numNodes - 1);
+        const int node1 = (node0 + 1 + i % 97) % (numNodes - 1);
+        cond << "<conduction><node0>STRUCT_" << node0 << "</node0><node1>STRUCT_" << node1
+             << "</node1><conductivity>1.5</conductivity></conduction>\n";
+        rad  << "<radiation><node0>STRUCT_" << node1 << "</node0><node1>"
+             << ((0 == i % 10) ? std::string("SPACE") : "STRUCT_" + std::string(1, '0' + i % 10))
+             << "</node1><coefficient>0.5</coefficient></radiation>\n";
+    }
+    cond << "</list>\n";
+    rad  << "</list>\n";
+    cond.close();
+    rad.close();
+
+    /// - Parse the files.
+    FriendlyThermFileParser article;
+    article.mNodeFile = nodeFile;
+    article.mCondFile = condFile;
+    article.mRadFile  = radFile;
+    timespec start;
+    timespec stop;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    CPPUNIT_ASSERT_NO_THROW(article.initialize("article_large"));
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+    const double parseTime = (stop.tv_sec - start.tv_sec) + 1.0e-9 * (stop.tv_nsec - start.tv_nsec);
+
+    /// @test  The repeated node & group were skipped, and everything else registered.
+    CPPUNIT_ASSERT_EQUAL(numNodes,     article.numNodes);
+    CPPUNIT_ASSERT_EQUAL(numNodes - 1, article.numLinksCap);
+    CPPUNIT_ASSERT_EQUAL(numGroups,    static_cast<int>(article.vCapEditGroupList.size()));
+    CPPUNIT_ASSERT_EQUAL(numLinks,     article.numLinksCond);
+    CPPUNIT_ASSERT_EQUAL(numLinks,     article.numLinksRad);
+    CPPUNIT_ASSERT(1007.0 == article.vCapCapacitances.at(907));
+    CPPUNIT_ASSERT_EQUAL(7,            article.vCapEditGroupIdentifiers.at(907));
+    CPPUNIT_ASSERT_EQUAL(numNodes - 1, article.getMapLocation("SPACE"));
+    CPPUNIT_ASSERT_EQUAL(1234,         article.getMapLocation("STRUCT_1234"));
+    CPPUNIT_ASSERT_EQUAL(ThermFileParser::NOT_FOUND, article.getMapLocation("STRUCT_10000"));
+    CPPUNIT_ASSERT_EQUAL(numNodes - 1, article.vRadPorts1.at(0));
+    CPPUNIT_ASSERT_EQUAL(3,            article.vRadPorts1.at(3));
+
+    /// - Resolve every link port name again, to time the lookups on their own.
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    int sum = 0;
+    for (int i = 0; i < numLinks; ++i) {
+        sum += article.getMapLocation(article.vNodeNames[article.vCondPorts0[i]]);
+        sum -= article.getMapLocation(article.vNodeNames[article.vCondPorts1[i]]);
+        sum += article.getMapLocation(article.vNodeNames[article.vRadPorts0[i]]);
+        sum -= article.getMapLocation(article.vNodeNames[article.vRadPorts1[i]]);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+    const double lookupTime = (stop.tv_sec - start.tv_sec) + 1.0e-9 * (stop.tv_nsec - start.tv_nsec);
+    int expected = 0;
+    for (int i = 0; i < numLinks; ++i) {
+        expected += article.vCondPorts0[i] - article.vCondPorts1[i]
+                  + article.vRadPorts0[i]  - article.vRadPorts1[i];
+    }
+    CPPUNIT_ASSERT_EQUAL(expected, sum);
+
+    remove(nodeFile.c_str());
+    remove(condFile.c_str());
+    remove(radFile.c_str());
+
+    std::cout << " Pass (parse " << parseTime << " s, " << 4 * numLinks << " lookups "
+              << lookupTime << " s)";
+}
@@ -0,0 +1,164 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((aspects/thermal/network/ThermNameIndex.o))
+***************************************************************************************************/
+#include "UtThermNameIndex.hh"
+#include <iostream>
+#include <sstream>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtThermNameIndex class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtThermNameIndex::UtThermNameIndex()
+    :
+    tArticle(0)
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtThermNameIndex class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtThermNameIndex::~UtThermNameIndex()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNameIndex::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tArticle;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNameIndex::setUp()
+{
+    tArticle = new FriendlyThermNameIndex();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for appropriate construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNameIndex::testConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n ThermNameIndex 01: Testing default construction ...............";
+
+    /// @test  Default values.
+    CPPUNIT_ASSERT(0 == tArticle->size());
+    CPPUNIT_ASSERT(tArticle->mPool.empty());
+    CPPUNIT_ASSERT(1 == tArticle->mOffsets.size());
+    CPPUNIT_ASSERT(0 == tArticle->mOffsets[0]);
+    CPPUNIT_ASSERT(tArticle->mHashes.empty());
+    CPPUNIT_ASSERT(tArticle->mSlots.empty());
+
+    /// @test  Find in an empty index.
+    CPPUNIT_ASSERT(ThermNameIndex::NOT_FOUND == tArticle->find("SPACE"));
+
+    /// @test  New/delete for code coverage.
+    ThermNameIndex* article = new ThermNameIndex();
+    delete article;
+
+    std::cout << " Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests insert & find of names, including repeated, blank and similar names.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNameIndex::testInsertFind()
+{
+    std::cout << "\n ThermNameIndex 02: Testing insert & find ......................";
+
+    /// @test  Names are indexed in the order inserted, and interned end to end in the pool.
+    CPPUNIT_ASSERT(tArticle->insert("CMBCKSHL_13330"));
+    CPPUNIT_ASSERT(tArticle->insert("CECLSS_26"));
+    CPPUNIT_ASSERT(tArticle->insert("SPACE"));
+    CPPUNIT_ASSERT(3 == tArticle->size());
+    CPPUNIT_ASSERT(0 == tArticle->find("CMBCKSHL_13330"));
+    CPPUNIT_ASSERT(1 == tArticle->find("CECLSS_26"));
+    CPPUNIT_ASSERT(2 == tArticle->find("SPACE"));
+    CPPUNIT_ASSERT("CMBCKSHL_13330CECLSS_26SPACE" ==
+                   std::string(&tArticle->mPool[0], tArticle->mPool.size()));
+    CPPUNIT_ASSERT(14 == tArticle->mOffsets[1]);
+    CPPUNIT_ASSERT(28 == tArticle->mOffsets[3]);
+
+    /// @test  A repeated name is refused and keeps its index.
+    CPPUNIT_ASSERT(not tArticle->insert("CECLSS_26"));
+    CPPUNIT_ASSERT(3 == tArticle->size());
+    CPPUNIT_ASSERT(1 == tArticle->find("CECLSS_26"));
+
+    /// @test  Prefixes, case and whitespace variants are different names.
+    CPPUNIT_ASSERT(ThermNameIndex::NOT_FOUND == tArticle->find("CECLSS_2"));
+    CPPUNIT_ASSERT(ThermNameIndex::NOT_FOUND == tArticle->find("CECLSS_260"));
+    CPPUNIT_ASSERT(ThermNameIndex::NOT_FOUND == tArticle->find("space"));
+    CPPUNIT_ASSERT(ThermNameIndex::NOT_FOUND == tArticle->find("SPACE "));
+
+    /// @test  The blank name is a name like any other.
+    CPPUNIT_ASSERT(ThermNameIndex::NOT_FOUND == tArticle->find(""));
+    CPPUNIT_ASSERT(tArticle->insert(""));
+    CPPUNIT_ASSERT(3 == tArticle->find(""));
+    CPPUNIT_ASSERT(not tArticle->insert(""));
+
+    std::cout << " Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests growth of the slot table past many rehashes, reserve and clear.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNameIndex::testGrowth()
+{
+    std::cout << "\n ThermNameIndex 03: Testing growth, reserve & clear ............";
+
+    /// @test  Every name is found after the table has grown many times, and the table stays at
+    ///        most half full with a power of two size.
+    const int numNames = 20000;
+    for (int i = 0; i < numNames; ++i) {
+        std::ostringstream name;
+        name << "NODE_" << i;
+        CPPUNIT_ASSERT(tArticle->insert(name.str()));
+    }
+    CPPUNIT_ASSERT(numNames == tArticle->size());
+    const int numSlots = static_cast<int>(tArticle->mSlots.size());
+    CPPUNIT_ASSERT(numSlots >= 2 * numNames);
+    CPPUNIT_ASSERT(0 == (numSlots & (numSlots - 1)));
+    for (int i = 0; i < numNames; ++i) {
+        std::ostringstream name;
+        name << "NODE_" << i;
+        CPPUNIT_ASSERT(i == tArticle->find(name.str()));
+        CPPUNIT_ASSERT(not tArticle->insert(name.str()));
+    }
+
+    /// @test  Clear empties the index but keeps the slot table.
+    tArticle->clear();
+    CPPUNIT_ASSERT(0 == tArticle->size());
+    CPPUNIT_ASSERT(numSlots == static_cast<int>(tArticle->mSlots.size()));
+    CPPUNIT_ASSERT(ThermNameIndex::NOT_FOUND == tArticle->find("NODE_0"));
+    CPPUNIT_ASSERT(tArticle->insert("NODE_1"));
+    CPPUNIT_ASSERT(0 == tArticle->find("NODE_1"));
+
+    /// @test  Reserve sizes the table up front, so inserts up to that size don't regrow it.
+    FriendlyThermNameIndex article;
+    article.reserve(0);
+    CPPUNIT_ASSERT(article.mSlots.empty());
+    article.reserve(1000);
+    const int reserved = static_cast<int>(article.mSlots.size());
+    CPPUNIT_ASSERT(2048 == reserved);
+    for (int i = 0; i < 1000; ++i) {
+        std::ostringstream name;
+        name << "N" << i;
+        CPPUNIT_ASSERT(article.insert(name.str()));
+    }
+    CPPUNIT_ASSERT(reserved == static_cast<int>(article.mSlots.size()));
+    CPPUNIT_ASSERT(999 == article.find("N999"));
+
+    std::cout << " Pass";
+}
@@ -0,0 +1,75 @@
+#ifndef UtThermNameIndex_EXISTS
+#define UtThermNameIndex_EXISTS
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_PTCS_THERMAL_NETWORK_NAME_INDEX    Thermal Network: ThermNameIndex Unit Test
+/// @ingroup  UT_PTCS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Thermal Network: ThermNameIndex
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "aspects/thermal/network/ThermNameIndex.hh"
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from ThermNameIndex and befriend UtThermNameIndex.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyThermNameIndex : public ThermNameIndex
+{
+    public:
+        FriendlyThermNameIndex();
+        virtual ~FriendlyThermNameIndex();
+        friend class UtThermNameIndex;
+};
+inline FriendlyThermNameIndex::FriendlyThermNameIndex() :
+        ThermNameIndex() {};
+inline FriendlyThermNameIndex::~FriendlyThermNameIndex() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    ThermNameIndex unit tests.
+////
+/// @details  Provides the unit tests for the ThermNameIndex within the CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtThermNameIndex: public CppUnit::TestFixture
+{
+    public:
+        /// @brief  Default Constructor.
+        UtThermNameIndex();
+        /// @brief  Default Destructor.
+        virtual ~UtThermNameIndex();
+        /// @brief  Executes after each test.
+        void tearDown();
+        /// @brief  Executes before each test.
+        void setUp();
+        /// @brief  Tests for appropriate construction.
+        void testConstruction();
+        /// @brief  Tests insert & find of names, including repeats.
+        void testInsertFind();
+        /// @brief  Tests growth of the slot table, reserve and clear.
+        void testGrowth();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtThermNameIndex);
+        CPPUNIT_TEST(testConstruction);
+        CPPUNIT_TEST(testInsertFind);
+        CPPUNIT_TEST(testGrowth);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief  (--) Test Article
+        FriendlyThermNameIndex* tArticle;
+
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        UtThermNameIndex(const UtThermNameIndex&);
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        UtThermNameIndex& operator =(const UtThermNameIndex&);
+};
+
+///@}
+
+#endif
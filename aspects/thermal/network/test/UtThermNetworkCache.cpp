@@ -0,0 +1,446 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((aspects/thermal/network/ThermNetworkCache.o)
+     (aspects/thermal/network/ThermalNetwork.o))
+***************************************************************************************************/
+#include "UtThermNetworkCache.hh"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtThermNetworkCache class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtThermNetworkCache::UtThermNetworkCache()
+    :
+    tArticle(0),
+    tParsed(0),
+    tCacheFile(),
+    tScratchFile()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtThermNetworkCache class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtThermNetworkCache::~UtThermNetworkCache()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNetworkCache::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tParsed;
+    delete tArticle;
+    remove(tCacheFile.c_str());
+    remove(tScratchFile.c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNetworkCache::setUp()
+{
+    tCacheFile   = "UtThermNetworkCache_scratch.bin";
+    tScratchFile = "UtThermNetworkCache_scratch.xml";
+    tArticle     = new FriendlyThermNetworkCache("article");
+
+    /// - Parse the nominal config-files, including the input override file.
+    tParsed = new FriendlyThermCacheParser("parsed");
+    setFiles(*tParsed);
+    tParsed->initialize("parsed");
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  parser  (--)  Parser to set the file names of.
+///
+/// @details  Sets the nominal config-file names in the given parser.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNetworkCache::setFiles(ThermFileParser& parser) const
+{
+    FriendlyThermCacheParser& friendly = static_cast<FriendlyThermCacheParser&>(parser);
+    friendly.mNodeFile       = "ThermNodes_base.xml";
+    friendly.mCondFile       = "ThermLinksCond_base.xml";
+    friendly.mRadFile        = "ThermLinksRad_base.xml";
+    friendly.mHtrFile        = "HtrRegistry_base.xml";
+    friendly.mPanFile        = "ThermLinksPan_base.xml";
+    friendly.mEtcFile        = "ThermLinksEtc_base.xml";
+    friendly.mThermInputFile = "ThermInput_base.xml";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  from   (--)  File to copy.
+/// @param[in]  to     (--)  File to write.
+/// @param[in]  extra  (--)  Text to append to the copy.
+///
+/// @details  Copies a file, optionally appending text to the copy.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNetworkCache::copyFile(const std::string& from, const std::string& to,
+                                   const std::string& extra) const
+{
+    std::ifstream in(from.c_str(), std::ios::binary);
+    std::ofstream out(to.c_str(), std::ios::binary);
+    CPPUNIT_ASSERT(in.good() and out.good());
+    out << in.rdbuf() << extra;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  offset  (--)  Byte offset into the cache file.
+/// @param[in]  data    (--)  Bytes to write.
+/// @param[in]  size    (--)  Number of bytes.
+///
+/// @details  Overwrites bytes of the cache file at the given offset.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNetworkCache::patchCache(const long offset, const void* data,
+                                     const unsigned int size) const
+{
+    FILE* file = fopen(tCacheFile.c_str(), "r+b");
+    CPPUNIT_ASSERT(0 != file);
+    fseek(file, offset, SEEK_SET);
+    fwrite(data, 1, size, file);
+    fclose(file);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  expected  (--)  Parser of the config-files.
+/// @param[in]  actual    (--)  Parser loaded from the cache.
+///
+/// @details  Asserts that two parsers hold the same data, as ThermalNetwork uses it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNetworkCache::assertSameData(const FriendlyThermCacheParser& expected,
+                                         const FriendlyThermCacheParser& actual) const
+{
+    CPPUNIT_ASSERT(actual.areNodesRegistered);
+    CPPUNIT_ASSERT(expected.numNodes                 == actual.numNodes);
+    CPPUNIT_ASSERT(expected.vNodeNames               == actual.vNodeNames);
+    CPPUNIT_ASSERT(expected.mNodeIndex.size()        == actual.mNodeIndex.size());
+    for (int i = 0; i < actual.numNodes; ++i) {
+        CPPUNIT_ASSERT(i == actual.mNodeIndex.find(expected.vNodeNames[i]));
+    }
+    CPPUNIT_ASSERT(expected.vCapEditGroupList        == actual.vCapEditGroupList);
+    for (unsigned int i = 0; i < actual.vCapEditGroupList.size(); ++i) {
+        CPPUNIT_ASSERT(static_cast<int>(i) ==
+                       actual.mCapEditGroupIndex.find(expected.vCapEditGroupList[i]));
+    }
+    CPPUNIT_ASSERT(expected.numLinksCap              == actual.numLinksCap);
+    CPPUNIT_ASSERT(expected.vCapNames                == actual.vCapNames);
+    CPPUNIT_ASSERT(expected.vCapPorts                == actual.vCapPorts);
+    CPPUNIT_ASSERT(expected.vCapTemperatures         == actual.vCapTemperatures);
+    CPPUNIT_ASSERT(expected.vCapCapacitances         == actual.vCapCapacitances);
+    CPPUNIT_ASSERT(expected.vCapEditGroupIdentifiers == actual.vCapEditGroupIdentifiers);
+    CPPUNIT_ASSERT(expected.numLinksCond             == actual.numLinksCond);
+    CPPUNIT_ASSERT(expected.vCondNames               == actual.vCondNames);
+    CPPUNIT_ASSERT(expected.vCondPorts0              == actual.vCondPorts0);
+    CPPUNIT_ASSERT(expected.vCondPorts1              == actual.vCondPorts1);
+    CPPUNIT_ASSERT(expected.vCondConductivities      == actual.vCondConductivities);
+    CPPUNIT_ASSERT(expected.numLinksRad              == actual.numLinksRad);
+    CPPUNIT_ASSERT(expected.numInputEntriesRad       == actual.numInputEntriesRad);
+    CPPUNIT_ASSERT(expected.vRadNames                == actual.vRadNames);
+    CPPUNIT_ASSERT(expected.vRadPorts0               == actual.vRadPorts0);
+    CPPUNIT_ASSERT(expected.vRadPorts1               == actual.vRadPorts1);
+    CPPUNIT_ASSERT(expected.vRadCoefficients         == actual.vRadCoefficients);
+    CPPUNIT_ASSERT(expected.vRadViewScalars          == actual.vRadViewScalars);
+    CPPUNIT_ASSERT(expected.numLinksHtr              == actual.numLinksHtr);
+    CPPUNIT_ASSERT(expected.vHtrNames                == actual.vHtrNames);
+    CPPUNIT_ASSERT(expected.vHtrScalars              == actual.vHtrScalars);
+    CPPUNIT_ASSERT(expected.vHtrPorts                == actual.vHtrPorts);
+    CPPUNIT_ASSERT(expected.vHtrFracs                == actual.vHtrFracs);
+    CPPUNIT_ASSERT(expected.numLinksPan              == actual.numLinksPan);
+    CPPUNIT_ASSERT(expected.vPanNames                == actual.vPanNames);
+    CPPUNIT_ASSERT(expected.vPanAreas                == actual.vPanAreas);
+    CPPUNIT_ASSERT(expected.vPanAbsorptivities       == actual.vPanAbsorptivities);
+    CPPUNIT_ASSERT(expected.vPanPorts                == actual.vPanPorts);
+    CPPUNIT_ASSERT(expected.vPanFracs                == actual.vPanFracs);
+    CPPUNIT_ASSERT(expected.numLinksPot              == actual.numLinksPot);
+    CPPUNIT_ASSERT(expected.vPotNames                == actual.vPotNames);
+    CPPUNIT_ASSERT(expected.vPotPorts                == actual.vPotPorts);
+    CPPUNIT_ASSERT(expected.vPotTemperatures         == actual.vPotTemperatures);
+    CPPUNIT_ASSERT(expected.vPotConductivities       == actual.vPotConductivities);
+    CPPUNIT_ASSERT(expected.numLinksSrc              == actual.numLinksSrc);
+    CPPUNIT_ASSERT(expected.vSrcNames                == actual.vSrcNames);
+    CPPUNIT_ASSERT(expected.vSrcInits                == actual.vSrcInits);
+    CPPUNIT_ASSERT(expected.vSrcScalars              == actual.vSrcScalars);
+    CPPUNIT_ASSERT(expected.vSrcPorts                == actual.vSrcPorts);
+    CPPUNIT_ASSERT(expected.vSrcFracs                == actual.vSrcFracs);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for appropriate construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNetworkCache::testConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n ThermNetworkCache 01: Testing default construction ............";
+
+    /// @test  Default values.
+    CPPUNIT_ASSERT("article" == tArticle->mName);
+    CPPUNIT_ASSERT(not tArticle->mInputsHashed);
+    CPPUNIT_ASSERT(not tArticle->isLoaded());
+    CPPUNIT_ASSERT(tArticle->mImage.empty());
+    CPPUNIT_ASSERT(0 == tArticle->mBase);
+    CPPUNIT_ASSERT(0 == tArticle->mSize);
+    for (int i = 0; i < FriendlyThermNetworkCache::NUM_INPUTS; ++i) {
+        CPPUNIT_ASSERT(0 == tArticle->mInputHash[i]);
+        CPPUNIT_ASSERT(0 == tArticle->mInputSize[i]);
+    }
+
+    /// @test  The header is padded so the first section is 8-byte aligned.
+    CPPUNIT_ASSERT(0 == FriendlyThermNetworkCache::HEADER_WORDS % 2);
+
+    /// @test  New/delete for code coverage.
+    ThermNetworkCache* article = new ThermNetworkCache();
+    delete article;
+
+    std::cout << " Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that a parser loaded from a saved cache holds the same data as the parse of the
+///           config-files it was compiled from.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNetworkCache::testRoundTrip()
+{
+    std::cout << "\n ThermNetworkCache 02: Testing round trip ......................";
+
+    /// @test  Save writes the cache file and releases the image.
+    tArticle->save(tCacheFile, *tParsed);
+    CPPUNIT_ASSERT(tArticle->mInputsHashed);
+    CPPUNIT_ASSERT(tArticle->mImage.empty());
+    std::ifstream check(tCacheFile.c_str());
+    CPPUNIT_ASSERT(check.good());
+
+    /// @test  The used input files are hashed, the unused ones are not.
+    CPPUNIT_ASSERT(0 != tArticle->mInputHash[FriendlyThermNetworkCache::NODE_FILE]);
+    CPPUNIT_ASSERT(0 != tArticle->mInputSize[FriendlyThermNetworkCache::INPUT_FILE]);
+    CPPUNIT_ASSERT(0 == tArticle->mInputHash[FriendlyThermNetworkCache::INPUT_RAD_FILE]);
+    CPPUNIT_ASSERT(0 == tArticle->mInputSize[FriendlyThermNetworkCache::INPUT_RAD_FILE]);
+
+    /// @test  Load by a new cache object into a new parser reproduces the parsed data.
+    FriendlyThermNetworkCache article("loader");
+    FriendlyThermCacheParser loaded("loaded");
+    setFiles(loaded);
+    CPPUNIT_ASSERT(article.load(tCacheFile, loaded));
+    CPPUNIT_ASSERT(article.isLoaded());
+    CPPUNIT_ASSERT(0 == article.mBase);
+    assertSameData(*tParsed, loaded);
+
+    /// @test  Loading again over data already in the parser replaces it.
+    CPPUNIT_ASSERT(article.load(tCacheFile, loaded));
+    assertSameData(*tParsed, loaded);
+
+    /// @test  A parse with no link files round trips with empty sections.
+    FriendlyThermCacheParser nodesOnly("nodesOnly");
+    nodesOnly.mNodeFile = "ThermNodes_base.xml";
+    nodesOnly.initialize("nodesOnly");
+    FriendlyThermNetworkCache article2;
+    article2.save(tCacheFile, nodesOnly);
+    FriendlyThermCacheParser loaded2("loaded2");
+    loaded2.mNodeFile = "ThermNodes_base.xml";
+    CPPUNIT_ASSERT(article2.load(tCacheFile, loaded2));
+    assertSameData(nodesOnly, loaded2);
+
+    std::cout << " Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that a cache is not loaded once any config-file it was compiled from changes,
+///           or the parser is set to use different files.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNetworkCache::testStale()
+{
+    std::cout << "\n ThermNetworkCache 03: Testing stale cache detection ...........";
+
+    /// - Compile a cache from a copy of the conduction file.
+    copyFile("ThermLinksCond_base.xml", tScratchFile);
+    FriendlyThermCacheParser parser("parser");
+    setFiles(parser);
+    parser.mCondFile = tScratchFile;
+    parser.initialize("parser");
+    tArticle->save(tCacheFile, parser);
+
+    /// @test  The cache is current for the unchanged files.
+    FriendlyThermCacheParser loaded("loaded");
+    setFiles(loaded);
+    loaded.mCondFile = tScratchFile;
+    CPPUNIT_ASSERT(tArticle->load(tCacheFile, loaded));
+
+    /// @test  An edit to a config-file, even one that doesn't change the data, makes it stale.
+    copyFile("ThermLinksCond_base.xml", tScratchFile, "<!-- edited -->\n");
+    CPPUNIT_ASSERT(not tArticle->load(tCacheFile, loaded));
+    CPPUNIT_ASSERT(not tArticle->isLoaded());
+
+    /// @test  A same-sized edit is detected by the hash.
+    copyFile("ThermLinksCond_base.xml", tScratchFile, "<!-- edit1 -->\n");
+    CPPUNIT_ASSERT(not tArticle->load(tCacheFile, loaded));
+    tArticle->save(tCacheFile, loaded);
+    CPPUNIT_ASSERT(tArticle->load(tCacheFile, loaded));
+    copyFile("ThermLinksCond_base.xml", tScratchFile, "<!-- edit2 -->\n");
+    CPPUNIT_ASSERT(not tArticle->load(tCacheFile, loaded));
+
+    /// @test  Using a different set of files makes it stale.
+    copyFile("ThermLinksCond_base.xml", tScratchFile, "<!-- edit1 -->\n");
+    CPPUNIT_ASSERT(tArticle->load(tCacheFile, loaded));
+    loaded.mThermInputFile = "";
+    CPPUNIT_ASSERT(not tArticle->load(tCacheFile, loaded));
+
+    /// @test  A missing config-file makes it stale.
+    loaded.mThermInputFile = "ThermInput_base.xml";
+    remove(tScratchFile.c_str());
+    CPPUNIT_ASSERT(not tArticle->load(tCacheFile, loaded));
+
+    std::cout << " Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that a missing, truncated, foreign or corrupted cache is ignored without throwing,
+///           and that an unwritable cache path only warns.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNetworkCache::testMalformed()
+{
+    std::cout << "\n ThermNetworkCache 04: Testing malformed cache handling ........";
+
+    FriendlyThermCacheParser loaded("loaded");
+    setFiles(loaded);
+
+    /// @test  No cache file name, or a missing cache file.
+    CPPUNIT_ASSERT(not tArticle->load("", loaded));
+    CPPUNIT_ASSERT(not tArticle->mInputsHashed);
+    CPPUNIT_ASSERT_NO_THROW(tArticle->save("", *tParsed));
+    remove(tCacheFile.c_str());
+    CPPUNIT_ASSERT(not tArticle->load(tCacheFile, loaded));
+
+    /// @test  An unwritable cache path.
+    CPPUNIT_ASSERT_NO_THROW(tArticle->save("no_such_dir/cache.bin", *tParsed));
+
+    /// @test  A file too small for the header.
+    copyFile("ThermLinks_empty.xml", tCacheFile);
+    CPPUNIT_ASSERT(not tArticle->load(tCacheFile, loaded));
+
+    /// @test  A file that isn't a cache.
+    copyFile("ThermLinksRad_base.xml", tCacheFile);
+    CPPUNIT_ASSERT_NO_THROW(tArticle->load(tCacheFile, loaded));
+    CPPUNIT_ASSERT(not tArticle->isLoaded());
+
+    /// @test  Another version or byte order.
+    const unsigned int bad = 0xFFFFFFFF;
+    tArticle->save(tCacheFile, *tParsed);
+    CPPUNIT_ASSERT(tArticle->load(tCacheFile, loaded));
+    patchCache(4 * FriendlyThermNetworkCache::VERSION_WORD, &bad, 4);
+    CPPUNIT_ASSERT(not tArticle->load(tCacheFile, loaded));
+    tArticle->save(tCacheFile, *tParsed);
+    patchCache(4 * FriendlyThermNetworkCache::ORDER_MARK, &bad, 4);
+    CPPUNIT_ASSERT(not tArticle->load(tCacheFile, loaded));
+
+    /// @test  A truncated cache.
+    tArticle->save(tCacheFile, *tParsed);
+    std::ifstream in(tCacheFile.c_str(), std::ios::binary);
+    std::string image((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::ofstream out(tCacheFile.c_str(), std::ios::binary);
+    out.write(image.data(), image.size() / 2);
+    out.close();
+    CPPUNIT_ASSERT(not tArticle->load(tCacheFile, loaded));
+
+    /// @test  A section offset past the end of the image.
+    tArticle->save(tCacheFile, *tParsed);
+    const unsigned int past = static_cast<unsigned int>(image.size());
+    patchCache(4 * (FriendlyThermNetworkCache::SECTION_OFFSETS +
+                    FriendlyThermNetworkCache::COND_NAMES), &past, 4);
+    CPPUNIT_ASSERT(not tArticle->load(tCacheFile, loaded));
+
+    /// @test  A port that doesn't refer to a node.
+    tArticle->save(tCacheFile, *tParsed);
+    unsigned int offset = 0;
+    memcpy(&offset, image.data() + 4 * (FriendlyThermNetworkCache::SECTION_OFFSETS +
+                                        FriendlyThermNetworkCache::COND_PORTS1), 4);
+    patchCache(offset + 8, &tParsed->numNodes, 4);
+    CPPUNIT_ASSERT(not tArticle->load(tCacheFile, loaded));
+
+    /// @test  A section count that disagrees with the link count.
+    tArticle->save(tCacheFile, *tParsed);
+    memcpy(&offset, image.data() + 4 * (FriendlyThermNetworkCache::SECTION_OFFSETS +
+                                        FriendlyThermNetworkCache::RAD_COEFFICIENTS), 4);
+    const unsigned int fewer = tParsed->numLinksRad - 1;
+    patchCache(offset, &fewer, 4);
+    CPPUNIT_ASSERT(not tArticle->load(tCacheFile, loaded));
+
+    /// @test  The intact cache still loads afterwards.
+    tArticle->save(tCacheFile, *tParsed);
+    CPPUNIT_ASSERT(tArticle->load(tCacheFile, loaded));
+    assertSameData(*tParsed, loaded);
+
+    std::cout << " Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that a ThermalNetwork compiles its cache on the first initialization, loads it on
+///           the next, and builds the same network either way.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermNetworkCache::testNetwork()
+{
+    std::cout << "\n ThermNetworkCache 05: Testing network initialization ..........";
+
+    remove(tCacheFile.c_str());
+    FriendlyThermCacheNetwork* network[2];
+    for (int i = 0; i < 2; ++i) {
+        std::ostringstream name;
+        name << "network" << i;
+        network[i] = new FriendlyThermCacheNetwork(name.str());
+        network[i]->mConfig.cNodeFile  = "ThermNodes_base.xml";
+        network[i]->mConfig.cCondFile  = "ThermLinksCond_base.xml";
+        network[i]->mConfig.cRadFile   = "ThermLinksRad_base.xml";
+        network[i]->mConfig.cHtrFile   = "HtrRegistry_base.xml";
+        network[i]->mConfig.cPanFile   = "ThermLinksPan_base.xml";
+        network[i]->mConfig.cEtcFile   = "ThermLinksEtc_base.xml";
+        network[i]->mConfig.cCacheFile = tCacheFile;
+        network[i]->initialize();
+    }
+
+    /// @test  The first network parsed the config-files & the second loaded the cache.
+    CPPUNIT_ASSERT(not network[0]->cache.isLoaded());
+    CPPUNIT_ASSERT(network[1]->cache.isLoaded());
+
+    /// @test  Both networks are built the same.
+    CPPUNIT_ASSERT(network[0]->netNodeList.mNumNodes == network[1]->netNodeList.mNumNodes);
+    CPPUNIT_ASSERT(network[0]->indexSpaceNode   == network[1]->indexSpaceNode);
+    CPPUNIT_ASSERT(network[0]->numCapEditGroups == network[1]->numCapEditGroups);
+    CPPUNIT_ASSERT(network[0]->numLinksCap      == network[1]->numLinksCap);
+    CPPUNIT_ASSERT(network[0]->numLinksCond     == network[1]->numLinksCond);
+    CPPUNIT_ASSERT(network[0]->numLinksRad      == network[1]->numLinksRad);
+    CPPUNIT_ASSERT(network[0]->numLinksHtr      == network[1]->numLinksHtr);
+    CPPUNIT_ASSERT(network[0]->numLinksPan      == network[1]->numLinksPan);
+    CPPUNIT_ASSERT(network[0]->numLinksPot      == network[1]->numLinksPot);
+    CPPUNIT_ASSERT(network[0]->numLinksSrc      == network[1]->numLinksSrc);
+    for (int i = 0; i < network[0]->numLinksCap; ++i) {
+        CPPUNIT_ASSERT(network[0]->mCapacitanceLinks[i].getCapacitance() ==
+                       network[1]->mCapacitanceLinks[i].getCapacitance());
+        CPPUNIT_ASSERT(network[0]->mCapacitanceLinks[i].getTemperature() ==
+                       network[1]->mCapacitanceLinks[i].getTemperature());
+    }
+
+    /// @test  Both networks step the same.
+    for (int step = 0; step < 3; ++step) {
+        network[0]->update(0.1);
+        network[1]->update(0.1);
+    }
+    for (int i = 0; i < network[0]->numLinksCap; ++i) {
+        CPPUNIT_ASSERT(network[0]->mCapacitanceLinks[i].getTemperature() ==
+                       network[1]->mCapacitanceLinks[i].getTemperature());
+    }
+
+    delete network[1];
+    delete network[0];
+    std::cout << " Pass";
+}
@@ -0,0 +1,130 @@
+#ifndef UtThermNetworkCache_EXISTS
+#define UtThermNetworkCache_EXISTS
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_PTCS_THERMAL_NETWORK_CACHE    Thermal Network: ThermNetworkCache Unit Test
+/// @ingroup  UT_PTCS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Thermal Network: ThermNetworkCache
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "aspects/thermal/network/ThermNetworkCache.hh"
+#include "aspects/thermal/network/ThermalNetwork.hh"
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from ThermNetworkCache and befriend UtThermNetworkCache.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyThermNetworkCache : public ThermNetworkCache
+{
+    public:
+        FriendlyThermNetworkCache(const std::string& name = "");
+        virtual ~FriendlyThermNetworkCache();
+        friend class UtThermNetworkCache;
+};
+inline FriendlyThermNetworkCache::FriendlyThermNetworkCache(const std::string& name) :
+        ThermNetworkCache(name) {};
+inline FriendlyThermNetworkCache::~FriendlyThermNetworkCache() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from ThermFileParser and befriend UtThermNetworkCache.
+///
+/// @details  Gives the unit test access to the parser's data vectors to compare them.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyThermCacheParser : public ThermFileParser
+{
+    public:
+        FriendlyThermCacheParser(const std::string& name = "");
+        virtual ~FriendlyThermCacheParser();
+        friend class UtThermNetworkCache;
+};
+inline FriendlyThermCacheParser::FriendlyThermCacheParser(const std::string& name) :
+        ThermFileParser(name) {};
+inline FriendlyThermCacheParser::~FriendlyThermCacheParser() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from ThermalNetwork and befriend UtThermNetworkCache.
+///
+/// @details  Gives the unit test access to the network's cache and link counts.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyThermCacheNetwork : public ThermalNetwork
+{
+    public:
+        FriendlyThermCacheNetwork(const std::string& name = "");
+        virtual ~FriendlyThermCacheNetwork();
+        friend class UtThermNetworkCache;
+};
+inline FriendlyThermCacheNetwork::FriendlyThermCacheNetwork(const std::string& name) :
+        ThermalNetwork(name) {};
+inline FriendlyThermCacheNetwork::~FriendlyThermCacheNetwork() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    ThermNetworkCache unit tests.
+////
+/// @details  Provides the unit tests for the ThermNetworkCache within the CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtThermNetworkCache: public CppUnit::TestFixture
+{
+    public:
+        /// @brief  Default Constructor.
+        UtThermNetworkCache();
+        /// @brief  Default Destructor.
+        virtual ~UtThermNetworkCache();
+        /// @brief  Executes after each test.
+        void tearDown();
+        /// @brief  Executes before each test.
+        void setUp();
+        /// @brief  Tests for appropriate construction.
+        void testConstruction();
+        /// @brief  Tests that a loaded cache reproduces the parsed config-files.
+        void testRoundTrip();
+        /// @brief  Tests that a cache is ignored once its config-files change.
+        void testStale();
+        /// @brief  Tests that a missing or malformed cache is ignored.
+        void testMalformed();
+        /// @brief  Tests a ThermalNetwork initialized through its cache.
+        void testNetwork();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtThermNetworkCache);
+        CPPUNIT_TEST(testConstruction);
+        CPPUNIT_TEST(testRoundTrip);
+        CPPUNIT_TEST(testStale);
+        CPPUNIT_TEST(testMalformed);
+        CPPUNIT_TEST(testNetwork);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief  (--) Test Article
+        FriendlyThermNetworkCache* tArticle;
+        /// @brief  (--) Parser of the config-files, for comparison
+        FriendlyThermCacheParser*  tParsed;
+        /// @brief  (--) Name of the cache file written by the tests.
+        std::string tCacheFile;
+        /// @brief  (--) Name of the scratch config-file written by the tests.
+        std::string tScratchFile;
+        /// @brief  Sets the nominal config-file names in the given parser.
+        void setFiles(ThermFileParser& parser) const;
+        /// @brief  Copies a file, optionally appending text to the copy.
+        void copyFile(const std::string& from, const std::string& to,
+                      const std::string& extra = "") const;
+        /// @brief  Overwrites bytes of the cache file at the given offset.
+        void patchCache(const long offset, const void* data, const unsigned int size) const;
+        /// @brief  Asserts that two parsers hold the same data.
+        void assertSameData(const FriendlyThermCacheParser& expected,
+                            const FriendlyThermCacheParser& actual) const;
+
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        UtThermNetworkCache(const UtThermNetworkCache&);
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        UtThermNetworkCache& operator =(const UtThermNetworkCache&);
+};
+
+///@}
+
+#endif
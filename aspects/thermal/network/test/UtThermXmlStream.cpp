@@ -0,0 +1,276 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    ((aspects/thermal/network/ThermXmlStream.o))
+***************************************************************************************************/
+#include "UtThermXmlStream.hh"
+#include "software/exceptions/TsParseException.hh"
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtThermXmlStream class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtThermXmlStream::UtThermXmlStream()
+    :
+    tArticle(0),
+    tScratchFile()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtThermXmlStream class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtThermXmlStream::~UtThermXmlStream()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermXmlStream::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tArticle;
+    remove(tScratchFile.c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermXmlStream::setUp()
+{
+    tArticle     = new FriendlyThermXmlStream();
+    tScratchFile = "UtThermXmlStream_scratch.xml";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  text  (--)  Contents of the file.
+///
+/// @details  Writes the given text to the scratch file.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermXmlStream::writeScratchFile(const std::string& text)
+{
+    FILE* file = fopen(tScratchFile.c_str(), "wb");
+    CPPUNIT_ASSERT(0 != file);
+    fwrite(text.c_str(), 1, text.size(), file);
+    fclose(file);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for appropriate construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermXmlStream::testConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n ThermXmlStream 01: Testing default construction ...............";
+
+    /// @test  Default values.
+    CPPUNIT_ASSERT(0     == tArticle->mFile);
+    CPPUNIT_ASSERT(""    == tArticle->mName);
+    CPPUNIT_ASSERT(""    == tArticle->getTag());
+    CPPUNIT_ASSERT(""    == tArticle->getRecord());
+    CPPUNIT_ASSERT(false == tArticle->mCapturing);
+    CPPUNIT_ASSERT(false == tArticle->mRootClosed);
+    CPPUNIT_ASSERT_EQUAL(0, tArticle->mDepth);
+    CPPUNIT_ASSERT_EQUAL(0, tArticle->getNumRecords());
+    CPPUNIT_ASSERT_EQUAL(0ul, tArticle->getFileSize());
+    CPPUNIT_ASSERT_EQUAL(0ul, tArticle->getBytesRead());
+    CPPUNIT_ASSERT_EQUAL(0ul, tArticle->getPeakBytes());
+    CPPUNIT_ASSERT_EQUAL(0.0, tArticle->getElapsedTime());
+
+    /// @test  Construction with a name.
+    ThermXmlStream article("stream");
+    CPPUNIT_ASSERT(0 == article.getNumRecords());
+
+    std::cout << " Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the sweep of the nominal node-file, which has its <capEditing> record between
+///           <node> records.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermXmlStream::testNominal()
+{
+    std::cout << "\n ThermXmlStream 02: Testing nominal file sweep .................";
+
+    /// @test  Opening leaves the stream inside the root element.
+    tArticle->open("ThermNodes_base.xml", "list");
+    CPPUNIT_ASSERT(0 != tArticle->mFile);
+    CPPUNIT_ASSERT_EQUAL(1, tArticle->mDepth);
+    CPPUNIT_ASSERT(tArticle->getFileSize() > 0);
+
+    /// @test  The first record is built into an element.
+    CPPUNIT_ASSERT(tArticle->nextRecord());
+    CPPUNIT_ASSERT("node" == tArticle->getTag());
+    CPPUNIT_ASSERT(0 == tArticle->getRecord().find("<node>"));
+    TiXmlElement* element = tArticle->getElement();
+    CPPUNIT_ASSERT(0 != element);
+    CPPUNIT_ASSERT(std::string("CECLSS_26") == element->FirstChildElement("name")->GetText());
+
+    /// @test  All records are found in file order, with no DOM built for them.
+    int nodes = 1;
+    int groups = 0;
+    while (tArticle->nextRecord()) {
+        if ("node" == tArticle->getTag()) {
+            ++nodes;
+        } else if ("capEditing" == tArticle->getTag()) {
+            CPPUNIT_ASSERT_EQUAL(6, nodes);
+            ++groups;
+        }
+    }
+    CPPUNIT_ASSERT_EQUAL(23, nodes);
+    CPPUNIT_ASSERT_EQUAL(1,  groups);
+    CPPUNIT_ASSERT_EQUAL(24, tArticle->getNumRecords());
+    CPPUNIT_ASSERT(tArticle->mRootClosed);
+
+    /// @test  The end of the root is sticky.
+    CPPUNIT_ASSERT(not tArticle->nextRecord());
+
+    /// @test  Statistics after close: the whole file was read once, and the elapsed time stops.
+    tArticle->close();
+    CPPUNIT_ASSERT(0 == tArticle->mFile);
+    CPPUNIT_ASSERT_EQUAL(tArticle->getFileSize(), tArticle->getBytesRead());
+    CPPUNIT_ASSERT(tArticle->getPeakBytes() >= ThermXmlStream::CHUNK_SIZE);
+    const double elapsed = tArticle->getElapsedTime();
+    CPPUNIT_ASSERT(elapsed > 0.0);
+    CPPUNIT_ASSERT_EQUAL(elapsed, tArticle->getElapsedTime());
+
+    std::cout << " Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests skipping of comments, CDATA and other markup between and within records.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermXmlStream::testMarkup()
+{
+    std::cout << "\n ThermXmlStream 03: Testing markup handling ....................";
+
+    writeScratchFile(
+        "\xEF\xBB\xBF<?xml version=\"1.0\" ?>\n"
+        "<!DOCTYPE list>\n"
+        "<!-- comment with <a> tag -> and ---->\n"
+        "<list>\n"
+        "  <!-- <node><name>COMMENTED</name></node> -->\n"
+        "  text between records\n"
+        "  <node units='a>b'><name>N1</name><node>nested</node></node>\n"
+        "  <empty/>\n"
+        "  <node>\n"
+        "    <![CDATA[ </node> ]]>\n"
+        "    <name>N2</name>\n"
+        "  </node>\n"
+        "</list>\n"
+        "<trailing>ignored</trailing>\n");
+    tArticle->open(tScratchFile, "list");
+
+    /// @test  A quoted '>' and a nested element of the same tag stay within the record.
+    CPPUNIT_ASSERT(tArticle->nextRecord());
+    CPPUNIT_ASSERT("node" == tArticle->getTag());
+    CPPUNIT_ASSERT("<node units='a>b'><name>N1</name><node>nested</node></node>"
+                   == tArticle->getRecord());
+    CPPUNIT_ASSERT(std::string("a>b") == tArticle->getElement()->Attribute("units"));
+
+    /// @test  Self-closing record.
+    CPPUNIT_ASSERT(tArticle->nextRecord());
+    CPPUNIT_ASSERT("empty" == tArticle->getTag());
+    CPPUNIT_ASSERT("<empty/>" == tArticle->getRecord());
+
+    /// @test  CDATA holding an end tag stays within the record.
+    CPPUNIT_ASSERT(tArticle->nextRecord());
+    CPPUNIT_ASSERT("node" == tArticle->getTag());
+    CPPUNIT_ASSERT(std::string("N2") == tArticle->getElement()->FirstChildElement("name")->GetText());
+
+    /// @test  Anything after the root is ignored.
+    CPPUNIT_ASSERT(not tArticle->nextRecord());
+    CPPUNIT_ASSERT_EQUAL(3, tArticle->getNumRecords());
+
+    /// @test  An empty, self-closing root.
+    writeScratchFile("<list/>");
+    tArticle->open(tScratchFile, "list");
+    CPPUNIT_ASSERT(not tArticle->nextRecord());
+
+    std::cout << " Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests a file spanning many read chunks, so that records straddle chunk boundaries.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermXmlStream::testLargeFile()
+{
+    std::cout << "\n ThermXmlStream 04: Testing large file .........................";
+
+    const int numNodes = 20000;
+    std::ostringstream text;
+    text << "<?xml version=\"1.0\" ?>\n<list>\n";
+    for (int i = 0; i < numNodes; ++i) {
+        text << "    <node>\n        <name>NODE_" << i << "</name>\n"
+             << "        <temperature units='K'>300.0</temperature>\n"
+             << "        <capacitance units='J/K'>" << i << ".5</capacitance>\n    </node>\n";
+    }
+    text << "</list>\n";
+    writeScratchFile(text.str());
+    CPPUNIT_ASSERT(text.str().size() > 10 * ThermXmlStream::CHUNK_SIZE);
+
+    /// @test  Every record is found intact.
+    tArticle->open(tScratchFile, "list");
+    int count = 0;
+    while (tArticle->nextRecord()) {
+        std::ostringstream name;
+        name << "NODE_" << count;
+        CPPUNIT_ASSERT(name.str() == tArticle->getElement()->FirstChildElement("name")->GetText());
+        ++count;
+    }
+    CPPUNIT_ASSERT_EQUAL(numNodes, count);
+
+    /// @test  Memory held stays at about one chunk, independent of the file size.
+    CPPUNIT_ASSERT(tArticle->getPeakBytes() < ThermXmlStream::CHUNK_SIZE + 1024);
+    CPPUNIT_ASSERT_EQUAL(static_cast<unsigned long>(text.str().size()), tArticle->getBytesRead());
+
+    std::cout << " Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for appropriate handling of off-nominal files.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermXmlStream::testErrorHandling()
+{
+    std::cout << "\n ThermXmlStream 05: Testing off-nominal files ..................";
+
+    /// @test  Use before open.
+    CPPUNIT_ASSERT_THROW(tArticle->nextRecord(), TsParseException);
+    CPPUNIT_ASSERT_THROW(tArticle->getElement(), TsParseException);
+
+    /// @test  Missing file, non-XML file, and a file without the root.
+    CPPUNIT_ASSERT_THROW(tArticle->open("no_file.net", "list"), TsParseException);
+    CPPUNIT_ASSERT_THROW(tArticle->open("main.cpp", "list"), TsParseException);
+    CPPUNIT_ASSERT_THROW(tArticle->open("ThermNodes_nolist.xml", "list"), TsParseException);
+    CPPUNIT_ASSERT(0 == tArticle->mFile);
+
+    /// @test  A record with an unclosed element runs to the end of the file.
+    tArticle->open("ThermNodes_illformed.xml", "list");
+    CPPUNIT_ASSERT(tArticle->nextRecord());
+    CPPUNIT_ASSERT_THROW(tArticle->nextRecord(), TsParseException);
+    CPPUNIT_ASSERT(0 == tArticle->mFile);
+
+    /// @test  A record with mismatched tags is found, but fails when built.
+    writeScratchFile("<list><node><name>N1</nam></node></list>");
+    tArticle->open(tScratchFile, "list");
+    CPPUNIT_ASSERT(tArticle->nextRecord());
+    CPPUNIT_ASSERT_THROW(tArticle->getElement(), TsParseException);
+
+    /// @test  Unterminated comment and tag.
+    writeScratchFile("<list><!-- no end </list>");
+    tArticle->open(tScratchFile, "list");
+    CPPUNIT_ASSERT_THROW(tArticle->nextRecord(), TsParseException);
+    writeScratchFile("<list><node name='x");
+    tArticle->open(tScratchFile, "list");
+    CPPUNIT_ASSERT_THROW(tArticle->nextRecord(), TsParseException);
+
+    std::cout << " Pass";
+}
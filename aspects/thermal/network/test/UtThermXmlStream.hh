@@ -0,0 +1,85 @@
+#ifndef UtThermXmlStream_EXISTS
+#define UtThermXmlStream_EXISTS
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_PTCS_THERMAL_NETWORK_STREAM    Thermal Network: ThermXmlStream Unit Test
+/// @ingroup  UT_PTCS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Thermal Network: ThermXmlStream
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "aspects/thermal/network/ThermXmlStream.hh"
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from ThermXmlStream and befriend UtThermXmlStream.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyThermXmlStream : public ThermXmlStream
+{
+    public:
+        FriendlyThermXmlStream();
+        virtual ~FriendlyThermXmlStream();
+        friend class UtThermXmlStream;
+};
+inline FriendlyThermXmlStream::FriendlyThermXmlStream() :
+        ThermXmlStream() {};
+inline FriendlyThermXmlStream::~FriendlyThermXmlStream() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    ThermXmlStream unit tests.
+////
+/// @details  Provides the unit tests for the ThermXmlStream within the CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtThermXmlStream: public CppUnit::TestFixture
+{
+    public:
+        /// @brief  Default Constructor.
+        UtThermXmlStream();
+        /// @brief  Default Destructor.
+        virtual ~UtThermXmlStream();
+        /// @brief  Executes after each test.
+        void tearDown();
+        /// @brief  Executes before each test.
+        void setUp();
+        /// @brief  Tests for appropriate construction.
+        void testConstruction();
+        /// @brief  Tests the sweep of a nominal config-file.
+        void testNominal();
+        /// @brief  Tests skipping of comments, CDATA and other markup between and within records.
+        void testMarkup();
+        /// @brief  Tests a file spanning many read chunks.
+        void testLargeFile();
+        /// @brief  Tests for appropriate handling of off-nominal files.
+        void testErrorHandling();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtThermXmlStream);
+        CPPUNIT_TEST(testConstruction);
+        CPPUNIT_TEST(testNominal);
+        CPPUNIT_TEST(testMarkup);
+        CPPUNIT_TEST(testLargeFile);
+        CPPUNIT_TEST(testErrorHandling);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief  (--) Test Article
+        FriendlyThermXmlStream* tArticle;
+        /// @brief  (--) Name of the scratch file written by the tests.
+        std::string tScratchFile;
+        /// @brief  Writes the given text to the scratch file.
+        void writeScratchFile(const std::string& text);
+
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        UtThermXmlStream(const UtThermXmlStream&);
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        UtThermXmlStream& operator =(const UtThermXmlStream&);
+};
+
+///@}
+
+#endif
@@ -152,6 +152,16 @@ void UtThermalNetwork::testConfig()
     CPPUNIT_ASSERT_MESSAGE( "cHtrFile", "" == configDefault.cHtrFile );
     CPPUNIT_ASSERT_MESSAGE( "cPanFile", "" == configDefault.cPanFile );
     CPPUNIT_ASSERT_MESSAGE( "cEtcFile", "" == configDefault.cEtcFile );
+    CPPUNIT_ASSERT_MESSAGE("cCacheFile", "" == configDefault.cCacheFile );
+    CPPUNIT_ASSERT_MESSAGE("cInitThreads", 1 == configDefault.cInitThreads );
+    CPPUNIT_ASSERT_MESSAGE("cHeatQueueFluxIndex", -1 == configDefault.cHeatQueueFluxIndex );
+
+    /// - Nominally construct config with link initialization threads and heat queues.
+    ThermalNetworkConfigData configInit(tNodeFile,tCondFile,tRadFile,tHtrFile,tPanFile,"","",3,2);
+    CPPUNIT_ASSERT_MESSAGE("cInitThreads", 3 == configInit.cInitThreads );
+    ThermalNetworkConfigData configInitCopy(configInit);
+    CPPUNIT_ASSERT_MESSAGE("cInitThreads", 3 == configInitCopy.cInitThreads );
+    CPPUNIT_ASSERT_MESSAGE("cHeatQueueFluxIndex", 2 == configInitCopy.cHeatQueueFluxIndex );
 
     /// - Copy construct config.
     ThermalNetworkConfigData configCopy(config);
@@ -853,6 +863,16 @@ void UtThermalNetwork::testValidate()
     CPPUNIT_ASSERT_THROW(tArticle->validate(), TsInitializationException);
     tArticle->netNumLocalNodes = tNumberNodes;
 
+    /// @test  No link initialization threads
+    tArticle->mConfig.cInitThreads = 0;
+    CPPUNIT_ASSERT_THROW(tArticle->validate(), TsInitializationException);
+    tArticle->mConfig.cInitThreads = 1;
+
+    /// @test  Heat queue flux index out of the capacitors' range
+    tArticle->mConfig.cHeatQueueFluxIndex = GunnsThermalCapacitor::NUM_EXT_HEATFLUXES;
+    CPPUNIT_ASSERT_THROW(tArticle->validate(), TsInitializationException);
+    tArticle->mConfig.cHeatQueueFluxIndex = -1;
+
     std::cout << "... Pass";
 }
 
@@ -994,6 +1014,14 @@ void UtThermalNetwork::testUpdate()
         }
     }
 
+    /// @test  The radiation links stepped with the conductivities of the radiation block.
+    CPPUNIT_ASSERT_EQUAL(tArticle->numLinksRad, tArticle->mRadiationBlock.getNumLinks());
+    for(int i = 0; i < tArticle->numLinksRad; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(tArticle->mRadiationBlock.getEffectiveConductivity(i),
+                             tArticle->mRadiationLinks[i].getEffectiveConductivity());
+    }
+
     /// - Check the island analyzer outputs.
     CPPUNIT_ASSERT(0 < tArticle->netIslandAnalyzer.getIslandSize());
 
@@ -1241,3 +1269,179 @@ void UtThermalNetwork::testSuperNetwork()
 
     std::cout << "... Pass";
 }
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that heater powers are kept set on the heaters and that capacitance edits are
+///           only applied to the links in the edited group.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermalNetwork::testLazyInputs()
+{
+    const char* test = "ThermalNetwork 14: Test lazy input changes........................";
+    std::cout << "\n " << test;
+    TEST_HS(test);
+
+    CPPUNIT_ASSERT(tArticle->numLinksHtr >= 2);
+    CPPUNIT_ASSERT(tArticle->numCapEditGroups >= 2);
+
+    /// @test  Heater powers are set on the first pass.
+    tArticle->mHtrPowerElectrical[0] = 43.5;
+    tArticle->mHtrPowerElectrical[1] = 19.0;
+    tArticle->setHeaterPowers();
+    CPPUNIT_ASSERT_EQUAL(43.5, tArticle->mHeaters[0].getPowerElectrical());
+    CPPUNIT_ASSERT_EQUAL(19.0, tArticle->mHeaters[1].getPowerElectrical());
+
+    /// @test  A power written directly to a heater is overridden on the next pass.
+    tArticle->mHeaters[0].setPowerElectrical(5.0);
+    tArticle->setHeaterPowers();
+    CPPUNIT_ASSERT_EQUAL(43.5, tArticle->mHeaters[0].getPowerElectrical());
+    CPPUNIT_ASSERT_EQUAL(19.0, tArticle->mHeaters[1].getPowerElectrical());
+
+    /// @test  A changed power is set to its heater.
+    tArticle->mHtrPowerElectrical[0] = 44.0;
+    tArticle->setHeaterPowers();
+    CPPUNIT_ASSERT_EQUAL(44.0, tArticle->mHeaters[0].getPowerElectrical());
+    CPPUNIT_ASSERT_EQUAL(19.0, tArticle->mHeaters[1].getPowerElectrical());
+
+    /// @test  The powers are still set after a restart.
+    tArticle->mHeaters[1].setPowerElectrical(6.0);
+    tArticle->restart();
+    tArticle->setHeaterPowers();
+    CPPUNIT_ASSERT_EQUAL(44.0, tArticle->mHeaters[0].getPowerElectrical());
+    CPPUNIT_ASSERT_EQUAL(19.0, tArticle->mHeaters[1].getPowerElectrical());
+
+    /// @test  The capacitance edit group lists hold each capacitor in its group, in link order.
+    CPPUNIT_ASSERT_EQUAL(tArticle->numCapEditGroups + 1,
+                         static_cast<int>(tArticle->mCapEditGroupStart.size()));
+    int listed = 0;
+    for (int group = 0; group < tArticle->numCapEditGroups; ++group) {
+        int k = tArticle->mCapEditGroupStart[group];
+        CPPUNIT_ASSERT_EQUAL(listed, k);
+        for (int i = 0; i < tArticle->numLinksCap; ++i) {
+            if (group == tArticle->mCapacitanceLinks[i].getEditCapacitanceGroup()) {
+                CPPUNIT_ASSERT_EQUAL(i, tArticle->mCapEditGroupLinks[k++]);
+            }
+        }
+        CPPUNIT_ASSERT_EQUAL(tArticle->mCapEditGroupStart[group + 1], k);
+        listed = k;
+    }
+    CPPUNIT_ASSERT(0 < tArticle->mCapEditGroupStart[1]);
+
+    /// @test  Applying a group only changes the capacitors in that group.
+    std::vector<double> original(tArticle->numLinksCap);
+    for (int i = 0; i < tArticle->numLinksCap; ++i) {
+        original[i] = tArticle->mCapacitanceLinks[i].getCapacitance();
+    }
+    tArticle->applyCapacitanceGroups(0, 2.0);
+    for (int i = 0; i < tArticle->numLinksCap; ++i) {
+        const double ratio = (0 == tArticle->mCapacitanceLinks[i].getEditCapacitanceGroup())
+                           ? 2.0 : 1.0;
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(ratio * original[i],
+                tArticle->mCapacitanceLinks[i].getCapacitance(), tTolerance);
+    }
+
+    std::cout << "... Pass";
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that initializing the links on several threads gives the same network as
+///           initializing them serially.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermalNetwork::testParallelLinks()
+{
+    const char* test = "ThermalNetwork 15: Test parallel link initialization..............";
+    std::cout << "\n " << test;
+    TEST_HS(test);
+
+    /// - Initialize the links on more threads than there are links of some types.
+    FriendlyThermalNetwork article("article");
+    article.mConfig.cNodeFile = tNodeFile;
+    article.mConfig.cCondFile = tCondFile;
+    article.mConfig.cRadFile  = tRadFile;
+    article.mConfig.cHtrFile  = tHtrFile;
+    article.mConfig.cPanFile  = tPanFile;
+    article.mConfig.cEtcFile  = tEtcFile;
+    article.mConfig.cInitThreads = 7;
+    article.initialize();
+
+    FriendlyThermalNetwork serial("article");
+    serial.mConfig.cNodeFile = tNodeFile;
+    serial.mConfig.cCondFile = tCondFile;
+    serial.mConfig.cRadFile  = tRadFile;
+    serial.mConfig.cHtrFile  = tHtrFile;
+    serial.mConfig.cPanFile  = tPanFile;
+    serial.mConfig.cEtcFile  = tEtcFile;
+    serial.initialize();
+
+    /// @test  Every link is initialized and registered in the same order, on the same nodes.
+    CPPUNIT_ASSERT(article.numLinksCap > 7);
+    CPPUNIT_ASSERT_EQUAL(serial.netLinks.size(), article.netLinks.size());
+    for (unsigned int k = 0; k < serial.netLinks.size(); ++k) {
+        CPPUNIT_ASSERT(article.netLinks[k]->isInitialized());
+        CPPUNIT_ASSERT_EQUAL(std::string(serial.netLinks[k]->getName()),
+                             std::string(article.netLinks[k]->getName()));
+        CPPUNIT_ASSERT_EQUAL(serial.netLinks[k]->getNumberPorts(),
+                             article.netLinks[k]->getNumberPorts());
+        for (int port = 0; port < serial.netLinks[k]->getNumberPorts(); ++port) {
+            CPPUNIT_ASSERT_EQUAL(serial.netLinks[k]->getNodeMap()[port],
+                                 article.netLinks[k]->getNodeMap()[port]);
+        }
+    }
+    CPPUNIT_ASSERT(&article.mCapacitanceLinks[0] == article.netLinks[0]);
+    CPPUNIT_ASSERT(&article.mSources[article.numLinksSrc - 1] == article.netLinks.back());
+
+    /// @test  The networks step the same.
+    article.update(tTimeStep);
+    serial.update(tTimeStep);
+    for (int node = 0; node < serial.netNodeList.mNumNodes; ++node) {
+        CPPUNIT_ASSERT_EQUAL(serial.netNodeList.mNodes[node].getPotential(),
+                             article.netNodeList.mNodes[node].getPotential());
+    }
+
+    std::cout << "... Pass";
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the network creates its heat queues when configured, and gives the queued heat
+///           to the capacitor links before the solver steps.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtThermalNetwork::testHeatQueues()
+{
+    const char* test = "ThermalNetwork 16: Test heat queues...............................";
+    std::cout << "\n " << test;
+    TEST_HS(test);
+
+    /// @test  No heat queues by default.
+    CPPUNIT_ASSERT(not tArticle->getHeatQueues().isInitialized());
+    CPPUNIT_ASSERT(not tArticle->getHeatQueues().addEnergy(0, 1.0));
+
+    /// - Initialize a network with heat queues on the last external heat flux.
+    const unsigned int index = GunnsThermalCapacitor::NUM_EXT_HEATFLUXES - 1;
+    FriendlyThermalNetwork article("article");
+    article.mConfig.cNodeFile = tNodeFile;
+    article.mConfig.cCondFile = tCondFile;
+    article.mConfig.cRadFile  = tRadFile;
+    article.mConfig.cHtrFile  = tHtrFile;
+    article.mConfig.cPanFile  = tPanFile;
+    article.mConfig.cEtcFile  = tEtcFile;
+    article.mConfig.cHeatQueueFluxIndex = index;
+    article.initialize();
+
+    /// @test  The heat queues are initialized on the network's capacitor links.
+    GunnsThermalNetworkHeatQueues& queues = article.getHeatQueues();
+    CPPUNIT_ASSERT(queues.isInitialized());
+    CPPUNIT_ASSERT(0 < article.numLinksCap);
+    GunnsThermalCapacitor& capacitor = article.mCapacitanceLinks[0];
+    const int node = capacitor.getNodeMap()[0];
+    CPPUNIT_ASSERT(&capacitor == queues.getCapacitor(node));
+
+    /// @test  Heat queued to a node is given to its capacitor as the average over the step, on top
+    ///        of the flux set there by another model.
+    capacitor.setExternalHeatFlux(index, 3.0);
+    CPPUNIT_ASSERT(queues.addEnergy(node, 10.0 * tTimeStep));
+    article.setIslandMode(Gunns::SOLVE);
+    article.netIslandAnalyzer.setAttachedNode(0);
+    article.update(tTimeStep);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(13.0, capacitor.getExternalHeatFlux(index), 1.0e-12);
+    CPPUNIT_ASSERT_EQUAL(0.0, queues.getQueuedEnergy(node));
+    article.update(tTimeStep);
+    CPPUNIT_ASSERT_EQUAL(3.0, capacitor.getExternalHeatFlux(index));
+
+    std::cout << "... Pass";
+}
@@ -91,6 +91,12 @@ class UtThermalNetwork: public CppUnit::TestFixture
         void testCapacitanceEdit();
         /// @brief  Tests the network in a super-network.
         void testSuperNetwork();
+        /// @brief  Tests heater powers and capacitance edits are only applied where needed.
+        void testLazyInputs();
+        /// @brief  Tests initializing the links on several threads.
+        void testParallelLinks();
+        /// @brief  Tests the network heat queues.
+        void testHeatQueues();
 
     private:
         CPPUNIT_TEST_SUITE(UtThermalNetwork);
@@ -107,6 +113,9 @@ class UtThermalNetwork: public CppUnit::TestFixture
         CPPUNIT_TEST(testAccess);
         CPPUNIT_TEST(testCapacitanceEdit);
         CPPUNIT_TEST(testSuperNetwork);
+        CPPUNIT_TEST(testLazyInputs);
+        CPPUNIT_TEST(testParallelLinks);
+        CPPUNIT_TEST(testHeatQueues);
         CPPUNIT_TEST_SUITE_END();
 
         FriendlyThermalNetwork*  tArticle; /**< (--)  pointer to test article */
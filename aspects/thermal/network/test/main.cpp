@@ -11,6 +11,9 @@ LIBRARY DEPENDENCY:
 #include <cppunit/ui/text/TestRunner.h>
 #include "UtThermalNetwork.hh"
 #include "UtThermFileParser.hh"
+#include "UtThermXmlStream.hh"
+#include "UtThermNameIndex.hh"
+#include "UtThermNetworkCache.hh"
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param    argc  int     --  used in enabling H&S
 /// @param    argv  char**  --  not used
@@ -22,7 +25,10 @@ LIBRARY DEPENDENCY:
 int main(int argc, char** argv)
 {
     CppUnit::TextTestRunner runner;
+    runner.addTest( UtThermXmlStream::suite() );
+    runner.addTest( UtThermNameIndex::suite() );
     runner.addTest( UtThermFileParser::suite() );
+    runner.addTest( UtThermNetworkCache::suite() );
     runner.addTest( UtThermalNetwork::suite() );
     runner.run();
     return 0;
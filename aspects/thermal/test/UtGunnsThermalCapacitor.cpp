@@ -9,6 +9,7 @@
     )
 ***************************************************************************************************/
 #include "UtGunnsThermalCapacitor.hh"
+#include "core/GunnsCheckpoint.hh"
 #include <iostream>
 
 #include "software/exceptions/TsInitializationException.hh"
@@ -552,5 +553,47 @@ void UtGunnsThermalCapacitor::testAccessors()
     CPPUNIT_ASSERT_THROW(tArticle->setExternalHeatFlux(GunnsThermalCapacitor::NUM_EXT_HEATFLUXES, 4.0),
                          TsOutOfBoundsException);
 
+    /// @test   getExternalHeatFlux with nominal and invalid indexes.
+    CPPUNIT_ASSERT(2.0 == tArticle->getExternalHeatFlux(0));
+    CPPUNIT_ASSERT(3.0 == tArticle->getExternalHeatFlux(GunnsThermalCapacitor::NUM_EXT_HEATFLUXES-1));
+    CPPUNIT_ASSERT_THROW(tArticle->getExternalHeatFlux(GunnsThermalCapacitor::NUM_EXT_HEATFLUXES),
+                         TsOutOfBoundsException);
+
+    std::cout << "... Pass";
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///// @details  Tests the native checkpoint save & load of the capacitor's state.
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalCapacitor::testCheckpoint()
+{
+    std::cout << "\n UtGunnsThermalCapacitor 13: testCheckpoint ......................";
+
+    /// - Step the network and save the capacitor's state.
+    tGunnsSolver.step(tTimeStep);
+    const double temperature = tArticle->mTemperature;
+    std::vector<unsigned char> buffer;
+    GunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&buffer);
+    tArticle->saveCheckpoint(writer);
+    writer.close();
+
+    /// - Edit the capacitance and change the temperature.
+    tArticle->setCapacitance(2.0 * tDefaultCapacitance);
+    tArticle->mTemperature = temperature + 10.0;
+
+    /// @test   The loaded state is the state that was saved.
+    GunnsCheckpointReader reader("reader");
+    reader.openBuffer(&buffer);
+    tArticle->loadCheckpoint(reader);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+    CPPUNIT_ASSERT(tDefaultCapacitance == tArticle->getCapacitance());
+    CPPUNIT_ASSERT(temperature         == tArticle->mTemperature);
+
+    /// @test   The capacitor opts in to native checkpoints, but a type derived from it doesn't.
+    GunnsThermalCapacitor article;
+    CPPUNIT_ASSERT(article.isCheckpointable());
+    CPPUNIT_ASSERT(not tArticle->isCheckpointable());
+
     std::cout << "... Pass";
 }
@@ -31,6 +31,7 @@ class FriendlyGunnsThermalCapacitor : public GunnsThermalCapacitor
         virtual ~FriendlyGunnsThermalCapacitor();
         friend class UtGunnsThermalCapacitor;
         friend class UtGunnsThermalCapacitorHeatQueues;
+        friend class UtGunnsThermalNetworkHeatQueues;
 };
 inline FriendlyGunnsThermalCapacitor::FriendlyGunnsThermalCapacitor() : GunnsThermalCapacitor() {};
 inline FriendlyGunnsThermalCapacitor::~FriendlyGunnsThermalCapacitor() {}
@@ -75,6 +76,8 @@ class UtGunnsThermalCapacitor: public CppUnit::TestFixture
         void testTemperatureOverrride();
         /// @brief  Tests setter and getter methods. */
         void testAccessors();
+        /// @brief  Tests the native checkpoint save & load.
+        void testCheckpoint();
 
     private:
         CPPUNIT_TEST_SUITE(UtGunnsThermalCapacitor);
@@ -90,6 +93,7 @@ class UtGunnsThermalCapacitor: public CppUnit::TestFixture
         CPPUNIT_TEST(testTemperatureRecord);
         CPPUNIT_TEST(testTemperatureOverrride);
         CPPUNIT_TEST(testAccessors);
+        CPPUNIT_TEST(testCheckpoint);
         CPPUNIT_TEST_SUITE_END();
 
         GunnsThermalCapacitorConfigData* tConfigData; /**< (--)   Pointer to nominal configuration data */
@@ -6,6 +6,7 @@
     ((aspects/thermal/GunnsThermalHeater.o))
 ***************************************************************************************************/
 #include "UtGunnsThermalHeater.hh"
+#include "core/GunnsCheckpoint.hh"
 #include <iostream>
 #include "software/exceptions/TsInitializationException.hh"
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -342,3 +343,46 @@ void UtGunnsThermalHeater::testValidation()
 
     std::cout << "... Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the native checkpoint save & load of the heater's state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalHeater::testCheckpoint()
+{
+    std::cout << "\n UtGunnsThermalHeater .. 09: testCheckpoint ......................";
+
+    /// - Step the heater with power & a flux override malfunction, and save its state.
+    tArticle1->setPowerElectrical(tPower);
+    tArticle1->mMalfFluxOverrideFlag  = true;
+    tArticle1->mMalfFluxOverrideValue = tMalfFluxOverrideValue;
+    tArticle1->step(tTimeStep);
+    const double flux = tArticle1->mFlux;
+    std::vector<unsigned char> buffer;
+    GunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&buffer);
+    tArticle1->saveCheckpoint(writer);
+    writer.close();
+
+    /// - Change the power and malfunction and step again.
+    tArticle1->setPowerElectrical(2.0 * tPower);
+    tArticle1->mMalfFluxOverrideFlag  = false;
+    tArticle1->mMalfFluxOverrideValue = 0.0;
+    tArticle1->step(tTimeStep);
+
+    /// @test  The loaded state is the state that was saved.
+    GunnsCheckpointReader reader("reader");
+    reader.openBuffer(&buffer);
+    tArticle1->loadCheckpoint(reader);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+    CPPUNIT_ASSERT(tPower                 == tArticle1->getPowerElectrical());
+    CPPUNIT_ASSERT(tArticle1->mMalfFluxOverrideFlag);
+    CPPUNIT_ASSERT(tMalfFluxOverrideValue == tArticle1->mMalfFluxOverrideValue);
+    CPPUNIT_ASSERT(flux                   == tArticle1->mFlux);
+
+    /// @test  The heater opts in to native checkpoints, but a type derived from it doesn't.
+    GunnsThermalHeater article;
+    CPPUNIT_ASSERT(article.isCheckpointable());
+    CPPUNIT_ASSERT(not tArticle1->isCheckpointable());
+
+    std::cout << "... Pass";
+}
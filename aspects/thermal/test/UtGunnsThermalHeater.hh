@@ -63,6 +63,8 @@ class UtGunnsThermalHeater: public CppUnit::TestFixture
         void testStep();
         /// @brief    Tests appropriate exceptions are thrown during validation.
         void testValidation();
+        /// @brief  Tests the native checkpoint save & load.
+        void testCheckpoint();
 
     private:
         CPPUNIT_TEST_SUITE(UtGunnsThermalHeater);
@@ -74,6 +76,7 @@ class UtGunnsThermalHeater: public CppUnit::TestFixture
         CPPUNIT_TEST(testUpdateState);
         CPPUNIT_TEST(testStep);
         CPPUNIT_TEST(testValidation);
+        CPPUNIT_TEST(testCheckpoint);
         CPPUNIT_TEST_SUITE_END();
 
         std::string  tName;  /**< (--) Heater name */
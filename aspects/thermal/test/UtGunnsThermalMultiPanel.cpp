@@ -6,6 +6,7 @@
     ((aspects/thermal/GunnsThermalMultiPanel.o))
 ***************************************************************************************************/
 #include "UtGunnsThermalMultiPanel.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include <iostream>
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -598,3 +599,46 @@ void UtGunnsThermalMultiPanel::setupIncidentFluxes()
     tArticle3->mIncidentFlux[3] = tIncidentFlux[3];
     tArticle3->mIncidentFlux[4] = tIncidentFlux[4];
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the native checkpoint save & load of the panel's state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalMultiPanel::testCheckpoint()
+{
+    std::cout << "\n UtGunnsThermalMultiPanel . 10: testCheckpoint ...................";
+
+    /// - Step the panel with incident fluxes and save its state.
+    setupIncidentFluxes();
+    tArticle1->step(tTimeStep);
+    const double flux = tArticle1->mFlux;
+    std::vector<unsigned char> buffer;
+    GunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&buffer);
+    tArticle1->saveCheckpoint(writer);
+    writer.close();
+
+    /// - Change the view scalars & incident fluxes and step again.
+    for (int i = 0; i < 5; i++) {
+        tArticle1->mViewScalar[i]   = 0.5 * tViewScalar[i];
+        tArticle1->mIncidentFlux[i] = 2.0 * tIncidentFlux[i];
+    }
+    tArticle1->step(tTimeStep);
+
+    /// @test  The loaded state is the state that was saved.
+    GunnsCheckpointReader reader("reader");
+    reader.openBuffer(&buffer);
+    tArticle1->loadCheckpoint(reader);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+    for (int i = 0; i < 5; i++) {
+        CPPUNIT_ASSERT(tViewScalar[i]   == tArticle1->getViewScalar(i));
+        CPPUNIT_ASSERT(tIncidentFlux[i] == tArticle1->getIncidentFlux(i));
+    }
+    CPPUNIT_ASSERT(flux == tArticle1->mFlux);
+
+    /// @test  The panel opts in to native checkpoints, but a type derived from it doesn't.
+    GunnsThermalMultiPanel article;
+    CPPUNIT_ASSERT(article.isCheckpointable());
+    CPPUNIT_ASSERT(not tArticle1->isCheckpointable());
+
+    std::cout << "... Pass";
+}
@@ -65,6 +65,8 @@ class UtGunnsThermalMultiPanel: public CppUnit::TestFixture
         void testRestart();
         /// @brief    Tests accessor methods.
         void testAccessors();
+        /// @brief  Tests the native checkpoint save & load.
+        void testCheckpoint();
 
     private:
         CPPUNIT_TEST_SUITE(UtGunnsThermalMultiPanel);
@@ -77,6 +79,7 @@ class UtGunnsThermalMultiPanel: public CppUnit::TestFixture
         CPPUNIT_TEST(testStep);
         CPPUNIT_TEST(testRestart);
         CPPUNIT_TEST(testAccessors);
+        CPPUNIT_TEST(testCheckpoint);
         CPPUNIT_TEST_SUITE_END();
 
         std::string  tName;  /**< (--) Test Article name */
@@ -0,0 +1,225 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+ ((aspects/thermal/GunnsThermalNetworkHeatQueues.o))
+***************************************************************************************************/
+
+#include "software/exceptions/TsInitializationException.hh"
+#include "UtGunnsThermalNetworkHeatQueues.hh"
+#include <pthread.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  arg  (--)  Pointer to the network heat queues to write.
+///
+/// @returns  void*  (--)  Always null.
+///
+/// @details  Writer thread for the queues test.  It adds 0.5 J to node 0 and 0.25 J to node 1 many
+///           times, which sum exactly in any order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void* writeNetworkHeatQueues(void* arg)
+{
+    GunnsThermalNetworkHeatQueues* queues = static_cast<GunnsThermalNetworkHeatQueues*>(arg);
+    for (int i = 0; i < 10000; ++i) {
+        queues->addEnergy(0, 0.5);
+        queues->addHeat(1, 2.5, 0.1);
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsThermalNetworkHeatQueues class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsThermalNetworkHeatQueues::UtGunnsThermalNetworkHeatQueues()
+    :
+    tArticle(0),
+    tName("test article"),
+    tConfig(tName, 3),
+    tInput(),
+    tNodes(),
+    tNodeList(),
+    tLinks(),
+    tCapacitors()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsThermalNetworkHeatQueues class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsThermalNetworkHeatQueues::~UtGunnsThermalNetworkHeatQueues()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalNetworkHeatQueues::tearDown()
+{
+    delete tArticle;
+    tArticle = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.  Sets up a network with capacitors on nodes 0 and 1
+///           and none on node 2.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalNetworkHeatQueues::setUp()
+{
+    tNodeList.mNumNodes = N_NODES;
+    tNodeList.mNodes    = tNodes;
+    for (int i = 0; i < N_NODES; ++i) {
+        tNodes[i].initialize("node");
+    }
+    tLinks.clear();
+    GunnsThermalCapacitorConfigData capConfig("capacitor", &tNodeList);
+    GunnsThermalCapacitorInputData  capInput(false, 0.0, 100.0, 300.0);
+    tCapacitors[0].initialize(capConfig, capInput, tLinks, 0, 2);
+    tCapacitors[1].initialize(capConfig, capInput, tLinks, 1, 2);
+
+    tArticle = new FriendlyGunnsThermalNetworkHeatQueues(tNodeList, tLinks);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the config and input data classes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalNetworkHeatQueues::testConfigAndInput()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsThermalNetworkHeatQueues 01: testConfigAndInput ..........";
+
+    /// @test  Nominal config data construction.
+    CPPUNIT_ASSERT(tName == tConfig.mName);
+    CPPUNIT_ASSERT(3     == tConfig.mFluxIndex);
+
+    /// @test  Default config data construction.
+    GunnsThermalNetworkHeatQueuesConfigData defaultConfig(tName);
+    CPPUNIT_ASSERT(0 == defaultConfig.mFluxIndex);
+
+    /// @test  Input data construction and destruction for code coverage.
+    GunnsThermalNetworkHeatQueuesInputData* input = new GunnsThermalNetworkHeatQueuesInputData();
+    delete input;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests initialization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalNetworkHeatQueues::testInitialize()
+{
+    std::cout << "\n UtGunnsThermalNetworkHeatQueues 02: testInitialize ..............";
+
+    /// @test  Initialization exceptions on bad config & input data types and flux index.
+    GunnsThermalCapacitorHeatQueuesConfigData badConfig(tName);
+    GunnsThermalCapacitorHeatQueuesInputData  badInput;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(&badConfig, &tInput), TsInitializationException);
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(&tConfig, &badInput), TsInitializationException);
+    GunnsThermalNetworkHeatQueuesConfigData badIndex(tName, GunnsThermalCapacitor::NUM_EXT_HEATFLUXES);
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(&badIndex, &tInput), TsInitializationException);
+    CPPUNIT_ASSERT(not tArticle->isInitialized());
+
+    /// @test  Heat can't be queued before initialization.
+    CPPUNIT_ASSERT(not tArticle->addEnergy(0, 1.0));
+
+    /// @test  Nominal initialization finds the capacitor on each node and empties the queues.
+    CPPUNIT_ASSERT_NO_THROW(tArticle->initialize(&tConfig, &tInput));
+    CPPUNIT_ASSERT(tArticle->isInitialized());
+    CPPUNIT_ASSERT(3 == tArticle->mFluxIndex);
+    CPPUNIT_ASSERT(&tCapacitors[0] == tArticle->getCapacitor(0));
+    CPPUNIT_ASSERT(&tCapacitors[1] == tArticle->getCapacitor(1));
+    CPPUNIT_ASSERT(0 == tArticle->getCapacitor(2));
+    CPPUNIT_ASSERT(0 == tArticle->getCapacitor(-1));
+    CPPUNIT_ASSERT(0 == tArticle->getCapacitor(N_NODES));
+    for (int i = 0; i < N_NODES; ++i) {
+        CPPUNIT_ASSERT(0   == tArticle->mEnergy[i]);
+        CPPUNIT_ASSERT(0.0 == tArticle->mBaseFlux[i]);
+        CPPUNIT_ASSERT(0.0 == tArticle->mLastFlux[i]);
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests queueing heat, from several threads at once.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalNetworkHeatQueues::testQueues()
+{
+    std::cout << "\n UtGunnsThermalNetworkHeatQueues 03: testQueues ..................";
+
+    tArticle->initialize(&tConfig, &tInput);
+
+    /// @test  Heat can't be queued to nodes without a capacitor.
+    CPPUNIT_ASSERT(not tArticle->addEnergy(2, 1.0));
+    CPPUNIT_ASSERT(not tArticle->addEnergy(N_NODES, 1.0));
+    CPPUNIT_ASSERT_EQUAL(0.0, tArticle->getQueuedEnergy(2));
+
+    /// @test  Heat written from several threads is all queued.
+    pthread_t threads[4];
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT(0 == pthread_create(&threads[i], 0, writeNetworkHeatQueues, tArticle));
+    }
+    for (int i = 0; i < 4; ++i) {
+        pthread_join(threads[i], 0);
+    }
+    CPPUNIT_ASSERT_EQUAL(20000.0, tArticle->getQueuedEnergy(0));
+    CPPUNIT_ASSERT_EQUAL(10000.0, tArticle->getQueuedEnergy(1));
+
+    /// @test  Draining a queue takes its energy and leaves it empty.
+    CPPUNIT_ASSERT_EQUAL(20000.0, tArticle->drainEnergy(0));
+    CPPUNIT_ASSERT_EQUAL(0.0,     tArticle->getQueuedEnergy(0));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests giving the queued heat to the capacitors, and that it's added to
+///           the flux other models set on the capacitors rather than replacing it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalNetworkHeatQueues::testStep()
+{
+    std::cout << "\n UtGunnsThermalNetworkHeatQueues 04: testStep ....................";
+
+    /// - Another model has already set a flux on capacitor 1.
+    tCapacitors[1].setExternalHeatFlux(3, 4.0);
+    tArticle->initialize(&tConfig, &tInput);
+    CPPUNIT_ASSERT(tArticle->addEnergy(0, 20.0));
+    CPPUNIT_ASSERT(tArticle->addEnergy(1, 10.0));
+
+    /// @test  Nothing is drained on a zero step.
+    tArticle->stepPreSolver(0.0);
+    CPPUNIT_ASSERT_EQUAL(0.0,  tCapacitors[0].mExternalHeatFlux[3]);
+    CPPUNIT_ASSERT_EQUAL(4.0,  tCapacitors[1].mExternalHeatFlux[3]);
+    CPPUNIT_ASSERT_EQUAL(20.0, tArticle->getQueuedEnergy(0));
+
+    /// @test  The queues are drained into the capacitors as the average heat over the step, added
+    ///        to the flux already there.
+    tArticle->stepPreSolver(10.0);
+    CPPUNIT_ASSERT_EQUAL(2.0, tCapacitors[0].mExternalHeatFlux[3]);
+    CPPUNIT_ASSERT_EQUAL(5.0, tCapacitors[1].mExternalHeatFlux[3]);
+    CPPUNIT_ASSERT_EQUAL(0.0, tArticle->getQueuedEnergy(0));
+    CPPUNIT_ASSERT_EQUAL(0.0, tArticle->getQueuedEnergy(1));
+
+    /// @test  Capacitors with empty queues are left with the other models' flux, and the spotter's
+    ///        own heat isn't taken as theirs.
+    tArticle->stepPreSolver(10.0);
+    CPPUNIT_ASSERT_EQUAL(0.0, tCapacitors[0].mExternalHeatFlux[3]);
+    CPPUNIT_ASSERT_EQUAL(4.0, tCapacitors[1].mExternalHeatFlux[3]);
+
+    /// @test  A flux another model writes between steps is kept, and the queued heat is added to
+    ///        it for as long as it stands.
+    tCapacitors[0].setExternalHeatFlux(3, 7.0);
+    CPPUNIT_ASSERT(tArticle->addHeat(0, 50.0, 0.5));
+    tArticle->stepPreSolver(0.25);
+    CPPUNIT_ASSERT_EQUAL(107.0, tCapacitors[0].mExternalHeatFlux[3]);
+    tArticle->stepPreSolver(0.25);
+    CPPUNIT_ASSERT_EQUAL(7.0,   tCapacitors[0].mExternalHeatFlux[3]);
+
+    /// @test  Other external heat fluxes of the capacitors are untouched.
+    CPPUNIT_ASSERT_EQUAL(0.0, tCapacitors[0].mExternalHeatFlux[0]);
+    tArticle->stepPostSolver(0.25);
+
+    std::cout << "... Pass";
+}
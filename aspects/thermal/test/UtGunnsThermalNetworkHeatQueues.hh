@@ -0,0 +1,89 @@
+#ifndef UtGunnsThermalNetworkHeatQueues_EXISTS
+#define UtGunnsThermalNetworkHeatQueues_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_THERMAL_NETWORK_HEAT_QUEUES    Gunns Thermal Network Heat Queues Spotter Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Gunns Thermal Network Heat Queues Spotter class
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "aspects/thermal/GunnsThermalNetworkHeatQueues.hh"
+#include "aspects/thermal/GunnsThermalCapacitorHeatQueues.hh"
+#include "UtGunnsThermalCapacitor.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsThermalNetworkHeatQueues and befriend UtGunnsThermalNetworkHeatQueues.
+///
+/// @details  Class derived from the unit under test.  It has a constructor with the same arguments
+///           as the parent and a default destructor, but it befriends the unit test case driver
+///           class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsThermalNetworkHeatQueues : public GunnsThermalNetworkHeatQueues
+{
+    public:
+        FriendlyGunnsThermalNetworkHeatQueues(GunnsNodeList& nodeList, std::vector<GunnsBasicLink*>& links)
+            : GunnsThermalNetworkHeatQueues(nodeList, links) {};
+        virtual ~FriendlyGunnsThermalNetworkHeatQueues() {;}
+        friend class UtGunnsThermalNetworkHeatQueues;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Thermal Network Heat Queues Spotter Unit Tests.
+///
+/// @details  This class provides the unit tests for the GunnsThermalNetworkHeatQueues class within
+///           the CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsThermalNetworkHeatQueues : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this GunnsThermalNetworkHeatQueues unit test.
+        UtGunnsThermalNetworkHeatQueues();
+        /// @brief    Default destructs this GunnsThermalNetworkHeatQueues unit test.
+        virtual ~UtGunnsThermalNetworkHeatQueues();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests the config and input data classes.
+        void testConfigAndInput();
+        /// @brief    Tests initialization.
+        void testInitialize();
+        /// @brief    Tests queueing heat from several threads.
+        void testQueues();
+        /// @brief    Tests the stepPreSolver and stepPostSolver methods.
+        void testStep();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsThermalNetworkHeatQueues);
+        CPPUNIT_TEST(testConfigAndInput);
+        CPPUNIT_TEST(testInitialize);
+        CPPUNIT_TEST(testQueues);
+        CPPUNIT_TEST(testStep);
+        CPPUNIT_TEST_SUITE_END();
+        /// @brief    Enumeration for the number of nodes.
+        enum {N_NODES = 3};
+        FriendlyGunnsThermalNetworkHeatQueues*  tArticle;        /**< (--) Test article. */
+        std::string                             tName;           /**< (--) Instance name. */
+        GunnsThermalNetworkHeatQueuesConfigData tConfig;         /**< (--) Nominal config data. */
+        GunnsThermalNetworkHeatQueuesInputData  tInput;          /**< (--) Nominal input data. */
+        GunnsBasicNode                          tNodes[N_NODES]; /**< (--) Network nodes. */
+        GunnsNodeList                           tNodeList;       /**< (--) Network node list. */
+        std::vector<GunnsBasicLink*>            tLinks;          /**< (--) Network links. */
+        FriendlyGunnsThermalCapacitor           tCapacitors[2];  /**< (--) Capacitors on nodes 0 and 1. */
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsThermalNetworkHeatQueues(const UtGunnsThermalNetworkHeatQueues& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsThermalNetworkHeatQueues& operator =(const UtGunnsThermalNetworkHeatQueues& that);
+};
+
+///@}
+
+#endif
@@ -6,6 +6,7 @@
     ((aspects/thermal/GunnsThermalPanel.o))
 ***************************************************************************************************/
 #include "UtGunnsThermalPanel.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include <iostream>
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -393,3 +394,39 @@ void UtGunnsThermalPanel::testStep()
 
     std::cout << "... Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the native checkpoint save & load of the panel's state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalPanel::testCheckpoint()
+{
+    std::cout << "\n UtGunnsThermalPanel ... 08: testCheckpoint ......................";
+
+    /// - Step the panel with an incident flux and save its state.
+    tArticle1->mIncidentHeatFluxPerArea = tIncidentHeatFluxPerArea;
+    tArticle1->step(tTimeStep);
+    std::vector<unsigned char> buffer;
+    GunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&buffer);
+    tArticle1->saveCheckpoint(writer);
+    writer.close();
+
+    /// - Change the incident flux and step again.
+    tArticle1->mIncidentHeatFluxPerArea = 2.0 * tIncidentHeatFluxPerArea;
+    tArticle1->step(tTimeStep);
+
+    /// @test  The loaded state is the state that was saved.
+    GunnsCheckpointReader reader("reader");
+    reader.openBuffer(&buffer);
+    tArticle1->loadCheckpoint(reader);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+    CPPUNIT_ASSERT(tIncidentHeatFluxPerArea == tArticle1->mIncidentHeatFluxPerArea);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tFlux, tArticle1->mFlux, tTol);
+
+    /// @test  The panel opts in to native checkpoints, but a type derived from it doesn't.
+    GunnsThermalPanel article;
+    CPPUNIT_ASSERT(article.isCheckpointable());
+    CPPUNIT_ASSERT(not tArticle1->isCheckpointable());
+
+    std::cout << "... Pass";
+}
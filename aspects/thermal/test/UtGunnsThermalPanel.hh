@@ -61,6 +61,8 @@ class UtGunnsThermalPanel: public CppUnit::TestFixture
         void testUpdateState();
         /// @brief  Test the step() method.
         void testStep();
+        /// @brief  Tests the native checkpoint save & load.
+        void testCheckpoint();
 
     private:
         CPPUNIT_TEST_SUITE(UtGunnsThermalPanel);
@@ -71,6 +73,7 @@ class UtGunnsThermalPanel: public CppUnit::TestFixture
         CPPUNIT_TEST(testValidation);
         CPPUNIT_TEST(testUpdateState);
         CPPUNIT_TEST(testStep);
+        CPPUNIT_TEST(testCheckpoint);
         CPPUNIT_TEST_SUITE_END();
 
         std::string  tName;  /**< (--) Thermal panel link name */
@@ -9,6 +9,7 @@
 ***************************************************************************************************/
 
 #include "UtGunnsThermalPotential.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -228,3 +229,42 @@ void UtGunnsThermalPotential::testSpecificPortRules()
 
     std::cout << "... Pass";
 }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the native checkpoint save & load of the potential's state.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalPotential::testCheckpoint()
+{
+    std::cout << "\n UtGunnsThermalPotential 07: testCheckpoint.......................";
+
+    /// - Set the source potential & heat flux and save the state.
+    tArticle.setSourcePotential(tInitialPotential + 10.0);
+    tArticle.mFlux = 4.0;
+    tArticle.processOutputs();
+    std::vector<unsigned char> buffer;
+    GunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&buffer);
+    tArticle.saveCheckpoint(writer);
+    writer.close();
+
+    /// - Change the source potential & heat flux.
+    tArticle.setSourcePotential(tInitialPotential);
+    tArticle.mFlux = 8.0;
+    tArticle.processOutputs();
+
+    /// @test The loaded state is the state that was saved.
+    GunnsCheckpointReader reader("reader");
+    reader.openBuffer(&buffer);
+    tArticle.loadCheckpoint(reader);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+    CPPUNIT_ASSERT(tInitialPotential + 10.0 == tArticle.getSourcePotential());
+    CPPUNIT_ASSERT(4.0                      == tArticle.mFlux);
+    CPPUNIT_ASSERT(-4.0                     == tArticle.mHeatFluxIntoNode);
+
+    /// @test The potential opts in to native checkpoints, but a type derived from it doesn't.
+    GunnsThermalPotential article;
+    CPPUNIT_ASSERT(article.isCheckpointable());
+    CPPUNIT_ASSERT(not tArticle.isCheckpointable());
+
+    std::cout << "... Pass";
+}
@@ -72,6 +72,9 @@ class UtGunnsThermalPotential: public CppUnit::TestFixture
         /// @brief    Tests checkSpecificPortRules method
         void testSpecificPortRules();
 
+        /// @brief    Tests the native checkpoint save & load
+        void testCheckpoint();
+
     private:
         CPPUNIT_TEST_SUITE(UtGunnsThermalPotential);
         CPPUNIT_TEST(testConfig);
@@ -80,6 +83,7 @@ class UtGunnsThermalPotential: public CppUnit::TestFixture
         CPPUNIT_TEST(testInitialization);
         CPPUNIT_TEST(testProcessOutputs);
         CPPUNIT_TEST(testSpecificPortRules);
+        CPPUNIT_TEST(testCheckpoint);
         CPPUNIT_TEST_SUITE_END();
 
 
@@ -8,6 +8,7 @@
     )
 ***************************************************************************************************/
 #include "UtGunnsThermalRadiation.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -284,3 +285,40 @@ void UtGunnsThermalRadiation::testUpdateState()
 
     std::cout << "... Pass";
 }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the native checkpoint save & load of the radiation link's state.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiation::testCheckpoint()
+{
+    std::cout << "\n UtGunnsThermalRadiation 08: testCheckpoint.......................";
+
+    /// - Step with a new view scalar and save the state.
+    tArticle.setViewScalar(0.5 * tViewScalar);
+    tArticle.step(tTimeStep);
+    const double flux = tArticle.mFlux;
+    std::vector<unsigned char> buffer;
+    GunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&buffer);
+    tArticle.saveCheckpoint(writer);
+    writer.close();
+
+    /// - Change the view scalar and flux.
+    tArticle.setViewScalar(tViewScalar);
+    tArticle.mFlux = flux + 1.0;
+
+    /// @test The loaded state is the state that was saved.
+    GunnsCheckpointReader reader("reader");
+    reader.openBuffer(&buffer);
+    tArticle.loadCheckpoint(reader);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+    CPPUNIT_ASSERT(0.5 * tViewScalar == tArticle.getViewScalar());
+    CPPUNIT_ASSERT(flux              == tArticle.mFlux);
+
+    /// @test The radiation link opts in to native checkpoints, but a type derived from it doesn't.
+    GunnsThermalRadiation article;
+    CPPUNIT_ASSERT(article.isCheckpointable());
+    CPPUNIT_ASSERT(not tArticle.isCheckpointable());
+
+    std::cout << "... Pass";
+}
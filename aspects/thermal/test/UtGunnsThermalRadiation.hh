@@ -75,6 +75,9 @@ class UtGunnsThermalRadiation: public CppUnit::TestFixture
         /// @brief    Tests method for updating the link
         void testUpdateState();
 
+        /// @brief    Tests the native checkpoint save & load
+        void testCheckpoint();
+
     private:
 
         CPPUNIT_TEST_SUITE(UtGunnsThermalRadiation);
@@ -85,6 +88,7 @@ class UtGunnsThermalRadiation: public CppUnit::TestFixture
         CPPUNIT_TEST(testRestart);
         CPPUNIT_TEST(testAccessors);
         CPPUNIT_TEST(testUpdateState);
+        CPPUNIT_TEST(testCheckpoint);
         CPPUNIT_TEST_SUITE_END();
 
         /// @brief  (--)  Pointer to nominal configuration data
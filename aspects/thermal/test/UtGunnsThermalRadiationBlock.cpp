@@ -0,0 +1,306 @@
+/************************** TRICK HEADER ***********************************************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+    (
+        (aspects/thermal/GunnsThermalRadiationBlock.o)
+    )
+***************************************************************************************************/
+#include "UtGunnsThermalRadiationBlock.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <sstream>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsThermalRadiationBlock class.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsThermalRadiationBlock::UtGunnsThermalRadiationBlock()
+    :
+    tArticle(0),
+    tLinks(0),
+    tReference(0),
+    tName(),
+    tNodes(),
+    tNodeList(),
+    tNetworkLinks(),
+    tReferenceLinks(),
+    tPort0(),
+    tPort1(),
+    tTimeStep()
+{
+    // Nothing to do
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsThermalRadiationBlock class.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsThermalRadiationBlock::~UtGunnsThermalRadiationBlock()
+{
+    // Nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBlock::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete [] tReference;
+    delete [] tLinks;
+    delete tArticle;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBlock::setUp()
+{
+    tName               = "tArticle";
+    tNodeList.mNumNodes = N_NODES;
+    tNodeList.mNodes    = tNodes;
+    tTimeStep           = 0.1;
+    tNetworkLinks.clear();
+    tReferenceLinks.clear();
+
+    /// - Nodes 0 and 2 are left at the same potential later, and node 3 is the ground node.
+    const int    port0[N_LINKS] = {0,    1,     2,     0,    0};
+    const int    port1[N_LINKS] = {1,    2,     3,     3,    2};
+    const double view [N_LINKS] = {1.0,  0.6,   0.25,  0.0,  0.9};
+    const double cond [N_LINKS] = {1.0,  2.5,   1.0e-7, 3.0, 0.5};
+
+    /// - Initialize the links and a matching set of reference links outside any block.
+    tLinks     = new FriendlyGunnsThermalRadiationBlockLink[N_LINKS];
+    tReference = new FriendlyGunnsThermalRadiationBlockLink[N_LINKS];
+    for (int i = 0; i < N_LINKS; ++i) {
+        std::ostringstream name;
+        name << "tLinks_" << i;
+        tPort0[i] = port0[i];
+        tPort1[i] = port1[i];
+        GunnsThermalRadiationConfigData config(name.str(), &tNodeList, cond[i]);
+        GunnsThermalRadiationInputData  input(false, 0.0, view[i]);
+        tLinks[i].initialize    (config, input, tNetworkLinks,   port0[i], port1[i]);
+        tReference[i].initialize(config, input, tReferenceLinks, port0[i], port1[i]);
+    }
+
+    /// - Construct the test article.
+    tArticle = new FriendlyGunnsThermalRadiationBlock(tName);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  potentials  (K)  Potential of each node, the last being ground.
+///
+/// @details  Sets the node potentials, and copies them to the link ports as the solver would.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBlock::setPotentials(const double* potentials)
+{
+    for (int node = 0; node < N_NODES; ++node) {
+        tNodes[node].setPotential(potentials[node]);
+    }
+    for (int i = 0; i < N_LINKS; ++i) {
+        tLinks[i].mPotentialVector[0]     = potentials[tPort0[i]];
+        tLinks[i].mPotentialVector[1]     = potentials[tPort1[i]];
+        tReference[i].mPotentialVector[0] = potentials[tPort0[i]];
+        tReference[i].mPotentialVector[1] = potentials[tPort1[i]];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBlock::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsThermalRadiationBlock 01: testDefaultConstruction ........";
+
+    /// @test Default values on construction
+    CPPUNIT_ASSERT(tName == tArticle->mName);
+    CPPUNIT_ASSERT(0     == tArticle->mNodeList);
+    CPPUNIT_ASSERT(0     == tArticle->getNumLinks());
+    CPPUNIT_ASSERT(tArticle->mPort0.empty());
+    CPPUNIT_ASSERT(tArticle->mEffectiveConductivity.empty());
+    CPPUNIT_ASSERT(tArticle->mNodeT4.empty());
+
+    /// @test Links start out of any block.
+    CPPUNIT_ASSERT(0 == tLinks[0].mBlock);
+    CPPUNIT_ASSERT(0 == tLinks[0].mBlockIndex);
+
+    /// @test Update of an empty block does nothing.
+    tArticle->update();
+
+    /// @test Dynamic new/delete for code coverage of destructor.
+    GunnsThermalRadiationBlock* article2 = new GunnsThermalRadiationBlock;
+    delete article2;
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for initialization.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBlock::testInitialization()
+{
+    std::cout << "\n UtGunnsThermalRadiationBlock 02: testInitialization .............";
+
+    tArticle->initialize(tNodeList, tLinks, N_LINKS);
+
+    /// @test Block arrays are gathered from the links.
+    CPPUNIT_ASSERT(&tNodeList == tArticle->mNodeList);
+    CPPUNIT_ASSERT(N_LINKS    == tArticle->getNumLinks());
+    CPPUNIT_ASSERT(N_NODES    == static_cast<int>(tArticle->mNodeTemperature.size()));
+    for (int i = 0; i < N_LINKS; ++i) {
+        CPPUNIT_ASSERT(tPort0[i]                      == tArticle->mPort0[i]);
+        CPPUNIT_ASSERT(tPort1[i]                      == tArticle->mPort1[i]);
+        CPPUNIT_ASSERT(tLinks[i].mViewScalar          == tArticle->mViewScalar[i]);
+        CPPUNIT_ASSERT(tLinks[i].mDefaultConductivity == tArticle->mDefaultConductivity[i]);
+        CPPUNIT_ASSERT(tLinks[i].mDefaultConductivity == tArticle->getEffectiveConductivity(i));
+        CPPUNIT_ASSERT(tArticle == tLinks[i].mBlock);
+        CPPUNIT_ASSERT(i        == tLinks[i].mBlockIndex);
+    }
+
+    /// @test No link is current before the first update.
+    CPPUNIT_ASSERT(tArticle->mNodeTemperature[0] != tArticle->mNodeTemperature[0]);
+    CPPUNIT_ASSERT(not tArticle->isCurrent(0, 0.0, 0.0, tLinks[0].mViewScalar,
+                                           tLinks[0].mDefaultConductivity));
+
+    /// @test Detaching a link from its block.
+    tLinks[0].setBlock(0, 0);
+    CPPUNIT_ASSERT(0 == tLinks[0].mBlock);
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests for initialization exceptions.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBlock::testInitializationExceptions()
+{
+    std::cout << "\n UtGunnsThermalRadiationBlock 03: testInitializationExceptions ...";
+
+    /// @test Exception on negative link count or missing link array.
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tNodeList, tLinks, -1), TsInitializationException);
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(tNodeList, 0, 1),       TsInitializationException);
+
+    /// @test Exception on a link with ports outside the node list.
+    GunnsNodeList smallList(2, tNodes);
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(smallList, tLinks, N_LINKS), TsInitializationException);
+
+    /// @test An empty block is allowed.
+    CPPUNIT_ASSERT_NO_THROW(tArticle->initialize(tNodeList, 0, 0));
+    CPPUNIT_ASSERT(0 == tArticle->getNumLinks());
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the batched update matches the links' own computation exactly, and is used by
+///           the links when they step.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBlock::testUpdate()
+{
+    std::cout << "\n UtGunnsThermalRadiationBlock 04: testUpdate .....................";
+
+    tArticle->initialize(tNodeList, tLinks, N_LINKS);
+
+    const double potentials[2][N_NODES] = {{300.0, 250.0, 300.0, 0.0},
+                                           {4.0,   275.3, 1.0e3, 0.0}};
+    for (int pass = 0; pass < 2; ++pass) {
+        setPotentials(potentials[pass]);
+        tArticle->update();
+
+        /// @test Node temperatures and 4th powers.
+        for (int node = 0; node < N_NODES; ++node) {
+            const double t = potentials[pass][node];
+            CPPUNIT_ASSERT(t             == tArticle->mNodeTemperature[node]);
+            CPPUNIT_ASSERT(t * t * t * t == tArticle->mNodeT4[node]);
+        }
+
+        /// @test Each link steps to the same conductance as its reference out of the block, and
+        ///       took it from the block.
+        for (int i = 0; i < N_LINKS; ++i) {
+            CPPUNIT_ASSERT(tArticle->isCurrent(i, tLinks[i].mPotentialVector[0],
+                                               tLinks[i].mPotentialVector[1],
+                                               tLinks[i].mViewScalar,
+                                               tLinks[i].mDefaultConductivity));
+            tLinks[i].step(tTimeStep);
+            tReference[i].step(tTimeStep);
+            CPPUNIT_ASSERT(tReference[i].mEffectiveConductivity
+                        == tArticle->getEffectiveConductivity(i));
+            CPPUNIT_ASSERT(tReference[i].mEffectiveConductivity
+                        == tLinks[i].mEffectiveConductivity);
+            CPPUNIT_ASSERT(tReference[i].mSystemConductance == tLinks[i].mSystemConductance);
+        }
+    }
+
+    /// @test Equal port temperatures give the default conductivity.
+    setPotentials(potentials[0]);
+    tArticle->update();
+    CPPUNIT_ASSERT(tLinks[4].mDefaultConductivity == tArticle->getEffectiveConductivity(4));
+
+    /// @test Zero view scalar gives zero conductivity.
+    CPPUNIT_ASSERT(0.0 == tArticle->getEffectiveConductivity(3));
+
+    std::cout << "... Pass";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the links computing their own conductivity when the block's inputs are stale.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalRadiationBlock::testFallback()
+{
+    std::cout << "\n UtGunnsThermalRadiationBlock 05: testFallback ...................";
+
+    tArticle->initialize(tNodeList, tLinks, N_LINKS);
+    const double potentials[N_NODES] = {300.0, 250.0, 310.0, 0.0};
+    setPotentials(potentials);
+    tArticle->update();
+
+    /// @test The view scalar setter writes through to the block.
+    tLinks[1].setViewScalar(0.3);
+    tReference[1].setViewScalar(0.3);
+    CPPUNIT_ASSERT(0.3 == tArticle->mViewScalar[1]);
+    CPPUNIT_ASSERT(0.3 == tLinks[1].getViewScalar());
+
+    /// @test The block's result for the link is re-evaluated with the new view scalar.
+    tLinks[1].step(tTimeStep);
+    tReference[1].step(tTimeStep);
+    CPPUNIT_ASSERT(tReference[1].mEffectiveConductivity == tLinks[1].mEffectiveConductivity);
+    CPPUNIT_ASSERT(tReference[1].mEffectiveConductivity == tArticle->getEffectiveConductivity(1));
+
+    /// @test A direct write of the view scalar or default conductivity is caught, the link
+    ///       computes its own conductivity and the block's copies are refreshed.
+    tLinks[0].mViewScalar              = 0.5;
+    tReference[0].mViewScalar          = 0.5;
+    tLinks[2].mDefaultConductivity     = 2.0e-7;
+    tReference[2].mDefaultConductivity = 2.0e-7;
+    for (int i = 0; i < 3; i += 2) {
+        tLinks[i].step(tTimeStep);
+        tReference[i].step(tTimeStep);
+        CPPUNIT_ASSERT(tReference[i].mEffectiveConductivity == tLinks[i].mEffectiveConductivity);
+    }
+    CPPUNIT_ASSERT(0.5    == tArticle->mViewScalar[0]);
+    CPPUNIT_ASSERT(2.0e-7 == tArticle->mDefaultConductivity[2]);
+
+    /// @test A port potential that differs from its node, as with a port override, is caught.
+    tLinks[3].mPotentialVector[0]     = 320.0;
+    tReference[3].mPotentialVector[0] = 320.0;
+    tLinks[3].setViewScalar(1.0);
+    tReference[3].setViewScalar(1.0);
+    tArticle->update();
+    tLinks[3].step(tTimeStep);
+    tReference[3].step(tTimeStep);
+    CPPUNIT_ASSERT(tReference[3].mEffectiveConductivity == tLinks[3].mEffectiveConductivity);
+    CPPUNIT_ASSERT(tReference[3].mEffectiveConductivity != tArticle->getEffectiveConductivity(3));
+
+    /// @test The next update uses the refreshed inputs, and the links take its results again.
+    setPotentials(potentials);
+    tArticle->update();
+    for (int i = 0; i < N_LINKS; ++i) {
+        tLinks[i].step(tTimeStep);
+        tReference[i].step(tTimeStep);
+        CPPUNIT_ASSERT(tReference[i].mEffectiveConductivity
+                    == tArticle->getEffectiveConductivity(i));
+        CPPUNIT_ASSERT(tReference[i].mEffectiveConductivity == tLinks[i].mEffectiveConductivity);
+    }
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,126 @@
+#ifndef UtGunnsThermalRadiationBlock_EXISTS
+#define UtGunnsThermalRadiationBlock_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup    UT_GUNNS_THERMAL_RADIATION_BLOCK  Gunns Thermal Radiation Block Unit test
+/// @ingroup     UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details     Unit Tests for Gunns Thermal Radiation Block
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "aspects/thermal/GunnsThermalRadiationBlock.hh"
+#include "aspects/thermal/GunnsThermalRadiation.hh"
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsThermalRadiationBlock and befriend UtGunnsThermalRadiationBlock.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsThermalRadiationBlock : public GunnsThermalRadiationBlock
+{
+    public:
+        FriendlyGunnsThermalRadiationBlock(const std::string& name = "");
+        virtual ~FriendlyGunnsThermalRadiationBlock();
+        friend class UtGunnsThermalRadiationBlock;
+};
+inline FriendlyGunnsThermalRadiationBlock::FriendlyGunnsThermalRadiationBlock(
+        const std::string& name) : GunnsThermalRadiationBlock(name) {};
+inline FriendlyGunnsThermalRadiationBlock::~FriendlyGunnsThermalRadiationBlock() {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsThermalRadiation and befriend UtGunnsThermalRadiationBlock.
+///
+/// @details  Gives the unit test access to the links' potentials and conductivities.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsThermalRadiationBlockLink : public GunnsThermalRadiation
+{
+    public:
+        FriendlyGunnsThermalRadiationBlockLink();
+        virtual ~FriendlyGunnsThermalRadiationBlockLink();
+        friend class UtGunnsThermalRadiationBlock;
+};
+inline FriendlyGunnsThermalRadiationBlockLink::FriendlyGunnsThermalRadiationBlockLink()
+        : GunnsThermalRadiation() {};
+inline FriendlyGunnsThermalRadiationBlockLink::~FriendlyGunnsThermalRadiationBlockLink() {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Thermal Radiation Block unit tests.
+///
+/// @details  This class provides unit tests for the Thermal Radiation Block within the CPPUnit
+///           framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsThermalRadiationBlock: public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default Constructor.
+        UtGunnsThermalRadiationBlock();
+
+        /// @brief    Default Destructor.
+        virtual ~UtGunnsThermalRadiationBlock();
+
+        /// @brief    Executes before each test.
+        void setUp();
+
+        /// @brief    Executes after each test.
+        void tearDown();
+
+        /// @brief    Tests Default Construction.
+        void testDefaultConstruction();
+
+        /// @brief    Tests initialize method.
+        void testInitialization();
+
+        /// @brief    Tests initialize method exceptions.
+        void testInitializationExceptions();
+
+        /// @brief    Tests the batched update against the links' own computation.
+        void testUpdate();
+
+        /// @brief    Tests the links falling back to their own computation.
+        void testFallback();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsThermalRadiationBlock);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialization);
+        CPPUNIT_TEST(testInitializationExceptions);
+        CPPUNIT_TEST(testUpdate);
+        CPPUNIT_TEST(testFallback);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief  Enumeration for the number of nodes and links.
+        enum {N_NODES = 4, N_LINKS = 5};
+
+        FriendlyGunnsThermalRadiationBlock*     tArticle;         /**< (--)  Test Article */
+        FriendlyGunnsThermalRadiationBlockLink* tLinks;           /**< (--)  Links in the block */
+        FriendlyGunnsThermalRadiationBlockLink* tReference;       /**< (--)  Same links, not in a block */
+        std::string                    tName;                     /**< (--)  Block name */
+        GunnsBasicNode                 tNodes[N_NODES];           /**< (--)  Network Nodes */
+        GunnsNodeList                  tNodeList;                 /**< (--)  Node List */
+        std::vector<GunnsBasicLink*>   tNetworkLinks;             /**< (--)  Network Links */
+        std::vector<GunnsBasicLink*>   tReferenceLinks;           /**< (--)  Reference Network Links */
+        int                            tPort0[N_LINKS];           /**< (--)  Port 0 of each link */
+        int                            tPort1[N_LINKS];           /**< (--)  Port 1 of each link */
+        double                         tTimeStep;                 /**< (s)   Nominal time step */
+
+        /// @brief  Sets the node potentials and outputs them to the link ports.
+        void setPotentials(const double* potentials);
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsThermalRadiationBlock(const UtGunnsThermalRadiationBlock& that);
+
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsThermalRadiationBlock& operator =(const UtGunnsThermalRadiationBlock& that);
+};
+
+///@}
+
+#endif
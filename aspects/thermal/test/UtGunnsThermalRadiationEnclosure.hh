@@ -0,0 +1,130 @@
+#ifndef UtGunnsThermalRadiationEnclosure_EXISTS
+#define UtGunnsThermalRadiationEnclosure_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup    UT_GUNNS_THERMAL_RADIATION_ENCLOSURE  Gunns Thermal Radiation Enclosure Unit test
+/// @ingroup     UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details     Unit Tests for Gunns Thermal Radiation Enclosure
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "aspects/thermal/GunnsThermalRadiationEnclosure.hh"
+#include "core/Gunns.hh"
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsThermalRadiationEnclosure and befriend
+///           UtGunnsThermalRadiationEnclosure.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsThermalRadiationEnclosure : public GunnsThermalRadiationEnclosure
+{
+    public:
+        FriendlyGunnsThermalRadiationEnclosure();
+        virtual ~FriendlyGunnsThermalRadiationEnclosure();
+        friend class UtGunnsThermalRadiationEnclosure;
+};
+inline FriendlyGunnsThermalRadiationEnclosure::FriendlyGunnsThermalRadiationEnclosure()
+        : GunnsThermalRadiationEnclosure() {};
+inline FriendlyGunnsThermalRadiationEnclosure::~FriendlyGunnsThermalRadiationEnclosure() {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Thermal Radiation Enclosure unit tests.
+///
+/// @details  This class provides unit tests for the Thermal Radiation Enclosure within the CPPUnit
+///           framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsThermalRadiationEnclosure: public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default Constructor.
+        UtGunnsThermalRadiationEnclosure();
+
+        /// @brief    Default Destructor.
+        virtual ~UtGunnsThermalRadiationEnclosure();
+
+        /// @brief    Executes before each test.
+        void setUp();
+
+        /// @brief    Executes after each test.
+        void tearDown();
+
+        /// @brief    Tests Config and Input data.
+        void testConfigAndInput();
+
+        /// @brief    Tests Default Construction.
+        void testDefaultConstruction();
+
+        /// @brief    Tests initialize method.
+        void testInitialization();
+
+        /// @brief    Tests initialize method exceptions.
+        void testInitializationExceptions();
+
+        /// @brief    Tests the step method against the pairwise exchange.
+        void testStep();
+
+        /// @brief    Tests the computeFlows method.
+        void testComputeFlows();
+
+        /// @brief    Tests the blockage malfunction.
+        void testBlockage();
+
+        /// @brief    Tests the restart method.
+        void testRestart();
+
+        /// @brief    Tests stability in a network with small and zero surface capacitances.
+        void testSmallCapacitance();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsThermalRadiationEnclosure);
+        CPPUNIT_TEST(testConfigAndInput);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialization);
+        CPPUNIT_TEST(testInitializationExceptions);
+        CPPUNIT_TEST(testStep);
+        CPPUNIT_TEST(testComputeFlows);
+        CPPUNIT_TEST(testBlockage);
+        CPPUNIT_TEST(testRestart);
+        CPPUNIT_TEST(testSmallCapacitance);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief  Enumeration for the number of nodes and surfaces.
+        enum {N_NODES = 5, N_PORTS = 4};
+
+        FriendlyGunnsThermalRadiationEnclosure*   tArticle;         /**< (--)   Test Article */
+        GunnsThermalRadiationEnclosureConfigData* tConfigData;      /**< (--)   Nominal config data */
+        GunnsThermalRadiationEnclosureInputData*  tInputData;       /**< (--)   Nominal input data */
+        std::string                  tName;                         /**< (--)   Link name */
+        GunnsBasicNode               tNodes[N_NODES];               /**< (--)   Network Nodes */
+        GunnsNodeList                tNodeList;                     /**< (--)   Node List */
+        std::vector<GunnsBasicLink*> tLinks;                        /**< (--)   Network Links */
+        std::vector<int>             tPorts;                        /**< (--)   Node of each surface */
+        std::vector<double>          tAreas;                        /**< (m2)   Surface areas */
+        std::vector<double>          tFactors;                      /**< (--)   Exchange factors */
+        double                       tExchange[N_PORTS][N_PORTS];   /**< (m2)   Reciprocal exchange matrix */
+        double                       tPotentials[N_PORTS];          /**< (K)    Surface temperatures */
+        double                       tTimeStep;                     /**< (s)    Nominal time step */
+        double                       tTol;                          /**< (--)   Nominal tolerance */
+
+        /// @brief  Returns the pairwise net heat absorbed by a surface at the test temperatures.
+        double pairwiseHeat(const int port) const;
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsThermalRadiationEnclosure(const UtGunnsThermalRadiationEnclosure& that);
+
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsThermalRadiationEnclosure& operator =(const UtGunnsThermalRadiationEnclosure& that);
+};
+
+///@}
+
+#endif
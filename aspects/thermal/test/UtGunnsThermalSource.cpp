@@ -8,6 +8,7 @@
     )
 ***************************************************************************************************/
 #include "UtGunnsThermalSource.hh"
+#include "core/GunnsCheckpoint.hh"
 #include <iostream>
 #include "software/exceptions/TsInitializationException.hh"
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -542,5 +543,55 @@ void UtGunnsThermalSource::testSpecificPortRules()
     CPPUNIT_ASSERT_MESSAGE("Port invalid but checkSpecificPortRules() does not return false.",
             false == tArticle3->checkSpecificPortRules(5, tArticle3->getGroundNodeIndex()) );
 
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the native checkpoint save & load of the source's state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsThermalSource::testCheckpoint()
+{
+    std::cout << "\n UtGunnsThermalSource .. 11: testCheckpoint.......................";
+
+    /// - Step the source with a demand, tuning & overrides, and save its state.
+    tArticle3->mDemandedFlux             = tFlux;
+    tArticle3->mTuningScalar             = tTuningScalar;
+    tArticle3->mTemperatureOverrideFlag  = true;
+    tArticle3->mTemperatureOverrideValue = tPort0Temperature;
+    tArticle3->setMalfFluxOverride(true, tMalfFluxOverrideValue);
+    tArticle3->step(tTimeStep);
+    const double avgTemperature = tArticle3->mAvgPortTemperature;
+    std::vector<unsigned char> buffer;
+    GunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&buffer);
+    tArticle3->saveCheckpoint(writer);
+    writer.close();
+
+    /// - Change the demand, tuning & overrides.
+    tArticle3->mDemandedFlux             = 2.0 * tFlux;
+    tArticle3->mTuningScalar             = 0.5 * tTuningScalar;
+    tArticle3->mTemperatureOverrideFlag  = false;
+    tArticle3->mTemperatureOverrideValue = 0.0;
+    tArticle3->mAvgPortTemperature       = 0.0;
+    tArticle3->setMalfFluxOverride();
+
+    /// @test  The loaded state is the state that was saved.
+    GunnsCheckpointReader reader("reader");
+    reader.openBuffer(&buffer);
+    tArticle3->loadCheckpoint(reader);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+    CPPUNIT_ASSERT(tFlux                  == tArticle3->mDemandedFlux);
+    CPPUNIT_ASSERT(tTuningScalar          == tArticle3->mTuningScalar);
+    CPPUNIT_ASSERT(tArticle3->mTemperatureOverrideFlag);
+    CPPUNIT_ASSERT(tPort0Temperature      == tArticle3->mTemperatureOverrideValue);
+    CPPUNIT_ASSERT(tArticle3->mMalfFluxOverrideFlag);
+    CPPUNIT_ASSERT(tMalfFluxOverrideValue == tArticle3->mMalfFluxOverrideValue);
+    CPPUNIT_ASSERT(avgTemperature         == tArticle3->mAvgPortTemperature);
+
+    /// @test  The source opts in to native checkpoints, but a type derived from it doesn't.
+    GunnsThermalSource article;
+    CPPUNIT_ASSERT(article.isCheckpointable());
+    CPPUNIT_ASSERT(not tArticle3->isCheckpointable());
+
     std::cout << "... Pass\n";
 }
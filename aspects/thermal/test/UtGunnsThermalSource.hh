@@ -67,6 +67,8 @@ class UtGunnsThermalSource: public CppUnit::TestFixture
         void testValidation();
         /// @brief  Test that the port rules check returns the correct booleans.
         void testSpecificPortRules();
+        /// @brief  Tests the native checkpoint save & load.
+        void testCheckpoint();
 
     private:
         CPPUNIT_TEST_SUITE(UtGunnsThermalSource);
@@ -80,6 +82,7 @@ class UtGunnsThermalSource: public CppUnit::TestFixture
         CPPUNIT_TEST(testStep);
         CPPUNIT_TEST(testValidation);
         CPPUNIT_TEST(testSpecificPortRules);
+        CPPUNIT_TEST(testCheckpoint);
         CPPUNIT_TEST_SUITE_END();
 
         std::string  tName;  /**< (--) Source name */
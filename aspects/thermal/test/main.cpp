@@ -11,7 +11,10 @@ LIBRARY DEPENDENCY:
 
 #include "UtGunnsThermalCapacitor.hh"
 #include "UtGunnsThermalCapacitorHeatQueues.hh"
+#include "UtGunnsThermalNetworkHeatQueues.hh"
 #include "UtGunnsThermalRadiation.hh"
+#include "UtGunnsThermalRadiationBlock.hh"
+#include "UtGunnsThermalRadiationEnclosure.hh"
 #include "UtGunnsThermalHeater.hh"
 #include "UtGunnsThermalPanel.hh"
 #include "UtGunnsThermalMultiPanel.hh"
@@ -34,7 +37,10 @@ int main(int argc, char** argv)
     CppUnit::TextTestRunner runner;
     runner.addTest( UtGunnsThermalCapacitor::suite() );
     runner.addTest( UtGunnsThermalCapacitorHeatQueues::suite() );
+    runner.addTest( UtGunnsThermalNetworkHeatQueues::suite() );
     runner.addTest( UtGunnsThermalRadiation::suite() );
+    runner.addTest( UtGunnsThermalRadiationBlock::suite() );
+    runner.addTest( UtGunnsThermalRadiationEnclosure::suite() );
     runner.addTest( UtGunnsThermalHeater::suite() );
     runner.addTest( UtGunnsThermalPotential::suite() );
     runner.addTest( UtGunnsThermalPanel::suite() );
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+# @copyright Copyright 2026 United States Government as represented by the Administrator of the
+#            National Aeronautics and Space Administration.  All Rights Reserved.
+#
+# @revs_title
+# @revs_begin
+# @rev_entry(GUNNS Development Team, CACI, GUNNS, October 2026, --, Initial implementation.)
+# @revs_end
+#
+# Converts Health & Status binary log files, written by TsHsTextPlugin when its binary records are
+# enabled, to the same text lines the plugin writes when they're not.
+#
+# Usage: hs_log_convert.py <binary log> [<binary log>...] [-o <text file>]
+#
+# Rotated files (name.1, name.2, ...) can be given in order, followed by the current file, to
+# convert them into one text log.
+#
+import struct
+import sys
+import time
+
+from argparse import *
+
+MAGIC = b'TSHSLOG\0'
+VERSION = 1
+BYTE_ORDER_MARK = 0x01020304
+
+# Record fields after the record length: type, line, MET pre, day, hour, min, sec, timestamp, and
+# the subsystem, file, function and text lengths.
+FIELDS = 'iiiiiiiQHHHI'
+
+TYPES = {0: 'DBG ', 1: 'INFO', 2: 'WARN', 3: 'ERR ', 4: 'FAT '}
+
+##############################################################################################################################################################
+### Formats a decoded message exactly as TsHsTextPlugin::formatText does.
+##############################################################################################################################################################
+def format_text(msgType, line, pre, day, hour, minute, sec, timestamp, subsys, file, function, text):
+    sign = '-' if pre < 0 else '+'
+    zulu = time.strftime('%Y-%m-%dT%H:%M:%SZ', time.gmtime(timestamp))
+    location = '%s:%d ' % (file, line)
+    if function:
+        location += '%s() ' % function
+    return '%s | %-12s | %s%03d %02d:%02d:%02d | %s | %-45s | %s' % (
+        TYPES.get(msgType, 'NA  '), subsys, sign, day, hour, minute, sec, zulu, location, text)
+
+##############################################################################################################################################################
+### Reads the binary records of a file and yields the text lines.
+##############################################################################################################################################################
+def convert(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    if data[0:8] != MAGIC:
+        raise ValueError('%s is not an H&S binary log' % path)
+
+    # The byte order marker tells us the byte order of the host that wrote the file.
+    order = '<'
+    version, mark = struct.unpack_from('<II', data, 8)
+    if mark != BYTE_ORDER_MARK:
+        order = '>'
+        version, mark = struct.unpack_from('>II', data, 8)
+    if version != VERSION:
+        raise ValueError('%s has unsupported version %d' % (path, version))
+
+    header = struct.Struct(order + FIELDS)
+    offset = 16
+    while offset + 4 <= len(data):
+        length, = struct.unpack_from(order + 'I', data, offset)
+        if offset + 4 + length > len(data):
+            sys.stderr.write('%s: truncated record at byte %d ignored\n' % (path, offset))
+            break
+        fields = header.unpack_from(data, offset + 4)
+        subsysLen, fileLen, functionLen, textLen = fields[8:]
+        start = offset + 4 + header.size
+        strings = []
+        for n in (subsysLen, fileLen, functionLen, textLen):
+            strings.append(data[start:start + n].decode('utf-8', 'replace'))
+            start += n
+        yield format_text(*(fields[0:8] + tuple(strings)))
+        offset += 4 + length
+
+def main():
+    parser = ArgumentParser(description='Converts H&S binary log files to text.')
+    parser.add_argument('files', nargs='+', help='binary log files, in order')
+    parser.add_argument('-o', '--output', help='output text file, default is standard output')
+    args = parser.parse_args()
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    try:
+        for path in args.files:
+            for line in convert(path):
+                out.write(line + '\n')
+    finally:
+        if args.output:
+            out.close()
+
+if __name__ == '__main__':
+    main()
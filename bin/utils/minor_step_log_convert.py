@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+# @copyright Copyright 2026 United States Government as represented by the Administrator of the
+#            National Aeronautics and Space Administration.  All Rights Reserved.
+#
+# @revs_title
+# @revs_begin
+# @rev_entry(GUNNS Development Team, CACI, GUNNS, October 2026, --, Initial implementation.)
+# @revs_end
+#
+# Converts GUNNS solver minor step log binary files, written by GunnsMinorStepLog when its output
+# format is BINARY, to the same csv the log writes when its output format is CSV.
+#
+# Usage: minor_step_log_convert.py <binary log> [-o <csv file>]
+#
+# The default output file is the input file with a .csv extension.
+#
+import os
+import struct
+import sys
+
+from argparse import *
+
+MAGIC = b'GUNNSMSL'
+VERSION = 1
+BYTE_ORDER_MARK = 0x01020304
+
+STEP_RESULTS = {0: 'SUCCESS', 1: 'CONFIRM', 2: 'REJECT', 3: 'DELAY', 4: 'DECOMP_LIMIT',
+                5: 'MINOR_LIMIT', 6: 'MATH_FAIL'}
+LINK_RESULTS = {0: 'REJECT', 1: 'CONFIRM', 2: 'DELAY'}
+
+##############################################################################################################################################################
+### Formats a value like the default C++ ostream format used by the csv output.
+##############################################################################################################################################################
+def format_value(value):
+    return '%g' % value
+
+##############################################################################################################################################################
+### Returns the csv header row, matching GunnsMinorStepLog::initLogHeader.
+##############################################################################################################################################################
+def render_header(networkSize, links):
+    header = ['Major Step', 'Minor Step', 'Decomposition', 'Solution Result']
+    header += ['Potential Vector [%d]' % i for i in range(networkSize)]
+    header += ['Node Convergence [%d]' % i for i in range(networkSize)]
+    for name, ports in links:
+        header.append('Link %s: Solution Result' % name)
+        header += ['Admittance Matrix [%d]' % i for i in range(ports * ports)]
+        header += ['Source Vector [%d]' % i for i in range(ports)]
+    return ', '.join(header)
+
+##############################################################################################################################################################
+### Reads the binary log and yields the csv lines, starting with the header row.
+##############################################################################################################################################################
+def convert(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    if data[0:8] != MAGIC:
+        raise ValueError('%s is not a GUNNS minor step log binary file' % path)
+
+    # The byte order marker tells us the byte order of the host that wrote the file.
+    order = '<'
+    version, mark = struct.unpack_from('<II', data, 8)
+    if mark != BYTE_ORDER_MARK:
+        order = '>'
+        version, mark = struct.unpack_from('>II', data, 8)
+    if version != VERSION:
+        raise ValueError('%s has unsupported version %d' % (path, version))
+
+    networkSize, numLinks, numFrames = struct.unpack_from(order + 'III', data, 16)
+    offset = 28
+    links = []
+    for link in range(numLinks):
+        ports, nameLen = struct.unpack_from(order + 'II', data, offset)
+        offset += 8
+        links.append((data[offset:offset + nameLen].decode('utf-8', 'replace'), ports))
+        offset += nameLen
+    yield render_header(networkSize, links)
+
+    # Each frame is the step counts and results, followed by one block of all its doubles.
+    numValues = 2 * networkSize + sum(ports * ports + ports for name, ports in links)
+    results = struct.Struct(order + '%di' % (4 + numLinks))
+    values = struct.Struct(order + '%dd' % numValues)
+    for frame in range(numFrames):
+        if offset + results.size + values.size > len(data):
+            sys.stderr.write('%s: truncated frame %d ignored\n' % (path, frame))
+            break
+        ints = results.unpack_from(data, offset)
+        offset += results.size
+        doubles = values.unpack_from(data, offset)
+        offset += values.size
+
+        row = [str(ints[0]), str(ints[1]), str(ints[2]), STEP_RESULTS.get(ints[3], 'invalid')]
+        row += [format_value(v) for v in doubles[0:2 * networkSize]]
+        index = 2 * networkSize
+        for link, (name, ports) in enumerate(links):
+            row.append(LINK_RESULTS.get(ints[4 + link], 'invalid'))
+            count = ports * ports + ports
+            row += [format_value(v) for v in doubles[index:index + count]]
+            index += count
+        yield ', '.join(row)
+
+def main():
+    parser = ArgumentParser(description='Converts a GUNNS minor step log binary file to csv.')
+    parser.add_argument('file', help='binary log file')
+    parser.add_argument('-o', '--output', help='output csv file, default is the input with .csv extension')
+    args = parser.parse_args()
+
+    output = args.output if args.output else os.path.splitext(args.file)[0] + '.csv'
+    with open(output, 'w') as out:
+        for line in convert(args.file):
+            out.write(line + '\n')
+
+if __name__ == '__main__':
+    main()
@@ -20,8 +20,10 @@ ASSUMPTIONS AND LIMITATIONS:
 LIBRARY DEPENDENCY:
    (
     (core/GunnsBasicLink.o)
+    (core/GunnsCheckpoint.o)
     (core/GunnsFluidNode.o)
     (core/GunnsFluidFlowOrchestrator.o)
+    (core/GunnsLinkDispatcher.o)
     (core/GunnsMinorStepLog.o)
     (math/linear_algebra/Sor.o)
     (math/linear_algebra/CholeskyLdu.o)
@@ -48,13 +50,16 @@ LIBRARY DEPENDENCY:
 
 #include "core/Gunns.hh"
 #include "core/GunnsBasicLink.hh"
+#include "core/GunnsCheckpoint.hh"
 #include "core/GunnsFluidNode.hh"
 #include "core/GunnsInfraMacros.hh"
 #include "core/GunnsFluidFlowOrchestrator.hh"
+#include "core/GunnsLinkDispatcher.hh"
 #include "math/linear_algebra/Sor.hh"
 #include "math/linear_algebra/CholeskyLdu.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
+#include "software/exceptions/TsParseException.hh"
 #include "software/exceptions/TsNumericalException.hh"
 
 #ifdef GUNNS_CUDA_ENABLE
@@ -123,6 +128,7 @@ Gunns::Gunns()
     mNodes                 (0),
     mFlowOrchestrator      (0),
     mOwnsFlowOrchestrator  (false),
+    mLinkDispatcher        (0),
     mAdmittanceMatrix      (0),
     mAdmittanceMatrixIsland(0),
     mSourceVector          (0),
@@ -173,6 +179,8 @@ Gunns::Gunns()
     mAvgDecompositionCount (0.0),
     mSolveTimeWorking      (0.0),
     mSolveTime             (0.0),
+    mDecomposeTimeWorking  (0.0),
+    mDecomposeTime         (0.0),
     mStepTime              (0.0),
     mWorstCaseTiming       (false),
     mLinksConvergence      (0),
@@ -189,6 +197,25 @@ Gunns::Gunns()
     mSorTolerance          (1.0E-12),
     mSorLastIteration      (-1),
     mSorFailCount          (0),
+    mMixedPrecision        (false),
+    mRefinementLimit       (10),
+    mRefinementTolerance   (1.0E-13),
+    mRefinementEscalated   (false),
+    mAdmittanceMatrixSingle(0),
+    mAdmittanceMatrixSingleIsland(0),
+    mAdmittanceMatrixLdu   (0),
+    mRefinementResidualVector(0),
+    mRefinementCorrection  (0),
+    mRefinementCount       (0),
+    mMaxRefinementCount    (0),
+    mRefinementResidual    (0.0),
+    mRefinementEscalationCount(0),
+    mFactorReuseLimit      (0),
+    mFactorReuseRate       (0.5),
+    mFactorsStale          (false),
+    mFactorReuseSteps      (0),
+    mLastConvergenceDelta  (0.0),
+    mFactorReuseCount      (0),
     mLastSolverMode        (NORMAL),
     mLastIslandMode        (OFF),
     mLastRunMode           (RUN)
@@ -257,6 +284,11 @@ void Gunns::cleanup()
         delete [] mLinks;
         mLinks = 0;
     }
+    TS_DELETE_ARRAY(mRefinementCorrection);
+    TS_DELETE_ARRAY(mRefinementResidualVector);
+    TS_DELETE_ARRAY(mAdmittanceMatrixLdu);
+    TS_DELETE_ARRAY(mAdmittanceMatrixSingleIsland);
+    TS_DELETE_ARRAY(mAdmittanceMatrixSingle);
     TS_DELETE_ARRAY(mDebugSavedNode);
     TS_DELETE_ARRAY(mDebugSavedSlice);
     TS_DELETE_ARRAY(mNodeIslandNumbers);
@@ -286,7 +318,8 @@ void Gunns::cleanup()
 /// @param[in]  threshold  (--)  Network/island size threshold value to take.
 ///
 /// @details  Rejects any GPU modes and outputs an H&S warning if the compilation is not GPU
-///           enabled.
+///           enabled.  Forces a new decomposition, since the mixed-precision and factor reuse
+///           options keep their factors separate from the admittance matrix only in NO_GPU mode.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void Gunns::setGpuOptions(const GpuMode mode, const int threshold)
 {
@@ -297,6 +330,98 @@ void Gunns::setGpuOptions(const GpuMode mode, const int threshold)
     } else {
         mGpuMode = mode;
     }
+    mRebuild = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  flag                 (--)  True enables the mixed-precision solution.
+/// @param[in]  refinementLimit      (--)  Maximum refinement iterations per solution.
+/// @param[in]  refinementTolerance  (--)  Relative residual for refinement convergence.
+///
+/// @details  Sets the mixed-precision solution option and its iterative refinement controls, and
+///           allocates the working arrays if the network is already initialized.  Invalid controls
+///           are reset to their defaults with an H&S warning.  Forces a new decomposition so that
+///           the next solution uses factors of the new precision.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setMixedPrecision(const bool   flag,
+                              const int    refinementLimit,
+                              const double refinementTolerance)
+{
+    mMixedPrecision      = flag;
+    mRefinementLimit     = refinementLimit;
+    mRefinementTolerance = refinementTolerance;
+    if (mRefinementLimit < 1) {
+        mRefinementLimit = 10;
+        GUNNS_WARNING("refinement limit reset to the default of 10.");
+    }
+    if (mRefinementTolerance <= 0.0) {
+        mRefinementTolerance = 1.0E-13;
+        GUNNS_WARNING("refinement tolerance reset to the default of 1.0E-13.");
+    }
+    if (mMixedPrecision and mAdmittanceMatrix) {
+        allocateFactorArrays();
+    }
+    mRebuild = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  limit      (--)  Maximum consecutive minor steps to reuse factors, 0 disables.
+/// @param[in]  rateLimit  (--)  Maximum ratio of successive minor step potential changes, (0-1).
+///
+/// @details  Sets the factor reuse (modified Newton) option controls, and allocates the working
+///           arrays if the network is already initialized.  Invalid controls are reset to their
+///           defaults with an H&S warning.  Forces a new decomposition so that the factors are kept
+///           where the new option expects them.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setFactorReuse(const int limit, const double rateLimit)
+{
+    mFactorReuseLimit = limit;
+    mFactorReuseRate  = rateLimit;
+    if (mFactorReuseLimit < 0) {
+        mFactorReuseLimit = 0;
+        GUNNS_WARNING("factor reuse limit reset to 0, disabling factor reuse.");
+    }
+    if (mFactorReuseRate <= 0.0 or mFactorReuseRate >= 1.0) {
+        mFactorReuseRate = 0.5;
+        GUNNS_WARNING("factor reuse rate limit reset to the default of 0.5.");
+    }
+    if (mFactorReuseLimit > 0 and mAdmittanceMatrix) {
+        allocateFactorArrays();
+    }
+    mFactorsStale     = false;
+    mFactorReuseSteps = 0;
+    mRebuild          = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Allocates the mixed-precision and factor reuse working arrays based on network size,
+///           if they haven't already been allocated.  These are only allocated when those options
+///           are used, since the matrices are as large as the admittance matrix.  The single-
+///           precision matrices are only needed for mixed-precision.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::allocateFactorArrays()
+{
+    const int matrixSize = mNetworkSize * mNetworkSize;
+    if (not mAdmittanceMatrixLdu) {
+        TS_NEW_PRIM_ARRAY_EXT(mAdmittanceMatrixLdu,      matrixSize,   double, mName + ".mAdmittanceMatrixLdu");
+        TS_NEW_PRIM_ARRAY_EXT(mRefinementResidualVector, mNetworkSize, double, mName + ".mRefinementResidualVector");
+        TS_NEW_PRIM_ARRAY_EXT(mRefinementCorrection,     mNetworkSize, double, mName + ".mRefinementCorrection");
+        for (int i = 0; i < matrixSize; ++i) {
+            mAdmittanceMatrixLdu[i] = 0.0;
+        }
+        for (int i = 0; i < mNetworkSize; ++i) {
+            mRefinementResidualVector[i] = 0.0;
+            mRefinementCorrection[i]     = 0.0;
+        }
+    }
+    if (mMixedPrecision and not mAdmittanceMatrixSingle) {
+        TS_NEW_PRIM_ARRAY_EXT(mAdmittanceMatrixSingle,       matrixSize, float, mName + ".mAdmittanceMatrixSingle");
+        TS_NEW_PRIM_ARRAY_EXT(mAdmittanceMatrixSingleIsland, matrixSize, float, mName + ".mAdmittanceMatrixSingleIsland");
+        for (int i = 0; i < matrixSize; ++i) {
+            mAdmittanceMatrixSingle[i]       = 0.0f;
+            mAdmittanceMatrixSingleIsland[i] = 0.0f;
+        }
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -379,6 +504,9 @@ void Gunns::initialize(const GunnsConfigData& configData, std::vector<GunnsBasic
         mNetCapDeltaPotential[i]   = 0.0;
     }
     clearDebugNode();
+    if (mMixedPrecision or mFactorReuseLimit > 0) {
+        allocateFactorArrays();
+    }
 
     mNumLinks              = linksVector.size();
     mDebugDesiredSlice     = 0;
@@ -448,6 +576,7 @@ void Gunns::initialize(const GunnsConfigData& configData, std::vector<GunnsBasic
 
     verifyNodeInitialization();
     mFlowOrchestrator->initialize(mName + ".mFlowOrchestrator", mLinks, mNodes);
+    bindLinkDispatcher();
 
     /// - Zero the potential and reset the state of the vacuum/ground boundary node.  This node is
     ///   always the last node in the list.
@@ -645,6 +774,37 @@ void Gunns::setFlowOrchestrator(GunnsBasicFlowOrchestrator* orchestrator)
     mOwnsFlowOrchestrator = false;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] dispatcher (--) Pointer to the link dispatcher to use, or null to loop over links.
+///
+/// @details  The dispatcher is not owned by this solver.  If the links have already been
+///           initialized, the dispatcher is bound to them now, otherwise it's bound during
+///           initialization.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::setLinkDispatcher(GunnsLinkDispatcher* dispatcher)
+{
+    mLinkDispatcher = dispatcher;
+    if (mLinks) {
+        bindLinkDispatcher();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Binds the link dispatcher to the links and passes it to the flow orchestrator.  If the
+///           dispatcher's links, types or node maps don't match ours, we issue a warning and revert
+///           to looping over the links, since that gives the same solution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::bindLinkDispatcher()
+{
+    if (mLinkDispatcher and not mLinkDispatcher->bind(mLinks, mNumLinks, mNetworkSize)) {
+        GUNNS_WARNING("link dispatcher doesn't match the network links, ignoring it.");
+        mLinkDispatcher = 0;
+    }
+    if (mFlowOrchestrator) {
+        mFlowOrchestrator->setLinkDispatcher(mLinkDispatcher);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @throws   TsInitializationException
 ///
@@ -681,6 +841,206 @@ void Gunns::restart()
     mInitFlag = true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Open native checkpoint stream to write to.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Writes only the network state that can't be rebuilt: the step counters, then each
+///           solvable node's and each link's own checkpoint state.  The admittance matrix, source &
+///           potential vectors, decompositions, islands, node net capacitance delta-potentials and
+///           the minor step log are all rebuilt by restart and the next step, so aren't written.
+///           The stream is bracketed by the node & link counts and a hash of the link names & port
+///           counts, so that loadCheckpoint can reject a checkpoint from a different network.
+///
+///           Every link writes the GunnsBasicLink state: the blockage malfunction, flux and
+///           potential drop.  Of the core links, GunnsBasicSource adds its flux demand,
+///           GunnsBasicPotential its source potential and GunnsFluidLink, and so all fluid links,
+///           its mass & volumetric flow rates.  The other core links have no further state that
+///           Trick would checkpoint.  Links outside the core add their own run-time state, such as
+///           valve and pump positions or thermal panel fluxes.  Links opt in to this by overriding
+///           GunnsBasicLink::isCheckpointable for their exact type, and a network holding a link
+///           that hasn't opted in throws rather than saving or restoring that link partially.
+///
+///           The caller owns the writer, so several networks can share one stream, and a memory
+///           buffer can be re-used for repeated in-run rollback checkpoints.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    if (not mInitFlag) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "network has not been initialized.");
+    }
+    checkCheckpointLinks();
+
+    const unsigned int signature = computeCheckpointSignature();
+    writer.write(mNetworkSize);
+    writer.write(mNumLinks);
+    writer.write(signature);
+    saveCheckpointState(writer);
+    writer.write(signature);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Open native checkpoint stream to read from.
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads the state written by saveCheckpoint back into this network, then loads the
+///           solver's potential vectors from the restored node potentials, calls restart to rebuild
+///           everything else as after a Trick checkpoint load, and outputs the potentials to the
+///           link ports.  Solver modes and options aren't part of the checkpoint and are left as
+///           they are.
+///
+///           A stream made by a network with a different size or topology is rejected from its
+///           header before any state is changed, as is a network holding a link that hasn't opted
+///           in to native checkpoints.  The nodes and links read their state straight from the
+///           stream, so an error in the body, such as a truncated or corrupt block, a node mixture
+///           mismatch or a trailer out of sync, can only be found part way through.
+///           The network's own state is therefore saved to a memory stream first, and loaded back
+///           if the body fails, so a failed load leaves the network as it was.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    if (not mInitFlag) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "network has not been initialized.");
+    }
+    checkCheckpointLinks();
+
+    const unsigned int signature   = computeCheckpointSignature();
+    int                networkSize = 0;
+    int                numLinks    = 0;
+    unsigned int       header      = 0;
+    reader.read(networkSize);
+    reader.read(numLinks);
+    reader.read(header);
+    if (networkSize != mNetworkSize or numLinks != mNumLinks or header != signature) {
+        GUNNS_ERROR(TsParseException, "Invalid Checkpoint Stream",
+                    "checkpoint is from a different network.");
+    }
+
+    /// - Save the current state to roll back to if the body fails.
+    std::vector<unsigned char> backup;
+    GunnsCheckpointWriter backupWriter(mName + ".backup");
+    backupWriter.openBuffer(&backup);
+    saveCheckpointState(backupWriter);
+    backupWriter.close();
+
+    try {
+        loadCheckpointState(reader);
+        unsigned int trailer = 0;
+        reader.read(trailer);
+        if (trailer != signature) {
+            GUNNS_ERROR(TsParseException, "Invalid Checkpoint Stream",
+                        "checkpoint node or link state is out of sync.");
+        }
+    } catch (...) {
+        GunnsCheckpointReader backupReader(mName + ".backup");
+        backupReader.openBuffer(&backup);
+        loadCheckpointState(backupReader);
+        throw;
+    }
+
+    for (int node = 0; node < mNetworkSize; ++node) {
+        mPotentialVector[node]      = mNodes[node]->getPotential();
+        mMinorPotentialVector[node] = mPotentialVector[node];
+        mMajorPotentialVector[node] = mPotentialVector[node];
+    }
+    restart();
+
+    /// - The link port potentials aren't checkpointed, but links such as capacitors integrate from
+    ///   them, so they must be restored too or the network won't retrace its trajectory.
+    outputPotentialVector();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Open native checkpoint stream to write to.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Writes the body of a native checkpoint: the step counters, then each solvable node's
+///           and each link's own checkpoint state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::saveCheckpointState(GunnsCheckpointWriter& writer) const
+{
+    writer.write(mMajorStepCount);
+    writer.write(mMinorStepCount);
+    writer.write(mAvgMinorStepCount);
+    writer.write(mDecompositionCount);
+    writer.write(mAvgDecompositionCount);
+    writer.write(mRefinementCount);
+    writer.write(mRefinementEscalationCount);
+    writer.write(mFactorReuseCount);
+
+    for (int node = 0; node < mNetworkSize; ++node) {
+        mNodes[node]->saveCheckpoint(writer);
+    }
+    for (int link = 0; link < mNumLinks; ++link) {
+        mLinks[link]->saveCheckpoint(writer);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Open native checkpoint stream to read from.
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the body written by saveCheckpointState, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::loadCheckpointState(GunnsCheckpointReader& reader)
+{
+    reader.read(mMajorStepCount);
+    reader.read(mMinorStepCount);
+    reader.read(mAvgMinorStepCount);
+    reader.read(mDecompositionCount);
+    reader.read(mAvgDecompositionCount);
+    reader.read(mRefinementCount);
+    reader.read(mRefinementEscalationCount);
+    reader.read(mFactorReuseCount);
+
+    for (int node = 0; node < mNetworkSize; ++node) {
+        mNodes[node]->loadCheckpoint(reader);
+    }
+    for (int link = 0; link < mNumLinks; ++link) {
+        mLinks[link]->loadCheckpoint(reader);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsInitializationException
+///
+/// @details  Throws if any link's native checkpoint doesn't cover all of its state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::checkCheckpointLinks() const
+{
+    for (int link = 0; link < mNumLinks; ++link) {
+        if (not mLinks[link]->isCheckpointable()) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "link " + std::string(mLinks[link]->getName())
+                        + " doesn't support native checkpoints.");
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int  (--)  FNV-1a hash of the network topology.
+///
+/// @details  Hashes the network size and each link's name and number of ports, in order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int Gunns::computeCheckpointSignature() const
+{
+    unsigned int hash = 2166136261U;
+    hash = (hash ^ static_cast<unsigned int>(mNetworkSize)) * 16777619U;
+    for (int link = 0; link < mNumLinks; ++link) {
+        for (const char* c = mLinks[link]->getName(); c and *c; ++c) {
+            hash = (hash ^ static_cast<unsigned char>(*c)) * 16777619U;
+        }
+        hash = (hash ^ static_cast<unsigned int>(mLinks[link]->getNumberPorts())) * 16777619U;
+    }
+    return hash;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details   Performs functions common to initialization and restart.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -697,6 +1057,7 @@ inline void Gunns::initializeRestartCommonFunctions()
     mLastMinorStep          = 0;
     mMaxDecompositionCount  = 0;
     mLastDecomposition      = 0;
+    mMaxRefinementCount     = 0;
 
     /// - Reset the worst-case timing mode flag.
     mWorstCaseTiming        = false;   
@@ -729,9 +1090,37 @@ void Gunns::step(const double timeStep)
 {
     double startTime = CLOCK_TIME;
 
-    /// - Check for proper initialization and run-time mode settings.
+    /// - Check for proper initialization and run-time mode settings, and prepare the links and
+    ///   nodes for the major step.
+    if (not beginMajorStep()) return;
+
+    /// - Build & solve the system of equations.
+    bool isConverged = false;
+    try {
+        isConverged = iterateMinorSteps(timeStep);
+    } catch (TsNumericalException& e) {
+        mStepLog.recordStepResult(mLastDecomposition, GunnsMinorStepData::MATH_FAIL);
+        mStepLog.endMajorStep();
+        throw e;
+    }
+
+    endMajorStep(timeStep, isConverged);
+    mStepTime = CLOCK_TIME - startTime;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) False if the solver is paused and the major step should be skipped.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Performs the first part of the major step, before the minor steps: checks the step
+///           inputs, counts the major step, calls the links to process their inputs and resets the
+///           node flows.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::beginMajorStep()
+{
     checkStepInputs();
-    if (PAUSE == mRunMode) return;
+    if (PAUSE == mRunMode) return false;
     ++mMajorStepCount;
     mStepLog.beginMajorStep();
 
@@ -745,17 +1134,19 @@ void Gunns::step(const double timeStep)
     for (int node = 0; node < mNumNodes; ++node) {
         mNodes[node]->resetFlows();
     }
+    return true;
+}
 
-    /// - Build & solve the system of equations.
-    bool isConverged = false;
-    try {
-        isConverged = iterateMinorSteps(timeStep);
-    } catch (TsNumericalException& e) {
-        mStepLog.recordStepResult(mLastDecomposition, GunnsMinorStepData::MATH_FAIL);
-        mStepLog.endMajorStep();
-        throw e;
-    }
-
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  timeStep    (s)  The time step of the major frame.
+/// @param[in]  isConverged (--) Whether the minor steps converged on a solution.
+///
+/// @details  Performs the last part of the major step, after the minor steps: updates the
+///           performance metrics, and either transports the flows and calls the links to process
+///           their outputs, or reverts to the last major step solution if not converged.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::endMajorStep(const double timeStep, const bool isConverged)
+{
     /// - System performance metrics: update the average minor frame count per major frame.
     mAvgMinorStepCount     = double (mMinorStepCount)     / double (mMajorStepCount);
     mAvgDecompositionCount = double (mDecompositionCount) / double (mMajorStepCount);
@@ -792,8 +1183,8 @@ void Gunns::step(const double timeStep)
     mRebuild = false;
     mStepLog.endMajorStep();
 
-    mSolveTime = mSolveTimeWorking;
-    mStepTime  = CLOCK_TIME - startTime;
+    mSolveTime     = mSolveTimeWorking;
+    mDecomposeTime = mDecomposeTimeWorking;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -816,6 +1207,7 @@ bool Gunns::iterateMinorSteps(const double timeStep)
     bool networkConverged = false;
     int  convergedStep    = 0;
     mSolveTimeWorking     = 0.0;
+    mDecomposeTimeWorking = 0.0;
     GunnsBasicLink::SolutionResult result = GunnsBasicLink::CONFIRM;
 
     /// - A linear network is always considered converged by definition, and minor steps are
@@ -835,39 +1227,14 @@ bool Gunns::iterateMinorSteps(const double timeStep)
     for (mLastMinorStep = 1; mLastMinorStep <= minorStepLimit; ++mLastMinorStep) {
 
         /// - Performance metrics: update the minor step counts.
-        ++mMinorStepCount;
-        if (mLastMinorStep > mMaxMinorStepCount) {
-            mMaxMinorStepCount = mLastMinorStep;
-        }
-        mStepLog.beginMinorStep(mMajorStepCount, mLastMinorStep);
+        beginMinorStep();
 
         /// - If the result of the previous minor step is DELAY, then we skip stepping the links and
         ///   building/solving the system.
         if (GunnsBasicLink::DELAY != result) {
 
-            /// - Step each link in the network.  On the first minor step, we call the link's main
-            ///   step method.  On subsequent minor steps (in a non-linear network), we call non-
-            ///   linear link's minorStep method.
-            for (int link = 0; link < mNumLinks; ++link) {
-
-                if (1 == mLastMinorStep) {
-                    mLinks[link]->step(timeStep);
-                }
-
-                else if(mLinks[link]->isNonLinear()) {
-                    mLinks[link]->minorStep(timeStep, mLastMinorStep);
-                }
-
-                /// - Rebuild the system if any link declares it is changing the admittance matrix.
-                if(mLinks[link]->needAdmittanceUpdate()) {
-                    mRebuild = true;
-                }
-            }
-
-            /// - Force rebuild of the system every minor step for worst-case timing mode.
-            if (mWorstCaseTiming) {
-                mRebuild = true;
-            }
+            /// - Step each link in the network for their contributions to the system.
+            stepLinks(timeStep, mLastMinorStep);
 
             /// - Now that we have all the link contributions to the system of equations, build and
             ///   solve the system for a new solution vector, handle overrides of the solution, and
@@ -940,6 +1307,72 @@ bool Gunns::iterateMinorSteps(const double timeStep)
     return networkConverged;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Updates the minor step performance metrics and starts the step log for the minor step
+///           given by mLastMinorStep.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::beginMinorStep()
+{
+    ++mMinorStepCount;
+    if (mLastMinorStep > mMaxMinorStepCount) {
+        mMaxMinorStepCount = mLastMinorStep;
+    }
+    mStepLog.beginMinorStep(mMajorStepCount, mLastMinorStep);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] timeStep  (s)  Execution time step.
+/// @param[in] minorStep (--) The absolute minor step # that the network is on.
+///
+/// @details  Steps the links for their contributions to the system of equations, through the link
+///           dispatcher if there is one, and flags the system for rebuild when any link changes its
+///           admittance matrix.  The dispatcher is dropped if a link re-maps a port out of its
+///           compiled node map.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::stepLinks(const double timeStep, const int minorStep)
+{
+    /// - Step each link in the network.  On the first minor step, we call the link's main
+    ///   step method.  On subsequent minor steps (in a non-linear network), we call non-
+    ///   linear link's minorStep method.
+    if (mLinkDispatcher) {
+        const bool update = (1 == minorStep)
+                          ? mLinkDispatcher->step(timeStep)
+                          : mLinkDispatcher->minorStep(timeStep, minorStep);
+        if (update) {
+            mRebuild = true;
+        }
+
+        /// - A link may have re-mapped a port when it stepped, which the dispatcher can't follow,
+        ///   so re-bind it, which reverts to the link loops with a warning on a mismatch.
+        if (not mLinkDispatcher->checkNodeMaps()) {
+            bindLinkDispatcher();
+            mRebuild = true;
+        }
+
+    } else {
+        for (int link = 0; link < mNumLinks; ++link) {
+
+            if (1 == minorStep) {
+                mLinks[link]->step(timeStep);
+            }
+
+            else if(mLinks[link]->isNonLinear()) {
+                mLinks[link]->minorStep(timeStep, minorStep);
+            }
+
+            /// - Rebuild the system if any link declares it is changing the admittance matrix.
+            if(mLinks[link]->needAdmittanceUpdate()) {
+                mRebuild = true;
+            }
+        }
+    }
+
+    /// - Force rebuild of the system every minor step for worst-case timing mode.
+    if (mWorstCaseTiming) {
+        mRebuild = true;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] minorStep (--) The absolute minor step # that the network is on
 /// @param[in] timeStep  (s)  Execution time step
@@ -953,15 +1386,7 @@ bool Gunns::iterateMinorSteps(const double timeStep)
 int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
 {
     //TODO prototype SOR/Cholesky mix
-    buildSourceVector();
-    bool needDecomposition = false;
-    if (mRebuild or mSorActive or mDebugDesiredStep != 0) {
-        buildAdmittanceMatrix();
-        conditionAdmittanceMatrix();
-        needDecomposition = true;
-        mRebuild = false;
-    }
-    mStepLog.recordLinkContributions();
+    bool needDecomposition = buildSystem();
 
     //if sorResult = -1, then sor didnt' converge, so throw a warning, reset mPotentialVector back
     //to the previous minor step, and go to Cholesky.
@@ -979,6 +1404,18 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
     //do cholesky if SOR either failed to converge or isn't being attempted.
     int result = 0;
     if (mSorLastIteration < 0) {
+        /// - When the factors can be reused, skip the decomposition of a changed admittance matrix
+        ///   and correct the solution with the last factors instead.  Stale factors that can't be
+        ///   reused are replaced by decomposing the current matrix, which was left intact.
+        bool reuseFactors = false;
+        if (NORMAL == mSolverMode) {
+            const bool reuseAllowed = isFactorReuseActive() and isFactorReuseAllowed(minorStep);
+            if (needDecomposition or mFactorsStale) {
+                reuseFactors      = reuseAllowed;
+                needDecomposition = not reuseAllowed;
+            }
+        }
+
         if (needDecomposition) {
             /// - Save pre-decomposition admittance matrix elements for debugging on the desired step.
             if (mDebugDesiredStep == minorStep or mDebugDesiredStep < 0) {
@@ -993,37 +1430,22 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
                     result = 1;
                     mLastDecomposition++;
                     mDecompositionCount++;
+                    mFactorsStale     = false;
+                    mFactorReuseSteps = 0;
 
-                    /// - Decompose admittance matrix by islands.  This builds a new sub-matrix for
-                    ///   each island, then copies the decomposed values back into the main
-                    ///   admittance matrix.
-                    if (SOLVE == mIslandMode) {
-                        /// - Loop over all islands, form a sub-matrix for each island and condition
-                        ///   it.  Only decompose islands that contain >1 nodes.
-                        for (int island = 0; island < mNetworkSize; ++island) {
-                            const int n = mIslandVectors[island].size();
-                            if ( (0 < n) and (GPU_SPARSE != mGpuMode) ) {
-                                /// - Form sub-matrix for island from the main matrix.
-                                for (int i=0, ij=0; i<n; ++i) {
-                                    const int in = mIslandVectors[island][i]*mNetworkSize;
-                                    for (int j=0; j<n; ++j, ++ij) {
-                                        mAdmittanceMatrixIsland[ij] =
-                                                mAdmittanceMatrix[in + mIslandVectors[island][j]];
-                                    }
-                                }
-                                if (1 < n) {
-                                    decompose(mAdmittanceMatrixIsland, n, island);
-                                }
-                                /// - Copy decomposed sub-matrix back into main matrix.
-                                for (int i=0, ij=0; i<n; ++i) {
-                                    const int in = mIslandVectors[island][i]*mNetworkSize;
-                                    for (int j=0; j<n; ++j, ++ij) {
-                                        mAdmittanceMatrix[in + mIslandVectors[island][j]] =
-                                                mAdmittanceMatrixIsland[ij];
-                                    }
-                                }
-                            }
-                        }
+                    /// - Decompose in single precision for the mixed-precision solution, which
+                    ///   leaves the double-precision admittance matrix intact for refinement.
+                    if (isMixedPrecisionActive()) {
+                        decomposeSingle();
+
+                    /// - Decompose a copy of the admittance matrix for factor reuse, which leaves
+                    ///   the admittance matrix intact for correcting later minor steps.
+                    } else if (isFactorReuseActive()) {
+                        decomposeCopy();
+
+                    /// - Decompose admittance matrix by islands.
+                    } else if (SOLVE == mIslandMode) {
+                        decomposeIslands(mAdmittanceMatrix);
 
                     /// - Decompose the full matrix without islands.
                     } else {
@@ -1045,7 +1467,11 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
         ///   potential.  In SLAVE mode, an external potential vector is received from the caller.
         /// - Final node network capacitance calculations following the network solution.
         if (NORMAL == mSolverMode) {
-            solveCholesky();
+            if (reuseFactors) {
+                solveReusedFactors();
+            } else {
+                solveCholesky();
+            }
             cleanPotentialVector();
             computeNetworkCapacitances(timeStep);
         }
@@ -1054,6 +1480,26 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
     return(result);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the admittance matrix was rebuilt and needs decomposition.
+///
+/// @details  Builds the source vector, and rebuilds and conditions the admittance matrix when any
+///           link has changed it or the solver options require it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::buildSystem()
+{
+    buildSourceVector();
+    bool needDecomposition = false;
+    if (mRebuild or mSorActive or mDebugDesiredStep != 0) {
+        buildAdmittanceMatrix();
+        conditionAdmittanceMatrix();
+        needDecomposition = true;
+        mRebuild = false;
+    }
+    mStepLog.recordLinkContributions();
+    return needDecomposition;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in,out] A      (--) The admittance sub-matrix to be decomposed.
 /// @param[in]     size   (--) The number of rows in the admittance sub-matrix.
@@ -1062,8 +1508,8 @@ int Gunns::buildAndSolveSystem(const int minorStep, const double timeStep)
 /// @throws   TsNumericalException
 ///
 /// @details  Calls the CPU or GPU decomposition based on the matrix size relative to the CPU/GPU
-///           cutoff.  In a Trick environment, also records the elapsed wall time of the
-///           decomposition for timing analysis.
+///           cutoff.  Also records the elapsed wall time of the decomposition for timing
+///           analysis.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void Gunns::decompose(double *A, const int size, const int island)
 {
@@ -1082,7 +1528,173 @@ void Gunns::decompose(double *A, const int size, const int island)
     } else if ( (GPU_SPARSE != mGpuMode) or (size < mGpuSizeThreshold) ) {
         handleDecompose(mSolverCpu, A, size, island);
     }
-    mSolveTimeWorking += CLOCK_TIME - startTime;
+    const double elapsedTime = CLOCK_TIME - startTime;
+    mSolveTimeWorking     += elapsedTime;
+    mDecomposeTimeWorking += elapsedTime;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] A  (--) The full admittance matrix to be decomposed by islands.
+///
+/// @throws   TsNumericalException
+///
+/// @details  Decomposes the given admittance matrix by islands.  This builds a new sub-matrix for
+///           each island, then copies the decomposed values back into the given matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::decomposeIslands(double *A)
+{
+    /// - Loop over all islands, form a sub-matrix for each island and condition it.  Only decompose
+    ///   islands that contain >1 nodes.
+    for (int island = 0; island < mNetworkSize; ++island) {
+        const int n = mIslandVectors[island].size();
+        if ( (0 < n) and (GPU_SPARSE != mGpuMode) ) {
+            /// - Form sub-matrix for island from the main matrix.
+            for (int i=0, ij=0; i<n; ++i) {
+                const int in = mIslandVectors[island][i]*mNetworkSize;
+                for (int j=0; j<n; ++j, ++ij) {
+                    mAdmittanceMatrixIsland[ij] = A[in + mIslandVectors[island][j]];
+                }
+            }
+            if (1 < n) {
+                decompose(mAdmittanceMatrixIsland, n, island);
+            }
+            /// - Copy decomposed sub-matrix back into main matrix.
+            for (int i=0, ij=0; i<n; ++i) {
+                const int in = mIslandVectors[island][i]*mNetworkSize;
+                for (int j=0; j<n; ++j, ++ij) {
+                    A[in + mIslandVectors[island][j]] = mAdmittanceMatrixIsland[ij];
+                }
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Decomposes a single-precision copy of the admittance matrix for the mixed-precision
+///           solution, by islands if islands are being solved.  The double-precision admittance
+///           matrix is left intact for computing the refinement residuals.  If the single-precision
+///           decomposition fails, such as from a pivot lost to round-off in a poorly conditioned
+///           matrix, this escalates to a double-precision decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::decomposeSingle()
+{
+    allocateFactorArrays();
+    mRefinementEscalated = false;
+    const double startTime = CLOCK_TIME;
+    bool failed = false;
+    try {
+        const int matrixSize = mNetworkSize * mNetworkSize;
+        for (int i = 0; i < matrixSize; ++i) {
+            mAdmittanceMatrixSingle[i] = static_cast<float>(mAdmittanceMatrix[i]);
+        }
+        if (SOLVE == mIslandMode) {
+            for (int island = 0; island < mNetworkSize; ++island) {
+                const int n = mIslandVectors[island].size();
+                if (1 < n) {
+                    /// - Form sub-matrix for island from the single-precision matrix, decompose it
+                    ///   and copy the decomposed values back.
+                    for (int i=0, ij=0; i<n; ++i) {
+                        const int in = mIslandVectors[island][i]*mNetworkSize;
+                        for (int j=0; j<n; ++j, ++ij) {
+                            mAdmittanceMatrixSingleIsland[ij] =
+                                    mAdmittanceMatrixSingle[in + mIslandVectors[island][j]];
+                        }
+                    }
+                    mSolverCpu->DecomposeSingle(mAdmittanceMatrixSingleIsland, n);
+                    for (int i=0, ij=0; i<n; ++i) {
+                        const int in = mIslandVectors[island][i]*mNetworkSize;
+                        for (int j=0; j<n; ++j, ++ij) {
+                            mAdmittanceMatrixSingle[in + mIslandVectors[island][j]] =
+                                    mAdmittanceMatrixSingleIsland[ij];
+                        }
+                    }
+                }
+            }
+        } else {
+            mSolverCpu->DecomposeSingle(mAdmittanceMatrixSingle, mNetworkSize);
+        }
+    } catch (TsNumericalException&) {
+        failed = true;
+    }
+    const double elapsedTime = CLOCK_TIME - startTime;
+    mSolveTimeWorking     += elapsedTime;
+    mDecomposeTimeWorking += elapsedTime;
+    if (failed) {
+        escalateDecomposition();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsNumericalException
+///
+/// @details  Decomposes a double-precision copy of the admittance matrix when the single-precision
+///           factors can't give an accurate enough solution.  The mixed-precision solution then
+///           uses these factors until the next decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::escalateDecomposition()
+{
+    decomposeCopy();
+    mRefinementEscalated = true;
+    mRefinementEscalationCount++;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsNumericalException
+///
+/// @details  Decomposes a double-precision copy of the admittance matrix, by islands if islands are
+///           being solved, leaving the admittance matrix intact for computing residuals.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::decomposeCopy()
+{
+    allocateFactorArrays();
+    const int matrixSize = mNetworkSize * mNetworkSize;
+    for (int i = 0; i < matrixSize; ++i) {
+        mAdmittanceMatrixLdu[i] = mAdmittanceMatrix[i];
+    }
+    if (SOLVE == mIslandMode) {
+        decomposeIslands(mAdmittanceMatrixLdu);
+    } else {
+        decompose(mAdmittanceMatrixLdu, mNetworkSize);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] minorStep (--) The minor step # that the network is on.
+///
+/// @returns  bool (--) True if this minor step can be solved with the last factors.
+///
+/// @details  Factors are never reused on the first minor step of a major step, so that every major
+///           step starts from factors of the current admittance matrix, nor when a node requests
+///           its network capacitance, which needs factors of the current matrix.  After that, they
+///           can be reused for up to the limit number of consecutive minor steps, as long as the
+///           minor step iterations are converging fast enough: the largest node potential change
+///           of the last minor step must be no more than the rate limit times that of the minor
+///           step before it.  This also saves the last potential change for the next minor step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Gunns::isFactorReuseAllowed(const int minorStep)
+{
+    double delta = 0.0;
+    if (minorStep > 1) {
+        for (int node = 0; node < mNetworkSize; ++node) {
+            delta = std::max(delta, mNodesConvergence[node]);
+        }
+    }
+    const double lastDelta = mLastConvergenceDelta;
+    mLastConvergenceDelta  = delta;
+
+    if (minorStep < 2 or mWorstCaseTiming or mSorActive or mDebugDesiredStep != 0
+            or mFactorReuseSteps >= mFactorReuseLimit) {
+        return false;
+    }
+    if (mFactorReuseSteps > 0 and delta > mFactorReuseRate * lastDelta) {
+        return false;
+    }
+    for (int node = 0; node < mNetworkSize; ++node) {
+        if (mNodes[node]->getNetworkCapacitanceRequest() > DBL_EPSILON) {
+            return false;
+        }
+    }
+    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1225,18 +1837,23 @@ void Gunns::buildAdmittanceMatrix()
         mAdmittanceMatrix[i] = 0.0;
     }
 
-    for (int link = 0; link < mNumLinks; ++link) {
-        const int numPorts = mLinkNumPorts[link];
+    if (mLinkDispatcher) {
+        mLinkDispatcher->buildAdmittanceMatrix(mAdmittanceMatrix);
 
-        for (int port1 = 0; port1 < numPorts; ++port1) {
-            const int node1 = mLinkNodeMaps[link][port1];
+    } else {
+        for (int link = 0; link < mNumLinks; ++link) {
+            const int numPorts = mLinkNumPorts[link];
 
-            for (int port2 = 0, a = port1*numPorts; port2 < numPorts; ++port2, ++a) {
-                const int node2 = mLinkNodeMaps[link][port2];
+            for (int port1 = 0; port1 < numPorts; ++port1) {
+                const int node1 = mLinkNodeMaps[link][port1];
 
-                // The vacuum/ground node is not actually in the system, so we leave it off.
-                if (node1 < mNetworkSize && node2 < mNetworkSize) {
-                    mAdmittanceMatrix[node1*mNetworkSize + node2] += mLinkAdmittanceMatrices[link][a];
+                for (int port2 = 0, a = port1*numPorts; port2 < numPorts; ++port2, ++a) {
+                    const int node2 = mLinkNodeMaps[link][port2];
+
+                    // The vacuum/ground node is not actually in the system, so we leave it off.
+                    if (node1 < mNetworkSize && node2 < mNetworkSize) {
+                        mAdmittanceMatrix[node1*mNetworkSize + node2] += mLinkAdmittanceMatrices[link][a];
+                    }
                 }
             }
         }
@@ -1345,14 +1962,19 @@ void Gunns::buildSourceVector()
         mSourceVector[i] = 0.0;
     }
 
-    for (int link = 0; link < mNumLinks; ++link) {
+    if (mLinkDispatcher) {
+        mLinkDispatcher->buildSourceVector(mSourceVector);
 
-        for (int port = 0; port < mLinkNumPorts[link]; ++port) {
-            const int node = mLinkNodeMaps[link][port];
+    } else {
+        for (int link = 0; link < mNumLinks; ++link) {
 
-            // The vacuum/ground node is not actually in the system, so we leave it off.
-            if (node < mNetworkSize) {
-                mSourceVector[node] += mLinkSourceVectors[link][port];
+            for (int port = 0; port < mLinkNumPorts[link]; ++port) {
+                const int node = mLinkNodeMaps[link][port];
+
+                // The vacuum/ground node is not actually in the system, so we leave it off.
+                if (node < mNetworkSize) {
+                    mSourceVector[node] += mLinkSourceVectors[link][port];
+                }
             }
         }
     }
@@ -1419,6 +2041,12 @@ void Gunns::solveCholesky()
                         mPotentialVector, mNetworkSize);
             mSolveTimeWorking += CLOCK_TIME - startTime;
         }
+    } else if (isMixedPrecisionActive()) {
+        solveMixedPrecision();
+    } else if (isFactorReuseActive()) {
+        double startTime = CLOCK_TIME;
+        handleSolve(mSolverCpu, mAdmittanceMatrixLdu, mSourceVector, mPotentialVector, mNetworkSize);
+        mSolveTimeWorking += CLOCK_TIME - startTime;
     } else {
         double startTime = CLOCK_TIME;
         handleSolve(mSolverCpu, mAdmittanceMatrix, mSourceVector, mPotentialVector, mNetworkSize);
@@ -1426,6 +2054,134 @@ void Gunns::solveCholesky()
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsNumericalException
+///
+/// @details  Corrects the last potential vector solution for the current admittance matrix and
+///           source vector with the last factors, which may be from an older admittance matrix:
+///           {p} += [LDU_old]^-1 ({w} - [A]{p}).  This is one modified Newton iteration, and the
+///           minor step iterations converge it the rest of the way.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::solveReusedFactors()
+{
+    const double startTime = CLOCK_TIME;
+    computeRefinementResidual();
+    if (isMixedPrecisionActive() and not mRefinementEscalated) {
+        try {
+            mSolverCpu->SolveSingle(mAdmittanceMatrixSingle, mRefinementResidualVector,
+                                    mRefinementCorrection, mNetworkSize);
+        } catch (TsNumericalException& e) {
+            std::ostringstream msg;
+            msg << e.getMessage() << " " << e.getThrowingEntityName() << " " << e.getCause() << ".";
+            GUNNS_ERROR(TsNumericalException, "Error Return Value", msg.str());
+        }
+    } else {
+        handleSolve(mSolverCpu, mAdmittanceMatrixLdu, mRefinementResidualVector,
+                    mRefinementCorrection, mNetworkSize);
+    }
+    for (int i = 0; i < mNetworkSize; ++i) {
+        mPotentialVector[i] += mRefinementCorrection[i];
+    }
+    mFactorsStale = true;
+    ++mFactorReuseSteps;
+    ++mFactorReuseCount;
+    mSolveTimeWorking += CLOCK_TIME - startTime;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsNumericalException
+///
+/// @details  Solves the system with the single-precision factors, then iteratively refines the
+///           solution against the double-precision admittance matrix: each iteration computes the
+///           residual {r} = {w} - [A]{p} in double precision, solves [A]{dp} = {r} with the single-
+///           precision factors, and adds the correction to {p}.  When the relative residual meets
+///           the refinement tolerance, refinement is done.  If the residual stops shrinking by at
+///           least half each iteration, or the refinement limit is reached, then the matrix is too
+///           poorly conditioned for single-precision factors, and we escalate to a double-precision
+///           decomposition and solution, which is then used until the next decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void Gunns::solveMixedPrecision()
+{
+    double startTime = CLOCK_TIME;
+    int iterations = 0;
+    double residual = 0.0;
+    if (not mRefinementEscalated) {
+        try {
+            mSolverCpu->SolveSingle(mAdmittanceMatrixSingle, mSourceVector, mPotentialVector,
+                                    mNetworkSize);
+            double lastResidual = 0.0;
+            while (true) {
+                residual = computeRefinementResidual();
+                if (residual <= mRefinementTolerance) {
+                    break;
+                }
+                if (iterations >= mRefinementLimit or (iterations > 0 and residual > 0.5 * lastResidual)) {
+                    break;
+                }
+                mSolverCpu->SolveSingle(mAdmittanceMatrixSingle, mRefinementResidualVector,
+                                        mRefinementCorrection, mNetworkSize);
+                for (int i = 0; i < mNetworkSize; ++i) {
+                    mPotentialVector[i] += mRefinementCorrection[i];
+                }
+                lastResidual = residual;
+                ++iterations;
+            }
+        } catch (TsNumericalException&) {
+            residual = mRefinementTolerance + 1.0;
+        }
+        mSolveTimeWorking += CLOCK_TIME - startTime;
+
+        /// - Refinement stalled, so escalate to double-precision factors.
+        if (residual > mRefinementTolerance) {
+            escalateDecomposition();
+        }
+        startTime = CLOCK_TIME;
+    }
+    if (mRefinementEscalated) {
+        handleSolve(mSolverCpu, mAdmittanceMatrixLdu, mSourceVector, mPotentialVector, mNetworkSize);
+        residual = computeRefinementResidual();
+    }
+    mSolveTimeWorking += CLOCK_TIME - startTime;
+
+    mRefinementCount   += iterations;
+    mRefinementResidual = residual;
+    if (iterations > mMaxRefinementCount) {
+        mMaxRefinementCount = iterations;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (--) The largest relative residual of the current solution's rows.
+///
+/// @details  Computes the residual {r} = {w} - [A]{p} of the current potential vector solution
+///           against the double-precision admittance matrix into the refinement residual vector,
+///           and returns the largest row residual relative to the magnitude of that row's terms.
+///           Scaling each row separately keeps rows with large admittances, such as potential
+///           sources, from hiding the error in the rest of the network.  A row that isn't finite
+///           returns the largest double, so that a NaN or infinite solution always fails the
+///           refinement tolerance rather than being dropped by the comparisons.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double Gunns::computeRefinementResidual()
+{
+    double maxResidual = 0.0;
+    for (int row = 0, rowN = 0; row < mNetworkSize; ++row, rowN += mNetworkSize) {
+        double sum   = mSourceVector[row];
+        double scale = fabs(mSourceVector[row]);
+        for (int col = 0; col < mNetworkSize; ++col) {
+            const double term = mAdmittanceMatrix[rowN + col] * mPotentialVector[col];
+            sum   -= term;
+            scale += fabs(term);
+        }
+        mRefinementResidualVector[row] = sum;
+        if (not (fabs(sum) <= DBL_MAX and scale <= DBL_MAX)) {
+            maxResidual = DBL_MAX;
+        } else if (scale > 0.0) {
+            maxResidual = std::max(maxResidual, fabs(sum) / scale);
+        }
+    }
+    return maxResidual;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] solver (--) Pointer to the linear algebra solver to call.
 /// @param[in] A      (--) The admittance matrix to decompose.
@@ -1484,7 +2240,7 @@ void Gunns::handleSolve(CholeskyLdu* solver, double* A, double* w, double* p, co
 /// @details  Zeroes out potential vector values that are smaller than a minimum absolute value.
 ///           This prevents a network from approaching dirty zeroes.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-inline void Gunns::cleanPotentialVector()
+void Gunns::cleanPotentialVector()
 {
     for (int node = 0; node < mNetworkSize; ++node) {
         if (fabs(mPotentialVector[node]) < DBL_EPSILON) {
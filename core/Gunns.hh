@@ -63,6 +63,8 @@ PROGRAMMERS:
 /// - Forward declare classes used for pointer attributes and method arguments.
 class  GunnsBasicNode;
 class  GunnsBasicFlowOrchestrator;
+class  GunnsLinkDispatcher;
+class  GunnsEnsemble;
 struct GunnsNodeList;
 class  PolyFluidConfigData;
 class  CholeskyLdu;
@@ -106,6 +108,8 @@ class GunnsConfigData
 class Gunns
 {
     TS_MAKE_SIM_COMPATIBLE(Gunns);
+    /// - The ensemble drives the major step phases of its lanes in lock-step.
+    friend class GunnsEnsemble;
 
     public:
         /// @brief Enumeration of the valid solver modes.
@@ -161,6 +165,12 @@ class Gunns
         /// @brief This method restarts this Gunns object.
         void restart();
 
+        /// @brief Writes the network's minimal state to a native checkpoint stream.
+        void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Loads the network's state from a native checkpoint stream and restarts.
+        void loadCheckpoint(GunnsCheckpointReader& reader);
+
         /// @brief Cycles this Gunns object to iterate the network in run-time.
         void step(const double timeStep);
 
@@ -188,9 +198,20 @@ class Gunns
         /// @brief Sets the solver worst-case timing flag.
         void setWorstCaseTiming(const bool flag);
 
+        /// @brief Sets the mixed-precision solution option and its iterative refinement controls.
+        void setMixedPrecision(const bool   flag,
+                               const int    refinementLimit     = 10,
+                               const double refinementTolerance = 1.0E-13);
+
+        /// @brief Sets the limit and convergence rate controls for reusing factors across minor steps.
+        void setFactorReuse(const int limit, const double rateLimit = 0.5);
+
         /// @brief Points the solver to use the given flow orchestrator.
         void setFlowOrchestrator(GunnsBasicFlowOrchestrator* orchestrator);
 
+        /// @brief Points the solver to dispatch its link loops to the given link dispatcher.
+        void setLinkDispatcher(GunnsLinkDispatcher* dispatcher);
+
         /// @brief Sets the slave potential vector values to the given array values.
         void setSlavePotentialVector(const double* potentials);
 
@@ -224,9 +245,27 @@ class Gunns
         /// @brief Gets the number of admittance matrix decompositions.
         int getDecompositionCount() const;
 
+        /// @brief Gets the total number of mixed-precision iterative refinement iterations.
+        int getRefinementCount() const;
+
+        /// @brief Gets the highest number of refinement iterations that has occurred in a solution.
+        int getMaxRefinementCount() const;
+
+        /// @brief Gets the relative residual of the last mixed-precision solution.
+        double getRefinementResidual() const;
+
+        /// @brief Gets the number of mixed-precision escalations to double-precision decomposition.
+        int getRefinementEscalationCount() const;
+
+        /// @brief Gets the total number of minor steps solved with reused factors.
+        int getFactorReuseCount() const;
+
         /// @brief Gets the most recent solve time value.
         double getSolveTime() const;
 
+        /// @brief Gets the most recent decomposition time value.
+        double getDecomposeTime() const;
+
         /// @brief Gets the most recent step time value.
         double getStepTime() const;
 
@@ -242,6 +281,9 @@ class Gunns
         /// @brief Gets the array of links orchestrated by this solver.
         GunnsBasicLink** getLinks() const;
 
+        /// @brief Gets the link dispatcher in use, or null if the solver loops over its links.
+        GunnsLinkDispatcher* getLinkDispatcher() const;
+
         /// @brief Gets the last minor step link solution results.
         const GunnsBasicLink::SolutionResult* getLinksConvergence() const;
 
@@ -256,6 +298,7 @@ class Gunns
         GunnsBasicNode** mNodes;          /**< ** (--) trick_chkpnt_io(**) Pointers to the network nodes */
         GunnsBasicFlowOrchestrator* mFlowOrchestrator; /**< ** (--) trick_chkpnt_io(**) The flow orchestrator. */
         bool mOwnsFlowOrchestrator;       /**< *o (--) trick_chkpnt_io(**) This solver owns and will delete the flow orchestrator when true. */
+        GunnsLinkDispatcher* mLinkDispatcher; /**< ** (--) trick_chkpnt_io(**) Optional link dispatcher replacing the link loops, not owned. */
 
         /// @details  The admittance matrix [A] in the [A]{x} = {b} system of equations.  This is an
         ///           n X n symmetrical positive definite matrix representing the ability of the
@@ -374,6 +417,8 @@ class Gunns
         double  mAvgDecompositionCount;   /**<    (--)                     Average matrix decompositions per major step since init */
         double  mSolveTimeWorking;        /**< ** (s)  trick_chkpnt_io(**) Working term for accumulating total value for mSolveTime. */
         double  mSolveTime;               /**<    (s)  trick_chkpnt_io(**) Total duration of all solver decomposition and solve calls the last major step. */
+        double  mDecomposeTimeWorking;    /**< ** (s)  trick_chkpnt_io(**) Working term for accumulating total value for mDecomposeTime. */
+        double  mDecomposeTime;           /**<    (s)  trick_chkpnt_io(**) Total duration of the solver decomposition calls the last major step, included in mSolveTime. */
         double  mStepTime;                /**<    (s)  trick_chkpnt_io(**) Total duration of the last step call. */
         /// @details  Forces the solver to keep decomposing the matrix up to the decomposition limit
         ///           each major step regardless of convergence, which uses the maximum CPU.  This
@@ -416,6 +461,47 @@ class Gunns
         int     mSorFailCount;            /**<    (--)                     SOR number of convergence failures */
         /// @}
 
+        /// @name     Mixed-precision solution attributes.
+        /// @{
+        /// @details  When mixed-precision is enabled, the admittance matrix is decomposed in single
+        ///           precision and the solution is iteratively refined to double precision accuracy
+        ///           against the double precision admittance matrix, which is left intact.  If the
+        ///           refinement stalls or the single precision decomposition fails, the solver
+        ///           escalates to a double precision decomposition for the remainder of that
+        ///           decomposition's solutions.  This only applies to the CPU (NO_GPU) solver.
+        bool    mMixedPrecision;                /**<    (--) trick_chkpnt_io(**) Use single-precision decomposition with iterative refinement */
+        int     mRefinementLimit;               /**<    (--) trick_chkpnt_io(**) Maximum refinement iterations per solution before escalating */
+        double  mRefinementTolerance;           /**<    (--) trick_chkpnt_io(**) Relative residual for refinement convergence */
+        bool    mRefinementEscalated;           /**< ** (--) trick_chkpnt_io(**) The current decomposition was escalated to double precision */
+        float*  mAdmittanceMatrixSingle;        /**< ** (--) trick_chkpnt_io(**) Single-precision decomposed admittance matrix */
+        float*  mAdmittanceMatrixSingleIsland;  /**< ** (--) trick_chkpnt_io(**) Working array for single-precision island decomposition */
+        double* mAdmittanceMatrixLdu;           /**< ** (--) trick_chkpnt_io(**) Double-precision decomposed admittance matrix when escalated or reusing factors */
+        double* mRefinementResidualVector;      /**< ** (--) trick_chkpnt_io(**) Working array for the refinement residual {b} - [A]{x} */
+        double* mRefinementCorrection;          /**< ** (--) trick_chkpnt_io(**) Working array for the refinement correction to {x} */
+        int     mRefinementCount;               /**<    (--)                     Total refinement iterations since init */
+        int     mMaxRefinementCount;            /**<    (--) trick_chkpnt_io(**) Highest refinement iterations in a solution since restart */
+        double  mRefinementResidual;            /**<    (--) trick_chkpnt_io(**) Relative residual of the last mixed-precision solution */
+        int     mRefinementEscalationCount;     /**<    (--)                     Total escalations to double-precision decomposition since init */
+        /// @}
+
+        /// @name     Factorization reuse attributes.
+        /// @{
+        /// @details  When factor reuse is enabled, a non-linear network that changes its admittance
+        ///           matrix on a minor step can skip the decomposition and instead correct the last
+        ///           solution through the source vector with the last factors (modified Newton):
+        ///           {p} += [LDU_old]^-1 ({w} - [A]{p}).  The factors are always current on the first
+        ///           minor step of a major step, and are reused for up to the limit number of minor
+        ///           steps after that, or until the largest node potential change fails to shrink by
+        ///           the rate limit from one minor step to the next.  This trades more minor steps
+        ///           for fewer decompositions.  This only applies to the CPU (NO_GPU) solver.
+        int     mFactorReuseLimit;              /**<    (--) trick_chkpnt_io(**) Maximum consecutive minor steps to reuse factors, 0 disables */
+        double  mFactorReuseRate;               /**<    (--) trick_chkpnt_io(**) Maximum ratio of successive minor step potential changes while reusing */
+        bool    mFactorsStale;                  /**< ** (--) trick_chkpnt_io(**) The factors are from an older admittance matrix than the current one */
+        int     mFactorReuseSteps;              /**< ** (--) trick_chkpnt_io(**) Consecutive minor steps solved with the current stale factors */
+        double  mLastConvergenceDelta;          /**< ** (--) trick_chkpnt_io(**) Largest node potential change of the previous minor step */
+        int     mFactorReuseCount;              /**<    (--)                     Total minor steps solved with reused factors since init */
+        /// @}
+
         /// @name     Last-pass states.
         /// @{
         /// @details  Some last-pass values are saved for responding to state changes.
@@ -424,6 +510,12 @@ class Gunns
         RunMode    mLastRunMode;          /**< ** (--) trick_chkpnt_io(**) The last-pass run mode. */
         /// @}
 
+        /// @brief Solves the system with single-precision factors and iterative refinement.
+        void       solveMixedPrecision();
+
+        /// @brief Computes the refinement residual vector and returns its relative magnitude.
+        double     computeRefinementResidual();
+
     private:
         /// @brief Copy constructor unavailable since declared private and not implemented.
         Gunns(const Gunns& that);
@@ -446,15 +538,72 @@ class Gunns
         /// @brief Decomposes an admittance matrix based on size and GPU options.
         void       decompose(double *A, const int size, const int island = -1);
 
+        /// @brief Decomposes the islands of the given admittance matrix separately.
+        void       decomposeIslands(double *A);
+
+        /// @brief Returns whether the mixed-precision solution is active.
+        bool       isMixedPrecisionActive() const;
+
+        /// @brief Returns whether the factors are kept separate from the admittance matrix for reuse.
+        bool       isFactorReuseActive() const;
+
+        /// @brief Allocates the mixed-precision and factor reuse working arrays.
+        void       allocateFactorArrays();
+
+        /// @brief Decomposes a double-precision copy of the admittance matrix.
+        void       decomposeCopy();
+
+        /// @brief Returns whether this minor step can reuse the last factors.
+        bool       isFactorReuseAllowed(const int minorStep);
+
+        /// @brief Corrects the last solution through the source vector with the reused factors.
+        void       solveReusedFactors();
+
+        /// @brief Binds the link dispatcher to the links, or reverts to the link loops on mismatch.
+        void       bindLinkDispatcher();
+
+        /// @brief Decomposes the admittance matrix in single precision.
+        void       decomposeSingle();
+
+        /// @brief Decomposes the admittance matrix in double precision after refinement stalls.
+        void       escalateDecomposition();
+
         /// @brief Verifies network initialization and step method arguments.
         void       checkStepInputs();
 
+        /// @brief Throws if the network holds a link that doesn't support native checkpoints.
+        void       checkCheckpointLinks() const;
+
+        /// @brief Returns a hash of the network topology for checking native checkpoints.
+        unsigned int computeCheckpointSignature() const;
+
+        /// @brief Writes the step counters and node & link state to a native checkpoint stream.
+        void       saveCheckpointState(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the step counters and node & link state from a native checkpoint stream.
+        void       loadCheckpointState(GunnsCheckpointReader& reader);
+
+        /// @brief Checks inputs and prepares the links and nodes for a major step.
+        bool       beginMajorStep();
+
+        /// @brief Updates metrics and processes the links and flows after the minor steps.
+        void       endMajorStep(const double timeStep, const bool isConverged);
+
         /// @brief Iterates through minor steps for network solution convergence.
         bool       iterateMinorSteps(const double timeStep);
 
+        /// @brief Updates the minor step metrics and step log.
+        void       beginMinorStep();
+
+        /// @brief Steps the links for their contributions to the system of equations.
+        void       stepLinks(const double timeStep, const int minorStep);
+
         /// @brief Builds and solves the system of equations.
         int        buildAndSolveSystem(const int minorStep, const double timeStep);
 
+        /// @brief Builds the source vector and admittance matrix from the link contributions.
+        bool       buildSystem();
+
         /// @brief Assembles the system admittance matrix from individual link contributions.
         void       buildAdmittanceMatrix();
 
@@ -603,6 +752,26 @@ inline void Gunns::setWorstCaseTiming(const bool flag)
     mWorstCaseTiming = flag;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the mixed-precision solution is enabled and applicable.
+///
+/// @details  Mixed-precision only applies to the CPU solver, so it is inactive in the GPU modes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool Gunns::isMixedPrecisionActive() const
+{
+    return mMixedPrecision and (NO_GPU == mGpuMode);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if factor reuse is enabled and applicable.
+///
+/// @details  Factor reuse only applies to the CPU solver, so it is inactive in the GPU modes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool Gunns::isFactorReuseActive() const
+{
+    return (mFactorReuseLimit > 0) and (NO_GPU == mGpuMode);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] potentials (--) Array of node potentials to use for SLAVE mode.
 ///
@@ -718,6 +887,59 @@ inline int Gunns::getDecompositionCount() const
     return mDecompositionCount;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return int -- Returns the refinement count.
+///
+/// @details  This method gets the total number of mixed-precision iterative refinement iterations.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int Gunns::getRefinementCount() const
+{
+    return mRefinementCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return int -- Returns the max refinement count.
+///
+/// @details  This method gets the highest number of refinement iterations that has occurred in a
+///           single mixed-precision solution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int Gunns::getMaxRefinementCount() const
+{
+    return mMaxRefinementCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return double -- Returns the refinement residual.
+///
+/// @details  This method gets the relative residual of the last mixed-precision solution.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double Gunns::getRefinementResidual() const
+{
+    return mRefinementResidual;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return int -- Returns the refinement escalation count.
+///
+/// @details  This method gets the number of times the mixed-precision solution escalated to a
+///           double-precision decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int Gunns::getRefinementEscalationCount() const
+{
+    return mRefinementEscalationCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return int -- Returns the factor reuse count.
+///
+/// @details  This method gets the number of minor steps that were solved by correcting the last
+///           solution with reused factors instead of a new decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int Gunns::getFactorReuseCount() const
+{
+    return mFactorReuseCount;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return   std::string (--) A list of various modes and their states as a string.
 ///
@@ -739,6 +961,17 @@ inline double Gunns::getSolveTime() const
     return mSolveTime;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return   double (s) Elapsed wall time of all decomposition calls the last major step.
+///
+/// @details  Returns the mDecomposeTime value.  This is a subset of mSolveTime, so the time spent in
+///           the solve calls alone is mSolveTime - mDecomposeTime.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double Gunns::getDecomposeTime() const
+{
+    return mDecomposeTime;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return   double (s) Elapsed wall time of the last step.
 ///
@@ -789,6 +1022,17 @@ inline GunnsBasicLink** Gunns::getLinks() const
     return mLinks;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @return  GunnsLinkDispatcher* (--) Pointer to the link dispatcher in use.
+///
+/// @details  Returns mLinkDispatcher, which is null when no dispatcher has been set or when the
+///           dispatcher didn't match the links and the solver reverted to its own link loops.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline GunnsLinkDispatcher* Gunns::getLinkDispatcher() const
+{
+    return mLinkDispatcher;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @return  GunnsBasicLink::SolutionResult* (--) Array of link last minor step solution results.
 ///
@@ -29,8 +29,10 @@ LIBRARY DEPENDENCY:
     )
 */
 #include "GunnsBasicCapacitor.hh"
+#include "GunnsCheckpoint.hh"
 #include "math/MsMath.hh"
 #include "software/exceptions/TsInitializationException.hh"
+#include <typeinfo>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] name  (--) Link name
@@ -192,6 +194,44 @@ void GunnsBasicCapacitor::restartModel()
     mEditCapacitance     = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the capacitance, so that run-time capacitance edits are rolled back with the
+///           network.  Trick doesn't checkpoint it, so that a new default in a new delivery isn't
+///           wiped out by old checkpoints, but a native checkpoint is only loaded back into the run
+///           that made it.  A pending edit is a one-shot command that restart clears, so it isn't
+///           written.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicCapacitor::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsBasicLink::saveCheckpoint(writer);
+    writer.write(mCapacitance);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicCapacitor::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsBasicLink::loadCheckpoint(reader);
+    reader.read(mCapacitance);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsBasicCapacitor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsBasicCapacitor::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsBasicCapacitor);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
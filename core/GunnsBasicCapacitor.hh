@@ -134,6 +134,15 @@ class GunnsBasicCapacitor : public GunnsBasicLink
         /// @brief Sets the capacitance directly
         void setCapacitance(const double capacitance);
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         /// @details  Note that although capacitance comes from input data and can change during
         ///           run-time, we do not checkpoint it - it is treated like config data with
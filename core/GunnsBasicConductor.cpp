@@ -31,6 +31,7 @@ LIBRARY DEPENDENCY:
 #include "GunnsBasicConductor.hh"
 #include "math/MsMath.hh"
 #include "software/exceptions/TsInitializationException.hh"
+#include <typeinfo>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] name                (--) Link name
@@ -188,6 +189,14 @@ void GunnsBasicConductor::restartModel()
     mSystemConductance     = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsBasicConductor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsBasicConductor::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsBasicConductor);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
@@ -122,6 +122,9 @@ class GunnsBasicConductor : public GunnsBasicLink
         /// @brief Returns the effective conductivity of the link
         double getEffectiveConductivity() const;
 
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         double mEffectiveConductivity; /**< (--) trick_chkpnt_io(**) Generic effective conductivity of the link */
         double mDefaultConductivity;   /**< (--) trick_chkpnt_io(**) Default conductivity of the link */
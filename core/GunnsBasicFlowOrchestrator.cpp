@@ -7,12 +7,14 @@
 
 LIBRARY DEPENDENCY:
   ((core/GunnsBasicLink.o)
+   (core/GunnsLinkDispatcher.o)
    (core/GunnsBasicNode.o))
 */
 
 #include "GunnsBasicFlowOrchestrator.hh"
 #include "core/GunnsMacros.hh"
 #include "core/GunnsBasicLink.hh"
+#include "core/GunnsLinkDispatcher.hh"
 #include "simulation/hs/TsHsMsg.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
@@ -28,6 +30,7 @@ GunnsBasicFlowOrchestrator::GunnsBasicFlowOrchestrator(const int& numLinks, cons
     mNumNodes(numNodes),
     mLinks   (0),
     mNodes   (0),
+    mLinkDispatcher(0),
     mName    (),
     mInitFlag(false),
     mVerbose (false)
@@ -113,9 +116,13 @@ void GunnsBasicFlowOrchestrator::validate()
 void GunnsBasicFlowOrchestrator::update(const double dt)
 {
     /// - Links loop in reverse order from the step loop to support composite links dependencies
-    ///   with their child links.
-    for (int link = mNumLinks-1; link >= 0; --link) {
-        mLinks[link]->computeFlows(dt);
+    ///   with their child links.  The link dispatcher does the same.
+    if (mLinkDispatcher) {
+        mLinkDispatcher->computeFlows(dt);
+    } else {
+        for (int link = mNumLinks-1; link >= 0; --link) {
+            mLinks[link]->computeFlows(dt);
+        }
     }
 
     for (int node = 0; node < mNumNodes-1; ++node) {
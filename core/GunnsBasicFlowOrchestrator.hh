@@ -35,6 +35,7 @@ PROGRAMMERS:
 // Forward-declare pointer types
 class GunnsBasicLink;
 class GunnsBasicNode;
+class GunnsLinkDispatcher;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    GUNNS Basic Flow Orchestrator Class.
@@ -59,6 +60,8 @@ class GunnsBasicFlowOrchestrator
         virtual void update(const double dt);
         /// @brief  Returns whether this GUNNS Basic Flow Orchestrator has been successfully initialized & validated.
         bool         isInitialized() const;
+        /// @brief  Sets the link dispatcher to compute link flows with, or null to loop over links.
+        void         setLinkDispatcher(GunnsLinkDispatcher* dispatcher);
         //TODO delete when #98 is completed
         void         setVerbose(const bool verbose);
 
@@ -67,6 +70,7 @@ class GunnsBasicFlowOrchestrator
         const int&       mNumNodes; /**< ** (--) trick_chkpnt_io(**) The number of nodes in the netowrk, including Ground. */
         GunnsBasicLink** mLinks;    /**< ** (--) trick_chkpnt_io(**) Array of pointers to the network links. */
         GunnsBasicNode** mNodes;    /**< ** (--) trick_chkpnt_io(**) Array of pointers to the network nodes. */
+        GunnsLinkDispatcher* mLinkDispatcher; /**< ** (--) trick_chkpnt_io(**) Optional link dispatcher, not owned. */
         std::string      mName;     /**< *o (--) trick_chkpnt_io(**) Instance name for self-identification in messages. */
         bool             mInitFlag; /**< *o (--) trick_chkpnt_io(**) Initialization status flag (T is good). */
         bool             mVerbose;  /**<    (--) TODO delete when #98 is completed */
@@ -98,4 +102,14 @@ inline bool GunnsBasicFlowOrchestrator::isInitialized() const
     return mInitFlag;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  dispatcher  (--)  Pointer to the link dispatcher, or null.
+///
+/// @details  Sets the link dispatcher that the solver has bound to the links.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsBasicFlowOrchestrator::setLinkDispatcher(GunnsLinkDispatcher* dispatcher)
+{
+    mLinkDispatcher = dispatcher;
+}
+
 #endif
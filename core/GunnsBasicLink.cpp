@@ -20,6 +20,7 @@
 LIBRARY DEPENDENCY:
     (
      (GunnsBasicNode.o)
+     (GunnsCheckpoint.o)
      (simulation/hs/TsHsMsg.o)
      (software/exceptions/TsInitializationException.o)
      (software/exceptions/TsOutOfBoundsException.o)
@@ -32,9 +33,11 @@ LIBRARY DEPENDENCY:
     )
 */
 #include "GunnsBasicLink.hh"
+#include "GunnsCheckpoint.hh"
 #include "math/MsMath.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
+#include <typeinfo>
 
 /// @details  Default Max Conductance
 const double GunnsBasicLink::mConductanceLimit = 1.0E15;
@@ -257,6 +260,54 @@ void GunnsBasicLink::restartModel()
     /// - Base class implementation is empty.
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Writes the link state that Trick would checkpoint: the blockage malfunction, flux and
+///           potential drop.  The admittance matrix, source vector and port potentials are
+///           rebuilt by the network on its next step, and aren't written.  Derived links with run-
+///           time state should override this, call the base class first, then write their own.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicLink::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    writer.write(mMalfBlockageFlag);
+    writer.write(mMalfBlockageValue);
+    writer.write(mFlux);
+    writer.write(mPotentialDrop);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicLink::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    reader.read(mMalfBlockageFlag);
+    reader.read(mMalfBlockageValue);
+    reader.read(mFlux);
+    reader.read(mPotentialDrop);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsBasicLink.
+///
+/// @details  Links opt in to native checkpoints: a class whose saveCheckpoint & loadCheckpoint
+///           write every term that Trick would checkpoint overrides this to compare against its own
+///           type.  The exact type is compared, so a derived class with state of its own isn't
+///           opted in by its parent and must override this too.  The network refuses to save or
+///           load a native checkpoint while it holds a link that returns false, rather than
+///           restoring that link partially.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsBasicLink::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsBasicLink);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Class attribute resets common to both initialization and restart.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
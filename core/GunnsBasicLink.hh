@@ -159,6 +159,15 @@ class GunnsBasicLink
         /// @brief Restarts the link after a checkpoint load
         void           restart();
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void   saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void   loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool   isCheckpointable() const;
+
         /// @brief Returns the object name
         const char*    getName() const;
 
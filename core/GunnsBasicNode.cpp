@@ -18,7 +18,10 @@ ASSUMPTIONS AND LIMITATIONS:
    ()
 
 LIBRARY DEPENDENCY:
-   ((software/exceptions/TsInitializationException.o))
+   (
+    (GunnsCheckpoint.o)
+    (software/exceptions/TsInitializationException.o)
+   )
 
 PROGRAMMERS:
    (
@@ -28,6 +31,7 @@ PROGRAMMERS:
 */
 
 #include "GunnsBasicNode.hh"
+#include "GunnsCheckpoint.hh"
 #include "software/exceptions/TsInitializationException.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -116,6 +120,35 @@ void GunnsBasicNode::restart()
     mIslandVector              = 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Writes the node state that can't be derived from the rest of the network: the
+///           potential and network capacitance.  Derived classes should call their base class
+///           implementation first, then write their own state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicNode::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    writer.write(mPotential);
+    writer.write(mNetworkCapacitance);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.  The network calls
+///           restart afterwards to rebuild everything else.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicNode::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    reader.read(mPotential);
+    reader.read(mNetworkCapacitance);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Validates this Gunns Basic Node initial state.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -52,6 +52,7 @@ PROGRAMMERS:
 #include <cstring>
 #include <vector>
 #include "software/SimCompatibility/TsSimCompatibility.hh"
+#include "core/GunnsHsRateLimiter.hh"
 #include "simulation/hs/TsHsMsg.hh"
 //TODO remove this once all links are using the GUNNS macros and no longer need this
 #include "software/exceptions/TsHsException.hh"
@@ -60,6 +61,8 @@ PROGRAMMERS:
 class PolyFluid;
 class PolyFluidConfigData;
 class GunnsBasicNode;
+class GunnsCheckpointWriter;
+class GunnsCheckpointReader;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief Gunns Node List Structure
@@ -169,6 +172,12 @@ class GunnsBasicNode
         /// @brief Restarts the node after a checkpoint load
         virtual void   restart();
 
+        /// @brief Writes the node's checkpointed state to a native checkpoint stream
+        virtual void   saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the node's checkpointed state from a native checkpoint stream
+        virtual void   loadCheckpoint(GunnsCheckpointReader& reader);
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         // The following are all dummy placeholder methods to allow polymorphism with the derived
         // GunnsFluidNode class.
@@ -298,6 +307,10 @@ class GunnsBasicNode
 ///           consistent warning reporting from all Gunns objects.  The text argument can use the
 ///           << operator.
 ///
+///           Messages from each call site are rate limited by a GunnsHsRateLimiter, checked before
+///           the message is built.  The first message allowed after messages were suppressed
+///           reports how many were suppressed and over what time.
+///
 /// @par      Example 1 (static text):
 /// @code
 ///           GUNNS_WARNING("All nodes uninitialized or vacuum.");
@@ -311,9 +324,17 @@ class GunnsBasicNode
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #define GUNNS_WARNING(text) \
 { \
-    TsHsMsg gunnsMsg(TS_HS_WARNING, TS_HS_GUNNS); \
-    gunnsMsg << mName << " " << text; \
-    hsSendMsg(gunnsMsg); \
+    static GunnsHsRateLimiter gunnsLimiter = GUNNS_HS_RATE_LIMITER_INIT; \
+    int    gunnsSuppressed = 0; \
+    double gunnsWindow     = 0.0; \
+    if (gunnsLimiter.allow(gunnsSuppressed, gunnsWindow)) { \
+        TsHsMsg gunnsMsg(TS_HS_WARNING, TS_HS_GUNNS); \
+        gunnsMsg << mName << " " << text; \
+        if (gunnsSuppressed > 0) { \
+            gunnsMsg << " (suppressed " << gunnsSuppressed << " repeats in " << gunnsWindow << " s)"; \
+        } \
+        hsSendMsg(gunnsMsg); \
+    } \
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -326,6 +347,10 @@ class GunnsBasicNode
 ///           consistent info reporting from all Gunns objects.  The text argument can use the
 ///           << operator.
 ///
+///           Messages from each call site are rate limited by a GunnsHsRateLimiter, checked before
+///           the message is built.  The first message allowed after messages were suppressed
+///           reports how many were suppressed and over what time.
+///
 /// @par      Example 1 (static text):
 /// @code
 ///           GUNNS_INFO("By your command.");
@@ -339,9 +364,17 @@ class GunnsBasicNode
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #define GUNNS_INFO(text) \
 { \
-    TsHsMsg gunnsMsg(TS_HS_INFO, TS_HS_GUNNS); \
-    gunnsMsg << mName << " " << text; \
-    hsSendMsg(gunnsMsg); \
+    static GunnsHsRateLimiter gunnsLimiter = GUNNS_HS_RATE_LIMITER_INIT; \
+    int    gunnsSuppressed = 0; \
+    double gunnsWindow     = 0.0; \
+    if (gunnsLimiter.allow(gunnsSuppressed, gunnsWindow)) { \
+        TsHsMsg gunnsMsg(TS_HS_INFO, TS_HS_GUNNS); \
+        gunnsMsg << mName << " " << text; \
+        if (gunnsSuppressed > 0) { \
+            gunnsMsg << " (suppressed " << gunnsSuppressed << " repeats in " << gunnsWindow << " s)"; \
+        } \
+        hsSendMsg(gunnsMsg); \
+    } \
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,8 @@ LIBRARY DEPENDENCY:
     )
 */
 #include "GunnsBasicPotential.hh"
+#include "GunnsCheckpoint.hh"
+#include <typeinfo>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] name                (--) Link name
@@ -175,6 +177,40 @@ void GunnsBasicPotential::restartModel()
     GunnsBasicConductor::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the source potential, which can be changed during run, to the base link state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicPotential::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsBasicConductor::saveCheckpoint(writer);
+    writer.write(mSourcePotential);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicPotential::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsBasicConductor::loadCheckpoint(reader);
+    reader.read(mSourcePotential);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsBasicPotential.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsBasicPotential::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsBasicPotential);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
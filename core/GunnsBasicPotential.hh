@@ -124,6 +124,15 @@ class GunnsBasicPotential : public GunnsBasicConductor
         /// @brief Returns the potential rise created by the link
         double       getSourcePotential() const;
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         double mSourcePotential;        /**< (--) Generic potential rise created by the link */
 
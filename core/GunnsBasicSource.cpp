@@ -29,6 +29,8 @@ LIBRARY DEPENDENCY:
     )
 */
 #include "GunnsBasicSource.hh"
+#include "GunnsCheckpoint.hh"
+#include <typeinfo>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] name  (--) Link name
@@ -170,6 +172,40 @@ void GunnsBasicSource::restartModel()
     GunnsBasicLink::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the flux demand, which can be changed during run, to the base link state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicSource::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsBasicLink::saveCheckpoint(writer);
+    writer.write(mSourceFlux);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBasicSource::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsBasicLink::loadCheckpoint(reader);
+    reader.read(mSourceFlux);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsBasicSource.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsBasicSource::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsBasicSource);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
@@ -128,6 +128,15 @@ class GunnsBasicSource : public GunnsBasicLink
         /// @brief Gets the Source Flux
         double getFluxDemand() const;
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         double mSourceFlux;               /**< (--) Demanded generic flux through the link */
 
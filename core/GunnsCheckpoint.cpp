@@ -0,0 +1,879 @@
+/**
+@file
+@brief    GUNNS Native Checkpoint implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   (
+    (software/exceptions/TsInitializationException.o)
+    (software/exceptions/TsParseException.o)
+   )
+*/
+
+#include "GunnsCheckpoint.hh"
+#include "core/GunnsMacros.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include "software/exceptions/TsParseException.hh"
+
+#include <cstring>
+
+const unsigned int GunnsCheckpointWriter::VERSION    = 1;
+const unsigned int GunnsCheckpointWriter::BLOCK_SIZE = 65536;
+
+/// @details  Stream magic number.
+static const char         CHECKPOINT_MAGIC[8]   = {'G', 'U', 'N', 'N', 'S', 'C', 'K', 'P'};
+/// @details  Byte-order mark, read back the same only on a host of the same byte order.
+static const unsigned int CHECKPOINT_BOM        = 0x01020304;
+/// @details  Size of each value slot in the stream.
+static const unsigned int CHECKPOINT_SLOT       = 8;
+/// @details  Largest block size the reader will accept.
+static const unsigned int CHECKPOINT_MAX_BLOCK  = 16777216;
+/// @details  Shortest back-reference the codec emits.
+static const unsigned int CODEC_MIN_MATCH       = 4;
+/// @details  Farthest back-reference the codec emits.
+static const unsigned int CODEC_MAX_OFFSET      = 65535;
+/// @details  Number of bits in the codec hash table index.
+static const unsigned int CODEC_HASH_BITS       = 12;
+/// @details  Bytes at the end of a block always left as literals, so the match finder can read a
+///           whole word anywhere before them.
+static const unsigned int CODEC_TAIL            = 12;
+/// @details  Marks an empty codec hash table entry.
+static const unsigned int CODEC_EMPTY           = 0xFFFFFFFF;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  p  (--)  Pointer to 4 bytes.
+///
+/// @returns    unsigned int  (--)  Hash table index of the 4 bytes.
+///
+/// @details  Multiplicative hash of the 4 bytes starting at p.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static inline unsigned int codecHash(const unsigned char* p)
+{
+    unsigned int word;
+    std::memcpy(&word, p, 4);
+    return ((word * 2654435761U) >> (32 - CODEC_HASH_BITS)) & ((1U << CODEC_HASH_BITS) - 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]    packed   (--)  Output array.
+/// @param[in]     capacity (--)  Size of the output array.
+/// @param[in,out] op       (--)  Output position.
+/// @param[in]     length   (--)  Length beyond the token nibble to encode.
+///
+/// @returns  bool  (--)  False if the output array is full.
+///
+/// @details  Encodes the remainder of a length that overflowed its token nibble as a run of 255
+///           bytes and a final byte less than 255.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static inline bool codecPutLength(unsigned char* packed, const unsigned int capacity,
+                                  unsigned int& op, unsigned int length)
+{
+    while (length >= 255) {
+        if (op >= capacity) {
+            return false;
+        }
+        packed[op++] = 255;
+        length      -= 255;
+    }
+    if (op >= capacity) {
+        return false;
+    }
+    packed[op++] = static_cast<unsigned char>(length);
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]    packed     (--)  Output array.
+/// @param[in]     capacity   (--)  Size of the output array.
+/// @param[in,out] op         (--)  Output position.
+/// @param[in]     literals   (--)  Literal bytes.
+/// @param[in]     numLiteral (--)  Number of literal bytes.
+/// @param[in]     offset     (--)  Back-reference distance, or zero for the final literal run.
+/// @param[in]     matchLen   (--)  Back-reference length.
+///
+/// @returns  bool  (--)  False if the output array is full.
+///
+/// @details  Encodes one sequence: a token byte with the literal length in the high nibble and the
+///           match length less the minimum in the low nibble, the literal length overflow, the
+///           literals, and then unless this is the final run, the 2-byte little-endian offset and
+///           the match length overflow.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static bool codecPutSequence(unsigned char* packed, const unsigned int capacity, unsigned int& op,
+                             const unsigned char* literals, const unsigned int numLiteral,
+                             const unsigned int offset, const unsigned int matchLen)
+{
+    if (op >= capacity) {
+        return false;
+    }
+    const unsigned int matchCode = (offset > 0) ? matchLen - CODEC_MIN_MATCH : 0;
+    packed[op++] = static_cast<unsigned char>(((numLiteral < 15 ? numLiteral : 15) << 4) |
+                                               (matchCode  < 15 ? matchCode  : 15));
+    if (numLiteral >= 15 and not codecPutLength(packed, capacity, op, numLiteral - 15)) {
+        return false;
+    }
+    if (op + numLiteral > capacity) {
+        return false;
+    }
+    std::memcpy(packed + op, literals, numLiteral);
+    op += numLiteral;
+    if (offset > 0) {
+        if (op + 2 > capacity) {
+            return false;
+        }
+        packed[op++] = static_cast<unsigned char>(offset & 0xFF);
+        packed[op++] = static_cast<unsigned char>(offset >> 8);
+        if (matchCode >= 15 and not codecPutLength(packed, capacity, op, matchCode - 15)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] packed   (--)  Output array for the compressed block.
+/// @param[in]  capacity (--)  Size of the output array.
+/// @param[in]  raw      (--)  Block to compress.
+/// @param[in]  rawSize  (--)  Size of the block, up to 4 GB.
+///
+/// @returns    unsigned int  (--)  Size of the compressed block, or zero if it won't fit.
+///
+/// @details  Greedy LZ77: each position is hashed on its next 4 bytes to find the last position
+///           with the same hash, and if those match, the match is extended as far as it goes and
+///           emitted along with the literals since the previous match.  The caller stores the block
+///           uncompressed when this returns zero.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int GunnsCheckpointCodec::compress(unsigned char* packed, const unsigned int capacity,
+                                            const unsigned char* raw, const unsigned int rawSize)
+{
+    unsigned int table[1 << CODEC_HASH_BITS];
+    for (unsigned int i = 0; i < (1U << CODEC_HASH_BITS); ++i) {
+        table[i] = CODEC_EMPTY;
+    }
+
+    unsigned int       op     = 0;
+    unsigned int       anchor = 0;
+    unsigned int       ip     = 0;
+    const unsigned int limit  = (rawSize > CODEC_TAIL) ? rawSize - CODEC_TAIL : 0;
+    while (ip < limit) {
+        const unsigned int hash = codecHash(raw + ip);
+        const unsigned int ref  = table[hash];
+        table[hash] = ip;
+        if (ref != CODEC_EMPTY and ip - ref <= CODEC_MAX_OFFSET
+                and 0 == std::memcmp(raw + ref, raw + ip, CODEC_MIN_MATCH)) {
+            unsigned int length = CODEC_MIN_MATCH;
+            while (ip + length < rawSize and raw[ref + length] == raw[ip + length]) {
+                ++length;
+            }
+            if (not codecPutSequence(packed, capacity, op, raw + anchor, ip - anchor, ip - ref,
+                                     length)) {
+                return 0;
+            }
+            ip    += length;
+            anchor = ip;
+        } else {
+            ++ip;
+        }
+    }
+    if (not codecPutSequence(packed, capacity, op, raw + anchor, rawSize - anchor, 0, 0)) {
+        return 0;
+    }
+    return op;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] raw        (--)  Output array for the decompressed block.
+/// @param[in]  rawSize    (--)  Expected size of the decompressed block.
+/// @param[in]  packed     (--)  Compressed block.
+/// @param[in]  packedSize (--)  Size of the compressed block.
+///
+/// @returns    bool  (--)  True if the block decompressed to exactly rawSize bytes.
+///
+/// @details  Every length and offset is checked against the input and output bounds, so a corrupt
+///           block fails rather than overrunning either array.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsCheckpointCodec::decompress(unsigned char* raw, const unsigned int rawSize,
+                                      const unsigned char* packed, const unsigned int packedSize)
+{
+    unsigned int ip = 0;
+    unsigned int op = 0;
+    while (ip < packedSize) {
+        const unsigned int token      = packed[ip++];
+        unsigned int       numLiteral = token >> 4;
+        if (15 == numLiteral) {
+            unsigned int extra = 255;
+            while (255 == extra) {
+                if (ip >= packedSize) {
+                    return false;
+                }
+                extra       = packed[ip++];
+                numLiteral += extra;
+            }
+        }
+        if (numLiteral > packedSize - ip or numLiteral > rawSize - op) {
+            return false;
+        }
+        std::memcpy(raw + op, packed + ip, numLiteral);
+        ip += numLiteral;
+        op += numLiteral;
+
+        /// - The final sequence has only literals.
+        if (ip == packedSize) {
+            break;
+        }
+        if (2 > packedSize - ip) {
+            return false;
+        }
+        const unsigned int offset = packed[ip] | (static_cast<unsigned int>(packed[ip + 1]) << 8);
+        ip += 2;
+        unsigned int length = (token & 0x0F) + CODEC_MIN_MATCH;
+        if (15 + CODEC_MIN_MATCH == length) {
+            unsigned int extra = 255;
+            while (255 == extra) {
+                if (ip >= packedSize) {
+                    return false;
+                }
+                extra   = packed[ip++];
+                length += extra;
+            }
+        }
+        if (0 == offset or offset > op or length > rawSize - op) {
+            return false;
+        }
+
+        /// - Copy byte-wise, since the match may overlap the bytes it produces.
+        const unsigned char* ref = raw + op - offset;
+        for (unsigned int i = 0; i < length; ++i) {
+            raw[op + i] = ref[i];
+        }
+        op += length;
+    }
+    return op == rawSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] out  (--)  Output array.
+/// @param[in]  in   (--)  Input array.
+/// @param[in]  size (--)  Size of the arrays.
+///
+/// @details  Gathers byte b of every 8-byte word into plane b of the output.  Any bytes past the
+///           last whole word are copied as-is.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointCodec::shuffle(unsigned char* out, const unsigned char* in,
+                                   const unsigned int size)
+{
+    const unsigned int words = size / CHECKPOINT_SLOT;
+    for (unsigned int b = 0; b < CHECKPOINT_SLOT; ++b) {
+        unsigned char*       plane = out + b * words;
+        const unsigned char* src   = in + b;
+        for (unsigned int w = 0; w < words; ++w) {
+            plane[w] = src[w * CHECKPOINT_SLOT];
+        }
+    }
+    const unsigned int whole = words * CHECKPOINT_SLOT;
+    std::memcpy(out + whole, in + whole, size - whole);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] out  (--)  Output array.
+/// @param[in]  in   (--)  Input array.
+/// @param[in]  size (--)  Size of the arrays.
+///
+/// @details  Scatters the byte planes made by shuffle back into 8-byte words.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointCodec::unshuffle(unsigned char* out, const unsigned char* in,
+                                     const unsigned int size)
+{
+    const unsigned int words = size / CHECKPOINT_SLOT;
+    for (unsigned int b = 0; b < CHECKPOINT_SLOT; ++b) {
+        const unsigned char* plane = in + b * words;
+        unsigned char*       dst   = out + b;
+        for (unsigned int w = 0; w < words; ++w) {
+            dst[w * CHECKPOINT_SLOT] = plane[w];
+        }
+    }
+    const unsigned int whole = words * CHECKPOINT_SLOT;
+    std::memcpy(out + whole, in + whole, size - whole);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name  (--)  Instance name for messages.
+///
+/// @details  Default constructs this Checkpoint Writer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsCheckpointWriter::GunnsCheckpointWriter(const std::string& name)
+    :
+    mName(name),
+    mFile(0),
+    mBuffer(0),
+    mRaw(BLOCK_SIZE),
+    mWork(BLOCK_SIZE),
+    mPacked(BLOCK_SIZE),
+    mRawUsed(0),
+    mRawSize(0),
+    mPackedSize(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Checkpoint Writer.  A stream that wasn't closed is left without
+///           its end block, so the reader will reject it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsCheckpointWriter::~GunnsCheckpointWriter()
+{
+    if (mFile) {
+        fclose(mFile);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  fileName  (--)  Name of the file to create or overwrite.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Opens the stream to the given file and writes the stream header.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointWriter::openFile(const std::string& fileName)
+{
+    if (isOpen()) {
+        close();
+    }
+    mFile = fopen(fileName.c_str(), "wb");
+    if (not mFile) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "could not open checkpoint file " + fileName + " for writing.");
+    }
+    mRawUsed    = 0;
+    mRawSize    = 0;
+    mPackedSize = 0;
+    output(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    outputWord(VERSION);
+    outputWord(CHECKPOINT_BOM);
+    outputWord(BLOCK_SIZE);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  buffer  (--)  Memory buffer to replace with the stream.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Opens the stream to the given memory buffer and writes the stream header.  The buffer
+///           keeps its capacity, so re-using the same buffer for repeated rollback checkpoints
+///           doesn't reallocate.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointWriter::openBuffer(std::vector<unsigned char>* buffer)
+{
+    if (isOpen()) {
+        close();
+    }
+    if (not buffer) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "null checkpoint buffer.");
+    }
+    mBuffer = buffer;
+    mBuffer->clear();
+    mRawUsed    = 0;
+    mRawSize    = 0;
+    mPackedSize = 0;
+    output(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    outputWord(VERSION);
+    outputWord(CHECKPOINT_BOM);
+    outputWord(BLOCK_SIZE);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  value  (--)  Value to write.
+///
+/// @details  Writes a double to the stream.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointWriter::write(const double value)
+{
+    putSlot(&value, sizeof(value));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  value  (--)  Value to write.
+///
+/// @details  Writes an int to the stream.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointWriter::write(const int value)
+{
+    putSlot(&value, sizeof(value));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  value  (--)  Value to write.
+///
+/// @details  Writes an unsigned int to the stream.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointWriter::write(const unsigned int value)
+{
+    putSlot(&value, sizeof(value));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  value  (--)  Value to write.
+///
+/// @details  Writes a bool to the stream, as a byte of 0 or 1.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointWriter::write(const bool value)
+{
+    const unsigned char byte = value ? 1 : 0;
+    putSlot(&byte, sizeof(byte));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  values  (--)  Array of values to write.
+/// @param[in]  count   (--)  Number of values in the array.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Writes an array of doubles to the stream.  Doubles fill their slots exactly, so the
+///           array is copied into the raw block in bulk.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointWriter::write(const double* values, const int count)
+{
+    if (not isOpen()) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "checkpoint stream is not open.");
+    }
+    unsigned int remaining = (count > 0) ? static_cast<unsigned int>(count) : 0;
+    while (remaining > 0) {
+        unsigned int n = (BLOCK_SIZE - mRawUsed) / CHECKPOINT_SLOT;
+        if (n > remaining) {
+            n = remaining;
+        }
+        std::memcpy(&mRaw[mRawUsed], values, n * CHECKPOINT_SLOT);
+        values    += n;
+        remaining -= n;
+        mRawUsed  += n * CHECKPOINT_SLOT;
+        mRawSize  += n * CHECKPOINT_SLOT;
+        if (mRawUsed >= BLOCK_SIZE) {
+            flushBlock();
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsInitializationException
+///
+/// @details  Outputs the last partial block and the end block, and closes the output.  Does nothing
+///           if the stream isn't open.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointWriter::close()
+{
+    if (isOpen()) {
+        flushBlock();
+        outputWord(0);
+        outputWord(0);
+        mBuffer = 0;
+        if (mFile) {
+            const int result = fclose(mFile);
+            mFile = 0;
+            if (0 != result) {
+                GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                            "error closing checkpoint file.");
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  value  (--)  Pointer to the value.
+/// @param[in]  size   (--)  Size of the value, up to 8 bytes.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Appends the value to the raw block in an 8-byte slot padded with zeroes, outputting
+///           the block when it fills.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointWriter::putSlot(const void* value, const unsigned int size)
+{
+    if (not isOpen()) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "checkpoint stream is not open.");
+    }
+    unsigned char* slot = &mRaw[mRawUsed];
+    std::memset(slot, 0, CHECKPOINT_SLOT);
+    std::memcpy(slot, value, size);
+    mRawUsed += CHECKPOINT_SLOT;
+    mRawSize += CHECKPOINT_SLOT;
+    if (mRawUsed >= BLOCK_SIZE) {
+        flushBlock();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsInitializationException
+///
+/// @details  Shuffles and compresses the raw block and outputs it, or outputs the raw block as-is
+///           if it doesn't get any smaller.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointWriter::flushBlock()
+{
+    if (mRawUsed > 0) {
+        GunnsCheckpointCodec::shuffle(&mWork[0], &mRaw[0], mRawUsed);
+        const unsigned int packedSize =
+                GunnsCheckpointCodec::compress(&mPacked[0], mRawUsed - 1, &mWork[0], mRawUsed);
+        outputWord(mRawUsed);
+        if (packedSize > 0) {
+            outputWord(packedSize);
+            output(&mPacked[0], packedSize);
+        } else {
+            outputWord(mRawUsed);
+            output(&mRaw[0], mRawUsed);
+        }
+        mRawUsed = 0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  data  (--)  Bytes to output.
+/// @param[in]  size  (--)  Number of bytes.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Outputs bytes to the file or buffer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointWriter::output(const void* data, const unsigned int size)
+{
+    if (mFile) {
+        if (size != fwrite(data, 1, size, mFile)) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "error writing checkpoint file.");
+        }
+    } else {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        mBuffer->insert(mBuffer->end(), bytes, bytes + size);
+    }
+    mPackedSize += size;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  value  (--)  Value to output.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Outputs a 32-bit unsigned value in native byte order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointWriter::outputWord(const unsigned int value)
+{
+    output(&value, 4);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name  (--)  Instance name for messages.
+///
+/// @details  Default constructs this Checkpoint Reader.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsCheckpointReader::GunnsCheckpointReader(const std::string& name)
+    :
+    mName(name),
+    mFile(0),
+    mBuffer(0),
+    mBufferPos(0),
+    mRaw(),
+    mWork(),
+    mPacked(),
+    mRawUsed(0),
+    mRawPos(0),
+    mBlockSize(0),
+    mEnd(false)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Checkpoint Reader.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsCheckpointReader::~GunnsCheckpointReader()
+{
+    close();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  fileName  (--)  Name of the file to read.
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Opens the stream from the given file and checks the stream header.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointReader::openFile(const std::string& fileName)
+{
+    close();
+    mFile = fopen(fileName.c_str(), "rb");
+    if (not mFile) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "could not open checkpoint file " + fileName + " for reading.");
+    }
+    readHeader();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  buffer  (--)  Memory buffer holding the stream.
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Opens the stream from the given memory buffer and checks the stream header.  The
+///           buffer must not change while the stream is open.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointReader::openBuffer(const std::vector<unsigned char>* buffer)
+{
+    close();
+    if (not buffer) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "null checkpoint buffer.");
+    }
+    mBuffer    = buffer;
+    mBufferPos = 0;
+    readHeader();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  value  (--)  Value read.
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads a double from the stream.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointReader::read(double& value)
+{
+    getSlot(&value, sizeof(value));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  value  (--)  Value read.
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads an int from the stream.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointReader::read(int& value)
+{
+    getSlot(&value, sizeof(value));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  value  (--)  Value read.
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads an unsigned int from the stream.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointReader::read(unsigned int& value)
+{
+    getSlot(&value, sizeof(value));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  value  (--)  Value read.
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads a bool from the stream.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointReader::read(bool& value)
+{
+    unsigned char byte = 0;
+    getSlot(&byte, sizeof(byte));
+    value = (0 != byte);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  values  (--)  Array to read into.
+/// @param[in]   count   (--)  Number of values to read.
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads an array of doubles from the stream in bulk.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointReader::read(double* values, const int count)
+{
+    unsigned int remaining = (count > 0) ? static_cast<unsigned int>(count) : 0;
+    while (remaining > 0) {
+        if (mRawPos >= mRawUsed) {
+            getSlot(values, CHECKPOINT_SLOT);
+            ++values;
+            --remaining;
+        } else {
+            unsigned int n = (mRawUsed - mRawPos) / CHECKPOINT_SLOT;
+            if (n > remaining) {
+                n = remaining;
+            }
+            std::memcpy(values, &mRaw[mRawPos], n * CHECKPOINT_SLOT);
+            values    += n;
+            remaining -= n;
+            mRawPos   += n * CHECKPOINT_SLOT;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Closes the input.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointReader::close()
+{
+    if (mFile) {
+        fclose(mFile);
+        mFile = 0;
+    }
+    mBuffer    = 0;
+    mBufferPos = 0;
+    mRawUsed   = 0;
+    mRawPos    = 0;
+    mEnd       = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if every value in the stream has been read.
+///
+/// @throws   TsParseException
+///
+/// @details  Returns whether all values in the stream have been read, reading ahead to the next
+///           block if needed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsCheckpointReader::isAtEnd()
+{
+    while (mRawPos >= mRawUsed and not mEnd and isOpen()) {
+        fillBlock();
+    }
+    return mRawPos >= mRawUsed;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  value  (--)  Pointer to the value.
+/// @param[in]   size   (--)  Size of the value, up to 8 bytes.
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads the next 8-byte slot, filling the raw block from the stream when it's used up.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointReader::getSlot(void* value, const unsigned int size)
+{
+    if (not isOpen()) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "checkpoint stream is not open.");
+    }
+    while (mRawPos >= mRawUsed) {
+        if (mEnd) {
+            GUNNS_ERROR(TsParseException, "Invalid Checkpoint Stream",
+                        "read past the end of the checkpoint stream.");
+        }
+        fillBlock();
+    }
+    std::memcpy(value, &mRaw[mRawPos], size);
+    mRawPos += CHECKPOINT_SLOT;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsParseException
+///
+/// @details  Reads the next block header and block, and decompresses and unshuffles it into the
+///           raw block.  The end block sets mEnd instead.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointReader::fillBlock()
+{
+    const unsigned int rawSize    = inputWord();
+    const unsigned int packedSize = inputWord();
+    mRawUsed = 0;
+    mRawPos  = 0;
+    if (0 == rawSize) {
+        if (0 != packedSize) {
+            GUNNS_ERROR(TsParseException, "Invalid Checkpoint Stream",
+                        "malformed checkpoint end block.");
+        }
+        mEnd = true;
+        return;
+    }
+    if (rawSize > mBlockSize or 0 != rawSize % CHECKPOINT_SLOT or packedSize > rawSize
+            or 0 == packedSize) {
+        GUNNS_ERROR(TsParseException, "Invalid Checkpoint Stream",
+                    "malformed checkpoint block header.");
+    }
+    if (packedSize == rawSize) {
+        input(&mRaw[0], rawSize);
+    } else {
+        input(&mPacked[0], packedSize);
+        if (not GunnsCheckpointCodec::decompress(&mWork[0], rawSize, &mPacked[0], packedSize)) {
+            GUNNS_ERROR(TsParseException, "Invalid Checkpoint Stream",
+                        "corrupt checkpoint block.");
+        }
+        GunnsCheckpointCodec::unshuffle(&mRaw[0], &mWork[0], rawSize);
+    }
+    mRawUsed = rawSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  data  (--)  Bytes input.
+/// @param[in]   size  (--)  Number of bytes.
+///
+/// @throws   TsParseException
+///
+/// @details  Inputs bytes from the file or buffer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointReader::input(void* data, const unsigned int size)
+{
+    if (mFile) {
+        if (size != fread(data, 1, size, mFile)) {
+            GUNNS_ERROR(TsParseException, "Invalid Checkpoint Stream",
+                        "truncated checkpoint stream.");
+        }
+    } else {
+        if (mBufferPos + size > mBuffer->size()) {
+            GUNNS_ERROR(TsParseException, "Invalid Checkpoint Stream",
+                        "truncated checkpoint stream.");
+        }
+        std::memcpy(data, &(*mBuffer)[mBufferPos], size);
+        mBufferPos += size;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int  (--)  Value input.
+///
+/// @throws   TsParseException
+///
+/// @details  Inputs a 32-bit unsigned value in native byte order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int GunnsCheckpointReader::inputWord()
+{
+    unsigned int value = 0;
+    input(&value, 4);
+    return value;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsParseException
+///
+/// @details  Reads and checks the stream magic number, version, byte order and block size, and
+///           sizes the block arrays.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsCheckpointReader::readHeader()
+{
+    char magic[sizeof(CHECKPOINT_MAGIC)];
+    input(magic, sizeof(magic));
+    if (0 != std::memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic))) {
+        GUNNS_ERROR(TsParseException, "Invalid Checkpoint Stream", "not a GUNNS checkpoint stream.");
+    }
+    if (GunnsCheckpointWriter::VERSION != inputWord()) {
+        GUNNS_ERROR(TsParseException, "Invalid Checkpoint Stream",
+                    "unsupported checkpoint stream version.");
+    }
+    if (CHECKPOINT_BOM != inputWord()) {
+        GUNNS_ERROR(TsParseException, "Invalid Checkpoint Stream",
+                    "checkpoint stream byte order doesn't match this host.");
+    }
+    mBlockSize = inputWord();
+    if (0 == mBlockSize or mBlockSize > CHECKPOINT_MAX_BLOCK or 0 != mBlockSize % CHECKPOINT_SLOT) {
+        GUNNS_ERROR(TsParseException, "Invalid Checkpoint Stream",
+                    "invalid checkpoint stream block size.");
+    }
+    mRaw.resize(mBlockSize);
+    mWork.resize(mBlockSize);
+    mPacked.resize(mBlockSize);
+    mRawUsed = 0;
+    mRawPos  = 0;
+    mEnd     = false;
+}
@@ -0,0 +1,261 @@
+#ifndef GunnsCheckpoint_EXISTS
+#define GunnsCheckpoint_EXISTS
+
+/**
+@file
+@brief    GUNNS Native Checkpoint declarations
+
+@defgroup  TSM_GUNNS_CORE_CHECKPOINT    GUNNS Native Checkpoint
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Streams the minimal state of a GUNNS network through a block compressor to a file or memory
+   buffer, and back, for fast checkpoint, restore and in-run rollback.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The stream is in the host's native byte order and is only read back on a host of the same byte
+   order; the reader checks this.)
+- (Every value is stored in an 8-byte slot so the compressor can shuffle like bytes together.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsCheckpoint.o))
+
+PROGRAMMERS:
+- ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+
+@{
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Checkpoint Block Codec
+///
+/// @details  A small, dependency-free block compressor for checkpoint streams.  Each block is first
+///           byte-shuffled as 8-byte words, so that the sign & exponent bytes of neighboring
+///           doubles, and the zero padding of integers, line up into long runs.  The shuffled block
+///           is then packed by a byte-oriented LZ77 coder: a sequence of literal runs each
+///           followed by a back-reference of at least 4 bytes within the block, with a token byte
+///           holding the two lengths and 255-continuation bytes for long lengths.  The coder favors
+///           speed over ratio, so checkpoints are cheap enough to cut during run.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsCheckpointCodec
+{
+    public:
+        /// @brief Compresses a block, returning the packed size or zero if it doesn't fit.
+        static unsigned int compress(unsigned char* packed, const unsigned int capacity,
+                                     const unsigned char* raw, const unsigned int rawSize);
+        /// @brief Decompresses a block, returning false if the packed data is malformed.
+        static bool         decompress(unsigned char* raw, const unsigned int rawSize,
+                                       const unsigned char* packed, const unsigned int packedSize);
+        /// @brief Transposes a block of 8-byte words into byte planes.
+        static void         shuffle(unsigned char* out, const unsigned char* in,
+                                    const unsigned int size);
+        /// @brief Reverses shuffle.
+        static void         unshuffle(unsigned char* out, const unsigned char* in,
+                                      const unsigned int size);
+
+    private:
+        /// @brief Default constructor unavailable since declared private and not implemented.
+        GunnsCheckpointCodec();
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsCheckpointCodec(const GunnsCheckpointCodec&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsCheckpointCodec& operator =(const GunnsCheckpointCodec&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Checkpoint Stream Writer
+///
+/// @details  Writes values to a compressed checkpoint stream, either a file or a memory buffer.
+///           Values are collected into a raw block, which is shuffled, compressed and output when
+///           it fills, or stored as-is if it doesn't compress.  The stream layout is:
+///           \verbatim
+///             header: 8-byte magic "GUNNSCKP", then 32-bit version, byte-order mark & block size
+///             blocks: 32-bit raw size, 32-bit packed size, then the packed bytes; packed size
+///                     equal to raw size means the block is stored uncompressed
+///             end:    a block with zero raw size
+///           \endverbatim
+///           The stream is finished by close(), which must be called before the output is used.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsCheckpointWriter
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsCheckpointWriter);
+    public:
+        /// @brief Stream format version.
+        static const unsigned int VERSION;
+        /// @brief Size of the raw blocks.
+        static const unsigned int BLOCK_SIZE;
+        /// @brief Default constructs this Checkpoint Writer.
+        GunnsCheckpointWriter(const std::string& name = "");
+        /// @brief Default destructs this Checkpoint Writer.
+        virtual ~GunnsCheckpointWriter();
+        /// @brief Opens the stream to the given file.
+        void          openFile(const std::string& fileName);
+        /// @brief Opens the stream to the given memory buffer.
+        void          openBuffer(std::vector<unsigned char>* buffer);
+        /// @brief Writes a double to the stream.
+        void          write(const double value);
+        /// @brief Writes an int to the stream.
+        void          write(const int value);
+        /// @brief Writes an unsigned int to the stream.
+        void          write(const unsigned int value);
+        /// @brief Writes a bool to the stream.
+        void          write(const bool value);
+        /// @brief Writes an array of doubles to the stream.
+        void          write(const double* values, const int count);
+        /// @brief Finishes the stream and closes the output.
+        void          close();
+        /// @brief Returns whether the stream is open.
+        bool          isOpen() const;
+        /// @brief Returns the number of raw bytes written.
+        unsigned long getRawSize() const;
+        /// @brief Returns the number of bytes output, including the stream overhead.
+        unsigned long getPackedSize() const;
+
+    protected:
+        std::string                 mName;       /**< *o (--) trick_chkpnt_io(**) Instance name for messages */
+        FILE*                       mFile;       /**< ** (--) trick_chkpnt_io(**) Output file, or 0 */
+        std::vector<unsigned char>* mBuffer;     /**< ** (--) trick_chkpnt_io(**) Output memory buffer, or 0 */
+        std::vector<unsigned char>  mRaw;        /**< ** (--) trick_chkpnt_io(**) Raw block being filled */
+        std::vector<unsigned char>  mWork;       /**< ** (--) trick_chkpnt_io(**) Shuffled block */
+        std::vector<unsigned char>  mPacked;     /**< ** (--) trick_chkpnt_io(**) Compressed block */
+        unsigned int                mRawUsed;    /**<    (--) trick_chkpnt_io(**) Bytes used in the raw block */
+        unsigned long               mRawSize;    /**<    (--) trick_chkpnt_io(**) Total raw bytes written */
+        unsigned long               mPackedSize; /**<    (--) trick_chkpnt_io(**) Total bytes output */
+        /// @brief Appends one 8-byte slot to the raw block.
+        void putSlot(const void* value, const unsigned int size);
+        /// @brief Compresses and outputs the raw block.
+        void flushBlock();
+        /// @brief Outputs bytes to the file or buffer.
+        void output(const void* data, const unsigned int size);
+        /// @brief Outputs a 32-bit unsigned value.
+        void outputWord(const unsigned int value);
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsCheckpointWriter(const GunnsCheckpointWriter&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsCheckpointWriter& operator =(const GunnsCheckpointWriter&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Checkpoint Stream Reader
+///
+/// @details  Reads values back from a stream made by GunnsCheckpointWriter, in the same order and
+///           of the same types they were written.  Any malformed, truncated or foreign stream
+///           throws TsParseException.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsCheckpointReader
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsCheckpointReader);
+    public:
+        /// @brief Default constructs this Checkpoint Reader.
+        GunnsCheckpointReader(const std::string& name = "");
+        /// @brief Default destructs this Checkpoint Reader.
+        virtual ~GunnsCheckpointReader();
+        /// @brief Opens the stream from the given file.
+        void openFile(const std::string& fileName);
+        /// @brief Opens the stream from the given memory buffer.
+        void openBuffer(const std::vector<unsigned char>* buffer);
+        /// @brief Reads a double from the stream.
+        void read(double& value);
+        /// @brief Reads an int from the stream.
+        void read(int& value);
+        /// @brief Reads an unsigned int from the stream.
+        void read(unsigned int& value);
+        /// @brief Reads a bool from the stream.
+        void read(bool& value);
+        /// @brief Reads an array of doubles from the stream.
+        void read(double* values, const int count);
+        /// @brief Closes the input.
+        void close();
+        /// @brief Returns whether the stream is open.
+        bool isOpen() const;
+        /// @brief Returns whether all values in the stream have been read.
+        bool isAtEnd();
+
+    protected:
+        std::string                       mName;        /**< *o (--) trick_chkpnt_io(**) Instance name for messages */
+        FILE*                             mFile;        /**< ** (--) trick_chkpnt_io(**) Input file, or 0 */
+        const std::vector<unsigned char>* mBuffer;      /**< ** (--) trick_chkpnt_io(**) Input memory buffer, or 0 */
+        unsigned long                     mBufferPos;   /**<    (--) trick_chkpnt_io(**) Read position in the memory buffer */
+        std::vector<unsigned char>        mRaw;         /**< ** (--) trick_chkpnt_io(**) Current raw block */
+        std::vector<unsigned char>        mWork;        /**< ** (--) trick_chkpnt_io(**) Shuffled block */
+        std::vector<unsigned char>        mPacked;      /**< ** (--) trick_chkpnt_io(**) Compressed block */
+        unsigned int                      mRawUsed;     /**<    (--) trick_chkpnt_io(**) Bytes in the current raw block */
+        unsigned int                      mRawPos;      /**<    (--) trick_chkpnt_io(**) Read position in the raw block */
+        unsigned int                      mBlockSize;   /**<    (--) trick_chkpnt_io(**) Stream block size */
+        bool                              mEnd;         /**<    (--) trick_chkpnt_io(**) The end block has been read */
+        /// @brief Reads one 8-byte slot from the raw block.
+        void getSlot(void* value, const unsigned int size);
+        /// @brief Reads and decompresses the next block.
+        void fillBlock();
+        /// @brief Inputs bytes from the file or buffer.
+        void input(void* data, const unsigned int size);
+        /// @brief Inputs a 32-bit unsigned value.
+        unsigned int inputWord();
+        /// @brief Reads and checks the stream header.
+        void readHeader();
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsCheckpointReader(const GunnsCheckpointReader&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsCheckpointReader& operator =(const GunnsCheckpointReader&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if the stream is open.
+///
+/// @details  Returns whether the stream is open.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsCheckpointWriter::isOpen() const
+{
+    return mFile or mBuffer;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned long  (--)  Number of raw bytes written.
+///
+/// @details  Returns the number of raw bytes written, 8 per value.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long GunnsCheckpointWriter::getRawSize() const
+{
+    return mRawSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned long  (--)  Number of bytes output.
+///
+/// @details  Returns the number of bytes output so far, including the header and block overhead.
+///           This is only the final size of the stream after close().
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long GunnsCheckpointWriter::getPackedSize() const
+{
+    return mPackedSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if the stream is open.
+///
+/// @details  Returns whether the stream is open.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsCheckpointReader::isOpen() const
+{
+    return mFile or mBuffer;
+}
+
+#endif
@@ -0,0 +1,606 @@
+/**
+@file
+@brief     GUNNS Ensemble implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ((core/Gunns.o))
+*/
+
+#include <sstream>
+#include "GunnsEnsemble.hh"
+#include "core/Gunns.hh"
+#include "core/GunnsInfraMacros.hh"
+#include "core/GunnsMacros.hh"
+#include "simulation/hs/TsHsMsg.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include "software/exceptions/TsNumericalException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this GUNNS Ensemble.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsEnsemble::GunnsEnsemble()
+    :
+    mName(),
+    mLanes(),
+    mNumLanes(0),
+    mNetworkSize(0),
+    mFactors(0),
+    mWorkMatrix(0),
+    mSourceVector(0),
+    mPotentialVector(0),
+    mRowStart(0),
+    mWorkRowStart(0),
+    mBatch(0),
+    mLaneBatched(0),
+    mLaneDecompose(0),
+    mLaneFailed(0),
+    mNumBatched(0),
+    mDecompositionCount(0),
+    mInitFlag(false)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Ensemble.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsEnsemble::~GunnsEnsemble()
+{
+    cleanup();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes allocated memory objects.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::cleanup()
+{
+    TS_DELETE_ARRAY(mLaneFailed);
+    TS_DELETE_ARRAY(mLaneDecompose);
+    TS_DELETE_ARRAY(mLaneBatched);
+    TS_DELETE_ARRAY(mBatch);
+    TS_DELETE_ARRAY(mWorkRowStart);
+    TS_DELETE_ARRAY(mRowStart);
+    TS_DELETE_ARRAY(mPotentialVector);
+    TS_DELETE_ARRAY(mSourceVector);
+    TS_DELETE_ARRAY(mWorkMatrix);
+    TS_DELETE_ARRAY(mFactors);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] lane (--) Pointer to the network to add as a lane.
+///
+/// @details  Adds the given network as the next lane of this ensemble.  The ensemble must be
+///           initialized after all of its lanes are added.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::addLane(Gunns* lane)
+{
+    mLanes.push_back(lane);
+    mInitFlag = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name (--) Instance name for H&S messages.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Verifies the lanes are all initialized networks of the same size, and allocates the
+///           structure-of-arrays storage for them.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::initialize(const std::string& name)
+{
+    mInitFlag = false;
+    mName     = name;
+    if (mName.empty()) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "missing name.");
+    }
+    if (mLanes.empty()) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "ensemble has no lanes.");
+    }
+
+    /// - Verify the lanes.
+    mNumLanes    = static_cast<int>(mLanes.size());
+    mNetworkSize = 0;
+    for (int lane = 0; lane < mNumLanes; ++lane) {
+        if (not mLanes[lane] or not mLanes[lane]->mInitFlag) {
+            std::ostringstream msg;
+            msg << "lane " << lane << " is not an initialized network.";
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data", msg.str());
+        }
+        if (0 == lane) {
+            mNetworkSize = mLanes[lane]->mNetworkSize;
+        } else if (mNetworkSize != mLanes[lane]->mNetworkSize) {
+            std::ostringstream msg;
+            msg << "lane " << lane << " network size " << mLanes[lane]->mNetworkSize
+                << " doesn't match lane 0 network size " << mNetworkSize << ".";
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data", msg.str());
+        }
+    }
+
+    /// - Allocate the structure-of-arrays storage.  The factors start as identity matrices so that
+    ///   solving the slots of lanes that haven't been decomposed yet is harmless.
+    cleanup();
+    const int n = mNetworkSize;
+    const int K = mNumLanes;
+    TS_NEW_PRIM_ARRAY_EXT(mFactors,         n*n*K, double, mName + ".mFactors");
+    TS_NEW_PRIM_ARRAY_EXT(mWorkMatrix,      n*n*K, double, mName + ".mWorkMatrix");
+    TS_NEW_PRIM_ARRAY_EXT(mSourceVector,    n*K,   double, mName + ".mSourceVector");
+    TS_NEW_PRIM_ARRAY_EXT(mPotentialVector, n*K,   double, mName + ".mPotentialVector");
+    TS_NEW_PRIM_ARRAY_EXT(mRowStart,        n,     int,    mName + ".mRowStart");
+    TS_NEW_PRIM_ARRAY_EXT(mWorkRowStart,    n,     int,    mName + ".mWorkRowStart");
+    TS_NEW_PRIM_ARRAY_EXT(mBatch,           K,     int,    mName + ".mBatch");
+    TS_NEW_PRIM_ARRAY_EXT(mLaneBatched,     K,     bool,   mName + ".mLaneBatched");
+    TS_NEW_PRIM_ARRAY_EXT(mLaneDecompose,   K,     bool,   mName + ".mLaneDecompose");
+    TS_NEW_PRIM_ARRAY_EXT(mLaneFailed,      K,     bool,   mName + ".mLaneFailed");
+    for (int row = 0; row < n; ++row) {
+        for (int col = 0; col < n; ++col) {
+            const double value = (row == col) ? 1.0 : 0.0;
+            for (int lane = 0, i = (row*n + col)*K; lane < K; ++lane, ++i) {
+                mFactors[i] = value;
+            }
+        }
+        mRowStart[row] = row;
+    }
+    for (int i = 0; i < n*K; ++i) {
+        mSourceVector[i]    = 0.0;
+        mPotentialVector[i] = 0.0;
+    }
+    for (int lane = 0; lane < K; ++lane) {
+        mBatch[lane]         = 0;
+        mLaneBatched[lane]   = false;
+        mLaneDecompose[lane] = false;
+        mLaneFailed[lane]    = false;
+    }
+    mNumBatched         = 0;
+    mDecompositionCount = 0;
+    mInitFlag           = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] lane (--) The lane network to check.
+///
+/// @returns  bool (--) True if the lane can be batched.
+///
+/// @details  Only the linear solution path without the optional solver methods is batched, as
+///           those methods keep their own working arrays or have minor step logic.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsEnsemble::isBatchable(const Gunns& lane) const
+{
+    return lane.mLinearNetwork
+       and (Gunns::NORMAL == lane.mSolverMode)
+       and (Gunns::RUN    == lane.mRunMode)
+       and (Gunns::SOLVE  != lane.mIslandMode)
+       and (Gunns::NO_GPU == lane.mGpuMode)
+       and (mNetworkSize  == lane.mNetworkSize)
+       and (0             <  lane.mDecompositionLimit)
+       and (0             == lane.mDebugDesiredStep)
+       and not lane.mSorActive
+       and not lane.isMixedPrecisionActive()
+       and not lane.isFactorReuseActive();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] timeStep (s) Integration time step.
+///
+/// @throws   TsInitializationException, TsNumericalException, TsOutOfBoundsException
+///
+/// @details  Steps every lane one major step.  Lanes that can't be batched are stepped on their own
+///           with Gunns::step, and the rest are stepped together.  A lane joining the batch
+///           rebuilds its admittance matrix, since its factors in the batch may be out of date.
+///
+///           Lanes whose batched decomposition fails are finished on their own after the batch, and
+///           the first of their failures is thrown once all other lanes have completed the step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::step(const double timeStep)
+{
+    if (not mInitFlag) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "ensemble has not been initialized.");
+    }
+    const double startTime = CLOCK_TIME;
+
+    mNumBatched = 0;
+    for (int lane = 0; lane < mNumLanes; ++lane) {
+        Gunns* network = mLanes[lane];
+        mLaneDecompose[lane] = false;
+        mLaneFailed[lane]    = false;
+        if (isBatchable(*network)) {
+            if (network->beginMajorStep()) {
+                if (not mLaneBatched[lane]) {
+                    network->mRebuild = true;
+                }
+                mLaneBatched[lane]    = true;
+                mBatch[mNumBatched++] = lane;
+            }
+        } else {
+            mLaneBatched[lane] = false;
+            network->step(timeStep);
+        }
+    }
+
+    if (mNumBatched > 0) {
+        try {
+            stepBatch(timeStep);
+        } catch (TsNumericalException& e) {
+            abortBatch();
+            throw e;
+        }
+
+        /// - The batched lanes share the step time.
+        if (mNumBatched > 0) {
+            const double stepTime = (CLOCK_TIME - startTime) / mNumBatched;
+            for (int i = 0; i < mNumBatched; ++i) {
+                mLanes[mBatch[i]]->mStepTime = stepTime;
+            }
+        }
+
+        /// - Finish the lanes that failed out of the batch.
+        finishFailedLanes(timeStep);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] timeStep (s) Integration time step.
+///
+/// @throws   TsNumericalException
+///
+/// @details  Does the single minor step of the batched linear lanes, with the same sequence as
+///           Gunns::iterateMinorSteps and Gunns::buildAndSolveSystem, except the decomposition and
+///           solution are batched.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::stepBatch(const double timeStep)
+{
+    /// - Step each lane's links and build its system.
+    bool anyDecomposition = false;
+    for (int i = 0; i < mNumBatched; ++i) {
+        const int lane   = mBatch[i];
+        Gunns*   network = mLanes[lane];
+        network->mSolveTimeWorking     = 0.0;
+        network->mDecomposeTimeWorking = 0.0;
+        network->mLastDecomposition    = 0;
+        network->mLastMinorStep        = 1;
+        network->beginMinorStep();
+        network->stepLinks(timeStep, 1);
+        mLaneDecompose[lane] = network->buildSystem();
+        anyDecomposition    |= mLaneDecompose[lane];
+    }
+
+    /// - Decompose the changed lanes, then start the network capacitance computations in each of
+    ///   them, which use the factors copied back into the lane.  Lanes that failed decomposition
+    ///   leave the batch.
+    if (anyDecomposition) {
+        const double startTime = CLOCK_TIME;
+        decomposeBatch();
+        const double elapsedTime = (CLOCK_TIME - startTime) / mNumBatched;
+        for (int i = 0; i < mNumBatched; ++i) {
+            Gunns* network = mLanes[mBatch[i]];
+            network->mSolveTimeWorking     += elapsedTime;
+            network->mDecomposeTimeWorking += elapsedTime;
+            if (mLaneDecompose[mBatch[i]] and not mLaneFailed[mBatch[i]]) {
+                network->perturbNetworkCapacitances();
+            }
+        }
+        removeFailedLanes();
+        if (0 == mNumBatched) {
+            return;
+        }
+    }
+
+    /// - Solve all lanes together.
+    const double startTime = CLOCK_TIME;
+    solveBatch();
+    const double elapsedTime = (CLOCK_TIME - startTime) / mNumBatched;
+
+    /// - Finish the minor and major steps in each lane.
+    for (int i = 0; i < mNumBatched; ++i) {
+        Gunns* network = mLanes[mBatch[i]];
+        network->mSolveTimeWorking += elapsedTime;
+        finishLane(network, timeStep);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] network  (--) The lane network to finish.
+/// @param[in] timeStep (s)  Integration time step.
+///
+/// @details  Finishes the minor and major steps of the given lane after its system is solved, with
+///           the same sequence as Gunns::buildAndSolveSystem and Gunns::step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::finishLane(Gunns* network, const double timeStep)
+{
+    network->cleanPotentialVector();
+    network->computeNetworkCapacitances(timeStep);
+    network->overridePotential();
+    network->outputPotentialVector();
+    network->mStepLog.recordPotential(network->mPotentialVector);
+    network->mStepLog.recordStepResult(network->mLastDecomposition,
+                                       GunnsMinorStepData::CONFIRM);
+    network->endMajorStep(timeStep, true);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Removes the lanes whose batched decomposition failed from the batch.  They are no
+///           longer flagged as batched, so they rebuild their admittance matrix when they rejoin.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::removeFailedLanes()
+{
+    int numBatched = 0;
+    for (int i = 0; i < mNumBatched; ++i) {
+        const int lane = mBatch[i];
+        if (mLaneFailed[lane]) {
+            mLaneBatched[lane] = false;
+        } else {
+            mBatch[numBatched++] = lane;
+        }
+    }
+    mNumBatched = numBatched;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] timeStep (s) Integration time step.
+///
+/// @throws   TsNumericalException
+///
+/// @details  Finishes the step of each lane whose batched decomposition failed, as Gunns::step
+///           would: its system was built and its admittance matrix left intact, so it's decomposed
+///           and solved with the lane's own serial solver.  A lane failing again records the math
+///           failure in its step log.  The remaining failed lanes are still finished, then the first
+///           failure is thrown.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::finishFailedLanes(const double timeStep)
+{
+    bool                 failed = false;
+    TsNumericalException failure;
+    for (int lane = 0; lane < mNumLanes; ++lane) {
+        if (mLaneFailed[lane]) {
+            mLaneFailed[lane] = false;
+            Gunns*       network   = mLanes[lane];
+            const double startTime = CLOCK_TIME;
+            try {
+                network->mLastDecomposition++;
+                network->mDecompositionCount++;
+                network->mFactorsStale     = false;
+                network->mFactorReuseSteps = 0;
+                network->decompose(network->mAdmittanceMatrix, mNetworkSize);
+                network->perturbNetworkCapacitances();
+                network->solveCholesky();
+                finishLane(network, timeStep);
+                network->mStepTime = CLOCK_TIME - startTime;
+            } catch (TsNumericalException& e) {
+                network->mStepLog.recordStepResult(network->mLastDecomposition,
+                                                   GunnsMinorStepData::MATH_FAIL);
+                network->mStepLog.endMajorStep();
+                if (not failed) {
+                    failed  = true;
+                    failure = e;
+                }
+            }
+        }
+    }
+    if (failed) {
+        throw failure;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Gathers the admittance matrices of the lanes needing decomposition into the work
+///           matrix, decomposes all lanes of the work matrix at once, and copies the new factors
+///           back into the lanes and into the factors array.  Lanes not being decomposed get an
+///           identity matrix in the work matrix, which decomposes to itself.
+///
+///           A lane with a diagonal that isn't positive is flagged as failed instead of throwing,
+///           so the other lanes aren't affected.  Its diagonal is replaced by one to keep the rest
+///           of its decomposition finite, and its factors aren't copied back.
+///
+///           The operations on each lane are the same as CholeskyLdu::Decompose, including its
+///           skipping of terms and underflow protection, which are done here with selects rather
+///           than branches so the lane loops vectorize.  The lanes' common profile of leading zeroes
+///           in each row is skipped, since those are zeroes in the factors too.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::decomposeBatch()
+{
+    const int n = mNetworkSize;
+    const int K = mNumLanes;
+
+    /// - Gather the lane admittance matrices, element-major and lane-minor.
+    for (int lane = 0; lane < K; ++lane) {
+        if (mLaneBatched[lane] and mLaneDecompose[lane]) {
+            const double* A = mLanes[lane]->mAdmittanceMatrix;
+            for (int ij = 0, i = lane; ij < n*n; ++ij, i += K) {
+                mWorkMatrix[i] = A[ij];
+            }
+        } else {
+            for (int row = 0, i = lane; row < n; ++row) {
+                for (int col = 0; col < n; ++col, i += K) {
+                    mWorkMatrix[i] = (row == col) ? 1.0 : 0.0;
+                }
+            }
+        }
+    }
+
+    /// - Find the first non-zero column in each row over all lanes.
+    for (int row = 0; row < n; ++row) {
+        mWorkRowStart[row] = row;
+        for (int col = 0; col < row; ++col) {
+            const double* p = mWorkMatrix + (row*n + col)*K;
+            bool nonZero = false;
+            for (int lane = 0; lane < K; ++lane) {
+                nonZero |= (0.0 != p[lane]);
+            }
+            if (nonZero) {
+                mWorkRowStart[row] = col;
+                break;
+            }
+        }
+    }
+
+    /// - Decompose all lanes, in the same order as CholeskyLdu::Decompose.
+    const double limit = -1.0E-100;
+    for (int i = 1; i < n; ++i) {
+        const int si = mWorkRowStart[i];
+
+        /// - Calculate elements given by the product L[i][j]*D[j].
+        for (int j = si; j < i; ++j) {
+            double* p_ij = mWorkMatrix + (i*n + j)*K;
+            const int sj = (mWorkRowStart[j] > si) ? mWorkRowStart[j] : si;
+            for (int k = sj; k < j; ++k) {
+                const double* p_ik = mWorkMatrix + (i*n + k)*K;
+                const double* p_jk = mWorkMatrix + (j*n + k)*K;
+                for (int lane = 0; lane < K; ++lane) {
+                    const double a = p_ik[lane];
+                    const double b = p_jk[lane];
+                    p_ij[lane] -= (limit > a and limit > b) ? a * b : 0.0;
+                }
+            }
+            for (int lane = 0; lane < K; ++lane) {
+                const double a = p_ij[lane];
+                p_ij[lane] = (a > limit and a < -limit) ? 0.0 : a;
+            }
+        }
+
+        /// - Calculate the diagonal element D[i] and L[i][j].  Store the transpose L[k][i].
+        double* p_ii = mWorkMatrix + (i*n + i)*K;
+        for (int k = si; k < i; ++k) {
+            double*       p_ik = mWorkMatrix + (i*n + k)*K;
+            double*       p_ki = mWorkMatrix + (k*n + i)*K;
+            const double* p_kk = mWorkMatrix + (k*n + k)*K;
+            for (int lane = 0; lane < K; ++lane) {
+                const double ld = p_ik[lane] / p_kk[lane];
+                p_ii[lane] -= p_ik[lane] * ld;
+                p_ik[lane]  = ld;
+                p_ki[lane]  = ld;
+            }
+        }
+
+        /// - Flag the failing lanes.
+        for (int lane = 0; lane < K; ++lane) {
+            if (not (p_ii[lane] > 0.0)) {
+                mLaneFailed[lane] = true;
+                p_ii[lane]        = 1.0;
+            }
+        }
+    }
+
+    /// - Copy the new factors back into the decomposed lanes and the factors array, and update
+    ///   their decomposition counts.  The profile of the factors can only grow until all batched
+    ///   lanes are decomposed together.
+    bool allDecomposed = true;
+    for (int lane = 0; lane < K; ++lane) {
+        if (mLaneFailed[lane]) {
+            allDecomposed = false;
+        } else if (mLaneBatched[lane] and mLaneDecompose[lane]) {
+            Gunns*  network = mLanes[lane];
+            double* A       = network->mAdmittanceMatrix;
+            for (int ij = 0, i = lane; ij < n*n; ++ij, i += K) {
+                A[ij]       = mWorkMatrix[i];
+                mFactors[i] = mWorkMatrix[i];
+            }
+            network->mLastDecomposition++;
+            network->mDecompositionCount++;
+            network->mFactorsStale     = false;
+            network->mFactorReuseSteps = 0;
+        } else if (mLaneBatched[lane]) {
+            allDecomposed = false;
+        }
+    }
+    for (int row = 0; row < n; ++row) {
+        if (allDecomposed or mWorkRowStart[row] < mRowStart[row]) {
+            mRowStart[row] = mWorkRowStart[row];
+        }
+    }
+    ++mDecompositionCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Gathers the lanes' source vectors, solves all lanes at once with their factors, and
+///           copies the solutions back into the batched lanes' potential vectors.  The operations
+///           on each lane are the same as CholeskyLdu::Solve, skipping the zeroes in the profile.
+///           The diagonal doesn't need checking for zero here, since the decomposition rejects
+///           factors with a diagonal that isn't positive.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::solveBatch()
+{
+    const int n = mNetworkSize;
+    const int K = mNumLanes;
+
+    /// - Gather the lane source vectors.  Lanes not batched solve for zero.
+    for (int lane = 0; lane < K; ++lane) {
+        if (mLaneBatched[lane]) {
+            const double* b = mLanes[lane]->mSourceVector;
+            for (int row = 0, i = lane; row < n; ++row, i += K) {
+                mSourceVector[i] = b[row];
+            }
+        } else {
+            for (int row = 0, i = lane; row < n; ++row, i += K) {
+                mSourceVector[i] = 0.0;
+            }
+        }
+    }
+
+    /// - Solve the linear equation Ly = B for y, where L is a unit lower triangular matrix.
+    double* x = mPotentialVector;
+    for (int k = 0; k < n; ++k) {
+        double*       x_k = x + k*K;
+        const double* b_k = mSourceVector + k*K;
+        for (int lane = 0; lane < K; ++lane) {
+            x_k[lane] = b_k[lane];
+        }
+        for (int i = mRowStart[k]; i < k; ++i) {
+            const double* x_i  = x + i*K;
+            const double* p_ki = mFactors + (k*n + i)*K;
+            for (int lane = 0; lane < K; ++lane) {
+                x_k[lane] -= x_i[lane] * p_ki[lane];
+            }
+        }
+    }
+
+    /// - Solve the linear equation Dz = y for z, where D is the diagonal matrix.
+    for (int k = 0; k < n; ++k) {
+        double*       x_k  = x + k*K;
+        const double* p_kk = mFactors + (k*n + k)*K;
+        for (int lane = 0; lane < K; ++lane) {
+            x_k[lane] /= p_kk[lane];
+        }
+    }
+
+    /// - Solve the linear equation Ux = z, where U is a unit upper triangular matrix.
+    for (int k = n-2; k >= 0; --k) {
+        double* x_k = x + k*K;
+        for (int i = k+1; i < n; ++i) {
+            if (mRowStart[i] <= k) {
+                const double* x_i  = x + i*K;
+                const double* p_ki = mFactors + (k*n + i)*K;
+                for (int lane = 0; lane < K; ++lane) {
+                    x_k[lane] -= x_i[lane] * p_ki[lane];
+                }
+            }
+        }
+    }
+
+    /// - Scatter the solutions to the batched lanes.
+    for (int i = 0; i < mNumBatched; ++i) {
+        const int lane = mBatch[i];
+        double*   p    = mLanes[lane]->mPotentialVector;
+        for (int row = 0, j = lane; row < n; ++row, j += K) {
+            p[row] = x[j];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Records the math failure and ends the major step in the step logs of the batched
+///           lanes, as Gunns::step does for its own failures.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsEnsemble::abortBatch()
+{
+    for (int i = 0; i < mNumBatched; ++i) {
+        Gunns* network = mLanes[mBatch[i]];
+        network->mStepLog.recordStepResult(network->mLastDecomposition,
+                                           GunnsMinorStepData::MATH_FAIL);
+        network->mStepLog.endMajorStep();
+    }
+}
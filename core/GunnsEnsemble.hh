@@ -0,0 +1,187 @@
+#ifndef GunnsEnsemble_EXISTS
+#define GunnsEnsemble_EXISTS
+
+/**
+@file
+@brief    GUNNS Ensemble declarations
+
+@defgroup  TSM_GUNNS_CORE_ENSEMBLE    GUNNS Ensemble
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:   (Steps an ensemble of copies of one network, such as the parameter-varied dispersions of
+            a Monte Carlo run, in lock-step, with the matrix decompositions and solutions of all
+            copies batched together.)
+
+@details
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (All lanes must be the same network topology, i.e. instances of the same network class.  Their
+   parameters and states can differ.)
+- (Only linear networks in NORMAL mode, with islands not solved and without SOR, mixed-precision,
+   factor reuse, GPU or debug slices are batched.  Other lanes are stepped on their own with
+   Gunns::step, so any lane's options can be changed at any time.)
+- (The links and nodes of each lane are still separate objects, so link stepping and system
+   assembly loop over each lane's links.)
+- (A lane whose batched decomposition fails, such as from a singular matrix, is finished on its own
+   with the serial decomposition after the rest of the batch, so the other lanes still complete
+   their step.  Its failure is then thrown as from Gunns::step.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsEnsemble.o))
+
+PROGRAMMERS:
+- ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+
+@{
+*/
+
+#include <string>
+#include <vector>
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+
+// Forward-declare pointer types
+class Gunns;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Ensemble Class.
+///
+/// @details  This steps K instances of the same network, called lanes, in lock-step.  Each lane is
+///           a normal, separately initialized network, so each lane's results are read through its
+///           usual node and link accessors.  The lanes' admittance matrices, source vectors and
+///           solutions are gathered into structure-of-arrays storage, where each matrix element is
+///           stored for all lanes contiguously.  The Cholesky LDU decomposition and solution of all
+///           lanes is then done in one pass, where the innermost loops run across the lanes and
+///           vectorize.  The lanes share a sparsity profile: the decomposition and solution skip
+///           the leading zeroes of each matrix row, which stay zero in the factors.
+///
+///           The batched decomposition makes the same operations in the same order as
+///           CholeskyLdu::Decompose, so the lanes get the same solution as Gunns::step.
+///
+///           Lanes are added with addLane after they're initialized, then the ensemble is
+///           initialized, and then the ensemble is stepped instead of its lanes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsEnsemble
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsEnsemble);
+
+    public:
+        /// @brief  Default constructs this GUNNS Ensemble.
+        GunnsEnsemble();
+        /// @brief  Default destructs this GUNNS Ensemble.
+        virtual ~GunnsEnsemble();
+        /// @brief  Adds the given network as a lane of this ensemble.
+        void   addLane(Gunns* lane);
+        /// @brief  Initializes this ensemble for its lanes.
+        void   initialize(const std::string& name);
+        /// @brief  Steps all lanes of this ensemble.
+        void   step(const double timeStep);
+        /// @brief  Returns the number of lanes in this ensemble.
+        int    getNumLanes() const;
+        /// @brief  Returns the given lane.
+        Gunns* getLane(const int lane) const;
+        /// @brief  Returns the number of lanes that were batched in the last step.
+        int    getNumBatched() const;
+        /// @brief  Returns the total number of batched decompositions.
+        int    getDecompositionCount() const;
+        /// @brief  Returns whether this ensemble has been successfully initialized.
+        bool   isInitialized() const;
+
+    protected:
+        std::string         mName;               /**< *o (--) trick_chkpnt_io(**) Instance name for H&S messages. */
+        std::vector<Gunns*> mLanes;              /**< ** (--) trick_chkpnt_io(**) The lane networks, not owned. */
+        int                 mNumLanes;           /**< *o (--) trick_chkpnt_io(**) Number of lanes, K. */
+        int                 mNetworkSize;        /**< *o (--) trick_chkpnt_io(**) Network size, n, of every lane. */
+        double*             mFactors;            /**< ** (--) trick_chkpnt_io(**) Lane LDU factors, [n][n][K]. */
+        double*             mWorkMatrix;         /**< ** (--) trick_chkpnt_io(**) Lane admittance matrices being decomposed, [n][n][K]. */
+        double*             mSourceVector;       /**< ** (--) trick_chkpnt_io(**) Lane source vectors, [n][K]. */
+        double*             mPotentialVector;    /**< ** (--) trick_chkpnt_io(**) Lane potential solutions, [n][K]. */
+        int*                mRowStart;           /**< ** (--) trick_chkpnt_io(**) Column of the first non-zero in each row of the factors. */
+        int*                mWorkRowStart;       /**< ** (--) trick_chkpnt_io(**) Column of the first non-zero in each row of mWorkMatrix. */
+        int*                mBatch;              /**< ** (--) trick_chkpnt_io(**) Indexes of the lanes batched this step. */
+        bool*               mLaneBatched;        /**< ** (--) trick_chkpnt_io(**) Whether each lane was batched in its last step. */
+        bool*               mLaneDecompose;      /**< ** (--) trick_chkpnt_io(**) Whether each lane needs decomposition this step. */
+        bool*               mLaneFailed;         /**< ** (--) trick_chkpnt_io(**) Whether each lane's batched decomposition failed this step. */
+        int                 mNumBatched;         /**< *o (--) trick_chkpnt_io(**) Number of lanes batched this step. */
+        int                 mDecompositionCount; /**< *o (--) trick_chkpnt_io(**) Total number of batched decompositions. */
+        bool                mInitFlag;           /**< *o (--) trick_chkpnt_io(**) Initialization complete flag. */
+        /// @brief  Deletes allocated memory objects.
+        void cleanup();
+        /// @brief  Returns whether the given lane's options allow it to be batched.
+        bool isBatchable(const Gunns& lane) const;
+        /// @brief  Steps the lanes being batched.
+        void stepBatch(const double timeStep);
+        /// @brief  Decomposes the admittance matrices of the batched lanes that changed.
+        void decomposeBatch();
+        /// @brief  Moves the lanes whose batched decomposition failed out of the batch.
+        void removeFailedLanes();
+        /// @brief  Solves the systems of all lanes with their factors.
+        void solveBatch();
+        /// @brief  Finishes the minor and major step of a lane after its system is solved.
+        void finishLane(Gunns* network, const double timeStep);
+        /// @brief  Finishes the lanes whose batched decomposition failed with the serial solver.
+        void finishFailedLanes(const double timeStep);
+        /// @brief  Records the math failure in the step logs of the batched lanes.
+        void abortBatch();
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsEnsemble(const GunnsEnsemble& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsEnsemble& operator =(const GunnsEnsemble& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) The number of lanes in this ensemble.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsEnsemble::getNumLanes() const
+{
+    return static_cast<int>(mLanes.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] lane (--) Index of the lane to return.
+///
+/// @returns  Gunns* (--) Pointer to the given lane, or null if the index is out of range.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline Gunns* GunnsEnsemble::getLane(const int lane) const
+{
+    if (lane >= 0 and lane < getNumLanes()) {
+        return mLanes[lane];
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) The number of lanes that were batched in the last step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsEnsemble::getNumBatched() const
+{
+    return mNumBatched;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) The total number of batched decompositions.
+///
+/// @details  Each batched decomposition decomposes all of the lanes that needed it in that step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsEnsemble::getDecompositionCount() const
+{
+    return mDecompositionCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if this ensemble has been successfully initialized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsEnsemble::isInitialized() const
+{
+    return mInitFlag;
+}
+
+#endif
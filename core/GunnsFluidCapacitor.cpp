@@ -29,9 +29,11 @@ LIBRARY DEPENDENCY:
 */
 
 #include "GunnsFluidCapacitor.hh"
+#include "GunnsCheckpoint.hh"
 #include "GunnsFluidUtils.hh"
 #include <cmath>
 #include "software/exceptions/TsInitializationException.hh"
+#include <typeinfo>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] name                 (--) Link name
@@ -253,6 +255,42 @@ void GunnsFluidCapacitor::restartModel()
     mEditVolume          = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the pressure correction disable flag to the base link state.  Volume edits are
+///           applied to the node, which writes its own volume, and the capacitance is found again
+///           on the next step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidCapacitor::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsFluidLink::saveCheckpoint(writer);
+    writer.write(mDisablePressureCorrection);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidCapacitor::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsFluidLink::loadCheckpoint(reader);
+    reader.read(mDisablePressureCorrection);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsFluidCapacitor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidCapacitor::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsFluidCapacitor);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
@@ -146,6 +146,15 @@ class GunnsFluidCapacitor : public GunnsFluidLink
         /// @brief Sets the volume edit controls
         void editVolume(const bool flag, const double volume);
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         double mCapacitance;               /**< (kg*mol/kPa) trick_chkpnt_io(**) Fluid molar capacitance applied to the capacitive node */
         double mExpansionScaleFactor;      /**< (--)         trick_chkpnt_io(**) Scaling for isentropic gas cooling (0-1) */
@@ -28,6 +28,7 @@ PROGRAMMERS:
 #include "GunnsFluidConductor.hh"
 #include "math/MsMath.hh"
 #include "software/exceptions/TsInitializationException.hh"
+#include <typeinfo>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] name                 (--) Link name
@@ -222,6 +223,14 @@ void GunnsFluidConductor::restartModel()
     mTuneDeltaT            = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsFluidConductor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidConductor::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsFluidConductor);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
@@ -128,6 +128,9 @@ class GunnsFluidConductor : public GunnsFluidLink
         /// @brief Returns the effective conductivity of the Fluid Conductor
         double getEffectiveConductivity() const;
 
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         double                      mEffectiveConductivity; /**< (m2)           trick_chkpnt_io(**) Effective conductivity of the link */
         double                      mMaxConductivity;       /**< (m2)           trick_chkpnt_io(**) Link Maximum Conductivity */
@@ -14,6 +14,7 @@ LIBRARY DEPENDENCY:
 #include "GunnsFluidDistributedIf.hh"
 #include "core/GunnsFluidUtils.hh"
 #include "core/GunnsFluidCapacitor.hh"
+#include "core/GunnsFluidDistributedIfTransport.hh"
 #include "math/MsMath.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
@@ -218,6 +219,96 @@ void GunnsFluidDistributedIfData::getTcMoleFractions(double* fractions)
 ///           for liquid and gas nodes.
 const double GunnsFluidDistributedIf::mNetworkCapacitanceFlux = 1.0E-6;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Fluid Distributed Interface predictor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidDistributedIfPredictor::GunnsFluidDistributedIfPredictor()
+    :
+    mOrder(0),
+    mNumSamples(0),
+    mFrames(),
+    mValues()
+{
+    reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Fluid Distributed Interface predictor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidDistributedIfPredictor::~GunnsFluidDistributedIfPredictor()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  order  (--)  Polynomial order of the extrapolation, limited to MAX_ORDER.
+///
+/// @details  Sets the polynomial order and empties the history.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfPredictor::initialize(const unsigned int order)
+{
+    mOrder = std::min(order, static_cast<unsigned int>(MAX_ORDER));
+    reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Empties the history.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfPredictor::reset()
+{
+    mNumSamples = 0;
+    for (unsigned int i = 0; i <= MAX_ORDER; ++i) {
+        mFrames[i] = 0;
+        mValues[i] = 0.0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  frame  (--)  Other side's frame count of the sample.
+/// @param[in]  value  (--)  Sample value.
+///
+/// @details  Pushes the sample onto the front of the history, dropping the oldest once the history
+///           holds order + 1 samples.  The caller is responsible for only adding frames newer than
+///           the latest in the history.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfPredictor::addSample(const unsigned int frame, const double value)
+{
+    for (unsigned int i = MAX_ORDER; i > 0; --i) {
+        mFrames[i] = mFrames[i-1];
+        mValues[i] = mValues[i-1];
+    }
+    mFrames[0] = frame;
+    mValues[0] = value;
+    mNumSamples = std::min(mNumSamples + 1, mOrder + 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  frame  (--)  Other side's frame count to predict the value at.
+///
+/// @returns  double  (--)  The predicted value, or zero if the history is empty.
+///
+/// @details  Evaluates the Lagrange polynomial through the samples in the history at the given
+///           frame.  Until the history fills, this uses a lower order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidDistributedIfPredictor::predict(const unsigned int frame) const
+{
+    /// - Frames are relative to the newest sample to keep the products small.
+    const double x = static_cast<double>(frame) - static_cast<double>(mFrames[0]);
+    double result = 0.0;
+    for (unsigned int i = 0; i < mNumSamples; ++i) {
+        const double xi = static_cast<double>(mFrames[i]) - static_cast<double>(mFrames[0]);
+        double basis = 1.0;
+        for (unsigned int j = 0; j < mNumSamples; ++j) {
+            if (j != i) {
+                const double xj = static_cast<double>(mFrames[j]) - static_cast<double>(mFrames[0]);
+                basis *= (x - xj) / (xi - xj);
+            }
+        }
+        result += basis * mValues[i];
+    }
+    return result;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] name          (--)  Link name.
 /// @param[in] nodes         (--)  Network nodes array.
@@ -246,7 +337,9 @@ GunnsFluidDistributedIfConfigData::GunnsFluidDistributedIfConfigData(
     mDemandFilterConstB(0.75),
     mFluidSizesOverride(false),
     mNumFluidOverride(0),
-    mNumTcOverride(0)
+    mNumTcOverride(0),
+    mPredictorOrder(0),
+    mCorrectorFrames(4)
 {
     // nothing to do
 }
@@ -334,7 +427,20 @@ GunnsFluidDistributedIf::GunnsFluidDistributedIf()
     mTempMoleFractions     (0),
     mTempTcMoleFractions   (0),
     mOtherIfs              (),
-    mFluidState            ()
+    mFluidState            (),
+    mTransport             (0),
+    mPredictorOrder        (0),
+    mCorrectorFrames       (0),
+    mSourcePredictor       (),
+    mEnergyPredictor       (),
+    mPredictorSettledFrame (0),
+    mPredictorNextFrame    (0),
+    mPredictorNumPending   (0),
+    mPredictorPendingFrames(),
+    mPredictorPendingFlows (),
+    mPredictorDebt         (0.0),
+    mPredictorLost         (0.0),
+    mPredictorTimeStep     (0.0)
 {
     // nothing to do
 }
@@ -384,6 +490,8 @@ void GunnsFluidDistributedIf::initialize(const GunnsFluidDistributedIfConfigData
     mModingCapacitanceRatio = configData.mModingCapacitanceRatio;
     mDemandFilterConstA     = configData.mDemandFilterConstA;
     mDemandFilterConstB     = configData.mDemandFilterConstB;
+    mPredictorOrder         = configData.mPredictorOrder;
+    mCorrectorFrames        = configData.mCorrectorFrames;
 
     /// - Initialize from input data.
     mForceDemandMode = inputData.mForceDemandMode;
@@ -432,6 +540,11 @@ void GunnsFluidDistributedIf::initialize(const GunnsFluidDistributedIfConfigData
     mLoopLatency           = 0;
     mDemandFluxGain        = 1.0;
     mSuppliedCapacitance   = 0.0;
+    mSourcePredictor.initialize(mPredictorOrder);
+    mEnergyPredictor.initialize(mPredictorOrder);
+    resetPredictor();
+    mPredictorLost         = 0.0;
+    mPredictorTimeStep     = 0.0;
 
     try {
         mFluidState.initializeName(mName + ".mFluidState");
@@ -480,6 +593,18 @@ void GunnsFluidDistributedIf::validate() const
         GUNNS_ERROR(TsInitializationException, "Invalid Input Data",
                     "both mode force flags are set.");
     }
+
+    /// - Throw on invalid predictor order.
+    if (mPredictorOrder > GunnsFluidDistributedIfPredictor::MAX_ORDER) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "predictor order > 2.");
+    }
+
+    /// - Throw on invalid corrector frames.
+    if (mCorrectorFrames < 1) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "corrector frames < 1.");
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -520,14 +645,24 @@ void GunnsFluidDistributedIf::restartModel()
     for (int i = 0; i < mNodes[0]->getFluidConfig()->mNTypes; ++i) {
         mTempMassFractions[i] = 0.0;
     }
+
+    /// - The predictor history isn't checkpointed, so start it over.  Any flow the corrector had
+    ///   yet to make up is moved to the lost total.
+    resetPredictor();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Pre-network step calculations.  Processes the incoming data from the external
-///           interface, flips modes and updates frame counters.
+///           interface, flips modes and updates frame counters.  If a transport is set, the
+///           incoming data is read from it first.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsFluidDistributedIf::processInputs()
 {
+    /// - Pull the latest data from the other side if we have our own transport.
+    if (mTransport) {
+        mTransport->read(mInData);
+    }
+
     /// - Mode changes and associated node volume update in response to incoming data.
     flipModesOnInput();
 
@@ -544,13 +679,16 @@ void GunnsFluidDistributedIf::processInputs()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]      pressure  (kPa)  Pressure to set the fluid to.
 /// @param[in,out]  fluid     (--)   Pointer to the PolyFluid object to be set.
+/// @param[in]      energy    (--)   Temperature (K) or specific enthalpy (J/kg) to set the fluid to.
 ///
 /// @returns  double (--) Sum of input bulk compound mole fractions, <= 1.
 ///
-/// @details  Copies the incoming fluid state from the other side of the interface (mInData) into
-///           the given fluid object and sets it to the given pressure.
+/// @details  Copies the incoming fluid mixture from the other side of the interface (mInData) into
+///           the given fluid object and sets it to the given pressure and energy.  The energy is
+///           normally mInData.mEnergy, or its predicted value.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-double GunnsFluidDistributedIf::inputFluid(const double pressure, PolyFluid* fluid)
+double GunnsFluidDistributedIf::inputFluid(const double pressure, PolyFluid* fluid,
+                                           const double energy)
 {
     /// - Normalize the incoming bulk mole fractions to sum to 1.  Internally, GUNNS sums the bulk
     ///   mole fractions to 1, and this doesn't include the trace compounds.  But the interface
@@ -578,9 +716,9 @@ double GunnsFluidDistributedIf::inputFluid(const double pressure, PolyFluid* flu
     fluid->setPressure(pressure);
 
     if (mUseEnthalpy) {
-        fluid->setTemperature(fluid->computeTemperature(mInData.mEnergy));
+        fluid->setTemperature(fluid->computeTemperature(energy));
     } else {
-        fluid->setTemperature(mInData.mEnergy);
+        fluid->setTemperature(energy);
     }
 
     if (mInData.mTcMoleFractions) {
@@ -618,8 +756,12 @@ void GunnsFluidDistributedIf::processInputsSupply()
             ///   internal GUNNS rate does not include the mole rate of the trace compounds.  The
             ///   inputFluid function returns the fraction of the bulk fluid compunds in the total,
             ///   which is our adjustment.
-            mDemandFlux = -mInData.mSource * UnitConversion::KILO_PER_UNIT
-                        * inputFluid(1.0, mInternalFluid);
+            double demandFlow = mInData.mSource;
+            if (mPredictorOrder > 0) {
+                demandFlow = predictDemandFlow();
+            }
+            mDemandFlux = -demandFlow * UnitConversion::KILO_PER_UNIT
+                        * inputFluid(1.0, mInternalFluid, mInData.mEnergy);
         }
     }
 }
@@ -631,9 +773,14 @@ void GunnsFluidDistributedIf::processInputsDemand()
 {
     if (mOutData.mDemandMode) {
         if (mInData.hasValidData() and not mInData.mDemandMode) {
+            double pressure = mInData.mSource;
+            double energy   = mInData.mEnergy;
+            if (mPredictorOrder > 0) {
+                predictSupplyState(pressure, energy);
+            }
             /// - Convert (Pa) to (kPa).
-            mSourcePressure = mInData.mSource * UnitConversion::KILO_PER_UNIT;
-            inputFluid(mSourcePressure, mNodes[0]->getContent());
+            mSourcePressure = pressure * UnitConversion::KILO_PER_UNIT;
+            inputFluid(mSourcePressure, mNodes[0]->getContent(), energy);
             mFluidState.setState(mNodes[0]->getContent());
         } else {
             /// - When we are in Demand mode but have not yet received Supply data from the other
@@ -643,6 +790,142 @@ void GunnsFluidDistributedIf::processInputsDemand()
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int  (--)  Number of frames to extrapolate the incoming data ahead.
+///
+/// @details  The incoming data is roughly half the loop latency old, so that's how far ahead the
+///           predictor extrapolates it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int GunnsFluidDistributedIf::getPredictionHorizon() const
+{
+    return static_cast<unsigned int>(MsMath::limitRange(0, mLoopLatency / 2,
+                                                        MAX_PREDICTION_FRAMES - 1));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out]  pressure  (Pa)  Incoming Supply pressure, replaced with its prediction.
+/// @param[in,out]  energy    (--)  Incoming Supply energy, replaced with its prediction.
+///
+/// @details  Adds new incoming Supply data to the predictor histories and extrapolates it ahead by
+///           the prediction horizon.  A predicted pressure or energy that isn't positive is
+///           ignored in favor of the incoming values.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIf::predictSupplyState(double& pressure, double& energy)
+{
+    /// - Start the history over when the other side's frame count goes backwards or jumps, such as
+    ///   when it restarts.
+    const unsigned int frame = mInData.mFrameCount;
+    const unsigned int newest = mSourcePredictor.getNewestFrame();
+    if (not mSourcePredictor.isEmpty() and
+            (frame < newest or frame - newest > MAX_PREDICTION_FRAMES)) {
+        resetPredictor();
+    }
+    if (mSourcePredictor.isEmpty() or frame > mSourcePredictor.getNewestFrame()) {
+        mSourcePredictor.addSample(frame, pressure);
+        mEnergyPredictor.addSample(frame, energy);
+    }
+
+    const unsigned int target = mSourcePredictor.getNewestFrame() + getPredictionHorizon();
+    const double predictedPressure = mSourcePredictor.predict(target);
+    const double predictedEnergy   = mEnergyPredictor.predict(target);
+    if (predictedPressure > 0.0 and predictedEnergy > 0.0) {
+        pressure = predictedPressure;
+        energy   = predictedEnergy;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double  (mol/s)  Demand flow to apply this frame.
+///
+/// @details  Adds new incoming Demand flow to the predictor history and reconciles it with the
+///           flows we've applied so far, then predicts the flow for the next Demand frame we
+///           haven't applied yet and adds a share of the unreconciled flow.
+///
+///           Each incoming Demand frame is owed exactly once, including frames we never received,
+///           which are interpolated from the history.  Each frame we apply is matched against the
+///           Demand frame it predicted once that arrives.  mPredictorDebt holds what is owed minus
+///           what was applied, summed over frames, and the corrector pays it off over
+///           mCorrectorFrames frames.  This assumes both sides run the same time step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidDistributedIf::predictDemandFlow()
+{
+    const unsigned int frame = mInData.mFrameCount;
+    if (not mSourcePredictor.isEmpty() and (frame < mSourcePredictor.getNewestFrame() or
+            frame - mPredictorSettledFrame > MAX_PREDICTION_FRAMES)) {
+        resetPredictor();
+    }
+
+    if (mSourcePredictor.isEmpty()) {
+        /// - The first frame after a reset is owed, and predictions start from it.
+        mSourcePredictor.addSample(frame, mInData.mSource);
+        mPredictorDebt        += mInData.mSource;
+        mPredictorSettledFrame = frame;
+        mPredictorNextFrame    = frame;
+    } else if (frame > mSourcePredictor.getNewestFrame()) {
+        /// - New data: owe every Demand frame since the last reconciled one, then settle the
+        ///   predictions made for them.
+        mSourcePredictor.addSample(frame, mInData.mSource);
+        for (unsigned int owed = mPredictorSettledFrame + 1; owed <= frame; ++owed) {
+            mPredictorDebt += mSourcePredictor.predict(owed);
+        }
+        unsigned int kept = 0;
+        for (unsigned int i = 0; i < mPredictorNumPending; ++i) {
+            if (mPredictorPendingFrames[i] <= frame) {
+                mPredictorDebt -= mPredictorPendingFlows[i];
+            } else {
+                mPredictorPendingFrames[kept] = mPredictorPendingFrames[i];
+                mPredictorPendingFlows[kept]  = mPredictorPendingFlows[i];
+                ++kept;
+            }
+        }
+        mPredictorNumPending   = kept;
+        mPredictorSettledFrame = frame;
+    }
+
+    /// - Predict the next Demand frame not yet applied, at least the horizon ahead of the latest
+    ///   data.  If the data stops coming and we run out of horizon, hold the last prediction; those
+    ///   frames aren't matched to any Demand frame so they are settled right away.
+    const unsigned int newest = mSourcePredictor.getNewestFrame();
+    const unsigned int target = std::max(newest + getPredictionHorizon(), mPredictorNextFrame);
+    double flow = 0.0;
+    if (target <= mPredictorSettledFrame) {
+        flow = mSourcePredictor.predict(target);
+        mPredictorDebt -= flow;
+        mPredictorNextFrame = target + 1;
+    } else if (target - newest < MAX_PREDICTION_FRAMES) {
+        flow = mSourcePredictor.predict(target);
+        mPredictorPendingFrames[mPredictorNumPending] = target;
+        mPredictorPendingFlows[mPredictorNumPending]  = flow;
+        ++mPredictorNumPending;
+        mPredictorNextFrame = target + 1;
+    } else {
+        flow = mSourcePredictor.predict(newest + MAX_PREDICTION_FRAMES - 1);
+        mPredictorDebt -= flow;
+    }
+
+    /// - Make up a share of the unreconciled flow.
+    const double correction = mPredictorDebt / mCorrectorFrames;
+    mPredictorDebt -= correction;
+    return flow + correction;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Empties the predictor histories and pending predictions.  Any flow the corrector had
+///           yet to make up is moved to the lost total.  Predictions pending at a mode flip are
+///           dropped along with the other side's flows for the same frames, and are part of the
+///           mode flip mass error already noted for this link.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIf::resetPredictor()
+{
+    mSourcePredictor.reset();
+    mEnergyPredictor.reset();
+    mPredictorLost        += mPredictorDebt;
+    mPredictorDebt         = 0.0;
+    mPredictorNumPending   = 0;
+    mPredictorSettledFrame = 0;
+    mPredictorNextFrame    = 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Handles mode flips in response to incoming data, and the initial mode flip at run
 ///           start.
@@ -703,6 +986,7 @@ void GunnsFluidDistributedIf::flipToDemandMode()
         mSupplyVolume = mNodes[0]->getVolume();
         mCapacitorLink->editVolume(true, 0.0);
         mFramesSinceFlip = 0;
+        resetPredictor();
         GUNNS_INFO("switched to Demand mode.")
     }
 }
@@ -719,6 +1003,7 @@ void GunnsFluidDistributedIf::flipToSupplyMode()
         mCapacitorLink->editVolume(true, mSupplyVolume);
         mSupplyVolume = 0.0;
         mFramesSinceFlip = 0;
+        resetPredictor();
         GUNNS_INFO("switched to Supply mode.")
     }
 }
@@ -726,7 +1011,8 @@ void GunnsFluidDistributedIf::flipToSupplyMode()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  End-of-network calculations.  Sets outputs data based on our current mode.  Calls to
 ///           check if its time to flip to Demand node from Supply mode based on relative
-///           capacitance, and updates the count of frames since the last mode flip.
+///           capacitance, and updates the count of frames since the last mode flip.  If a
+///           transport is set, the outgoing data is written to it last.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsFluidDistributedIf::processOutputs()
 {
@@ -737,6 +1023,11 @@ void GunnsFluidDistributedIf::processOutputs()
         flipModesOnCapacitance();
     }
     mFramesSinceFlip++;
+
+    /// - Push our data to the other side if we have our own transport.
+    if (mTransport) {
+        mTransport->write(mOutData);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -879,6 +1170,8 @@ void GunnsFluidDistributedIf::outputCapacitance()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsFluidDistributedIf::step(const double dt)
 {
+    mPredictorTimeStep = dt;
+
     /// - In Demand mode, conductance mirrors the Supply network capacitance: G = C/dt.  In Supply
     ///   mode, zero conductance blocks the Demand mode potential source effect.
     if (mOutData.mDemandMode and dt > DBL_EPSILON) {
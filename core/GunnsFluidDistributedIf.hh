@@ -26,6 +26,8 @@ LIBRARY DEPENDENCY:
 
 PROGRAMMERS:
 - ((Jason Harvey) (CACI) (2019-03) (Initial))
+- ((GUNNS Development Team) (CACI) (October 2026) (Optional transport for the interface data))
+- ((GUNNS Development Team) (CACI) (October 2026) (Latency predictor and mass corrector))
 
 @{
 */
@@ -73,6 +75,10 @@ class GunnsFluidDistributedIfData
         void getMoleFractions(double* fractions);
         /// @brief  Sets the given array to the interface trace compound mole fraction values.
         void getTcMoleFractions(double* fractions);
+        /// @brief  Returns the number of primary fluid compounds in the interface.
+        unsigned int getNumFluidIf() const;
+        /// @brief  Returns the number of trace compounds in the interface.
+        unsigned int getNumTcIf() const;
         /// @brief Assignment operator for this Fluid Distributed Interface interface data.
         GunnsFluidDistributedIfData& operator =(const GunnsFluidDistributedIfData& that);
 
@@ -89,8 +95,85 @@ class GunnsFluidDistributedIfData
         GunnsFluidDistributedIfData(const GunnsFluidDistributedIfData&);
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int  (--)  Number of primary fluid compounds in the interface.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned int GunnsFluidDistributedIfData::getNumFluidIf() const
+{
+    return mNumFluidIf;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int  (--)  Number of trace compounds in the interface.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned int GunnsFluidDistributedIfData::getNumTcIf() const
+{
+    return mNumTcIf;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Fluid Distributed Interface Predictor
+///
+/// @details  Keeps a short history of one value received from the other side of the interface,
+///           indexed by the other side's frame count, and extrapolates it to a later frame with a
+///           polynomial through the latest samples: order 0 holds the latest sample, order 1 is
+///           linear and order 2 is quadratic.  Frames inside the history are interpolated.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidDistributedIfPredictor
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsFluidDistributedIfPredictor);
+    public:
+        /// @brief Highest polynomial order supported.
+        enum {MAX_ORDER = 2};
+        /// @brief  Default constructs this Fluid Distributed Interface predictor.
+        GunnsFluidDistributedIfPredictor();
+        /// @brief  Default destructs this Fluid Distributed Interface predictor.
+        virtual ~GunnsFluidDistributedIfPredictor();
+        /// @brief  Sets the polynomial order and empties the history.
+        void initialize(const unsigned int order);
+        /// @brief  Empties the history.
+        void reset();
+        /// @brief  Adds a sample newer than the latest in the history.
+        void addSample(const unsigned int frame, const double value);
+        /// @brief  Returns the value predicted at the given frame.
+        double predict(const unsigned int frame) const;
+        /// @brief  Returns whether the history is empty.
+        bool isEmpty() const;
+        /// @brief  Returns the frame of the latest sample in the history.
+        unsigned int getNewestFrame() const;
+
+    protected:
+        unsigned int mOrder;                   /**< (--) trick_chkpnt_io(**) Polynomial order of the extrapolation. */
+        unsigned int mNumSamples;              /**< (--) trick_chkpnt_io(**) Number of samples in the history. */
+        unsigned int mFrames[MAX_ORDER + 1];   /**< (--) trick_chkpnt_io(**) Frames of the samples, newest first. */
+        double       mValues[MAX_ORDER + 1];   /**< (--) trick_chkpnt_io(**) Values of the samples, newest first. */
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsFluidDistributedIfPredictor(const GunnsFluidDistributedIfPredictor&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsFluidDistributedIfPredictor& operator =(const GunnsFluidDistributedIfPredictor&);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if there are no samples in the history.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsFluidDistributedIfPredictor::isEmpty() const
+{
+    return 0 == mNumSamples;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int  (--)  Frame of the latest sample, or zero if the history is empty.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned int GunnsFluidDistributedIfPredictor::getNewestFrame() const
+{
+    return mFrames[0];
+}
+
 // Forward declarations for pointer types
 class GunnsFluidCapacitor;
+class GunnsFluidDistributedIfTransport;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief    Fluid Distributed Interface Configuration Data
@@ -111,6 +194,8 @@ class GunnsFluidDistributedIfConfigData : public GunnsFluidLinkConfigData
         bool                 mFluidSizesOverride;     /**< (--) trick_chkpnt_io(**) Override of fluid mixture sizes is active. */
         unsigned int         mNumFluidOverride;       /**< (--) trick_chkpnt_io(**) Number of primary fluid compounds override value. */
         unsigned int         mNumTcOverride;          /**< (--) trick_chkpnt_io(**) Number of trace compounds override value. */
+        unsigned int         mPredictorOrder;         /**< (--) trick_chkpnt_io(**) Order of the incoming data predictor, 0 disables it. */
+        unsigned int         mCorrectorFrames;        /**< (--) trick_chkpnt_io(**) Number of frames the mass corrector spreads its correction over. */
         /// @brief Default constructs this Fluid Distributed Interface configuration data.
         GunnsFluidDistributedIfConfigData(
                 const std::string&   name           = "",
@@ -195,6 +280,14 @@ class GunnsFluidDistributedIfInputData : public GunnsFluidLinkInputData
 ///
 ///           Note that in interfaces with a large conductance, such as hatches, this works best
 ///           with a minLinearizationPotential of 1e-8 or less.
+///
+///           Optionally (mPredictorOrder > 0), the link extrapolates the incoming data ahead by half
+///           the loop latency, to make up for its age.  In Demand mode this predicts the Supply
+///           pressure and energy.  In Supply mode it predicts the Demand flow, and a corrector
+///           reconciles each predicted frame against the actual Demand flow when that arrives,
+///           feeding the difference back into later frames' flow over mCorrectorFrames frames.  The
+///           mass not yet made up, plus what was left over at mode flips and restarts, is reported
+///           by getConservationError.
 ///           \verbatim
 ///
 ///              Master-Side Network                                          Slave-Side Network
@@ -242,8 +335,16 @@ class GunnsFluidDistributedIf : public GunnsFluidLink
         double getSuppliedCapacitance() const;
         /// @brief Returns the node's network capacitance delta-potentials array.
         const double* getNetCapDeltaPotential() const;
+        /// @brief Sets the transport that moves the interface data to and from the other link.
+        void setTransport(GunnsFluidDistributedIfTransport* transport);
+        /// @brief Returns the round-trip loop data lag measured by the pair master.
+        int getLoopLatency() const;
+        /// @brief Returns the Supply side mass error accumulated by the predictor.
+        double getConservationError() const;
 
     protected:
+        /// @brief Furthest the predictor extrapolates ahead of the latest incoming frame.
+        enum {MAX_PREDICTION_FRAMES = 16};
         bool                        mIsPairMaster;           /**<    (--)       trick_chkpnt_io(**) This is the master of the link pair. */
         bool                        mUseEnthalpy;            /**<    (--)       trick_chkpnt_io(**) Transport energy as specific enthalpy instead of temperature. */
         bool                        mDemandOption;           /**<    (--)       trick_chkpnt_io(**) Demand mode option to trade stability for less restriction on flow rate. */
@@ -267,6 +368,19 @@ class GunnsFluidDistributedIf : public GunnsFluidLink
         double*                     mTempTcMoleFractions;    /**< ** (--)       trick_chkpnt_io(**) Scratch array for trace compound mole fraction adjustments. */
         std::vector<GunnsFluidDistributedIf*> mOtherIfs;     /**< ** (--)       trick_chkpnt_io(**) Vector of other similar links to avoid capacitance interference with. */
         PolyFluid                   mFluidState;             /**<    (--)       trick_chkpnt_io(**) Fluid state of the interface volume, for sensors. */
+        GunnsFluidDistributedIfTransport* mTransport;        /**< ** (--)       trick_chkpnt_io(**) Optional transport of the interface data. */
+        unsigned int                mPredictorOrder;         /**<    (--)       trick_chkpnt_io(**) Order of the incoming data predictor, 0 disables it. */
+        unsigned int                mCorrectorFrames;        /**<    (--)       trick_chkpnt_io(**) Number of frames the mass corrector spreads its correction over. */
+        GunnsFluidDistributedIfPredictor mSourcePredictor;   /**<    (--)       trick_chkpnt_io(**) Predictor of the incoming pressure or molar flow source. */
+        GunnsFluidDistributedIfPredictor mEnergyPredictor;   /**<    (--)       trick_chkpnt_io(**) Predictor of the incoming Supply energy. */
+        unsigned int                mPredictorSettledFrame;  /**<    (--)       trick_chkpnt_io(**) Latest incoming Demand frame reconciled by the corrector. */
+        unsigned int                mPredictorNextFrame;     /**<    (--)       trick_chkpnt_io(**) Earliest incoming Demand frame not yet predicted. */
+        unsigned int                mPredictorNumPending;    /**<    (--)       trick_chkpnt_io(**) Number of predicted Demand frames not yet reconciled. */
+        unsigned int                mPredictorPendingFrames[MAX_PREDICTION_FRAMES]; /**< (--) trick_chkpnt_io(**) Incoming Demand frames predicted and not yet reconciled. */
+        double                      mPredictorPendingFlows[MAX_PREDICTION_FRAMES];  /**< (mol/s) trick_chkpnt_io(**) Predicted Demand flows not yet reconciled. */
+        double                      mPredictorDebt;          /**<    (mol/s)    trick_chkpnt_io(**) Reconciled Demand flow not yet made up, summed over frames. */
+        double                      mPredictorLost;          /**<    (mol/s)    trick_chkpnt_io(**) Demand flow left unreconciled at resets, summed over frames. */
+        double                      mPredictorTimeStep;      /**<    (s)        trick_chkpnt_io(**) Time step of the last network step. */
         static const double         mNetworkCapacitanceFlux; /**< ** (kg*mol/s) trick_chkpnt_io(**) Flux value to use in network node capacitance calculations. */
         /// @brief Validates the initialization of this Gunns Fluid Distributed Interface.
         void validate() const;
@@ -285,7 +399,15 @@ class GunnsFluidDistributedIf : public GunnsFluidLink
         /// @brief Special processing of Demand mode data input.
         void processInputsDemand();
         /// @brief Copies incoming fluid state from the interface to the given fluid object.
-        double inputFluid(const double pressure, PolyFluid* fluid);
+        double inputFluid(const double pressure, PolyFluid* fluid, const double energy);
+        /// @brief Predicts the Supply pressure and energy from the incoming data in Demand mode.
+        void predictSupplyState(double& pressure, double& energy);
+        /// @brief Predicts and corrects the Demand flow from the incoming data in Supply mode.
+        double predictDemandFlow();
+        /// @brief Returns the number of frames to extrapolate the incoming data ahead.
+        unsigned int getPredictionHorizon() const;
+        /// @brief Resets the predictors and the corrector.
+        void resetPredictor();
         /// @brief Copies the given fluid object state to the outgoing interface.
         double outputFluid(PolyFluid* fluid);
         /// @brief Handles several mode flip cases based on input data.
@@ -344,4 +466,38 @@ inline const double* GunnsFluidDistributedIf::getNetCapDeltaPotential() const
     return mNodes[0]->getNetCapDeltaPotential();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  transport  (--)  The transport to use, or null to leave the data to the sim bus.
+///
+/// @details  Sets the transport that moves the interface data to and from the other link.  When
+///           set, mInData is read from the transport at the start of processInputs and mOutData is
+///           written to it at the end of processOutputs.  The link doesn't own the transport.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsFluidDistributedIf::setTransport(GunnsFluidDistributedIfTransport* transport)
+{
+    mTransport = transport;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int  (--)  Round-trip loop data lag in frames.
+///
+/// @details  Returns the value of mLoopLatency.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int GunnsFluidDistributedIf::getLoopLatency() const
+{
+    return mLoopLatency;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double  (mol)  Net Demand mass not matched by the Supply side.
+///
+/// @details  Returns the Demand flow the Supply side corrector has yet to make up, plus what it
+///           abandoned at mode flips and restarts, converted to moles at the last time step.
+///           Positive means the Demand side took more than the Supply side gave up.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double GunnsFluidDistributedIf::getConservationError() const
+{
+    return (mPredictorDebt + mPredictorLost) * mPredictorTimeStep;
+}
+
 #endif
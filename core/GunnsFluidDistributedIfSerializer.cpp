@@ -0,0 +1,404 @@
+/**
+@file
+@brief    GUNNS Fluid Distributed Interface Serializer implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   (
+    (core/GunnsFluidDistributedIf.o)
+   )
+*/
+
+#include "GunnsFluidDistributedIfSerializer.hh"
+#include "core/GunnsFluidDistributedIf.hh"
+#include "core/GunnsMacros.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+#include <cstring>
+
+const unsigned char GunnsFluidDistributedIfSerializer::VERSION     = 1;
+const unsigned int  GunnsFluidDistributedIfSerializer::HEADER_SIZE = 42;
+
+/// @details  Message magic number, "GF" in little-endian order.
+static const unsigned int SERIALIZER_MAGIC = 0x4647;
+/// @details  Full scale of the 32-bit fixed point mole fractions.
+static const double       QUANTIZE_SCALE   = 4294967295.0;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Fluid Distributed Interface Serializer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidDistributedIfSerializer::GunnsFluidDistributedIfSerializer()
+    :
+    mName(),
+    mNumFluid(0),
+    mNumTc(0),
+    mKeyFrameInterval(0),
+    mTxFramesSinceKey(0),
+    mTxForceKey(true),
+    mTxKeyFrame(0),
+    mTxTc(0),
+    mRxHasKey(false),
+    mRxKeyFrame(0),
+    mRxTc(0),
+    mRxMissedKeys(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Fluid Distributed Interface Serializer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidDistributedIfSerializer::~GunnsFluidDistributedIfSerializer()
+{
+    delete [] mRxTc;
+    delete [] mTxTc;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name             (--)  Instance name for messages.
+/// @param[in]  data             (--)  Initialized interface data, for the mixture sizes.
+/// @param[in]  keyFrameInterval (--)  Frames between trace compound key frames, at least 1.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Sizes the serializer for the interface mixtures and resets the key frame state, so
+///           the next packed message is a key frame.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfSerializer::initialize(const std::string&                 name,
+                                                   const GunnsFluidDistributedIfData& data,
+                                                   const unsigned int                 keyFrameInterval)
+{
+    mName = name;
+    if (data.getNumFluidIf() > 255 or data.getNumTcIf() > 255) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "interface mixtures have more than 255 compounds.");
+    }
+    if (keyFrameInterval < 1) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "key frame interval < 1.");
+    }
+    mNumFluid         = data.getNumFluidIf();
+    mNumTc            = data.getNumTcIf();
+    mKeyFrameInterval = keyFrameInterval;
+    mTxFramesSinceKey = 0;
+    mTxForceKey       = true;
+    mTxKeyFrame       = 0;
+    delete [] mTxTc;
+    delete [] mRxTc;
+    mTxTc = 0;
+    mRxTc = 0;
+    if (mNumTc > 0) {
+        mTxTc = new float[mNumTc];
+        mRxTc = new float[mNumTc];
+        for (unsigned int i = 0; i < mNumTc; ++i) {
+            mTxTc[i] = 0.0f;
+            mRxTc[i] = 0.0f;
+        }
+    }
+    mRxHasKey     = false;
+    mRxKeyFrame   = 0;
+    mRxMissedKeys = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int  (--)  The largest message size in bytes, for sizing buffers.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int GunnsFluidDistributedIfSerializer::getMaxSize() const
+{
+    return HEADER_SIZE + 4 * mNumFluid + maskSize() + 4 * mNumTc;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  fraction  (--)  Mole fraction, clamped to [0, 1].
+///
+/// @returns  unsigned int  (--)  The fraction in 32-bit fixed point.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int GunnsFluidDistributedIfSerializer::quantize(const double fraction)
+{
+    if (not (fraction > 0.0)) {
+        return 0;
+    } else if (fraction >= 1.0) {
+        return 0xFFFFFFFF;
+    }
+    return static_cast<unsigned int>(fraction * QUANTIZE_SCALE + 0.5);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  value  (--)  Mole fraction in 32-bit fixed point.
+///
+/// @returns  double  (--)  The mole fraction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidDistributedIfSerializer::dequantize(const unsigned int value)
+{
+    return value / QUANTIZE_SCALE;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  buffer  (--)  Buffer of at least getMaxSize() bytes.
+/// @param[in]   data    (--)  The outgoing interface data.
+///
+/// @returns  unsigned int  (--)  Size of the packed message in bytes.
+///
+/// @details  Packs the data.  Every mKeyFrameInterval messages, or when forced, all trace
+///           compounds are sent and remembered as the new key frame; otherwise only those whose
+///           float value differs from the key frame are sent.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int GunnsFluidDistributedIfSerializer::pack(unsigned char*                     buffer,
+                                                     const GunnsFluidDistributedIfData& data)
+{
+    const bool keyFrame = mTxForceKey or mTxFramesSinceKey + 1 >= mKeyFrameInterval;
+    if (keyFrame) {
+        mTxForceKey       = false;
+        mTxFramesSinceKey = 0;
+        mTxKeyFrame       = data.mFrameCount;
+    } else {
+        ++mTxFramesSinceKey;
+    }
+
+    unsigned char flags = 0;
+    if (data.mDemandMode) {
+        flags |= DEMAND_MODE;
+    }
+    if (keyFrame) {
+        flags |= TC_KEY_FRAME;
+    }
+
+    unsigned char* p = putU16(buffer, SERIALIZER_MAGIC);
+    *p++ = VERSION;
+    *p++ = flags;
+    *p++ = static_cast<unsigned char>(mNumFluid);
+    *p++ = static_cast<unsigned char>(mNumTc);
+    p = putU32(p, data.mFrameCount);
+    p = putU32(p, data.mFrameLoopback);
+    p = putU32(p, mTxKeyFrame);
+    p = putF64(p, data.mCapacitance);
+    p = putF64(p, data.mSource);
+    p = putF64(p, data.mEnergy);
+    for (unsigned int i = 0; i < mNumFluid; ++i) {
+        p = putU32(p, quantize(data.mMoleFractions[i]));
+    }
+
+    if (keyFrame) {
+        for (unsigned int i = 0; i < mNumTc; ++i) {
+            mTxTc[i] = static_cast<float>(data.mTcMoleFractions[i]);
+            p = putF32(p, mTxTc[i]);
+        }
+    } else if (mNumTc > 0) {
+        unsigned char* mask = p;
+        memset(mask, 0, maskSize());
+        p += maskSize();
+        for (unsigned int i = 0; i < mNumTc; ++i) {
+            const float value = static_cast<float>(data.mTcMoleFractions[i]);
+            if (value != mTxTc[i]) {
+                mask[i / 8] |= static_cast<unsigned char>(1 << (i % 8));
+                p = putF32(p, value);
+            }
+        }
+    }
+    return static_cast<unsigned int>(p - buffer);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  buffer     (--)  The received message.
+/// @param[in]  size       (--)  Size of the received message in bytes.
+/// @param[out] frameCount (--)  The message frame count, if valid.
+///
+/// @returns  bool  (--)  True if the message is complete and matches this interface.
+///
+/// @details  Checks the message magic, version, mixture sizes and length, without unpacking it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidDistributedIfSerializer::peek(const unsigned char* buffer,
+                                             const unsigned int   size,
+                                             unsigned int&        frameCount) const
+{
+    if (size < HEADER_SIZE or SERIALIZER_MAGIC != getU16(buffer) or VERSION != buffer[2]
+            or mNumFluid != buffer[4] or mNumTc != buffer[5]) {
+        return false;
+    }
+    unsigned int expected = HEADER_SIZE + 4 * mNumFluid;
+    if (buffer[3] & TC_KEY_FRAME) {
+        expected += 4 * mNumTc;
+    } else if (mNumTc > 0) {
+        expected += maskSize();
+        if (size < expected) {
+            return false;
+        }
+        const unsigned char* mask = buffer + HEADER_SIZE + 4 * mNumFluid;
+        for (unsigned int i = 0; i < mNumTc; ++i) {
+            if (mask[i / 8] & (1 << (i % 8))) {
+                expected += 4;
+            }
+        }
+    }
+    if (size != expected) {
+        return false;
+    }
+    frameCount = getU32(buffer + 6);
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  data    (--)  The incoming interface data, unchanged if the message is invalid.
+/// @param[in]   buffer  (--)  The received message.
+/// @param[in]   size    (--)  Size of the received message in bytes.
+///
+/// @returns  bool  (--)  True if the message was valid and unpacked.
+///
+/// @details  Unpacks the message into the data.  Trace compounds not in the message are restored
+///           from the copy of the key frame it refers to, since the sender only sends those that
+///           differ from it.  If that key frame wasn't received they keep whatever they had, which
+///           is counted, and are corrected at the next key frame.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidDistributedIfSerializer::unpack(GunnsFluidDistributedIfData& data,
+                                               const unsigned char*         buffer,
+                                               const unsigned int           size)
+{
+    unsigned int frameCount = 0;
+    if (not peek(buffer, size, frameCount)) {
+        return false;
+    }
+
+    const unsigned char  flags = buffer[3];
+    const unsigned char* p     = buffer + 6;
+    data.mFrameCount    = getU32(p);
+    data.mFrameLoopback = getU32(p + 4);
+    const unsigned int keyFrame = getU32(p + 8);
+    data.mCapacitance   = getF64(p + 12);
+    data.mSource        = getF64(p + 20);
+    data.mEnergy        = getF64(p + 28);
+    data.mDemandMode    = (0 != (flags & DEMAND_MODE));
+    p = buffer + HEADER_SIZE;
+    for (unsigned int i = 0; i < mNumFluid; ++i, p += 4) {
+        data.mMoleFractions[i] = dequantize(getU32(p));
+    }
+
+    if (flags & TC_KEY_FRAME) {
+        for (unsigned int i = 0; i < mNumTc; ++i, p += 4) {
+            mRxTc[i] = getF32(p);
+            data.mTcMoleFractions[i] = mRxTc[i];
+        }
+        mRxHasKey   = true;
+        mRxKeyFrame = keyFrame;
+    } else if (mNumTc > 0) {
+        const bool hasKey = mRxHasKey and keyFrame == mRxKeyFrame;
+        if (not hasKey) {
+            ++mRxMissedKeys;
+        }
+        const unsigned char* mask = p;
+        p += maskSize();
+        for (unsigned int i = 0; i < mNumTc; ++i) {
+            if (mask[i / 8] & (1 << (i % 8))) {
+                data.mTcMoleFractions[i] = getF32(p);
+                p += 4;
+            } else if (hasKey) {
+                data.mTcMoleFractions[i] = mRxTc[i];
+            }
+        }
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  p      (--)  Where to write.
+/// @param[in]   value  (--)  Value to write, low 16 bits.
+///
+/// @returns  unsigned char*  (--)  Position after the written bytes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned char* GunnsFluidDistributedIfSerializer::putU16(unsigned char* p, const unsigned int value)
+{
+    p[0] = static_cast<unsigned char>(value);
+    p[1] = static_cast<unsigned char>(value >> 8);
+    return p + 2;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  p      (--)  Where to write.
+/// @param[in]   value  (--)  Value to write.
+///
+/// @returns  unsigned char*  (--)  Position after the written bytes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned char* GunnsFluidDistributedIfSerializer::putU32(unsigned char* p, const unsigned int value)
+{
+    p[0] = static_cast<unsigned char>(value);
+    p[1] = static_cast<unsigned char>(value >> 8);
+    p[2] = static_cast<unsigned char>(value >> 16);
+    p[3] = static_cast<unsigned char>(value >> 24);
+    return p + 4;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  p      (--)  Where to write.
+/// @param[in]   value  (--)  Value to write.
+///
+/// @returns  unsigned char*  (--)  Position after the written bytes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned char* GunnsFluidDistributedIfSerializer::putF32(unsigned char* p, const float value)
+{
+    unsigned int bits = 0;
+    memcpy(&bits, &value, 4);
+    return putU32(p, bits);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  p      (--)  Where to write.
+/// @param[in]   value  (--)  Value to write.
+///
+/// @returns  unsigned char*  (--)  Position after the written bytes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned char* GunnsFluidDistributedIfSerializer::putF64(unsigned char* p, const double value)
+{
+    unsigned long long bits = 0;
+    memcpy(&bits, &value, 8);
+    p = putU32(p, static_cast<unsigned int>(bits));
+    return putU32(p, static_cast<unsigned int>(bits >> 32));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  p  (--)  Where to read.
+///
+/// @returns  unsigned int  (--)  The 16-bit value read.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int GunnsFluidDistributedIfSerializer::getU16(const unsigned char* p)
+{
+    return static_cast<unsigned int>(p[0]) | (static_cast<unsigned int>(p[1]) << 8);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  p  (--)  Where to read.
+///
+/// @returns  unsigned int  (--)  The 32-bit value read.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned int GunnsFluidDistributedIfSerializer::getU32(const unsigned char* p)
+{
+    return  static_cast<unsigned int>(p[0])        | (static_cast<unsigned int>(p[1]) << 8)
+         | (static_cast<unsigned int>(p[2]) << 16) | (static_cast<unsigned int>(p[3]) << 24);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  p  (--)  Where to read.
+///
+/// @returns  float  (--)  The float read.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+float GunnsFluidDistributedIfSerializer::getF32(const unsigned char* p)
+{
+    const unsigned int bits = getU32(p);
+    float value = 0.0f;
+    memcpy(&value, &bits, 4);
+    return value;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  p  (--)  Where to read.
+///
+/// @returns  double  (--)  The double read.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidDistributedIfSerializer::getF64(const unsigned char* p)
+{
+    const unsigned long long bits = static_cast<unsigned long long>(getU32(p))
+                                  | (static_cast<unsigned long long>(getU32(p + 4)) << 32);
+    double value = 0.0;
+    memcpy(&value, &bits, 8);
+    return value;
+}
@@ -0,0 +1,178 @@
+#ifndef GunnsFluidDistributedIfSerializer_EXISTS
+#define GunnsFluidDistributedIfSerializer_EXISTS
+
+/**
+@file
+@brief    GUNNS Fluid Distributed Interface Serializer declarations
+
+@defgroup  TSM_GUNNS_CORE_LINK_FLUID_DISTRIBUTED_IF_SERIALIZER    GUNNS Fluid Distributed Interface Serializer
+@ingroup   TSM_GUNNS_CORE_LINK_FLUID
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Packs GunnsFluidDistributedIfData into a compact, versioned wire format and back.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (Both sides have the same interface mixture sizes, at most 255 of each.)
+- (Bulk mole fractions are quantized to 32 bits over [0, 1], and trace compound mole fractions are
+   sent as 32-bit floats.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsFluidDistributedIfSerializer.o))
+
+PROGRAMMERS:
+- ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+
+@{
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <string>
+
+class GunnsFluidDistributedIfData;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Fluid Distributed Interface Serializer
+///
+/// @details  Packs GunnsFluidDistributedIfData into a packed little-endian message, independent of
+///           the host's byte order and structure layout, and unpacks it on the other side.  The
+///           message layout, version 1, is:
+///           \verbatim
+///             offset  size  field
+///                  0     2  magic "GF"
+///                  2     1  version
+///                  3     1  flags: bit 0 demand mode, bit 1 trace compound key frame
+///                  4     1  number of bulk fluid mole fractions, nF
+///                  5     1  number of trace compound mole fractions, nTc
+///                  6     4  frame count
+///                 10     4  frame loopback
+///                 14     4  frame count of the trace compound key frame this message refers to
+///                 18     8  capacitance (mol/Pa), IEEE double
+///                 26     8  source, IEEE double
+///                 34     8  energy, IEEE double
+///                 42  4*nF  bulk mole fractions, unsigned 32-bit fixed point over [0, 1]
+///           followed, in a key frame, by nTc 32-bit IEEE float trace compound mole fractions, or
+///           otherwise by a bit mask of (nTc + 7) / 8 bytes marking the trace compounds that
+///           differ from the key frame, followed by their 32-bit IEEE float values in order.
+///           \endverbatim
+///           Trace compounds change slowly and there can be many of them, so only those that
+///           changed since the last key frame are sent, with a full key frame every few frames.
+///           The receiver keeps its own copy of the last key frame it unpacked, and restores the
+///           unsent ones from it, so a trace compound that changes and then returns to its key frame
+///           value is restored too.  The values sent are absolute, so a receiver that missed the
+///           key frame still applies every value it gets and only keeps stale values for the unsent
+///           ones until the next key frame.
+///
+///           The frame count doubles as the message sequence number, so the transport can detect
+///           lost and out-of-order messages.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidDistributedIfSerializer
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsFluidDistributedIfSerializer);
+    public:
+        /// @brief Message flag bits.
+        enum Flags {
+            DEMAND_MODE  = 0x01, ///< The sender is in Demand mode.
+            TC_KEY_FRAME = 0x02  ///< The message has all trace compounds.
+        };
+        static const unsigned char VERSION;     /**< ** (--) trick_chkpnt_io(**) Message layout version. */
+        static const unsigned int  HEADER_SIZE; /**< ** (--) trick_chkpnt_io(**) Size of the fixed part of the message in bytes. */
+        /// @brief Default constructs this Fluid Distributed Interface Serializer.
+        GunnsFluidDistributedIfSerializer();
+        /// @brief Default destructs this Fluid Distributed Interface Serializer.
+        virtual ~GunnsFluidDistributedIfSerializer();
+        /// @brief Initializes the serializer for the given interface data sizes.
+        void initialize(const std::string&                 name,
+                        const GunnsFluidDistributedIfData& data,
+                        const unsigned int                 keyFrameInterval = 32);
+        /// @brief Returns the largest message size in bytes.
+        unsigned int getMaxSize() const;
+        /// @brief Packs the given data into the given buffer.
+        unsigned int pack(unsigned char* buffer, const GunnsFluidDistributedIfData& data);
+        /// @brief Validates the given message and returns its frame count.
+        bool peek(const unsigned char* buffer, const unsigned int size, unsigned int& frameCount) const;
+        /// @brief Unpacks the given message into the given data.
+        bool unpack(GunnsFluidDistributedIfData& data, const unsigned char* buffer,
+                    const unsigned int size);
+        /// @brief Forces the next packed message to be a trace compound key frame.
+        void forceKeyFrame();
+        /// @brief Returns the number of unpacked messages whose key frame wasn't received.
+        unsigned long getMissedKeyFrames() const;
+        /// @brief Quantizes a mole fraction to 32-bit fixed point.
+        static unsigned int quantize(const double fraction);
+        /// @brief Converts a 32-bit fixed point mole fraction back to double.
+        static double dequantize(const unsigned int value);
+
+    protected:
+        std::string   mName;             /**<    (--) trick_chkpnt_io(**) Instance name for messages. */
+        unsigned int  mNumFluid;         /**<    (--) trick_chkpnt_io(**) Number of bulk fluid mole fractions. */
+        unsigned int  mNumTc;            /**<    (--) trick_chkpnt_io(**) Number of trace compound mole fractions. */
+        unsigned int  mKeyFrameInterval; /**<    (--) trick_chkpnt_io(**) Frames between trace compound key frames. */
+        unsigned int  mTxFramesSinceKey; /**<    (--) trick_chkpnt_io(**) Packed messages since the last key frame. */
+        bool          mTxForceKey;       /**<    (--) trick_chkpnt_io(**) The next packed message is a key frame. */
+        unsigned int  mTxKeyFrame;       /**<    (--) trick_chkpnt_io(**) Frame count of the last packed key frame. */
+        float*        mTxTc;             /**< ** (--) trick_chkpnt_io(**) Trace compounds as of the last packed key frame. */
+        bool          mRxHasKey;         /**<    (--) trick_chkpnt_io(**) A key frame has been unpacked. */
+        unsigned int  mRxKeyFrame;       /**<    (--) trick_chkpnt_io(**) Frame count of the last unpacked key frame. */
+        float*        mRxTc;             /**< ** (--) trick_chkpnt_io(**) Trace compounds as of the last unpacked key frame. */
+        unsigned long mRxMissedKeys;     /**<    (--) trick_chkpnt_io(**) Unpacked messages whose key frame wasn't received. */
+        /// @brief Returns the size of the trace compound bit mask in bytes.
+        unsigned int maskSize() const;
+        /// @brief Writes a 16-bit value in little-endian order.
+        static unsigned char* putU16(unsigned char* p, const unsigned int value);
+        /// @brief Writes a 32-bit value in little-endian order.
+        static unsigned char* putU32(unsigned char* p, const unsigned int value);
+        /// @brief Writes a float in little-endian order.
+        static unsigned char* putF32(unsigned char* p, const float value);
+        /// @brief Writes a double in little-endian order.
+        static unsigned char* putF64(unsigned char* p, const double value);
+        /// @brief Reads a 16-bit value in little-endian order.
+        static unsigned int   getU16(const unsigned char* p);
+        /// @brief Reads a 32-bit value in little-endian order.
+        static unsigned int   getU32(const unsigned char* p);
+        /// @brief Reads a float in little-endian order.
+        static float          getF32(const unsigned char* p);
+        /// @brief Reads a double in little-endian order.
+        static double         getF64(const unsigned char* p);
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsFluidDistributedIfSerializer(const GunnsFluidDistributedIfSerializer&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsFluidDistributedIfSerializer& operator =(const GunnsFluidDistributedIfSerializer&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int  (--)  Size of the trace compound bit mask in bytes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned int GunnsFluidDistributedIfSerializer::maskSize() const
+{
+    return (mNumTc + 7) / 8;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Forces the next packed message to be a trace compound key frame, for instance when the
+///           transport knows the other side just connected.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void GunnsFluidDistributedIfSerializer::forceKeyFrame()
+{
+    mTxForceKey = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned long  (--)  Number of unpacked messages whose key frame wasn't received.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long GunnsFluidDistributedIfSerializer::getMissedKeyFrames() const
+{
+    return mRxMissedKeys;
+}
+
+#endif
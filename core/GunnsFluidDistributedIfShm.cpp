@@ -0,0 +1,353 @@
+/**
+@file
+@brief    GUNNS Fluid Distributed Interface Shared Memory Transport implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   (
+    (core/GunnsFluidDistributedIf.o)
+   )
+*/
+
+#include "GunnsFluidDistributedIfShm.hh"
+#include "core/GunnsFluidDistributedIf.hh"
+#include "core/GunnsMacros.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// @details  Identifies a GUNNS distributed interface segment, "GDIF".
+const unsigned int GunnsFluidDistributedIfShm::SHM_MAGIC      = 0x46494447;
+/// @details  Bump this when the segment layout changes.
+const unsigned int GunnsFluidDistributedIfShm::SHM_VERSION    = 1;
+/// @details  Keeps the two channels in separate cache lines so the writers don't contend.
+const unsigned int GunnsFluidDistributedIfShm::LINE_SIZE      = 64;
+/// @details  A write is a few hundred bytes at most, so this many retries is plenty.
+const int          GunnsFluidDistributedIfShm::MAX_READ_TRIES = 8;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Fluid Distributed Interface Shared Memory Transport.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidDistributedIfShm::GunnsFluidDistributedIfShm()
+    :
+    mName(),
+    mSegmentName(),
+    mIsPairMaster(false),
+    mFd(-1),
+    mSegment(0),
+    mSegmentSize(0),
+    mNumFluidIf(0),
+    mNumTcIf(0),
+    mOutChannel(0),
+    mInChannel(0),
+    mLastInSequence(0),
+    mScratch(0),
+    mWriteCount(0),
+    mReadCount(0),
+    mReadRetries(0),
+    mReadFailures(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Fluid Distributed Interface Shared Memory Transport.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidDistributedIfShm::~GunnsFluidDistributedIfShm()
+{
+    close();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  numFluid  (--)  Number of bulk fluid mole fractions in the interface.
+/// @param[in]  numTc     (--)  Number of trace compound mole fractions in the interface.
+///
+/// @returns  unsigned long  (--)  Size of the segment in bytes.
+///
+/// @details  The segment is a header line followed by the two channels, each starting on its own
+///           cache line.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+unsigned long GunnsFluidDistributedIfShm::computeSegmentSize(const unsigned int numFluid,
+                                                             const unsigned int numTc)
+{
+    const unsigned long channelSize = sizeof(GunnsFluidDistributedIfShmChannel)
+                                    + (numFluid + numTc) * sizeof(double);
+    const unsigned long channelLines = (channelSize + LINE_SIZE - 1) / LINE_SIZE;
+    return LINE_SIZE * (1 + 2 * channelLines);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name         (--)  Instance name for messages.
+/// @param[in]  segmentName  (--)  Name of the shared memory segment, starting with '/'.
+/// @param[in]  isPairMaster (--)  This is the master side of the link pair.
+/// @param[in]  data         (--)  Initialized interface data, for the mixture sizes.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Opens the named shared memory segment, creating it if the other side hasn't yet, and
+///           maps it.  The segment header is claimed by whichever side comes first and checked by
+///           the other, so both sides must have the same interface mixture sizes.  The channels are
+///           left as they are, so that a side re-initializing after a restart picks up the other
+///           side's latest data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfShm::initialize(const std::string&                 name,
+                                            const std::string&                 segmentName,
+                                            const bool                         isPairMaster,
+                                            const GunnsFluidDistributedIfData& data)
+{
+    unmap();
+    mName         = name;
+    mSegmentName  = segmentName;
+    mIsPairMaster = isPairMaster;
+    mNumFluidIf   = data.getNumFluidIf();
+    mNumTcIf      = data.getNumTcIf();
+
+    /// - Validate the segment name.  POSIX only guarantees portable behavior for names of the
+    ///   form "/name" with no other slashes.
+    if (segmentName.size() < 2 or '/' != segmentName[0]
+            or std::string::npos != segmentName.find('/', 1)) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "segment name must be a '/' followed by one or more non-'/' characters.");
+    }
+
+    /// - Open or create the segment, and size it if we created it.
+    const unsigned long size = computeSegmentSize(mNumFluidIf, mNumTcIf);
+    mFd = shm_open(segmentName.c_str(), O_CREAT | O_RDWR, 0600);
+    if (mFd < 0) {
+        GUNNS_ERROR(TsInitializationException, "Initialization Error",
+                    "shm_open failed for segment " + segmentName + ": " + strerror(errno));
+    }
+    struct stat status;
+    if (0 != fstat(mFd, &status)) {
+        const int error = errno;
+        unmap();
+        GUNNS_ERROR(TsInitializationException, "Initialization Error",
+                    "fstat failed for segment " + segmentName + ": " + strerror(error));
+    }
+    if (0 == status.st_size) {
+        if (0 != ftruncate(mFd, size)) {
+            const int error = errno;
+            unmap();
+            GUNNS_ERROR(TsInitializationException, "Initialization Error",
+                        "ftruncate failed for segment " + segmentName + ": " + strerror(error));
+        }
+    } else if (static_cast<unsigned long>(status.st_size) != size) {
+        unmap();
+        GUNNS_ERROR(TsInitializationException, "Initialization Error",
+                    "existing segment " + segmentName + " has the wrong size for these "
+                    "interface mixtures.");
+    }
+
+    /// - Map the segment.
+    void* segment = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0);
+    if (MAP_FAILED == segment) {
+        const int error = errno;
+        unmap();
+        GUNNS_ERROR(TsInitializationException, "Initialization Error",
+                    "mmap failed for segment " + segmentName + ": " + strerror(error));
+    }
+    mSegment     = static_cast<char*>(segment);
+    mSegmentSize = size;
+
+    /// - Claim or check the header.  The mixture sizes are stored + 1 so that zero means
+    ///   unclaimed.
+    if (not (claimHeaderWord(MAGIC,     SHM_MAGIC)       and
+             claimHeaderWord(VERSION,   SHM_VERSION)     and
+             claimHeaderWord(NUM_FLUID, mNumFluidIf + 1) and
+             claimHeaderWord(NUM_TC,    mNumTcIf + 1))) {
+        unmap();
+        GUNNS_ERROR(TsInitializationException, "Initialization Error",
+                    "existing segment " + segmentName + " doesn't match this interface.");
+    }
+
+    /// - Master writes channel 0 and reads channel 1, slave the reverse.
+    const unsigned long channelBytes = (size - LINE_SIZE) / 2;
+    GunnsFluidDistributedIfShmChannel* channel0 =
+            reinterpret_cast<GunnsFluidDistributedIfShmChannel*>(mSegment + LINE_SIZE);
+    GunnsFluidDistributedIfShmChannel* channel1 =
+            reinterpret_cast<GunnsFluidDistributedIfShmChannel*>(mSegment + LINE_SIZE + channelBytes);
+    if (mIsPairMaster) {
+        mOutChannel = channel0;
+        mInChannel  = channel1;
+    } else {
+        mOutChannel = channel1;
+        mInChannel  = channel0;
+    }
+
+    /// - Any data already in our incoming channel is stale from a previous run, so we only take
+    ///   data written from now on.  A write in progress leaves the sequence odd, so its completion
+    ///   still counts as new data.
+    mLastInSequence = mInChannel->mSequence & ~1u;
+    if (mNumFluidIf + mNumTcIf > 0) {
+        mScratch = new double[mNumFluidIf + mNumTcIf];
+    }
+    mWriteCount   = 0;
+    mReadCount    = 0;
+    mReadRetries  = 0;
+    mReadFailures = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  word   (--)  Which header word.
+/// @param[in]  value  (--)  Value this side expects, non-zero.
+///
+/// @returns  bool  (--)  True if the word was unclaimed or already had the given value.
+///
+/// @details  Sets the header word to the given value if it's still zero, atomically so the two
+///           sides can initialize at the same time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidDistributedIfShm::claimHeaderWord(const HeaderWords word, const unsigned int value)
+{
+    unsigned int* header = reinterpret_cast<unsigned int*>(mSegment);
+    const unsigned int previous = __sync_val_compare_and_swap(&header[word], 0u, value);
+    return 0 == previous or value == previous;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Unmaps and closes the segment.  The pair master also unlinks the segment name, so the
+///           segment is freed once the slave closes too.  Does nothing if not initialized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfShm::close()
+{
+    const bool unlink = mIsPairMaster and mFd >= 0;
+    unmap();
+    if (unlink) {
+        shm_unlink(mSegmentName.c_str());
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Unmaps and closes the segment without unlinking its name, so that re-initializing or
+///           failing to initialize doesn't pull the segment out from under the other side.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfShm::unmap()
+{
+    if (mSegment) {
+        munmap(mSegment, mSegmentSize);
+        mSegment     = 0;
+        mSegmentSize = 0;
+    }
+    if (mFd >= 0) {
+        ::close(mFd);
+        mFd = -1;
+    }
+    mOutChannel = 0;
+    mInChannel  = 0;
+    delete [] mScratch;
+    mScratch = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  data  (--)  The outgoing interface data.
+///
+/// @details  Copies the data into this side's channel under the seqlock.  This never waits, since
+///           this side is the channel's only writer.  Does nothing if not initialized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfShm::write(const GunnsFluidDistributedIfData& data)
+{
+    if (not mOutChannel) {
+        return;
+    }
+
+    /// - Odd sequence tells readers a write is in progress.
+    const unsigned int sequence = mOutChannel->mSequence;
+    mOutChannel->mSequence = sequence + 1;
+    __sync_synchronize();
+
+    mOutChannel->mFrameCount    = data.mFrameCount;
+    mOutChannel->mFrameLoopback = data.mFrameLoopback;
+    mOutChannel->mDemandMode    = data.mDemandMode;
+    mOutChannel->mCapacitance   = data.mCapacitance;
+    mOutChannel->mSource        = data.mSource;
+    mOutChannel->mEnergy        = data.mEnergy;
+    double* fractions = channelFractions(mOutChannel);
+    if (mNumFluidIf > 0) {
+        memcpy(fractions, data.mMoleFractions, mNumFluidIf * sizeof(double));
+    }
+    if (mNumTcIf > 0) {
+        memcpy(fractions + mNumFluidIf, data.mTcMoleFractions, mNumTcIf * sizeof(double));
+    }
+
+    __sync_synchronize();
+    mOutChannel->mSequence = sequence + 2;
+    ++mWriteCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  data  (--)  The incoming interface data, updated only if new data was read.
+///
+/// @returns  bool  (--)  True if new data was read.
+///
+/// @details  Copies the other side's channel under the seqlock.  The copy goes to scratch storage
+///           first and is only committed to the given data once the sequence shows it wasn't torn
+///           by a concurrent write.  After MAX_READ_TRIES torn copies the read gives up, leaving
+///           the data as it was, and the new data is picked up on the next read.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidDistributedIfShm::read(GunnsFluidDistributedIfData& data)
+{
+    if (not mInChannel) {
+        return false;
+    }
+
+    const double* fractions = channelFractions(mInChannel);
+    const unsigned int numFractions = mNumFluidIf + mNumTcIf;
+    for (int tries = 0; tries < MAX_READ_TRIES; ++tries) {
+        const unsigned int sequence = mInChannel->mSequence;
+        if (sequence == mLastInSequence) {
+            return false;
+        }
+        if (0 == (sequence & 1u)) {
+            __sync_synchronize();
+            const unsigned int frameCount    = mInChannel->mFrameCount;
+            const unsigned int frameLoopback = mInChannel->mFrameLoopback;
+            const int          demandMode    = mInChannel->mDemandMode;
+            const double       capacitance   = mInChannel->mCapacitance;
+            const double       source        = mInChannel->mSource;
+            const double       energy        = mInChannel->mEnergy;
+            if (numFractions > 0) {
+                memcpy(mScratch, fractions, numFractions * sizeof(double));
+            }
+            __sync_synchronize();
+            if (sequence == mInChannel->mSequence) {
+                data.mFrameCount    = frameCount;
+                data.mFrameLoopback = frameLoopback;
+                data.mDemandMode    = (0 != demandMode);
+                data.mCapacitance   = capacitance;
+                data.mSource        = source;
+                data.mEnergy        = energy;
+                if (mNumFluidIf > 0) {
+                    memcpy(data.mMoleFractions, mScratch, mNumFluidIf * sizeof(double));
+                }
+                if (mNumTcIf > 0) {
+                    memcpy(data.mTcMoleFractions, mScratch + mNumFluidIf,
+                           mNumTcIf * sizeof(double));
+                }
+                mLastInSequence = sequence;
+                ++mReadCount;
+                return true;
+            }
+        }
+        ++mReadRetries;
+    }
+    ++mReadFailures;
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if the other side has completed a write that hasn't been read.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidDistributedIfShm::isDataPending()
+{
+    if (not mInChannel) {
+        return false;
+    }
+    const unsigned int sequence = mInChannel->mSequence;
+    return sequence != mLastInSequence and 0 == (sequence & 1u);
+}
@@ -0,0 +1,209 @@
+#ifndef GunnsFluidDistributedIfShm_EXISTS
+#define GunnsFluidDistributedIfShm_EXISTS
+
+/**
+@file
+@brief    GUNNS Fluid Distributed Interface Shared Memory Transport declarations
+
+@defgroup  TSM_GUNNS_CORE_LINK_FLUID_DISTRIBUTED_IF_SHM    GUNNS Fluid Distributed Interface Shared Memory Transport
+@ingroup   TSM_GUNNS_CORE_LINK_FLUID
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Moves GunnsFluidDistributedIfData between paired links in separate processes on the same host
+   through a POSIX shared memory segment.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (Both processes run on the same host and use the same byte order and structure layout.)
+- (Each direction has exactly one writer, the link on that side of the pair.)
+- (Older glibc versions need the program linked with -lrt for shm_open.)
+- (A segment left behind by a crashed pair master is reused if its size matches, and otherwise
+   must be removed from /dev/shm by hand.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsFluidDistributedIfShm.o))
+
+PROGRAMMERS:
+- ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+
+@{
+*/
+
+#include "core/GunnsFluidDistributedIfTransport.hh"
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Fluid Distributed Interface Shared Memory Channel
+///
+/// @details  The fixed part of one direction of the interface data in the shared memory segment.
+///           The bulk and trace compound mole fractions follow it in the segment.  The sequence
+///           number is odd while the writer is updating the channel and even otherwise.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct GunnsFluidDistributedIfShmChannel
+{
+    volatile unsigned int mSequence;      /**< (--) Seqlock sequence number, odd during a write. */
+    unsigned int          mFrameCount;    /**< (--) Frame count driven by the writing side. */
+    unsigned int          mFrameLoopback; /**< (--) Frame count driven by the reading side, echoed back. */
+    int                   mDemandMode;    /**< (--) Demand mode flag. */
+    double                mCapacitance;   /**< (mol/Pa) Network capacitance. */
+    double                mSource;        /**< (--) Fluid pressure (Pa) or molar flow (mol/s). */
+    double                mEnergy;        /**< (--) Fluid temperature (K) or specific enthalpy (J/kg). */
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Fluid Distributed Interface Shared Memory Transport
+///
+/// @details  This transport places both directions of a GunnsFluidDistributedIf link pair's
+///           interface data in one POSIX shared memory segment, so that networks running in
+///           separate processes on the same host exchange data every frame without the sim bus or
+///           Trick variable server.  With both processes stepping in lockstep, the loop latency
+///           measured by the pair master drops to one frame.
+///
+///           Each direction is a channel guarded by a seqlock: the writer makes the sequence odd,
+///           copies the data and makes it even again, and the reader copies the data and retries
+///           if the sequence was odd or changed during the copy.  Neither side ever blocks.  A read
+///           that can't get a consistent copy in a few tries keeps the last good data and is
+///           counted as a failure.
+///
+///           Both sides initialize with the same segment name; whichever comes first creates the
+///           segment.  The master writes channel 0 and reads channel 1, the slave the reverse.
+///           The segment header records the interface mixture sizes, and a side whose sizes don't
+///           match is rejected.  The pair master unlinks the segment name when closed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidDistributedIfShm : public GunnsFluidDistributedIfTransport
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsFluidDistributedIfShm);
+    public:
+        /// @brief Default constructs this Fluid Distributed Interface Shared Memory Transport.
+        GunnsFluidDistributedIfShm();
+        /// @brief Default destructs this Fluid Distributed Interface Shared Memory Transport.
+        virtual ~GunnsFluidDistributedIfShm();
+        /// @brief Opens and maps the shared memory segment.
+        void initialize(const std::string&                 name,
+                        const std::string&                 segmentName,
+                        const bool                         isPairMaster,
+                        const GunnsFluidDistributedIfData& data);
+        /// @brief Unmaps and closes the shared memory segment.
+        void close();
+        /// @brief Writes the given data to this side's outgoing channel.
+        virtual void write(const GunnsFluidDistributedIfData& data);
+        /// @brief Reads the latest data from the other side's channel.
+        virtual bool read(GunnsFluidDistributedIfData& data);
+        /// @brief Returns whether the other side has written data that hasn't been read yet.
+        virtual bool isDataPending();
+        /// @brief Returns whether the segment is mapped.
+        bool isInitialized() const;
+        /// @brief Returns the number of writes.
+        unsigned long getWriteCount() const;
+        /// @brief Returns the number of reads that got new data.
+        unsigned long getReadCount() const;
+        /// @brief Returns the number of read retries due to concurrent writes.
+        unsigned long getReadRetries() const;
+        /// @brief Returns the number of reads that couldn't get a consistent copy.
+        unsigned long getReadFailures() const;
+
+    protected:
+        /// @brief Segment header word indexes.
+        enum HeaderWords {
+            MAGIC     = 0, ///< Identifies the segment.
+            VERSION   = 1, ///< Layout version.
+            NUM_FLUID = 2, ///< Number of bulk fluid mole fractions + 1.
+            NUM_TC    = 3  ///< Number of trace compound mole fractions + 1.
+        };
+        std::string                        mName;           /**<    (--) trick_chkpnt_io(**) Instance name for messages. */
+        std::string                        mSegmentName;    /**<    (--) trick_chkpnt_io(**) Name of the shared memory segment. */
+        bool                               mIsPairMaster;   /**<    (--) trick_chkpnt_io(**) This is the master side of the pair. */
+        int                                mFd;             /**<    (--) trick_chkpnt_io(**) Shared memory file descriptor. */
+        char*                              mSegment;        /**< ** (--) trick_chkpnt_io(**) Mapped shared memory segment. */
+        unsigned long                      mSegmentSize;    /**<    (--) trick_chkpnt_io(**) Size of the mapped segment in bytes. */
+        unsigned int                       mNumFluidIf;     /**<    (--) trick_chkpnt_io(**) Number of bulk fluid mole fractions in the interface. */
+        unsigned int                       mNumTcIf;        /**<    (--) trick_chkpnt_io(**) Number of trace compound mole fractions in the interface. */
+        GunnsFluidDistributedIfShmChannel* mOutChannel;     /**< ** (--) trick_chkpnt_io(**) Channel written by this side. */
+        GunnsFluidDistributedIfShmChannel* mInChannel;      /**< ** (--) trick_chkpnt_io(**) Channel written by the other side. */
+        unsigned int                       mLastInSequence; /**<    (--) trick_chkpnt_io(**) Sequence of the last channel data read. */
+        double*                            mScratch;        /**< ** (--) trick_chkpnt_io(**) Scratch copy of the incoming mole fractions. */
+        unsigned long                      mWriteCount;     /**<    (--) trick_chkpnt_io(**) Number of writes. */
+        unsigned long                      mReadCount;      /**<    (--) trick_chkpnt_io(**) Number of reads that got new data. */
+        unsigned long                      mReadRetries;    /**<    (--) trick_chkpnt_io(**) Number of read retries due to concurrent writes. */
+        unsigned long                      mReadFailures;   /**<    (--) trick_chkpnt_io(**) Number of reads that couldn't get a consistent copy. */
+        static const unsigned int          SHM_MAGIC;       /**< ** (--) trick_chkpnt_io(**) Segment header magic number. */
+        static const unsigned int          SHM_VERSION;     /**< ** (--) trick_chkpnt_io(**) Segment layout version. */
+        static const unsigned int          LINE_SIZE;       /**< ** (--) trick_chkpnt_io(**) Alignment of the header and channels, a cache line. */
+        static const int                   MAX_READ_TRIES;  /**< ** (--) trick_chkpnt_io(**) Maximum read attempts before giving up. */
+        /// @brief Returns the segment size for the given mixture sizes.
+        static unsigned long computeSegmentSize(const unsigned int numFluid, const unsigned int numTc);
+        /// @brief Checks or claims a segment header word.
+        bool claimHeaderWord(const HeaderWords word, const unsigned int value);
+        /// @brief Unmaps and closes the segment without unlinking it.
+        void unmap();
+        /// @brief Returns the mole fractions array following the given channel.
+        double* channelFractions(GunnsFluidDistributedIfShmChannel* channel) const;
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsFluidDistributedIfShm(const GunnsFluidDistributedIfShm&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsFluidDistributedIfShm& operator =(const GunnsFluidDistributedIfShm&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if the segment is mapped.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsFluidDistributedIfShm::isInitialized() const
+{
+    return 0 != mSegment;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned long  (--)  The number of writes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long GunnsFluidDistributedIfShm::getWriteCount() const
+{
+    return mWriteCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned long  (--)  The number of reads that got new data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long GunnsFluidDistributedIfShm::getReadCount() const
+{
+    return mReadCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned long  (--)  The number of read retries due to concurrent writes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long GunnsFluidDistributedIfShm::getReadRetries() const
+{
+    return mReadRetries;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned long  (--)  The number of reads that couldn't get a consistent copy.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned long GunnsFluidDistributedIfShm::getReadFailures() const
+{
+    return mReadFailures;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  channel  (--)  The channel in the segment.
+///
+/// @returns  double*  (--)  The bulk mole fractions, followed by the trace compound mole fractions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double* GunnsFluidDistributedIfShm::channelFractions(
+        GunnsFluidDistributedIfShmChannel* channel) const
+{
+    return reinterpret_cast<double*>(channel + 1);
+}
+
+#endif
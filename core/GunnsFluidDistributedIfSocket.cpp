@@ -0,0 +1,599 @@
+/**
+@file
+@brief    GUNNS Fluid Distributed Interface Socket Transport implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   (
+    (core/GunnsFluidDistributedIf.o)
+    (core/GunnsFluidDistributedIfSerializer.o)
+   )
+*/
+
+#include "GunnsFluidDistributedIfSocket.hh"
+#include "core/GunnsFluidDistributedIf.hh"
+#include "core/GunnsMacros.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/// @details  Enough queued messages to ride out a brief stall without building up stale data.
+const unsigned int GunnsFluidDistributedIfSocket::MAX_TX_QUEUE = 8;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs these statistics.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidDistributedIfSocketStats::GunnsFluidDistributedIfSocketStats()
+    :
+    mMessagesSent(0),
+    mMessagesReceived(0),
+    mBytesSent(0),
+    mBytesReceived(0),
+    mMessagesLost(0),
+    mMessagesLate(0),
+    mMessagesInvalid(0),
+    mSendDrops(0),
+    mTxBandwidth(0.0),
+    mRxBandwidth(0.0),
+    mLoopFrames(0),
+    mRoundTripSamples(0),
+    mRoundTripLast(0.0),
+    mRoundTripMin(0.0),
+    mRoundTripMax(0.0),
+    mRoundTripAvg(0.0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs these statistics.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidDistributedIfSocketStats::~GunnsFluidDistributedIfSocketStats()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Resets all statistics to zero.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfSocketStats::reset()
+{
+    mMessagesSent     = 0;
+    mMessagesReceived = 0;
+    mBytesSent        = 0;
+    mBytesReceived    = 0;
+    mMessagesLost     = 0;
+    mMessagesLate     = 0;
+    mMessagesInvalid  = 0;
+    mSendDrops        = 0;
+    mTxBandwidth      = 0.0;
+    mRxBandwidth      = 0.0;
+    mLoopFrames       = 0;
+    mRoundTripSamples = 0;
+    mRoundTripLast    = 0.0;
+    mRoundTripMin     = 0.0;
+    mRoundTripMax     = 0.0;
+    mRoundTripAvg     = 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Fluid Distributed Interface Socket Transport.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidDistributedIfSocket::GunnsFluidDistributedIfSocket()
+    :
+    mName(),
+    mProtocol(UDP),
+    mIsPairMaster(false),
+    mSocket(-1),
+    mListenSocket(-1),
+    mConnecting(false),
+    mHasPeer(false),
+    mLearnPeer(false),
+    mPeerAddress(),
+    mLocalPort(0),
+    mSerializer(),
+    mTxMessage(),
+    mTxQueue(),
+    mRxQueue(),
+    mHasRxFrame(false),
+    mLastRxFrame(0),
+    mLastTxFrame(0),
+    mTxTimes(),
+    mTxFrames(),
+    mTxTimed(),
+    mStatsWindow(1.0),
+    mWindowStart(0.0),
+    mWindowTxBytes(0),
+    mWindowRxBytes(0),
+    mStats()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Fluid Distributed Interface Socket Transport.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsFluidDistributedIfSocket::~GunnsFluidDistributedIfSocket()
+{
+    close();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double  (s)  Monotonic clock time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsFluidDistributedIfSocket::now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1.0e-9 * time.tv_nsec;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  name             (--)  Instance name for messages.
+/// @param[in]  data             (--)  Initialized interface data, for the mixture sizes.
+/// @param[in]  protocol         (--)  UDP or TCP.
+/// @param[in]  isPairMaster     (--)  This is the master side of the pair, the TCP listener.
+/// @param[in]  localPort        (--)  Local port to bind, or 0 for any.  The TCP master's listening
+///                                    port; not used by the TCP slave.
+/// @param[in]  remoteHost       (--)  Other side's host name or IPv4 address.  Optional for UDP,
+///                                    and not used by the TCP master.
+/// @param[in]  remotePort       (--)  Other side's port.
+/// @param[in]  keyFrameInterval (--)  Frames between trace compound key frames.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Opens and binds the UDP socket, opens the TCP master's listening socket, or starts the
+///           TCP slave's connection.  Resets the statistics.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfSocket::initialize(const std::string&                 name,
+                                               const GunnsFluidDistributedIfData& data,
+                                               const Protocols                    protocol,
+                                               const bool                         isPairMaster,
+                                               const unsigned int                 localPort,
+                                               const std::string&                 remoteHost,
+                                               const unsigned int                 remotePort,
+                                               const unsigned int                 keyFrameInterval)
+{
+    close();
+    mName         = name;
+    mProtocol     = protocol;
+    mIsPairMaster = isPairMaster;
+    mSerializer.initialize(name + ".mSerializer", data, keyFrameInterval);
+    mTxMessage.assign(mSerializer.getMaxSize() + 2, 0);
+    mHasRxFrame  = false;
+    mLastRxFrame = 0;
+    mLastTxFrame = 0;
+    for (unsigned int i = 0; i < 64; ++i) {
+        mTxTimes[i]  = 0.0;
+        mTxFrames[i] = 0;
+        mTxTimed[i]  = false;
+    }
+    mWindowStart   = now();
+    mWindowTxBytes = 0;
+    mWindowRxBytes = 0;
+    mStats.reset();
+
+    /// - Validate the addresses.
+    if (UDP != protocol and TCP != protocol) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "invalid protocol.");
+    }
+    if (localPort > 65535 or remotePort > 65535) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "port > 65535.");
+    }
+    const bool needsRemote = TCP == protocol and not isPairMaster;
+    const bool hasRemote   = not remoteHost.empty() and remotePort > 0;
+    if (needsRemote and not hasRemote) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                    "TCP slave needs the remote host and port.");
+    }
+    memset(&mPeerAddress, 0, sizeof(mPeerAddress));
+    if (hasRemote and not (TCP == protocol and isPairMaster)) {
+        struct addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        struct addrinfo* result = 0;
+        if (0 != getaddrinfo(remoteHost.c_str(), 0, &hints, &result) or 0 == result) {
+            GUNNS_ERROR(TsInitializationException, "Invalid Initialization Data",
+                        "can't resolve remote host " + remoteHost + ".");
+        }
+        memcpy(&mPeerAddress, result->ai_addr, sizeof(mPeerAddress));
+        freeaddrinfo(result);
+        mPeerAddress.sin_port = htons(static_cast<unsigned short>(remotePort));
+        mHasPeer = true;
+    }
+    mLearnPeer = UDP == protocol and not hasRemote;
+
+    /// - TCP slave connects to the master, finishing the connection later if it's in progress.
+    if (needsRemote) {
+        connectToMaster();
+        return;
+    }
+
+    /// - UDP socket or TCP listening socket, bound to the local port.
+    const int fd = socket(AF_INET, UDP == protocol ? SOCK_DGRAM : SOCK_STREAM, 0);
+    if (fd < 0) {
+        GUNNS_ERROR(TsInitializationException, "Initialization Error",
+                    std::string("socket failed: ") + strerror(errno));
+    }
+    if (UDP == protocol) {
+        mSocket = fd;
+    } else {
+        mListenSocket = fd;
+        const int reuse = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family      = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    local.sin_port        = htons(static_cast<unsigned short>(localPort));
+    if (0 != bind(fd, reinterpret_cast<struct sockaddr*>(&local), sizeof(local))
+            or (TCP == protocol and 0 != listen(fd, 1))) {
+        const int error = errno;
+        close();
+        GUNNS_ERROR(TsInitializationException, "Initialization Error",
+                    std::string("bind failed: ") + strerror(error));
+    }
+    socklen_t length = sizeof(local);
+    getsockname(fd, reinterpret_cast<struct sockaddr*>(&local), &length);
+    mLocalPort = ntohs(local.sin_port);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Closes the sockets and discards any queued data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfSocket::close()
+{
+    if (mSocket >= 0) {
+        ::close(mSocket);
+        mSocket = -1;
+    }
+    if (mListenSocket >= 0) {
+        ::close(mListenSocket);
+        mListenSocket = -1;
+    }
+    mConnecting = false;
+    mHasPeer    = false;
+    mLocalPort  = 0;
+    mTxQueue.clear();
+    mRxQueue.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Starts a non-blocking connection to the TCP pair master.  If it doesn't complete
+///           immediately, serviceConnection finishes it.  If it fails, it's retried on the next
+///           service.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfSocket::connectToMaster()
+{
+    mSocket = socket(AF_INET, SOCK_STREAM, 0);
+    if (mSocket < 0) {
+        return;
+    }
+    fcntl(mSocket, F_SETFL, fcntl(mSocket, F_GETFL, 0) | O_NONBLOCK);
+    const int noDelay = 1;
+    setsockopt(mSocket, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    if (0 == connect(mSocket, reinterpret_cast<struct sockaddr*>(&mPeerAddress),
+                     sizeof(mPeerAddress))) {
+        mConnecting = false;
+        mSerializer.forceKeyFrame();
+    } else if (EINPROGRESS == errno) {
+        mConnecting = true;
+    } else {
+        ::close(mSocket);
+        mSocket = -1;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  For TCP, the master accepts a waiting connection, and the slave starts or completes
+///           its connection.  A new connection starts with a trace compound key frame.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfSocket::serviceConnection()
+{
+    if (TCP != mProtocol) {
+        return;
+    }
+    if (mIsPairMaster) {
+        if (mSocket < 0 and mListenSocket >= 0) {
+            mSocket = accept(mListenSocket, 0, 0);
+            if (mSocket >= 0) {
+                fcntl(mSocket, F_SETFL, fcntl(mSocket, F_GETFL, 0) | O_NONBLOCK);
+                const int noDelay = 1;
+                setsockopt(mSocket, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+                mHasPeer = true;
+                mSerializer.forceKeyFrame();
+            }
+        }
+    } else if (mSocket < 0) {
+        connectToMaster();
+    } else if (mConnecting) {
+        struct pollfd poller;
+        poller.fd      = mSocket;
+        poller.events  = POLLOUT;
+        poller.revents = 0;
+        if (poll(&poller, 1, 0) > 0) {
+            int       error  = 0;
+            socklen_t length = sizeof(error);
+            getsockopt(mSocket, SOL_SOCKET, SO_ERROR, &error, &length);
+            if (0 == error) {
+                mConnecting = false;
+                mSerializer.forceKeyFrame();
+            } else {
+                dropConnection();
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Closes the TCP connection and discards its queued data.  The master waits for a new
+///           connection and the slave reconnects on the next service.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfSocket::dropConnection()
+{
+    if (mSocket >= 0) {
+        ::close(mSocket);
+        mSocket = -1;
+    }
+    mConnecting = false;
+    if (mIsPairMaster) {
+        mHasPeer = false;
+    }
+    mTxQueue.clear();
+    mRxQueue.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  data  (--)  The outgoing interface data.
+///
+/// @details  Packs and sends the data.  It's dropped and counted if there's no peer yet, the UDP
+///           send would block, or the TCP queue is full.  The send time is kept for the round trip
+///           measurement.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfSocket::write(const GunnsFluidDistributedIfData& data)
+{
+    serviceConnection();
+    if (not isConnected()) {
+        ++mStats.mSendDrops;
+        return;
+    }
+
+    const unsigned int size = mSerializer.pack(&mTxMessage[2], data);
+    bool sent = false;
+    if (UDP == mProtocol) {
+        const ssize_t result = sendto(mSocket, &mTxMessage[2], size, 0,
+                                      reinterpret_cast<struct sockaddr*>(&mPeerAddress),
+                                      sizeof(mPeerAddress));
+        sent = static_cast<ssize_t>(size) == result;
+    } else if (mTxQueue.size() + size + 2 <= MAX_TX_QUEUE * mTxMessage.size()) {
+        mTxMessage[0] = static_cast<unsigned char>(size);
+        mTxMessage[1] = static_cast<unsigned char>(size >> 8);
+        mTxQueue.insert(mTxQueue.end(), mTxMessage.begin(), mTxMessage.begin() + size + 2);
+        flush();
+        sent = true;
+    }
+
+    const double time = now();
+    if (sent) {
+        ++mStats.mMessagesSent;
+        mStats.mBytesSent += size;
+        mWindowTxBytes    += size;
+        mLastTxFrame = data.mFrameCount;
+        const unsigned int index = data.mFrameCount & 63;
+        mTxTimes[index]  = time;
+        mTxFrames[index] = data.mFrameCount;
+        mTxTimed[index]  = true;
+    } else {
+        ++mStats.mSendDrops;
+    }
+    updateBandwidth(time);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Sends as much of the queued TCP data as the socket takes without blocking.  An error
+///           drops the connection.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfSocket::flush()
+{
+    while (not mTxQueue.empty() and mSocket >= 0) {
+        const ssize_t result = send(mSocket, &mTxQueue[0], mTxQueue.size(), MSG_NOSIGNAL);
+        if (result > 0) {
+            mTxQueue.erase(mTxQueue.begin(), mTxQueue.begin() + result);
+        } else {
+            if (result < 0 and EAGAIN != errno and EWOULDBLOCK != errno) {
+                dropConnection();
+            }
+            break;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Moves everything the socket has received into the receive queue.  UDP datagrams are
+///           given the same 16-bit length framing as the TCP stream.  A UDP side with no configured
+///           remote address replies to the source of the latest datagram.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfSocket::receive()
+{
+    serviceConnection();
+    if (mSocket < 0 or mConnecting) {
+        return;
+    }
+    flush();
+
+    unsigned char buffer[4096];
+    for (;;) {
+        if (UDP == mProtocol) {
+            struct sockaddr_in source;
+            socklen_t length = sizeof(source);
+            const ssize_t size = recvfrom(mSocket, buffer, sizeof(buffer), 0,
+                                          reinterpret_cast<struct sockaddr*>(&source), &length);
+            if (size < 0) {
+                break;
+            }
+            if (mLearnPeer) {
+                mPeerAddress = source;
+                mHasPeer     = true;
+            }
+            mRxQueue.push_back(static_cast<unsigned char>(size));
+            mRxQueue.push_back(static_cast<unsigned char>(size >> 8));
+            mRxQueue.insert(mRxQueue.end(), buffer, buffer + size);
+        } else {
+            const ssize_t size = recv(mSocket, buffer, sizeof(buffer), 0);
+            if (size > 0) {
+                mRxQueue.insert(mRxQueue.end(), buffer, buffer + size);
+            } else {
+                if (0 == size or (EAGAIN != errno and EWOULDBLOCK != errno)) {
+                    dropConnection();
+                }
+                break;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if a complete message is waiting in the receive queue.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidDistributedIfSocket::isDataPending()
+{
+    receive();
+    if (mRxQueue.size() < 2) {
+        return false;
+    }
+    const unsigned int size = mRxQueue[0] | (mRxQueue[1] << 8);
+    return mRxQueue.size() >= size + 2;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  data  (--)  The incoming interface data, updated only if new data was received.
+///
+/// @returns  bool  (--)  True if a newer message was received.
+///
+/// @details  Takes every complete message in the receive queue, in order, keeping each that is
+///           newer than the last.  A TCP frame length that can't be a message means the stream is
+///           out of step, so the connection is dropped and made again.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidDistributedIfSocket::read(GunnsFluidDistributedIfData& data)
+{
+    receive();
+    const double time = now();
+    bool         taken = false;
+    unsigned int position = 0;
+    while (position + 2 <= mRxQueue.size()) {
+        const unsigned int size = mRxQueue[position] | (mRxQueue[position + 1] << 8);
+        if (TCP == mProtocol and (size < GunnsFluidDistributedIfSerializer::HEADER_SIZE
+                                  or size > mSerializer.getMaxSize())) {
+            ++mStats.mMessagesInvalid;
+            dropConnection();
+            position = 0;
+            break;
+        }
+        if (position + 2 + size > mRxQueue.size()) {
+            break;
+        }
+        taken   |= takeMessage(data, &mRxQueue[position + 2], size, time);
+        position += 2 + size;
+    }
+    mRxQueue.erase(mRxQueue.begin(), mRxQueue.begin() + position);
+    updateBandwidth(time);
+    return taken;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out]  data     (--)  The incoming interface data.
+/// @param[in]   message  (--)  The received message.
+/// @param[in]   size     (--)  Size of the message in bytes.
+/// @param[in]   time     (s)   Receive time.
+///
+/// @returns  bool  (--)  True if the message was newer and unpacked into the data.
+///
+/// @details  Uses the frame count as the sequence number.  A frame count of 0 after others means
+///           the other side restarted, so it starts a new sequence.  Updates the traffic and
+///           round trip statistics.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidDistributedIfSocket::takeMessage(GunnsFluidDistributedIfData& data,
+                                                const unsigned char*         message,
+                                                const unsigned int           size,
+                                                const double                 time)
+{
+    mStats.mBytesReceived += size;
+    mWindowRxBytes        += size;
+
+    unsigned int frameCount = 0;
+    if (not mSerializer.peek(message, size, frameCount)) {
+        ++mStats.mMessagesInvalid;
+        return false;
+    }
+    if (mHasRxFrame and 0 != frameCount) {
+        const int gap = static_cast<int>(frameCount - mLastRxFrame);
+        if (gap <= 0) {
+            ++mStats.mMessagesLate;
+            return false;
+        }
+        mStats.mMessagesLost += gap - 1;
+    }
+    mSerializer.unpack(data, message, size);
+    mHasRxFrame  = true;
+    mLastRxFrame = frameCount;
+    ++mStats.mMessagesReceived;
+
+    /// - Loopback 0 means the other side hadn't received anything from us yet.
+    const unsigned int loopback = data.mFrameLoopback;
+    if (0 != loopback) {
+        mStats.mLoopFrames = static_cast<int>(mLastTxFrame - loopback);
+        const unsigned int index = loopback & 63;
+        if (mTxTimed[index] and loopback == mTxFrames[index]) {
+            mTxTimed[index] = false;
+            const double roundTrip = time - mTxTimes[index];
+            ++mStats.mRoundTripSamples;
+            mStats.mRoundTripLast = roundTrip;
+            if (1 == mStats.mRoundTripSamples) {
+                mStats.mRoundTripMin = roundTrip;
+                mStats.mRoundTripMax = roundTrip;
+                mStats.mRoundTripAvg = roundTrip;
+            } else {
+                if (roundTrip < mStats.mRoundTripMin) {
+                    mStats.mRoundTripMin = roundTrip;
+                }
+                if (roundTrip > mStats.mRoundTripMax) {
+                    mStats.mRoundTripMax = roundTrip;
+                }
+                mStats.mRoundTripAvg += (roundTrip - mStats.mRoundTripAvg)
+                                      / mStats.mRoundTripSamples;
+            }
+        }
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  time  (s)  Current time.
+///
+/// @details  Updates the bandwidth statistics at the end of each statistics window.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidDistributedIfSocket::updateBandwidth(const double time)
+{
+    const double elapsed = time - mWindowStart;
+    if (elapsed > 0.0 and elapsed >= mStatsWindow) {
+        mStats.mTxBandwidth = mWindowTxBytes / elapsed;
+        mStats.mRxBandwidth = mWindowRxBytes / elapsed;
+        mWindowStart   = time;
+        mWindowTxBytes = 0;
+        mWindowRxBytes = 0;
+    }
+}
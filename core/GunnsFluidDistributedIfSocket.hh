@@ -0,0 +1,210 @@
+#ifndef GunnsFluidDistributedIfSocket_EXISTS
+#define GunnsFluidDistributedIfSocket_EXISTS
+
+/**
+@file
+@brief    GUNNS Fluid Distributed Interface Socket Transport declarations
+
+@defgroup  TSM_GUNNS_CORE_LINK_FLUID_DISTRIBUTED_IF_SOCKET    GUNNS Fluid Distributed Interface Socket Transport
+@ingroup   TSM_GUNNS_CORE_LINK_FLUID
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Moves GunnsFluidDistributedIfData between paired links on separate hosts over UDP or TCP, in
+   the GunnsFluidDistributedIfSerializer wire format.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (IPv4 only.)
+- (The sockets are non-blocking and serviced only from read, write and isDataPending, so a TCP
+   connection is only made while the link is being stepped.)
+- (UDP messages may be lost or reordered; lost messages are counted and late ones discarded.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsFluidDistributedIfSocket.o))
+
+PROGRAMMERS:
+- ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+
+@{
+*/
+
+#include "core/GunnsFluidDistributedIfSerializer.hh"
+#include "core/GunnsFluidDistributedIfTransport.hh"
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include <netinet/in.h>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Fluid Distributed Interface Socket Transport Statistics
+///
+/// @details  Traffic, bandwidth and latency statistics of one side of an interface pair.  The
+///           round trip time is from sending a frame to receiving a message from the other side
+///           that echoes that frame back in its loopback, so it includes the other side's frame
+///           time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidDistributedIfSocketStats
+{
+    public:
+        unsigned long mMessagesSent;      /**< (--)  Messages sent. */
+        unsigned long mMessagesReceived;  /**< (--)  Valid, in-order messages received. */
+        unsigned long mBytesSent;         /**< (--)  Message bytes sent, not counting framing and protocol headers. */
+        unsigned long mBytesReceived;     /**< (--)  Message bytes received, not counting framing and protocol headers. */
+        unsigned long mMessagesLost;      /**< (--)  Messages missing from the received frame count sequence. */
+        unsigned long mMessagesLate;      /**< (--)  Duplicate or out-of-order messages discarded. */
+        unsigned long mMessagesInvalid;   /**< (--)  Malformed or mismatched messages discarded. */
+        unsigned long mSendDrops;         /**< (--)  Messages not sent for lack of a peer, connection or buffer space. */
+        double        mTxBandwidth;       /**< (1/s) Bytes sent per second over the last statistics window. */
+        double        mRxBandwidth;       /**< (1/s) Bytes received per second over the last statistics window. */
+        int           mLoopFrames;        /**< (--)  Frames between our last sent frame and the frame the other side last echoed. */
+        unsigned long mRoundTripSamples;  /**< (--)  Number of round trip time samples. */
+        double        mRoundTripLast;     /**< (s)   Last round trip time. */
+        double        mRoundTripMin;      /**< (s)   Minimum round trip time. */
+        double        mRoundTripMax;      /**< (s)   Maximum round trip time. */
+        double        mRoundTripAvg;      /**< (s)   Average round trip time. */
+        /// @brief Default constructs these statistics.
+        GunnsFluidDistributedIfSocketStats();
+        /// @brief Default destructs these statistics.
+        virtual ~GunnsFluidDistributedIfSocketStats();
+        /// @brief Resets all statistics to zero.
+        void reset();
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Fluid Distributed Interface Socket Transport
+///
+/// @details  This transport sends a GunnsFluidDistributedIf link's outgoing data to the paired link
+///           in another process, usually on another host, and receives the paired link's data, over
+///           UDP datagrams or a TCP stream.  Messages are packed by GunnsFluidDistributedIfSerializer
+///           and, on TCP, framed with a 16-bit little-endian length.  The frame count in each
+///           message is its sequence number: the receiver keeps only messages newer than the last
+///           one it took, and counts the gaps as lost.  The frame loopback echoed by the other side
+///           gives the round trip time of our frames.
+///
+///           Over UDP each side binds its local port.  A side given no remote address replies to
+///           wherever the other side's messages come from.  Over TCP the pair master listens on its
+///           local port and accepts one connection, and the slave connects to it, reconnecting if
+///           the connection drops.  All socket calls are non-blocking.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidDistributedIfSocket : public GunnsFluidDistributedIfTransport
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsFluidDistributedIfSocket);
+    public:
+        /// @brief Socket protocols.
+        enum Protocols {
+            UDP = 0, ///< Datagrams, lowest latency, messages may be lost.
+            TCP = 1  ///< Stream, reliable, messages may queue behind a slow link.
+        };
+        /// @brief Default constructs this Fluid Distributed Interface Socket Transport.
+        GunnsFluidDistributedIfSocket();
+        /// @brief Default destructs this Fluid Distributed Interface Socket Transport.
+        virtual ~GunnsFluidDistributedIfSocket();
+        /// @brief Opens the socket.
+        void initialize(const std::string&                 name,
+                        const GunnsFluidDistributedIfData& data,
+                        const Protocols                    protocol,
+                        const bool                         isPairMaster,
+                        const unsigned int                 localPort,
+                        const std::string&                 remoteHost       = "",
+                        const unsigned int                 remotePort       = 0,
+                        const unsigned int                 keyFrameInterval = 32);
+        /// @brief Closes the sockets.
+        void close();
+        /// @brief Sends the given data to the other side.
+        virtual void write(const GunnsFluidDistributedIfData& data);
+        /// @brief Receives the latest data from the other side.
+        virtual bool read(GunnsFluidDistributedIfData& data);
+        /// @brief Returns whether a complete message from the other side is waiting.
+        virtual bool isDataPending();
+        /// @brief Returns the local port the socket is bound to.
+        unsigned int getLocalPort() const;
+        /// @brief Returns whether there is a peer to send to.
+        bool isConnected() const;
+        /// @brief Returns the statistics of this side of the pair.
+        const GunnsFluidDistributedIfSocketStats& getStats() const;
+
+    protected:
+        std::string                        mName;            /**<    (--) trick_chkpnt_io(**) Instance name for messages. */
+        Protocols                          mProtocol;        /**<    (--) trick_chkpnt_io(**) Socket protocol. */
+        bool                               mIsPairMaster;    /**<    (--) trick_chkpnt_io(**) This is the master side of the pair. */
+        int                                mSocket;          /**<    (--) trick_chkpnt_io(**) UDP socket or TCP connection. */
+        int                                mListenSocket;    /**<    (--) trick_chkpnt_io(**) TCP listening socket of the pair master. */
+        bool                               mConnecting;      /**<    (--) trick_chkpnt_io(**) TCP connect is in progress. */
+        bool                               mHasPeer;         /**<    (--) trick_chkpnt_io(**) The peer address is known. */
+        bool                               mLearnPeer;       /**<    (--) trick_chkpnt_io(**) Take the UDP peer address from received messages. */
+        struct sockaddr_in                 mPeerAddress;     /**< ** (--) trick_chkpnt_io(**) Peer IPv4 socket address. */
+        unsigned int                       mLocalPort;       /**<    (--) trick_chkpnt_io(**) Bound local port. */
+        GunnsFluidDistributedIfSerializer  mSerializer;      /**<    (--) trick_chkpnt_io(**) Message serializer. */
+        std::vector<unsigned char>         mTxMessage;       /**< ** (--) trick_chkpnt_io(**) Outgoing message buffer. */
+        std::vector<unsigned char>         mTxQueue;         /**< ** (--) trick_chkpnt_io(**) Framed TCP bytes waiting to be sent. */
+        std::vector<unsigned char>         mRxQueue;         /**< ** (--) trick_chkpnt_io(**) Received bytes, as length-framed messages. */
+        bool                               mHasRxFrame;      /**<    (--) trick_chkpnt_io(**) A message has been taken since initialization. */
+        unsigned int                       mLastRxFrame;     /**<    (--) trick_chkpnt_io(**) Frame count of the last message taken. */
+        unsigned int                       mLastTxFrame;     /**<    (--) trick_chkpnt_io(**) Frame count of the last message sent. */
+        double                             mTxTimes[64];     /**<    (s)  trick_chkpnt_io(**) Send times of recent frames, by frame count modulo 64. */
+        unsigned int                       mTxFrames[64];    /**<    (--) trick_chkpnt_io(**) Frame counts of the mTxTimes entries. */
+        bool                               mTxTimed[64];     /**<    (--) trick_chkpnt_io(**) The mTxTimes entry hasn't been echoed back yet. */
+        double                             mStatsWindow;     /**<    (s)  trick_chkpnt_io(**) Length of the bandwidth statistics window. */
+        double                             mWindowStart;     /**<    (s)  trick_chkpnt_io(**) Start time of the current bandwidth window. */
+        unsigned long                      mWindowTxBytes;   /**<    (--) trick_chkpnt_io(**) Bytes sent in the current bandwidth window. */
+        unsigned long                      mWindowRxBytes;   /**<    (--) trick_chkpnt_io(**) Bytes received in the current bandwidth window. */
+        GunnsFluidDistributedIfSocketStats mStats;           /**<    (--) trick_chkpnt_io(**) Statistics of this side of the pair. */
+        static const unsigned int          MAX_TX_QUEUE;     /**< ** (--) trick_chkpnt_io(**) Maximum queued TCP messages before dropping. */
+        /// @brief Starts the TCP connection to the pair master.
+        void connectToMaster();
+        /// @brief Accepts or completes the TCP connection.
+        void serviceConnection();
+        /// @brief Moves received bytes from the socket into the receive queue.
+        void receive();
+        /// @brief Sends as much of the TCP queue as the socket takes.
+        void flush();
+        /// @brief Closes the TCP connection after an error so it can be made again.
+        void dropConnection();
+        /// @brief Takes the given message if it's the newest, updating statistics.
+        bool takeMessage(GunnsFluidDistributedIfData& data, const unsigned char* message,
+                         const unsigned int size, const double now);
+        /// @brief Updates the bandwidth statistics.
+        void updateBandwidth(const double now);
+        /// @brief Returns the monotonic clock time.
+        static double now();
+
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        GunnsFluidDistributedIfSocket(const GunnsFluidDistributedIfSocket&);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        GunnsFluidDistributedIfSocket& operator =(const GunnsFluidDistributedIfSocket&);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  unsigned int  (--)  The bound local port, or the listening port of a TCP master.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline unsigned int GunnsFluidDistributedIfSocket::getLocalPort() const
+{
+    return mLocalPort;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if there is a known UDP peer or an established TCP connection.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool GunnsFluidDistributedIfSocket::isConnected() const
+{
+    return mHasPeer and mSocket >= 0 and not mConnecting;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  GunnsFluidDistributedIfSocketStats&  (--)  The statistics of this side of the pair.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline const GunnsFluidDistributedIfSocketStats& GunnsFluidDistributedIfSocket::getStats() const
+{
+    return mStats;
+}
+
+#endif
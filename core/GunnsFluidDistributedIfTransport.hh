@@ -0,0 +1,62 @@
+#ifndef GunnsFluidDistributedIfTransport_EXISTS
+#define GunnsFluidDistributedIfTransport_EXISTS
+
+/**
+@file
+@brief    GUNNS Fluid Distributed Interface Transport declarations
+
+@defgroup  TSM_GUNNS_CORE_LINK_FLUID_DISTRIBUTED_IF_TRANSPORT    GUNNS Fluid Distributed Interface Transport
+@ingroup   TSM_GUNNS_CORE_LINK_FLUID
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Interface for transports that move GunnsFluidDistributedIfData between the paired links.)
+
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (TBD)
+
+LIBRARY DEPENDENCY:
+- ()
+
+PROGRAMMERS:
+- ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+
+@{
+*/
+
+class GunnsFluidDistributedIfData;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Fluid Distributed Interface Transport
+///
+/// @details  Abstract interface for moving the GunnsFluidDistributedIfData between a pair of
+///           GunnsFluidDistributedIf links without going through the sim bus.  When a transport is
+///           given to the link with GunnsFluidDistributedIf::setTransport, the link reads its
+///           mInData from the transport at the start of processInputs and writes its mOutData to
+///           the transport at the end of processOutputs.
+///
+///           Implementations must not block in read or write, since they are called from the
+///           network step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsFluidDistributedIfTransport
+{
+    public:
+        /// @brief Default destructs this Fluid Distributed Interface Transport.
+        virtual ~GunnsFluidDistributedIfTransport() {}
+        /// @brief Sends the given data to the other side of the interface.
+        virtual void write(const GunnsFluidDistributedIfData& data) = 0;
+        /// @brief Copies the latest data from the other side of the interface into the given data.
+        virtual bool read(GunnsFluidDistributedIfData& data) = 0;
+        /// @brief Returns whether the other side has sent data that hasn't been read yet.
+        virtual bool isDataPending() = 0;
+};
+
+/// @}
+
+#endif
@@ -36,6 +36,7 @@ LIBRARY DEPENDENCY:
 #include <cfloat>
 
 #include "GunnsFluidLink.hh"
+#include "GunnsCheckpoint.hh"
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
 
@@ -178,6 +179,35 @@ void GunnsFluidLink::restartModel()
     GunnsBasicLink::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the mass and volumetric flow rates to the base link state.  The internal fluid is
+///           updated from the node contents each step, so it isn't written.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidLink::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsBasicLink::saveCheckpoint(writer);
+    writer.write(mFlowRate);
+    writer.write(mVolFlowRate);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidLink::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsBasicLink::loadCheckpoint(reader);
+    reader.read(mFlowRate);
+    reader.read(mVolFlowRate);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] forcedOutflow (--) Indicates that this flow is leaving the node, but changes the
 ///                               mixture of the node (by only flowing out certain constituents), so
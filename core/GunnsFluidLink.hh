@@ -128,6 +128,12 @@ class GunnsFluidLink : public GunnsBasicLink
                                         const int  fromPort = 0,
                                         const int  toPort   = 1);
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void     saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void     loadCheckpoint(GunnsCheckpointReader& reader);
+
     protected:
         /// @details  Pointer to the link internal fluid.  The internal fluid is optional - it is
         ///           only needed when a link needs to change the properties of the fluid passing
@@ -32,12 +32,14 @@ PROGRAMMERS:
     )
 */
 #include "GunnsFluidNode.hh"
+#include "GunnsCheckpoint.hh"
 #include "GunnsFluidUtils.hh"
 #include "properties/FluidProperties.hh"
 #include <cmath>
 #include <cfloat>
 #include "software/exceptions/TsInitializationException.hh"
 #include "software/exceptions/TsOutOfBoundsException.hh"
+#include "software/exceptions/TsParseException.hh"
 
 /// @details  In the computePressureCorrection method, we only apply the pressure correction if the
 ///           error is above this threshold, to avoid creating extra noise in the system.
@@ -280,6 +282,100 @@ void GunnsFluidNode::restart()
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the fluid contents to the base node state.  Of the contents, only temperature,
+///           pressure, mass, mass fractions and trace compounds are written; the other fluid
+///           properties are functions of these and are recomputed on load.  The mass error and
+///           pressure correction filter state are also written, so that restart sees the same mass
+///           error it would after a Trick checkpoint load.  Trick doesn't checkpoint the volume, but
+///           it is written here so that run-time volume edits, such as from a fluid capacitor, are
+///           rolled back with the contents instead of restart resetting the mass to the new volume.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidNode::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsBasicNode::saveCheckpoint(writer);
+
+    writer.write(mContent.getTemperature());
+    writer.write(mContent.getPressure());
+    writer.write(mContent.getMass());
+    writer.write(mNumFluidTypes);
+    for (int i = 0; i < mNumFluidTypes; ++i) {
+        writer.write(mContent.getMassFraction(i));
+    }
+
+    const GunnsFluidTraceCompounds* tc = mContent.getTraceCompounds();
+    const int numTc = tc ? tc->getConfig()->mNTypes : 0;
+    writer.write(numTc);
+    if (numTc > 0) {
+        writer.write(tc->getMasses(), numTc);
+        writer.write(tc->getMoleFractions(), numTc);
+    }
+
+    writer.write(mPreviousPressure);
+    writer.write(mPreviousTemperature);
+    writer.write(mMassError);
+    writer.write(mPressureCorrection);
+    writer.write(mCorrectGain);
+    writer.write(mVolume);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint.  The contents are rebuilt by setting
+///           composition & mass first, then pressure, then temperature, which recomputes the rest
+///           of the fluid properties from all three.  Throws if the stream's mixture sizes don't
+///           match this node's.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidNode::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsBasicNode::loadCheckpoint(reader);
+
+    double temperature = 0.0;
+    double pressure    = 0.0;
+    double mass        = 0.0;
+    int    numTypes    = 0;
+    reader.read(temperature);
+    reader.read(pressure);
+    reader.read(mass);
+    reader.read(numTypes);
+    if (numTypes != mNumFluidTypes) {
+        GUNNS_ERROR(TsParseException, "Invalid Checkpoint Stream",
+                    "checkpoint number of fluid types doesn't match the node.");
+    }
+    double fractions[FluidProperties::NO_FLUID];
+    reader.read(fractions, numTypes);
+    mContent.setMassAndMassFractions(mass, fractions);
+    mContent.setPressure(pressure);
+    mContent.setTemperature(temperature);
+
+    GunnsFluidTraceCompounds* tc = mContent.getTraceCompounds();
+    const int numTc = tc ? tc->getConfig()->mNTypes : 0;
+    int numTcIn = 0;
+    reader.read(numTcIn);
+    if (numTcIn != numTc) {
+        GUNNS_ERROR(TsParseException, "Invalid Checkpoint Stream",
+                    "checkpoint number of trace compounds doesn't match the node.");
+    }
+    if (numTc > 0) {
+        reader.read(tc->getMasses(), numTc);
+        reader.read(tc->getMoleFractions(), numTc);
+    }
+
+    reader.read(mPreviousPressure);
+    reader.read(mPreviousTemperature);
+    reader.read(mMassError);
+    reader.read(mPressureCorrection);
+    reader.read(mCorrectGain);
+    reader.read(mVolume);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] volume (m3) Desired node volume
 ///
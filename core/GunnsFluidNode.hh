@@ -73,6 +73,12 @@ class GunnsFluidNode : public GunnsBasicNode
         /// @brief Restarts the node after a checkpoint load
         virtual void   restart();
 
+        /// @brief Writes the node's checkpointed state to a native checkpoint stream
+        virtual void   saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the node's checkpointed state from a native checkpoint stream
+        virtual void   loadCheckpoint(GunnsCheckpointReader& reader);
+
         /// @brief Initializes the node volume for the beginning of the run
         virtual void   initVolume(const double toVolume);
 
@@ -31,7 +31,9 @@ LIBRARY DEPENDENCY:
     )
 */
 #include "GunnsFluidPotential.hh"
+#include "GunnsCheckpoint.hh"
 #include "aspects/fluid/fluid/PolyFluid.hh"
+#include <typeinfo>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] name                 (--) Link name
@@ -182,6 +184,40 @@ void GunnsFluidPotential::restartModel()
     GunnsFluidConductor::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the source pressure, which can be changed during run, to the conductor state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidPotential::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsFluidConductor::saveCheckpoint(writer);
+    writer.write(mSourcePressure);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidPotential::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsFluidConductor::loadCheckpoint(reader);
+    reader.read(mSourcePressure);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsFluidPotential.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidPotential::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsFluidPotential);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
@@ -125,6 +125,15 @@ class GunnsFluidPotential : public GunnsFluidConductor
         /// @brief Gets the Source Pressure
         double getSourcePressure() const;
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         double mSourcePressure;        /**< (kPa) Pressure rise created by the link */
 
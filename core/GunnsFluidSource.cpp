@@ -31,7 +31,9 @@ LIBRARY DEPENDENCY:
     )
 */
 #include "GunnsFluidSource.hh"
+#include "GunnsCheckpoint.hh"
 #include "aspects/fluid/fluid/PolyFluid.hh"
+#include <typeinfo>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] name  (--) Link name
@@ -175,6 +177,40 @@ void GunnsFluidSource::restartModel()
     GunnsFluidLink::restartModel();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] writer (--) Native checkpoint stream to write to
+///
+/// @throws   TsInitializationException
+///
+/// @details  Adds the flow demand, which can be changed during run, to the base link state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidSource::saveCheckpoint(GunnsCheckpointWriter& writer) const
+{
+    GunnsFluidLink::saveCheckpoint(writer);
+    writer.write(mFlowDemand);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] reader (--) Native checkpoint stream to read from
+///
+/// @throws   TsInitializationException, TsParseException
+///
+/// @details  Reads back the state written by saveCheckpoint, in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsFluidSource::loadCheckpoint(GunnsCheckpointReader& reader)
+{
+    GunnsFluidLink::loadCheckpoint(reader);
+    reader.read(mFlowDemand);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool  (--)  True if this link is exactly a GunnsFluidSource.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsFluidSource::isCheckpointable() const
+{
+    return typeid(*this) == typeid(GunnsFluidSource);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] dt (s) Integration time step
 ///
@@ -134,6 +134,15 @@ class GunnsFluidSource : public GunnsFluidLink
         /// @brief Returns the flow demand of the link
         virtual double getFlowDemand() const;
 
+        /// @brief Writes the link's checkpointed state to a native checkpoint stream
+        virtual void saveCheckpoint(GunnsCheckpointWriter& writer) const;
+
+        /// @brief Reads the link's checkpointed state from a native checkpoint stream
+        virtual void loadCheckpoint(GunnsCheckpointReader& reader);
+
+        /// @brief Returns whether the native checkpoint covers all of the link's state
+        virtual bool isCheckpointable() const;
+
     protected:
         double mFlowDemand; /**< (kg/s) User demanded mass flow rate through the link */
 
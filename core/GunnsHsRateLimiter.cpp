@@ -0,0 +1,103 @@
+/**
+@file
+@brief    GUNNS H&S Rate Limiter implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+   ()
+*/
+
+#include "GunnsHsRateLimiter.hh"
+#include <ctime>
+
+/// @details  By default each call site may issue 10 messages per minute.
+int    GunnsHsRateLimiter::sLimit  = 10;
+double GunnsHsRateLimiter::sWindow = 60.0;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] suppressed (--) Number of messages suppressed in the last window, or zero.
+/// @param[out] window     (s)  Duration of the last window, when suppressed is non-zero.
+///
+/// @returns  bool (--) True if the message is allowed, false if it should be suppressed.
+///
+/// @details  Counts this message in the current window, and allows it if the window's count is
+///           within the limit.  If the window has expired, the first caller to see it starts a new
+///           window and takes the last window's suppressed count for its summary.  This is called
+///           before the message is formatted, so it only reads the coarse clock and updates the
+///           counters.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool GunnsHsRateLimiter::allow(int& suppressed, double& window)
+{
+    suppressed = 0;
+    window     = 0.0;
+    const int limit = sLimit;
+    if (limit <= 0) {
+        return true;
+    }
+
+    const long now   = getClockMs();
+    const long start = mWindowStart;
+    if (0 == start or now - start >= static_cast<long>(1000.0 * sWindow)) {
+        if (__sync_bool_compare_and_swap(&mWindowStart, start, now)) {
+            __sync_lock_test_and_set(&mCount, 0);
+            suppressed = __sync_lock_test_and_set(&mSuppressed, 0);
+            if (0 != start) {
+                window = 0.001 * static_cast<double>(now - start);
+            }
+        }
+    }
+
+    if (__sync_add_and_fetch(&mCount, 1) <= limit) {
+        return true;
+    }
+    __sync_fetch_and_add(&mSuppressed, 1);
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] limit  (--) Number of messages allowed per window from each call site, 0 for no limit.
+/// @param[in] window (s)  Duration of the rate limit windows.
+///
+/// @details  Sets the rate limit shared by all call sites.  Windows already started keep their
+///           start time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsHsRateLimiter::setLimit(const int limit, const double window)
+{
+    sLimit  = limit;
+    sWindow = window;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Number of messages allowed per window from each call site, 0 for no limit.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int GunnsHsRateLimiter::getLimit()
+{
+    return sLimit;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (s) Duration of the rate limit windows.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsHsRateLimiter::getWindow()
+{
+    return sWindow;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  long (ms) The monotonic clock time, never zero.
+///
+/// @details  Uses the coarse clock where available, which is read without a system call and is
+///           plenty fine for windows of seconds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+long GunnsHsRateLimiter::getClockMs()
+{
+    struct timespec now;
+#ifdef CLOCK_MONOTONIC_COARSE
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &now);
+#endif
+    return 1 + 1000L * static_cast<long>(now.tv_sec) + static_cast<long>(now.tv_nsec) / 1000000L;
+}
@@ -0,0 +1,82 @@
+#ifndef GunnsHsRateLimiter_EXISTS
+#define GunnsHsRateLimiter_EXISTS
+
+/**
+@file
+@brief    GUNNS H&S Rate Limiter declarations
+
+@defgroup  TSM_GUNNS_CORE_HS_RATE_LIMITER    GUNNS H&S Rate Limiter
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:   (Limits the rate of H&S messages from a GUNNS message macro call site, before the message
+            is formatted, and reports how many messages were suppressed.)
+
+@details
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (Limits are per call site, not per object: all instances of a class share the limit of a
+   message in that class's code.)
+- (The summary of suppressed messages is added to the first message allowed in the next window,
+   so it's not reported if the call site stops being called.)
+- (Windows are timed by the real-time monotonic clock, not sim time, since the point is to limit
+   the real-time cost of messages.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsHsRateLimiter.o))
+
+PROGRAMMERS:
+- ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+
+@{
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS H&S Rate Limiter.
+///
+/// @details  The GUNNS_WARNING and GUNNS_INFO macros declare one of these as a static local at
+///           each call site, and check it before building the message, so that a message issued
+///           every frame, such as a network failing to converge, doesn't cost its formatting and
+///           filtering every frame.  Each call site is allowed up to the limit number of messages in
+///           each time window; further messages in the window are only counted.  The first message
+///           allowed in the next window carries the number of messages suppressed in the last.
+///
+///           This is an aggregate with no constructor, so that the static locals are initialized
+///           statically with GUNNS_HS_RATE_LIMITER_INIT, without a guard.  The counters are updated
+///           with atomic operations, so call sites can be shared by networks in different threads.
+///
+///           The limit and window are shared by all call sites, and can be changed at any time by
+///           setLimit.  A limit of zero disables rate limiting.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct GunnsHsRateLimiter
+{
+    volatile long mWindowStart;        /**< ** (ms) Clock time the current window started, 0 before the first message. */
+    volatile int  mCount;              /**< ** (--) Number of messages checked in the current window. */
+    volatile int  mSuppressed;         /**< ** (--) Number of messages suppressed in the current window. */
+
+    /// @brief  Checks whether a message from this call site is allowed, and returns the summary of
+    ///         the last window's suppressed messages when a new window starts.
+    bool          allow(int& suppressed, double& window);
+    /// @brief  Sets the number of messages allowed per window from each call site, and the window.
+    static void   setLimit(const int limit, const double window);
+    /// @brief  Returns the number of messages allowed per window from each call site.
+    static int    getLimit();
+    /// @brief  Returns the rate limit window.
+    static double getWindow();
+    /// @brief  Returns the monotonic clock time in milliseconds.
+    static long   getClockMs();
+
+    static int    sLimit;              /**< ** (--) Messages allowed per window from each call site, 0 for no limit. */
+    static double sWindow;             /**< ** (s)  Duration of the rate limit windows. */
+};
+
+/// @brief  Static initializer for GunnsHsRateLimiter call site instances.
+#define GUNNS_HS_RATE_LIMITER_INIT {0, 0, 0}
+
+/// @}
+
+#endif
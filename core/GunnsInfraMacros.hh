@@ -39,6 +39,8 @@ PROGRAMMERS:
 #else
 #include "sim_services/Clock/include/clock_proto.h"
 #endif
+#else  // non-Trick
+#include <time.h>
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -47,15 +49,28 @@ PROGRAMMERS:
 /// @returns  double (s) Time value in seconds.
 ///
 /// @details  This macro replaces the generic clockTime with the specific function call for the sim
-///           environment infrastructure.  Currently only Trick is supported, and when not in the
-///           Trick environment, this just returns zero.
+///           environment infrastructure.  In Trick this is the Trick clock.  When not in the Trick
+///           environment, this is the POSIX monotonic clock, so that Trick-less applications such
+///           as benchmarks still get valid solver timing metrics.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 #ifndef no_TRICK_ENV
 #define CLOCK_TIME \
 clock_time() / 1000000.0
 #else  // non-Trick
 #define CLOCK_TIME \
-0.0
+gunnsNoTrickClockTime()
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (s) Monotonic clock time value in seconds.
+///
+/// @details  Returns the POSIX monotonic clock time for the non-Trick CLOCK_TIME macro.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline double gunnsNoTrickClockTime()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) * 1.0E-9;
+}
 #endif
 
 #endif
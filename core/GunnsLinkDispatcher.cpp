@@ -0,0 +1,28 @@
+/**
+@file
+@brief     GUNNS Link Dispatcher implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+LIBRARY DEPENDENCY:
+  ()
+*/
+
+#include "GunnsLinkDispatcher.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this GUNNS Link Dispatcher.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsLinkDispatcher::GunnsLinkDispatcher()
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this GUNNS Link Dispatcher.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsLinkDispatcher::~GunnsLinkDispatcher()
+{
+    // nothing to do
+}
@@ -0,0 +1,91 @@
+#ifndef GunnsLinkDispatcher_EXISTS
+#define GunnsLinkDispatcher_EXISTS
+
+/**
+@file
+@brief     GUNNS Link Dispatcher declarations
+
+@defgroup  TSM_GUNNS_CORE_LINK_DISPATCHER    GUNNS Link Dispatcher
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:   (Provides the interface for replacing the GUNNS solver's per-link loops with network-
+            specific code, such as the static network composition in GunnsStaticNetwork.hh.)
+
+@details
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (The dispatcher must handle exactly the solver's links, in the same order and with the same
+   node maps, as verified by bind.)
+- (Node maps must not change after the dispatcher is bound, so links that move their ports at
+   run-time (jumpers, sockets, etc.) can't be dispatched.)
+
+LIBRARY DEPENDENCY:
+- ((GunnsLinkDispatcher.o))
+
+PROGRAMMERS:
+- ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+
+@{
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+
+// Forward-declare pointer types
+class GunnsBasicLink;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Link Dispatcher Interface Class.
+///
+/// @details  When given to the solver with Gunns::setLinkDispatcher, the solver calls this once
+///           per phase instead of looping over its array of base class link pointers:
+///           - stepping the links on the first minor step,
+///           - minor-stepping the non-linear links on subsequent minor steps,
+///           - assembling the link contributions to the admittance matrix and source vector, and
+///           - computing link flows in the basic flow orchestrator.
+///
+///           The solver also checks the node maps after stepping the links, since links can re-map
+///           their ports at run-time, and reverts to its own loops if they no longer match.
+///
+///           This allows a derived class that knows the network's link types and node maps at
+///           compile time to call the links without virtual dispatch and assemble the system with
+///           constant indexes.  The solution is unchanged: implementations must call the links in
+///           the same order as the solver and add the same terms to the system.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsLinkDispatcher
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsLinkDispatcher);
+    public:
+        /// @brief  Default constructor.
+        GunnsLinkDispatcher();
+        /// @brief  Default destructor.
+        virtual ~GunnsLinkDispatcher();
+        /// @brief  Binds to and verifies the solver's links, returns false if they don't match.
+        virtual bool bind(GunnsBasicLink** links, const int numLinks, const int networkSize) = 0;
+        /// @brief  Steps all links, returns whether any link needs an admittance update.
+        virtual bool step(const double dt) = 0;
+        /// @brief  Minor-steps non-linear links, returns whether any link needs an admittance update.
+        virtual bool minorStep(const double dt, const int minorStep) = 0;
+        /// @brief  Computes all link flows, in reverse link order.
+        virtual void computeFlows(const double dt) = 0;
+        /// @brief  Adds the link admittance matrices to the zeroed system admittance matrix.
+        virtual void buildAdmittanceMatrix(double* admittanceMatrix) const = 0;
+        /// @brief  Adds the link source vectors to the zeroed system source vector.
+        virtual void buildSourceVector(double* sourceVector) const = 0;
+        /// @brief  Returns whether the links' node maps still match the binding.
+        virtual bool checkNodeMaps() const = 0;
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsLinkDispatcher(const GunnsLinkDispatcher& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsLinkDispatcher& operator =(const GunnsLinkDispatcher& that);
+};
+
+/// @}
+
+#endif
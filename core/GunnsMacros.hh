@@ -25,14 +25,16 @@ ASSUMPTIONS AND LIMITATIONS:
 - ()
 
 LIBRARY DEPENDENCY:
-- ()
+- ((core/GunnsHsRateLimiter.o))
 
 PROGRAMMERS:
 - ((Kenneth McMurtrie) (Tietronix Software) (add stack trace) (2013-06))
+- ((GUNNS Development Team) (CACI) (October 2026) (rate limit warnings and info))
 
 @{
 */
 
+#include "core/GunnsHsRateLimiter.hh"
 #include "simulation/hs/TsHsMsg.hh"
 #include "software/exceptions/TsHsException.hh"
 #include "software/exceptions/TsInitializationException.hh"
@@ -282,6 +284,10 @@ PROGRAMMERS:
 ///           consistent warning reporting from all Gunns objects.  The text argument can use the
 ///           << operator.
 ///
+///           Messages from each call site are rate limited by a GunnsHsRateLimiter, checked before
+///           the message is built.  The first message allowed after messages were suppressed
+///           reports how many were suppressed and over what time.
+///
 /// @par      Example 1 (static text):
 /// @code
 ///           GUNNS_WARNING("All nodes uninitialized or vacuum.");
@@ -295,9 +301,17 @@ PROGRAMMERS:
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #define GUNNS_WARNING(text) \
 { \
-    TsHsMsg gunnsMsg(TS_HS_WARNING, TS_HS_GUNNS); \
-    gunnsMsg << mName << " " << text; \
-    hsSendMsg(gunnsMsg); \
+    static GunnsHsRateLimiter gunnsLimiter = GUNNS_HS_RATE_LIMITER_INIT; \
+    int    gunnsSuppressed = 0; \
+    double gunnsWindow     = 0.0; \
+    if (gunnsLimiter.allow(gunnsSuppressed, gunnsWindow)) { \
+        TsHsMsg gunnsMsg(TS_HS_WARNING, TS_HS_GUNNS); \
+        gunnsMsg << mName << " " << text; \
+        if (gunnsSuppressed > 0) { \
+            gunnsMsg << " (suppressed " << gunnsSuppressed << " repeats in " << gunnsWindow << " s)"; \
+        } \
+        hsSendMsg(gunnsMsg); \
+    } \
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -312,6 +326,10 @@ PROGRAMMERS:
 ///           consistent info reporting from all Gunns objects.  The text argument can use the
 ///           << operator.
 ///
+///           Messages from each call site are rate limited by a GunnsHsRateLimiter, checked before
+///           the message is built.  The first message allowed after messages were suppressed
+///           reports how many were suppressed and over what time.
+///
 /// @par      Example 1 (static text):
 /// @code
 ///           GUNNS_INFO("By your command.");
@@ -325,9 +343,17 @@ PROGRAMMERS:
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #define GUNNS_INFO(text) \
 { \
-    TsHsMsg gunnsMsg(TS_HS_INFO, TS_HS_GUNNS); \
-    gunnsMsg << mName << " " << text; \
-    hsSendMsg(gunnsMsg); \
+    static GunnsHsRateLimiter gunnsLimiter = GUNNS_HS_RATE_LIMITER_INIT; \
+    int    gunnsSuppressed = 0; \
+    double gunnsWindow     = 0.0; \
+    if (gunnsLimiter.allow(gunnsSuppressed, gunnsWindow)) { \
+        TsHsMsg gunnsMsg(TS_HS_INFO, TS_HS_GUNNS); \
+        gunnsMsg << mName << " " << text; \
+        if (gunnsSuppressed > 0) { \
+            gunnsMsg << " (suppressed " << gunnsSuppressed << " repeats in " << gunnsWindow << " s)"; \
+        } \
+        hsSendMsg(gunnsMsg); \
+    } \
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -10,6 +10,7 @@ LIBRARY DEPENDENCY:
     (software/exceptions/TsInitializationException.o))
 */
 
+#include <cstring>
 #include <iostream>
 #include <fstream>
 #include "GunnsMinorStepLog.hh"
@@ -181,16 +182,19 @@ std::string GunnsMinorStepData::renderSolutionResult() const
 /// @param[in]  modeCommand  (--)  Commanded operating mode.
 /// @param[in]  logSteps     (--)  Number of minor steps to record in each log.
 /// @param[in]  path         (--)  File system relative path for output files to go.
+/// @param[in]  outputFormat (--)  Format of the output files.
 ///
 /// @details  Default constructs this minor step input data.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-GunnsMinorStepLogInputData::GunnsMinorStepLogInputData(const LogCommands  modeCommand,
-                                                       const unsigned int logSteps,
-                                                       const std::string  path)
+GunnsMinorStepLogInputData::GunnsMinorStepLogInputData(const LogCommands   modeCommand,
+                                                       const unsigned int  logSteps,
+                                                       const std::string   path,
+                                                       const OutputFormats outputFormat)
     :
     mModeCommand(modeCommand),
     mLogSteps(logSteps),
-    mPath(path)
+    mPath(path),
+    mOutputFormat(outputFormat)
 {
     // nothing to do
 }
@@ -212,7 +216,12 @@ GunnsMinorStepLog::GunnsMinorStepLog()
     mName(""),
     mState(PAUSED),
     mIsRecording(false),
-    mBuffer(),
+    mArena(0),
+    mNetworkSize(0),
+    mNumLinks(0),
+    mLinkPorts(),
+    mIntsSize(0),
+    mFrameSize(0),
     mSize(0),
     mHeadIndex(0),
     mNumValidSteps(0),
@@ -228,7 +237,7 @@ GunnsMinorStepLog::GunnsMinorStepLog()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 GunnsMinorStepLog::~GunnsMinorStepLog()
 {
-    // nothing to do
+    delete [] mArena;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -248,12 +257,29 @@ void GunnsMinorStepLog::initialize(const std::string& name, const int networkSiz
     }
     validate(name, networkSize, numLinks, links);
 
-    /// - Create an initial empty frame of data with its links sized properly for the network;
-    ///   This will be copied when the buffer size is initialized.
-    mBuffer.push_back(GunnsMinorStepData(networkSize, numLinks, links));
-    mHeadIndex     = mSize - 1;
+    /// - Lay out the frames for the network: the int values padded to a multiple of a double so
+    ///   the double values are aligned, then the potential vector, nodes convergence, and each
+    ///   link's admittance matrix and source vector.
+    mNetworkSize = networkSize;
+    mNumLinks    = numLinks;
+    mLinkPorts.clear();
+    unsigned int numValues = 2 * mNetworkSize;
+    for (unsigned int link = 0; link < mNumLinks; ++link) {
+        const unsigned int ports = links[link]->getNumberPorts();
+        mLinkPorts.push_back(ports);
+        numValues += ports * ports + ports;
+    }
+    mIntsSize  = (LINK_RESULTS + mNumLinks) * sizeof(int);
+    mIntsSize += (sizeof(double) - mIntsSize % sizeof(double)) % sizeof(double);
+    mFrameSize = mIntsSize + numValues * sizeof(double);
+    mLinks     = links;
+
+    /// - Release any buffer from a previous initialization so it is resized to the new layout.
+    delete [] mArena;
+    mArena         = 0;
+    mSize          = 0;
+    mHeadIndex     = 0;
     mNumValidSteps = 0;
-    mLinks         = links;
 
     /// - Initialize the log header row string.
     initLogHeader();
@@ -327,8 +353,9 @@ void GunnsMinorStepLog::beginMinorStep(const int majorStep, const int minorStep)
 {
     if (mIsRecording) {
         step();
-        head().mMajorStep = majorStep;
-        head().mMinorStep = minorStep;
+        int* ints = frameInts(mHeadIndex);
+        ints[MAJOR_STEP] = majorStep;
+        ints[MINOR_STEP] = minorStep;
         recordAllLinksResult(GunnsBasicLink::CONFIRM);
     }
 }
@@ -342,7 +369,7 @@ void GunnsMinorStepLog::beginMinorStep(const int majorStep, const int minorStep)
 void GunnsMinorStepLog::recordPotential(const double* potential)
 {
     if (mIsRecording) {
-        head().mPotentialVector.assign(potential, potential + head().mPotentialVector.size());
+        memcpy(frameValues(mHeadIndex), potential, mNetworkSize * sizeof(double));
     }
 }
 
@@ -355,7 +382,8 @@ void GunnsMinorStepLog::recordPotential(const double* potential)
 void GunnsMinorStepLog::recordNodesConvergence(const double* nodesConvergence)
 {
     if (mIsRecording) {
-        head().mNodesConvergence.assign(nodesConvergence, nodesConvergence + head().mNodesConvergence.size());
+        memcpy(frameValues(mHeadIndex) + mNetworkSize, nodesConvergence,
+               mNetworkSize * sizeof(double));
     }
 }
 
@@ -366,14 +394,16 @@ void GunnsMinorStepLog::recordNodesConvergence(const double* nodesConvergence)
 void GunnsMinorStepLog::recordLinkContributions()
 {
     if (mIsRecording) {
-        /// - Store the ring buffer head reference since we're going to reference it many times.
-        GunnsMinorStepData& data = head();
-        for (unsigned int link=0; link<data.mLinksData.size(); ++link) {
-            double* source = mLinks[link]->getSourceVector();
-            data.mLinksData[link].mSourceVector.assign(source, source + data.mLinksData[link].mSourceVector.size());
-
-            double* admittance = mLinks[link]->getAdmittanceMatrix();
-            data.mLinksData[link].mAdmittanceMatrix.assign(admittance, admittance + data.mLinksData[link].mAdmittanceMatrix.size());
+        /// - The links' data are consecutive in the frame, after the potential and convergence.
+        double* data = frameValues(mHeadIndex) + 2 * mNetworkSize;
+        for (unsigned int link=0; link<mNumLinks; ++link) {
+            const unsigned int ports = mLinkPorts[link];
+            if (ports > 0) {
+                memcpy(data, mLinks[link]->getAdmittanceMatrix(), ports * ports * sizeof(double));
+                data += ports * ports;
+                memcpy(data, mLinks[link]->getSourceVector(), ports * sizeof(double));
+                data += ports;
+            }
         }
     }
 }
@@ -388,7 +418,7 @@ void GunnsMinorStepLog::recordLinkContributions()
 void GunnsMinorStepLog::recordLinkResult(const unsigned int link, const GunnsBasicLink::SolutionResult result)
 {
     if (mIsRecording) {
-        head().mLinksData[link].mSolutionResult = result;
+        frameInts(mHeadIndex)[LINK_RESULTS + link] = result;
     }
 }
 
@@ -400,8 +430,11 @@ void GunnsMinorStepLog::recordLinkResult(const unsigned int link, const GunnsBas
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsMinorStepLog::recordAllLinksResult(const GunnsBasicLink::SolutionResult result)
 {
-    for (unsigned int link=0; link<head().mLinksData.size(); ++link) {
-        recordLinkResult(link, result);
+    if (mIsRecording) {
+        int* results = frameInts(mHeadIndex) + LINK_RESULTS;
+        for (unsigned int link=0; link<mNumLinks; ++link) {
+            results[link] = result;
+        }
     }
 }
 
@@ -417,8 +450,9 @@ void GunnsMinorStepLog::recordAllLinksResult(const GunnsBasicLink::SolutionResul
 void GunnsMinorStepLog::recordStepResult(const int decomposition, const GunnsMinorStepData::SolutionResults result)
 {
     if (mIsRecording) {
-        head().mDecomposition  = decomposition;
-        head().mSolutionResult = result;
+        int* ints = frameInts(mHeadIndex);
+        ints[DECOMPOSITION]   = decomposition;
+        ints[SOLUTION_RESULT] = result;
     }
 }
 
@@ -430,7 +464,8 @@ void GunnsMinorStepLog::recordStepResult(const int decomposition, const GunnsMin
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsMinorStepLog::endMajorStep()
 {
-    if (RECORDING_AUTO == mState and GunnsMinorStepData::SUCCESS != head().mSolutionResult) {
+    if (RECORDING_AUTO == mState and
+            GunnsMinorStepData::SUCCESS != frameInts(mHeadIndex)[SOLUTION_RESULT]) {
         initiateDump();
     }
 }
@@ -438,17 +473,25 @@ void GunnsMinorStepLog::endMajorStep()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Writes the output file if the output file name has been set.  This method should be
 ///           called in an asynchronous thread that does not interfere with the real-time GUNNS
-///           network thread.
+///           network thread.  The binary format is streamed straight from the buffer, avoiding the
+///           text formatting and the temporary string of the csv format.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsMinorStepLog::updateAsync()
 {
     if (not mFilename.empty()) {
-        std::ofstream file (mFilename.c_str(), (std::ofstream::out | std::ofstream::trunc));
+        const bool binary = (GunnsMinorStepLogInputData::BINARY == mInputData.mOutputFormat);
+        std::ofstream file (mFilename.c_str(), binary
+                ? (std::ofstream::out | std::ofstream::trunc | std::ofstream::binary)
+                : (std::ofstream::out | std::ofstream::trunc));
         if (file.fail()) {
             GUNNS_WARNING("error opening file: " << mFilename);
         } else {
             GUNNS_INFO("writing file: " << mFilename);
-            file << renderOutput();
+            if (binary) {
+                renderBinary(file);
+            } else {
+                file << renderOutput();
+            }
         }
         file.close();
 
@@ -459,29 +502,68 @@ void GunnsMinorStepLog::updateAsync()
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details  If the commanded size is different from the current buffer size, then clear the buffer
-///           vector and refill the vector with fill data to the new given size.  The startLogging
-///           function is called to reset the buffer head and valid frames count, and enable
-///           recording from the solver.
+/// @details  If the commanded size is different from the current buffer size, then reallocate the
+///           buffer arena to the new given size, with zeroed frames and CONFIRM link results.  The
+///           startLogging function is called to reset the buffer head and valid frames count, and
+///           enable recording from the solver.
 ///
-/// @note  This should only be called in simulation initialization or freeze, because it can take
-///        a long time complete and could cause frame overruns if called during run.
+/// @note  This should only be called in simulation initialization or freeze, because allocating a
+///        large buffer could cause frame overruns if called during run.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsMinorStepLog::updateFreeze()
 {
-    if (mSize != mInputData.mLogSteps and mInputData.mLogSteps > 0 and mBuffer.size() > 0) {
-        /// - Save a frame of data for sizing of frames after the vector has been cleared.
-        GunnsMinorStepData saveFrame(mBuffer[0]);
-
-        mBuffer.clear();
-        mSize = mInputData.mLogSteps;
+    if (mSize != mInputData.mLogSteps and mInputData.mLogSteps > 0 and mFrameSize > 0) {
+        delete [] mArena;
+        mSize  = mInputData.mLogSteps;
+        mArena = new char[mSize * mFrameSize];
+        memset(mArena, 0, mSize * mFrameSize);
         for (unsigned int i=0; i<mSize; ++i) {
-            mBuffer.push_back(GunnsMinorStepData(saveFrame));
+            int* results = frameInts(i) + LINK_RESULTS;
+            for (unsigned int link=0; link<mNumLinks; ++link) {
+                results[link] = GunnsBasicLink::CONFIRM;
+            }
         }
         startLogging();
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  index  (--)  Index of the frame in the ring buffer.
+///
+/// @returns  GunnsMinorStepData (--) Unpacked copy of the frame data.
+///
+/// @details  Returns an unpacked copy of the data in the given ring buffer frame, for inspection.
+///           This allocates, so it shouldn't be called by the solver.  Returns empty data if this
+///           log hasn't been initialized or the index is outside the buffer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsMinorStepData GunnsMinorStepLog::getFrame(const unsigned int index) const
+{
+    if (index >= mSize) {
+        return GunnsMinorStepData();
+    }
+    GunnsMinorStepData data(mNetworkSize, mNumLinks, mLinks);
+    const int*    ints   = frameInts(index);
+    const double* values = frameValues(index);
+    data.mMajorStep      = ints[MAJOR_STEP];
+    data.mMinorStep      = ints[MINOR_STEP];
+    data.mDecomposition  = ints[DECOMPOSITION];
+    data.mSolutionResult = static_cast<GunnsMinorStepData::SolutionResults>(ints[SOLUTION_RESULT]);
+    data.mPotentialVector.assign(values, values + mNetworkSize);
+    values += mNetworkSize;
+    data.mNodesConvergence.assign(values, values + mNetworkSize);
+    values += mNetworkSize;
+    for (unsigned int link = 0; link < mNumLinks; ++link) {
+        const unsigned int ports = mLinkPorts[link];
+        GunnsMinorStepLinkData& linkData = data.mLinksData[link];
+        linkData.mSolutionResult = static_cast<GunnsBasicLink::SolutionResult>(ints[LINK_RESULTS + link]);
+        linkData.mAdmittanceMatrix.assign(values, values + ports * ports);
+        values += ports * ports;
+        linkData.mSourceVector.assign(values, values + ports);
+        values += ports;
+    }
+    return data;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  name         (--)  Name of the object.
 /// @param[in]  networkSize  (--)  Number of nodes in the network, not counting the ground node.
@@ -540,7 +622,7 @@ void GunnsMinorStepLog::validate(const std::string& name, const int networkSize,
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void GunnsMinorStepLog::initLogHeader()
 {
-    const unsigned int networkSize = mBuffer[0].mPotentialVector.size();
+    const unsigned int networkSize = mNetworkSize;
     std::ostringstream header;
     header << "Major Step, Minor Step, Decomposition, Solution Result";
     for (unsigned int node = 0; node < networkSize; ++node) {
@@ -549,12 +631,12 @@ void GunnsMinorStepLog::initLogHeader()
     for (unsigned int node = 0; node < networkSize; ++node) {
         header << ", Node Convergence [" << node << "]";
     }
-    for (unsigned int link = 0; link < mBuffer[0].mLinksData.size(); ++link) {
+    for (unsigned int link = 0; link < mNumLinks; ++link) {
         header << ", Link " << mLinks[link]->getName() << ": Solution Result";
-        for (unsigned int i = 0; i < mBuffer[0].mLinksData[link].mAdmittanceMatrix.size(); ++i) {
+        for (unsigned int i = 0; i < mLinkPorts[link] * mLinkPorts[link]; ++i) {
             header << ", Admittance Matrix [" << i << "]";
         }
-        for (unsigned int i = 0; i < mBuffer[0].mLinksData[link].mSourceVector.size(); ++i) {
+        for (unsigned int i = 0; i < mLinkPorts[link]; ++i) {
             header << ", Source Vector [" << i << "]";
         }
     }
@@ -577,27 +659,27 @@ std::string GunnsMinorStepLog::renderOutput()
 {
     std::string output = "";
     if (not mIsRecording) {
-        const unsigned int networkSize = mBuffer[0].mPotentialVector.size();
         std::ostringstream data;
         data << mLogHeader;
+        /// - These render the solution result enumerations as text.
+        GunnsMinorStepData     stepResult;
+        GunnsMinorStepLinkData linkResult;
         /// - Loop over the number valid steps from the tail to the head, with wrap-around.
         for (int j = 1 - mNumValidSteps; j < 1; ++j) {
-            const GunnsMinorStepData& frame = headOffset(j);
-            data << frame.mMajorStep << ", " << frame.mMinorStep << ", " << frame.mDecomposition
-                 << ", " << frame.renderSolutionResult();
-            for (unsigned int node = 0; node < networkSize; ++node) {
-                data << ", " << frame.mPotentialVector[node];
+            const unsigned int index  = headOffset(j);
+            const int*         ints   = frameInts(index);
+            const double*      values = frameValues(index);
+            stepResult.mSolutionResult = static_cast<GunnsMinorStepData::SolutionResults>(ints[SOLUTION_RESULT]);
+            data << ints[MAJOR_STEP] << ", " << ints[MINOR_STEP] << ", " << ints[DECOMPOSITION]
+                 << ", " << stepResult.renderSolutionResult();
+            for (unsigned int node = 0; node < 2 * mNetworkSize; ++node) {
+                data << ", " << *values++;
             }
-            for (unsigned int node = 0; node < networkSize; ++node) {
-                data << ", " << frame.mNodesConvergence[node];
-            }
-            for (unsigned int link = 0; link < mBuffer[0].mLinksData.size(); ++link) {
-                data << ", " << frame.mLinksData[link].renderSolutionResult();
-                for (unsigned int i = 0; i < mBuffer[0].mLinksData[link].mAdmittanceMatrix.size(); ++i) {
-                    data << ", " << frame.mLinksData[link].mAdmittanceMatrix[i];
-                }
-                for (unsigned int i = 0; i < mBuffer[0].mLinksData[link].mSourceVector.size(); ++i) {
-                    data << ", " << frame.mLinksData[link].mSourceVector[i];
+            for (unsigned int link = 0; link < mNumLinks; ++link) {
+                linkResult.mSolutionResult = static_cast<GunnsBasicLink::SolutionResult>(ints[LINK_RESULTS + link]);
+                data << ", " << linkResult.renderSolutionResult();
+                for (unsigned int i = 0; i < mLinkPorts[link] * (mLinkPorts[link] + 1); ++i) {
+                    data << ", " << *values++;
                 }
             }
             data << std::endl;
@@ -609,6 +691,55 @@ std::string GunnsMinorStepLog::renderOutput()
     return output;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  stream  (--)  Output stream, opened in binary mode, to write to.
+///
+/// @details  Writes the recorded data log in a binary format, in the host byte order.  Each frame
+///           is written directly from the buffer arena, without formatting.  The
+///           header is:
+///           - "GUNNSMSL" (8 chars), format version (uint32), 0x01020304 (uint32, so readers can
+///             detect the byte order),
+///           - network size, number of links and number of frames (uint32 each),
+///           - for each link: number of ports (uint32), name length (uint32) and the name.
+///
+///           Then each valid frame, from the tail to the head of the buffer:
+///           - major step, minor step, decomposition, network solution result (int32 each),
+///           - the solution result of each link (int32 each),
+///           - potential vector and nodes convergence (network size doubles each),
+///           - for each link: admittance matrix (ports * ports doubles) and source vector (ports
+///             doubles).
+///
+///           bin/utils/minor_step_log_convert.py converts this to the csv format.
+///
+/// @note  As with renderOutput, nothing is written if the mIsRecording flag is set.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsMinorStepLog::renderBinary(std::ostream& stream)
+{
+    if (mIsRecording) {
+        GUNNS_WARNING("logging was not stopped when renderBinary was called.");
+        return;
+    }
+
+    const unsigned int header[5] = {1, 0x01020304, mNetworkSize, mNumLinks, mNumValidSteps};
+    stream.write("GUNNSMSL", 8);
+    stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+    for (unsigned int link = 0; link < mNumLinks; ++link) {
+        const std::string  name        = mLinks[link]->getName();
+        const unsigned int linkInfo[2] = {mLinkPorts[link], static_cast<unsigned int>(name.size())};
+        stream.write(reinterpret_cast<const char*>(linkInfo), sizeof(linkInfo));
+        stream.write(name.data(), name.size());
+    }
+
+    /// - Loop over the number valid steps from the tail to the head, with wrap-around.  The frame
+    ///   padding between the ints and doubles isn't written.
+    const unsigned int intsSize = (LINK_RESULTS + mNumLinks) * sizeof(int);
+    for (int j = 1 - mNumValidSteps; j < 1; ++j) {
+        const unsigned int index = headOffset(j);
+        stream.write(reinterpret_cast<const char*>(frameInts(index)), intsSize);
+        stream.write(reinterpret_cast<const char*>(frameValues(index)), mFrameSize - mIntsSize);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details  Initiates the file write by pausing recording, moding to the WRITING_FILE state and
 ///           sending the output filename to the asynchronous file output function (updateAsync),
@@ -619,6 +750,7 @@ void GunnsMinorStepLog::initiateDump()
     stopLogging();
     mState = WRITING_FILE;
     std::ostringstream file;
-    file << mInputData.mPath << mName << "_" << head().mMajorStep << ".csv";
+    file << mInputData.mPath << mName << "_" << frameInts(mHeadIndex)[MAJOR_STEP]
+         << ((GunnsMinorStepLogInputData::BINARY == mInputData.mOutputFormat) ? ".bin" : ".csv");
     mFilename = file.str();
 }
@@ -25,10 +25,13 @@ LIBRARY DEPENDENCY:
 
 PROGRAMMERS:
 - ((Jason Harvey) (L3) (2014-09) (Initial Prototype)
+   ((GUNNS Development Team) (CACI) (October 2026) (Binary output format))
+   ((GUNNS Development Team) (CACI) (October 2026) (Contiguous ring buffer arena))
 
 @{
 */
 
+#include <ostream>
 #include <vector>
 #include "core/GunnsBasicLink.hh"
 #include "software/SimCompatibility/TsSimCompatibility.hh"
@@ -37,7 +40,8 @@ PROGRAMMERS:
 /// @brief  GUNNS Solver Minor Step Log Link Data Class
 ///
 /// @details  Stores a network link's contributions to the system of equations, and the result
-///           of its confirmation check on the solution, for a network minor step.
+///           of its confirmation check on the solution, for a network minor step.  This is used for
+///           an unpacked copy of a frame from the log ring buffer.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class GunnsMinorStepLinkData
 {
@@ -61,7 +65,7 @@ class GunnsMinorStepLinkData
 /// @brief  GUNNS Solver Minor Step Log Data Class
 ///
 /// @details  Stores a data for a network minor step, including system of equations and results of
-///           the solution.
+///           the solution.  This is used for an unpacked copy of a frame from the log ring buffer.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class GunnsMinorStepData
 {
@@ -110,13 +114,20 @@ class GunnsMinorStepLogInputData
             RECORD_SNAP = 2, ///< Record data from the solver and file will be dumped when user inputs SNAP.
             SNAP        = 3, ///< File is dumped immediately.
         };
-        LogCommands  mModeCommand; /**< (1) trick_chkpnt_io(**) Commanded operating mode. */
-        unsigned int mLogSteps;    /**< (1) trick_chkpnt_io(**) Number of minor steps to record in each log. */
-        std::string  mPath;        /**< (1) trick_chkpnt_io(**) File system relative path for output files to go. */
+        /// @brief  Enumeration of the minor step log output file formats.
+        enum OutputFormats {
+            CSV    = 0, ///< Comma-separated text with a header row of column labels (.csv).
+            BINARY = 1  ///< Binary header of the network layout followed by raw frame data (.bin).
+        };
+        LogCommands   mModeCommand;  /**< (1) trick_chkpnt_io(**) Commanded operating mode. */
+        unsigned int  mLogSteps;     /**< (1) trick_chkpnt_io(**) Number of minor steps to record in each log. */
+        std::string   mPath;         /**< (1) trick_chkpnt_io(**) File system relative path for output files to go. */
+        OutputFormats mOutputFormat; /**< (1) trick_chkpnt_io(**) Format of the output files. */
         /// @brief  Default constructs this GUNNS Solver Minor Step Log input data.
-        GunnsMinorStepLogInputData(const LogCommands  modeCommand = PAUSE,
-                                   const unsigned int logSteps    = 0,
-                                   const std::string  path        = "");
+        GunnsMinorStepLogInputData(const LogCommands   modeCommand  = PAUSE,
+                                   const unsigned int  logSteps     = 0,
+                                   const std::string   path         = "",
+                                   const OutputFormats outputFormat = CSV);
         /// @brief  Default destructs this GUNNS Solver Minor Step Log input data.
         virtual ~GunnsMinorStepLogInputData();
 
@@ -132,6 +143,12 @@ class GunnsMinorStepLogInputData
 ///         solver minor step data -- one minor step of data for each frame in the buffer.
 ///         Interfaces are provided for the solver to initialize this object and record data for the
 ///         current minor step, and start and close out a major step.
+///
+/// @details  The ring buffer is a single preallocated arena of fixed-size frames, so recording a
+///           minor step is a few memcpy's with no allocation.  Each frame is a block of ints: the
+///           major step, minor step, decomposition, solution result and the link results, padded to
+///           a multiple of a double; followed by a block of doubles: the potential vector, nodes
+///           convergence, and each link's admittance matrix and source vector.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class GunnsMinorStepLog
 {
@@ -172,13 +189,28 @@ class GunnsMinorStepLog
         void updateAsync();
         /// @brief  Freeze job function to resize the log buffer.
         void updateFreeze();
+        /// @brief  Returns an unpacked copy of the data in the given ring buffer frame.
+        GunnsMinorStepData getFrame(const unsigned int index) const;
         GunnsMinorStepLogInputData      mInputData;     /**<    (1) trick_chkpnt_io(**) Input data for initialization and run inputs. */
 
     protected:
+        /// @brief  Enumeration of the int values at the start of each frame.
+        enum FrameInts {
+            MAJOR_STEP      = 0, ///< Total elapsed major step count since init.
+            MINOR_STEP      = 1, ///< Minor step count within the major step.
+            DECOMPOSITION   = 2, ///< Decomposition count within the major step.
+            SOLUTION_RESULT = 3, ///< Solution result of the minor step.
+            LINK_RESULTS    = 4  ///< Start of the link results of the minor step.
+        };
         std::string                     mName;          /**< *o (1) trick_chkpnt_io(**) Object name for identification in outputs. */
         LogModes                        mState;         /**< *o (1) trick_chkpnt_io(**) Operating mode of the log dump function. */
         bool                            mIsRecording;   /**< *o (1) trick_chkpnt_io(**) Recording data from the solver when set. */
-        std::vector<GunnsMinorStepData> mBuffer;        /**< ** (1) trick_chkpnt_io(**) The ring buffer of minor step data. */
+        char*                           mArena;         /**< ** (1) trick_chkpnt_io(**) The ring buffer of minor step data frames, not allocated by the sim memory manager. */
+        unsigned int                    mNetworkSize;   /**< *o (1) trick_chkpnt_io(**) Number of nodes in the network, not counting the ground node. */
+        unsigned int                    mNumLinks;      /**< *o (1) trick_chkpnt_io(**) Number of links in the network. */
+        std::vector<unsigned int>       mLinkPorts;     /**< ** (1) trick_chkpnt_io(**) Number of ports of each link. */
+        unsigned int                    mIntsSize;      /**< *o (1) trick_chkpnt_io(**) Size in bytes of the padded int block of a frame. */
+        unsigned int                    mFrameSize;     /**< *o (1) trick_chkpnt_io(**) Size in bytes of a frame. */
         unsigned int                    mSize;          /**< *o (1) trick_chkpnt_io(**) The current size, in number of minor steps, of the ring buffer. */
         unsigned int                    mHeadIndex;     /**< *o (1) trick_chkpnt_io(**) The index of the currently logging step in the ring buffer. */
         unsigned int                    mNumValidSteps; /**< *o (1) trick_chkpnt_io(**) The number of steps in the ring buffer containing valid data, up to mSize. */
@@ -197,12 +229,16 @@ class GunnsMinorStepLog
         void startLogging();
         /// @brief  Returns the formatted output file contents as a string.
         std::string renderOutput();
+        /// @brief  Writes the binary output file contents to the given stream.
+        void renderBinary(std::ostream& stream);
         /// @brief  Initiates output file write of the log data.
         void initiateDump();
-        /// @brief  Returns a mutable reference to the data at the current ring buffer head.
-        GunnsMinorStepData& head();
-        /// @brief  Returns a const reference to the data at an offset from the current ring buffer head.
-        const GunnsMinorStepData& headOffset(const int offset = 0) const;
+        /// @brief  Returns a pointer to the int values of the given ring buffer frame.
+        int* frameInts(const unsigned int index) const;
+        /// @brief  Returns a pointer to the double values of the given ring buffer frame.
+        double* frameValues(const unsigned int index) const;
+        /// @brief  Returns the ring buffer index at an offset from the current ring buffer head.
+        unsigned int headOffset(const int offset = 0) const;
 
     private:
         /// @details  Assignment operator unavailable since declared private and not implemented.
@@ -254,24 +290,39 @@ inline void GunnsMinorStepLog::stopLogging()
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @returns  GunnsMinorStepData& (--) Reference to the data at the current ring buffer head.
+/// @param[in]  index  (--)  Index of the frame in the ring buffer.
+///
+/// @returns  int* (--) Pointer to the frame's int values, indexed by FrameInts.
+///
+/// @details  Returns a pointer to the int values at the start of the given ring buffer frame.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline int* GunnsMinorStepLog::frameInts(const unsigned int index) const
+{
+    return reinterpret_cast<int*>(mArena + index * mFrameSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  index  (--)  Index of the frame in the ring buffer.
+///
+/// @returns  double* (--) Pointer to the frame's double values.
 ///
-/// @details  Returns a reference to the data at the current ring buffer head.
+/// @details  Returns a pointer to the double values of the given ring buffer frame, which follow the
+///           padded int values.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-inline GunnsMinorStepData& GunnsMinorStepLog::head()
+inline double* GunnsMinorStepLog::frameValues(const unsigned int index) const
 {
-    return mBuffer[mHeadIndex];
+    return reinterpret_cast<double*>(mArena + index * mFrameSize + mIntsSize);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in]  offset  (--)  Frame offset relative to the current head to retrieve.
 ///
-/// @returns  GunnsMinorStepData& (--) Const reference to the data.
+/// @returns  unsigned int (--) Index of the frame in the ring buffer.
 ///
-/// @details  Returns a const reference to the data at the given offset from the current ring buffer
-///           head.
+/// @details  Returns the ring buffer index of the frame at the given offset from the current ring
+///           buffer head.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-inline const GunnsMinorStepData& GunnsMinorStepLog::headOffset(const int offset) const
+inline unsigned int GunnsMinorStepLog::headOffset(const int offset) const
 {
     //TODO what if offset wraps around multiple times? would be an invalid argument...
     int index = mHeadIndex + offset;
@@ -280,7 +331,7 @@ inline const GunnsMinorStepData& GunnsMinorStepLog::headOffset(const int offset)
     } else if (index >= static_cast<int>(mSize)) {
         index -= mSize;
     }
-    return mBuffer[index];
+    return index;
 }
 
 #endif
@@ -0,0 +1,491 @@
+#ifndef GunnsStaticNetwork_EXISTS
+#define GunnsStaticNetwork_EXISTS
+
+/**
+@file
+@brief     GUNNS Static Network Composition declarations
+
+@defgroup  TSM_GUNNS_CORE_STATIC_NETWORK    GUNNS Static Network Composition
+@ingroup   TSM_GUNNS_CORE
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:   (Provides templates for composing a network's links and node maps at compile time, for
+            the solver to step the links, compute their flows and assemble the system without
+            virtual dispatch or node map lookups.)
+
+@details
+REFERENCE:
+- (TBD)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (Each link's type must be its exact run-time type, since calls are qualified with it.)
+- (Fixed-port elements support up to 4 ports.  Links with more ports or a variable number of
+   ports use GunnsStaticLinkN, which still calls the link directly but reads its node map.)
+- (Only stand-alone networks are supported, since node numbers are fixed at compile time and
+   sub-networks are offset by their super-network.)
+- (Node maps are fixed at compile time.  If a link moves a port at run-time (port commands,
+   jumpers, sockets, etc.), the solver finds the mismatch after stepping the links, warns and
+   reverts to its own link loops.)
+- (The list nests one template per link, so very large networks may exceed the compiler's
+   template instantiation depth.  GunnsDraw's netexport.py limits the links it composes.)
+
+LIBRARY DEPENDENCY:
+- ()
+
+PROGRAMMERS:
+- ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+
+@{
+*/
+
+#include "core/GunnsBasicLink.hh"
+#include "core/GunnsLinkDispatcher.hh"
+#include <typeinfo>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Static Link Element with compile-time node map.
+///
+/// @details  Holds a pointer to a link of the exact type LinkT whose ports connect to nodes N0-N3.
+///           Unused ports are -1.  Calls to the link are qualified with LinkT so they are direct
+///           calls instead of virtual, and the link's admittance matrix and source vector are added
+///           to the system with indexes that are constant at compile time.  Contributions to the
+///           Ground node, which isn't in the system, are removed at compile time.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class LinkT, int N0, int N1 = -1, int N2 = -1, int N3 = -1>
+class GunnsStaticLink
+{
+    public:
+        /// @brief  Number of link ports.
+        enum {NUM_PORTS = (N0 >= 0) + (N1 >= 0) + (N2 >= 0) + (N3 >= 0)};
+        /// @brief  Default constructor.
+        GunnsStaticLink() : mLink(0), mAdmittance(0), mSource(0) {}
+        /// @brief  Binds to the given link and returns whether its type and node map match.
+        bool bind(GunnsBasicLink* link);
+        /// @brief  Steps the link, returns whether it needs an admittance update.
+        bool step(const double dt);
+        /// @brief  Minor-steps the link if non-linear, returns whether it needs an admittance update.
+        bool minorStep(const double dt, const int minorStep);
+        /// @brief  Computes the link flows.
+        void computeFlows(const double dt);
+        /// @brief  Adds the link admittance matrix to the system admittance matrix.
+        template <int SIZE> void buildAdmittanceMatrix(double* admittanceMatrix) const;
+        /// @brief  Adds the link source vector to the system source vector.
+        template <int SIZE> void buildSourceVector(double* sourceVector) const;
+        /// @brief  Returns whether the link's node map still matches this element.
+        bool checkNodeMap() const;
+
+    protected:
+        LinkT*        mLink;       /**< ** (--) trick_chkpnt_io(**) The bound link. */
+        const double* mAdmittance; /**< ** (--) trick_chkpnt_io(**) The link's admittance matrix. */
+        const double* mSource;     /**< ** (--) trick_chkpnt_io(**) The link's source vector. */
+        /// @brief  Adds one row of the link admittance matrix to the system admittance matrix.
+        template <int SIZE, int ROW> void addRow(double* admittanceMatrix, const double* row) const;
+        /// @brief  Adds one term to the system admittance matrix, if both nodes are in the system.
+        template <int SIZE, int ROW, int COL> static void addTerm(double* admittanceMatrix,
+                                                                  const double  term);
+        /// @brief  Adds one term to the system source vector, if the node is in the system.
+        template <int SIZE, int ROW> static void addSource(double* sourceVector, const double term);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Static Link Element with run-time node map.
+///
+/// @details  Holds a pointer to a link of the exact type LinkT and calls it directly like
+///           GunnsStaticLink, but assembles its contributions with its node map like the solver.
+///           This is for links with more than 4 ports, or a number of ports that is configured.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class LinkT>
+class GunnsStaticLinkN : public GunnsStaticLink<LinkT, -1>
+{
+    public:
+        /// @brief  Default constructor.
+        GunnsStaticLinkN() : GunnsStaticLink<LinkT, -1>(), mNodeMap(0), mNumPorts(0) {}
+        /// @brief  Binds to the given link and returns whether its type matches.
+        bool bind(GunnsBasicLink* link);
+        /// @brief  Adds the link admittance matrix to the system admittance matrix.
+        template <int SIZE> void buildAdmittanceMatrix(double* admittanceMatrix) const;
+        /// @brief  Adds the link source vector to the system source vector.
+        template <int SIZE> void buildSourceVector(double* sourceVector) const;
+        /// @brief  Returns true, since the node map is read from the link.
+        bool checkNodeMap() const {return true;}
+
+    protected:
+        const int* mNodeMap;  /**< ** (--) trick_chkpnt_io(**) The link's node map. */
+        int        mNumPorts; /**< *o (--) trick_chkpnt_io(**) The link's number of ports. */
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Static Link List terminator.
+///
+/// @details  Ends a GunnsStaticLinkList, and does nothing.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsStaticLinkListEnd
+{
+    public:
+        /// @brief  Number of links in the list.
+        enum {NUM_LINKS = 0};
+        /// @brief  Does nothing, returns true.
+        bool bind(GunnsBasicLink**) {return true;}
+        /// @brief  Does nothing, returns false.
+        bool step(const double) {return false;}
+        /// @brief  Does nothing, returns false.
+        bool minorStep(const double, const int) {return false;}
+        /// @brief  Does nothing.
+        void computeFlows(const double) {}
+        /// @brief  Does nothing.
+        template <int SIZE> void buildAdmittanceMatrix(double*) const {}
+        /// @brief  Does nothing.
+        template <int SIZE> void buildSourceVector(double*) const {}
+        /// @brief  Does nothing, returns true.
+        bool checkNodeMaps() const {return true;}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Static Link List.
+///
+/// @details  A compile-time list of link elements (GunnsStaticLink or GunnsStaticLinkN), in the
+///           same order as the solver's links.  HeadT is the first element and TailT is the list of
+///           the remaining elements, ending with GunnsStaticLinkListEnd.  Each operation applies to
+///           the head then recurses into the tail, which the compiler expands into straight-line
+///           code over all the links.  For example, a conductor from Node0 to Node1 followed by a
+///           potential source from Ground to Node0:
+///
+///               typedef GunnsStaticLinkList<GunnsStaticLink<GunnsBasicConductor, Node0, Node1>,
+///                       GunnsStaticLinkList<GunnsStaticLink<GunnsBasicPotential, GROUND, Node0>
+///                       > > Links;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class HeadT, class TailT = GunnsStaticLinkListEnd>
+class GunnsStaticLinkList
+{
+    public:
+        /// @brief  Number of links in the list.
+        enum {NUM_LINKS = 1 + TailT::NUM_LINKS};
+        /// @brief  Binds the elements to the given array of links, returns whether they all match.
+        bool bind(GunnsBasicLink** links)
+        {
+            return mHead.bind(links[0]) and mTail.bind(links + 1);
+        }
+        /// @brief  Steps the links in order, returns whether any needs an admittance update.
+        bool step(const double dt)
+        {
+            const bool head = mHead.step(dt);
+            const bool tail = mTail.step(dt);
+            return head or tail;
+        }
+        /// @brief  Minor-steps the links in order, returns whether any needs an admittance update.
+        bool minorStep(const double dt, const int minorStep)
+        {
+            const bool head = mHead.minorStep(dt, minorStep);
+            const bool tail = mTail.minorStep(dt, minorStep);
+            return head or tail;
+        }
+        /// @brief  Computes the link flows in reverse order, like the basic flow orchestrator.
+        void computeFlows(const double dt)
+        {
+            mTail.computeFlows(dt);
+            mHead.computeFlows(dt);
+        }
+        /// @brief  Adds the link admittance matrices to the system in order.
+        template <int SIZE> void buildAdmittanceMatrix(double* admittanceMatrix) const
+        {
+            mHead.template buildAdmittanceMatrix<SIZE>(admittanceMatrix);
+            mTail.template buildAdmittanceMatrix<SIZE>(admittanceMatrix);
+        }
+        /// @brief  Adds the link source vectors to the system in order.
+        template <int SIZE> void buildSourceVector(double* sourceVector) const
+        {
+            mHead.template buildSourceVector<SIZE>(sourceVector);
+            mTail.template buildSourceVector<SIZE>(sourceVector);
+        }
+        /// @brief  Returns whether all the links' node maps still match their elements.
+        bool checkNodeMaps() const
+        {
+            return mHead.checkNodeMap() and mTail.checkNodeMaps();
+        }
+
+    protected:
+        HeadT mHead; /**< ** (--) trick_chkpnt_io(**) The first link element. */
+        TailT mTail; /**< ** (--) trick_chkpnt_io(**) The remaining link elements. */
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Static Network link dispatcher.
+///
+/// @details  Dispatches the solver's link loops to a GunnsStaticLinkList of a network with SIZE
+///           non-Ground nodes.  Give this to the solver with Gunns::setLinkDispatcher before or
+///           after initializing it.  The solver binds this to its links at initialization, and
+///           reverts to its own link loops with a warning if the links don't match the list.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class ListT, int SIZE>
+class GunnsStaticNetwork : public GunnsLinkDispatcher
+{
+    public:
+        /// @brief  Default constructor.
+        GunnsStaticNetwork() : GunnsLinkDispatcher(), mLinks() {}
+        /// @brief  Default destructor.
+        virtual ~GunnsStaticNetwork() {}
+        /// @brief  Binds to and verifies the solver's links, returns false if they don't match.
+        virtual bool bind(GunnsBasicLink** links, const int numLinks, const int networkSize)
+        {
+            return ListT::NUM_LINKS == numLinks and SIZE == networkSize and mLinks.bind(links);
+        }
+        /// @brief  Steps all links, returns whether any link needs an admittance update.
+        virtual bool step(const double dt)
+        {
+            return mLinks.step(dt);
+        }
+        /// @brief  Minor-steps non-linear links, returns whether any link needs an admittance update.
+        virtual bool minorStep(const double dt, const int minorStep)
+        {
+            return mLinks.minorStep(dt, minorStep);
+        }
+        /// @brief  Computes all link flows, in reverse link order.
+        virtual void computeFlows(const double dt)
+        {
+            mLinks.computeFlows(dt);
+        }
+        /// @brief  Adds the link admittance matrices to the zeroed system admittance matrix.
+        virtual void buildAdmittanceMatrix(double* admittanceMatrix) const
+        {
+            mLinks.template buildAdmittanceMatrix<SIZE>(admittanceMatrix);
+        }
+        /// @brief  Adds the link source vectors to the zeroed system source vector.
+        virtual void buildSourceVector(double* sourceVector) const
+        {
+            mLinks.template buildSourceVector<SIZE>(sourceVector);
+        }
+        /// @brief  Returns whether the links' node maps still match the composition.
+        virtual bool checkNodeMaps() const
+        {
+            return mLinks.checkNodeMaps();
+        }
+
+    protected:
+        ListT mLinks; /**< ** (--) trick_chkpnt_io(**) The list of link elements. */
+
+    private:
+        /// @brief  Copy constructor unavailable since declared private and not implemented.
+        GunnsStaticNetwork(const GunnsStaticNetwork& that);
+        /// @brief  Assignment operator unavailable since declared private and not implemented.
+        GunnsStaticNetwork& operator =(const GunnsStaticNetwork& that);
+};
+
+/// @}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] link (--) The solver's link to bind to.
+///
+/// @returns  bool (--) True if the link's type, number of ports and node map match this element.
+///
+/// @details  The type must match exactly, because the qualified calls would skip the overrides of
+///           a derived type.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class LinkT, int N0, int N1, int N2, int N3>
+inline bool GunnsStaticLink<LinkT, N0, N1, N2, N3>::bind(GunnsBasicLink* link)
+{
+    mLink       = 0;
+    mAdmittance = 0;
+    mSource     = 0;
+    if (not link or typeid(*link) != typeid(LinkT) or NUM_PORTS != link->getNumberPorts()) {
+        return false;
+    }
+    const int  nodes[4] = {N0, N1, N2, N3};
+    const int* nodeMap  = link->getNodeMap();
+    for (int port = 0; port < NUM_PORTS; ++port) {
+        if (nodes[port] != nodeMap[port]) {
+            return false;
+        }
+    }
+    mLink       = static_cast<LinkT*>(link);
+    mAdmittance = link->getAdmittanceMatrix();
+    mSource     = link->getSourceVector();
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] dt (s) Integration time step.
+///
+/// @returns  bool (--) True if the link needs an admittance update.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class LinkT, int N0, int N1, int N2, int N3>
+inline bool GunnsStaticLink<LinkT, N0, N1, N2, N3>::step(const double dt)
+{
+    mLink->LinkT::step(dt);
+    return mLink->LinkT::needAdmittanceUpdate();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] dt        (s)  Integration time step.
+/// @param[in] minorStep (--) The minor step number that the network is on.
+///
+/// @returns  bool (--) True if the link needs an admittance update.
+///
+/// @details  Like the solver, linear links aren't minor-stepped but are still checked for an
+///           admittance update.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class LinkT, int N0, int N1, int N2, int N3>
+inline bool GunnsStaticLink<LinkT, N0, N1, N2, N3>::minorStep(const double dt, const int minorStep)
+{
+    if (mLink->LinkT::isNonLinear()) {
+        mLink->LinkT::minorStep(dt, minorStep);
+    }
+    return mLink->LinkT::needAdmittanceUpdate();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] dt (s) Integration time step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class LinkT, int N0, int N1, int N2, int N3>
+inline void GunnsStaticLink<LinkT, N0, N1, N2, N3>::computeFlows(const double dt)
+{
+    mLink->LinkT::computeFlows(dt);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] admittanceMatrix (--) The system admittance matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class LinkT, int N0, int N1, int N2, int N3>
+template <int SIZE>
+inline void GunnsStaticLink<LinkT, N0, N1, N2, N3>::buildAdmittanceMatrix(
+        double* admittanceMatrix) const
+{
+    addRow<SIZE, N0>(admittanceMatrix, mAdmittance);
+    if (NUM_PORTS > 1) addRow<SIZE, N1>(admittanceMatrix, mAdmittance + NUM_PORTS);
+    if (NUM_PORTS > 2) addRow<SIZE, N2>(admittanceMatrix, mAdmittance + NUM_PORTS * 2);
+    if (NUM_PORTS > 3) addRow<SIZE, N3>(admittanceMatrix, mAdmittance + NUM_PORTS * 3);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] admittanceMatrix (--) The system admittance matrix.
+/// @param[in]     row              (--) The row of the link admittance matrix for node ROW.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class LinkT, int N0, int N1, int N2, int N3>
+template <int SIZE, int ROW>
+inline void GunnsStaticLink<LinkT, N0, N1, N2, N3>::addRow(double*       admittanceMatrix,
+                                                           const double* row) const
+{
+    if (ROW >= 0 and ROW < SIZE) {
+        addTerm<SIZE, ROW, N0>(admittanceMatrix, row[0]);
+        if (NUM_PORTS > 1) addTerm<SIZE, ROW, N1>(admittanceMatrix, row[1]);
+        if (NUM_PORTS > 2) addTerm<SIZE, ROW, N2>(admittanceMatrix, row[2]);
+        if (NUM_PORTS > 3) addTerm<SIZE, ROW, N3>(admittanceMatrix, row[3]);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] admittanceMatrix (--) The system admittance matrix.
+/// @param[in]     term             (--) The link admittance term to add at ROW, COL.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class LinkT, int N0, int N1, int N2, int N3>
+template <int SIZE, int ROW, int COL>
+inline void GunnsStaticLink<LinkT, N0, N1, N2, N3>::addTerm(double*      admittanceMatrix,
+                                                            const double term)
+{
+    if (COL >= 0 and COL < SIZE) {
+        admittanceMatrix[ROW * SIZE + COL] += term;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] sourceVector (--) The system source vector.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class LinkT, int N0, int N1, int N2, int N3>
+template <int SIZE>
+inline void GunnsStaticLink<LinkT, N0, N1, N2, N3>::buildSourceVector(double* sourceVector) const
+{
+    addSource<SIZE, N0>(sourceVector, mSource[0]);
+    if (NUM_PORTS > 1) addSource<SIZE, N1>(sourceVector, mSource[1]);
+    if (NUM_PORTS > 2) addSource<SIZE, N2>(sourceVector, mSource[2]);
+    if (NUM_PORTS > 3) addSource<SIZE, N3>(sourceVector, mSource[3]);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] sourceVector (--) The system source vector.
+/// @param[in]     term         (--) The link source term to add at ROW.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class LinkT, int N0, int N1, int N2, int N3>
+template <int SIZE, int ROW>
+inline void GunnsStaticLink<LinkT, N0, N1, N2, N3>::addSource(double* sourceVector, const double term)
+{
+    if (ROW >= 0 and ROW < SIZE) {
+        sourceVector[ROW] += term;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  bool (--) True if the link's node map still matches this element's nodes.
+///
+/// @details  The compared nodes are constant, so this is a few integer compares per link.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class LinkT, int N0, int N1, int N2, int N3>
+inline bool GunnsStaticLink<LinkT, N0, N1, N2, N3>::checkNodeMap() const
+{
+    const int* nodeMap = mLink->getNodeMap();
+    return                    N0 == nodeMap[0]
+       and (NUM_PORTS < 2 or N1 == nodeMap[1])
+       and (NUM_PORTS < 3 or N2 == nodeMap[2])
+       and (NUM_PORTS < 4 or N3 == nodeMap[3]);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] link (--) The solver's link to bind to.
+///
+/// @returns  bool (--) True if the link's type matches this element.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class LinkT>
+inline bool GunnsStaticLinkN<LinkT>::bind(GunnsBasicLink* link)
+{
+    this->mLink       = 0;
+    this->mAdmittance = 0;
+    this->mSource     = 0;
+    mNodeMap          = 0;
+    mNumPorts         = 0;
+    if (not link or typeid(*link) != typeid(LinkT)) {
+        return false;
+    }
+    this->mLink       = static_cast<LinkT*>(link);
+    this->mAdmittance = link->getAdmittanceMatrix();
+    this->mSource     = link->getSourceVector();
+    mNodeMap          = link->getNodeMap();
+    mNumPorts         = link->getNumberPorts();
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] admittanceMatrix (--) The system admittance matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class LinkT>
+template <int SIZE>
+inline void GunnsStaticLinkN<LinkT>::buildAdmittanceMatrix(double* admittanceMatrix) const
+{
+    for (int port1 = 0; port1 < mNumPorts; ++port1) {
+        const int node1 = mNodeMap[port1];
+        if (node1 < SIZE) {
+            for (int port2 = 0, a = port1 * mNumPorts; port2 < mNumPorts; ++port2, ++a) {
+                const int node2 = mNodeMap[port2];
+                if (node2 < SIZE) {
+                    admittanceMatrix[node1 * SIZE + node2] += this->mAdmittance[a];
+                }
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] sourceVector (--) The system source vector.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class LinkT>
+template <int SIZE>
+inline void GunnsStaticLinkN<LinkT>::buildSourceVector(double* sourceVector) const
+{
+    for (int port = 0; port < mNumPorts; ++port) {
+        const int node = mNodeMap[port];
+        if (node < SIZE) {
+            sourceVector[node] += this->mSource[port];
+        }
+    }
+}
+
+#endif
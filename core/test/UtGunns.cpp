@@ -6,6 +6,7 @@
 #include <iostream>
 #include <cmath>
 #include <cfloat>
+#include <limits>
 
 #include "UtGunns.hh"
 #include "UtGunnsMinorStepLog.hh"
@@ -413,6 +414,8 @@ void UtGunns::testDefaultConstruction()
     CPPUNIT_ASSERT(0             == tNetwork.mLastDecomposition);
     CPPUNIT_ASSERT(0             == tNetwork.mAvgDecompositionCount);
     CPPUNIT_ASSERT(0.0           == tNetwork.mSolveTime);
+    CPPUNIT_ASSERT(0.0           == tNetwork.mDecomposeTimeWorking);
+    CPPUNIT_ASSERT(0.0           == tNetwork.mDecomposeTime);
     CPPUNIT_ASSERT(0.0           == tNetwork.mStepTime);
     CPPUNIT_ASSERT(false         == tNetwork.mWorstCaseTiming);
     CPPUNIT_ASSERT(0             == tNetwork.mLinksConvergence);
@@ -429,6 +432,25 @@ void UtGunns::testDefaultConstruction()
     CPPUNIT_ASSERT(1.0e-12       == tNetwork.mSorTolerance);
     CPPUNIT_ASSERT(-1            == tNetwork.mSorLastIteration);
     CPPUNIT_ASSERT(0             == tNetwork.mSorFailCount);
+    CPPUNIT_ASSERT(false         == tNetwork.mMixedPrecision);
+    CPPUNIT_ASSERT(10            == tNetwork.mRefinementLimit);
+    CPPUNIT_ASSERT(1.0E-13       == tNetwork.mRefinementTolerance);
+    CPPUNIT_ASSERT(false         == tNetwork.mRefinementEscalated);
+    CPPUNIT_ASSERT(0             == tNetwork.mAdmittanceMatrixSingle);
+    CPPUNIT_ASSERT(0             == tNetwork.mAdmittanceMatrixSingleIsland);
+    CPPUNIT_ASSERT(0             == tNetwork.mAdmittanceMatrixLdu);
+    CPPUNIT_ASSERT(0             == tNetwork.mRefinementResidualVector);
+    CPPUNIT_ASSERT(0             == tNetwork.mRefinementCorrection);
+    CPPUNIT_ASSERT(0             == tNetwork.mRefinementCount);
+    CPPUNIT_ASSERT(0             == tNetwork.mMaxRefinementCount);
+    CPPUNIT_ASSERT(0.0           == tNetwork.mRefinementResidual);
+    CPPUNIT_ASSERT(0             == tNetwork.mRefinementEscalationCount);
+    CPPUNIT_ASSERT(0             == tNetwork.mFactorReuseLimit);
+    CPPUNIT_ASSERT(0.5           == tNetwork.mFactorReuseRate);
+    CPPUNIT_ASSERT(false         == tNetwork.mFactorsStale);
+    CPPUNIT_ASSERT(0             == tNetwork.mFactorReuseSteps);
+    CPPUNIT_ASSERT(0.0           == tNetwork.mLastConvergenceDelta);
+    CPPUNIT_ASSERT(0             == tNetwork.mFactorReuseCount);
     CPPUNIT_ASSERT(Gunns::NORMAL == tNetwork.mLastSolverMode);
     CPPUNIT_ASSERT(Gunns::OFF    == tNetwork.mLastIslandMode);
     CPPUNIT_ASSERT(Gunns::RUN    == tNetwork.mLastRunMode);
@@ -880,19 +902,19 @@ void UtGunns::testLinearStep()
 
     /// - Verify outputs to the minor step log.
     FriendlyGunnsMinorStepLog* log = static_cast<FriendlyGunnsMinorStepLog*>(&tNetwork.mStepLog);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[0].mMajorStep);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[0].mMinorStep);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[0].mDecomposition);
-    CPPUNIT_ASSERT(tNetwork.mPotentialVector[0]        == log->mBuffer[0].mPotentialVector[0]);
-    CPPUNIT_ASSERT(tNetwork.mPotentialVector[1]        == log->mBuffer[0].mPotentialVector[1]);
-    CPPUNIT_ASSERT(tNetwork.mPotentialVector[2]        == log->mBuffer[0].mPotentialVector[2]);
-    CPPUNIT_ASSERT(0.0                                 == log->mBuffer[0].mNodesConvergence[0]);
-    CPPUNIT_ASSERT(0.0                                 == log->mBuffer[0].mNodesConvergence[1]);
-    CPPUNIT_ASSERT(0.0                                 == log->mBuffer[0].mNodesConvergence[2]);
-    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->mBuffer[0].mSolutionResult);
-    CPPUNIT_ASSERT(tPotential.getAdmittanceMatrix()[0] == log->mBuffer[0].mLinksData[0].mAdmittanceMatrix[0]);
-    CPPUNIT_ASSERT(tSource.getSourceVector()[0]        == log->mBuffer[0].mLinksData[4].mSourceVector[0]);
-    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM             == log->mBuffer[0].mLinksData[0].mSolutionResult);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(0).mMajorStep);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(0).mMinorStep);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(0).mDecomposition);
+    CPPUNIT_ASSERT(tNetwork.mPotentialVector[0]        == log->getFrame(0).mPotentialVector[0]);
+    CPPUNIT_ASSERT(tNetwork.mPotentialVector[1]        == log->getFrame(0).mPotentialVector[1]);
+    CPPUNIT_ASSERT(tNetwork.mPotentialVector[2]        == log->getFrame(0).mPotentialVector[2]);
+    CPPUNIT_ASSERT(0.0                                 == log->getFrame(0).mNodesConvergence[0]);
+    CPPUNIT_ASSERT(0.0                                 == log->getFrame(0).mNodesConvergence[1]);
+    CPPUNIT_ASSERT(0.0                                 == log->getFrame(0).mNodesConvergence[2]);
+    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->getFrame(0).mSolutionResult);
+    CPPUNIT_ASSERT(tPotential.getAdmittanceMatrix()[0] == log->getFrame(0).mLinksData[0].mAdmittanceMatrix[0]);
+    CPPUNIT_ASSERT(tSource.getSourceVector()[0]        == log->getFrame(0).mLinksData[4].mSourceVector[0]);
+    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM             == log->getFrame(0).mLinksData[0].mSolutionResult);
 
     /// - Step again and verify results of the 2nd major step.
     tNetwork.step(tDeltaTime);
@@ -913,9 +935,9 @@ void UtGunns::testLinearStep()
             tNetwork.mPotentialVector[2], DBL_EPSILON);
 
     /// - Verify outputs to the minor step log.
-    CPPUNIT_ASSERT(2 == log->mBuffer[1].mMajorStep);
-    CPPUNIT_ASSERT(1 == log->mBuffer[1].mMinorStep);
-    CPPUNIT_ASSERT(0 == log->mBuffer[1].mDecomposition);
+    CPPUNIT_ASSERT(2 == log->getFrame(1).mMajorStep);
+    CPPUNIT_ASSERT(1 == log->getFrame(1).mMinorStep);
+    CPPUNIT_ASSERT(0 == log->getFrame(1).mDecomposition);
 
     /// - Step a 3rd time with tConductor2 overriding its port 0 potential, and verify the network
     ///   solution gets this override value and passes it to other incident links on that node.
@@ -955,17 +977,17 @@ void UtGunns::testNonLinearStep()
 
     /// - Verify minor step log init.
     FriendlyGunnsMinorStepLog* log = static_cast<FriendlyGunnsMinorStepLog*>(&tNetwork.mStepLog);
+    CPPUNIT_ASSERT(0                         != log->mArena);
     CPPUNIT_ASSERT(5                         == log->mSize);
-    CPPUNIT_ASSERT(5                         == log->mBuffer.size());
     CPPUNIT_ASSERT(GunnsMinorStepLog::PAUSED == log->mState);
     CPPUNIT_ASSERT(true                      == log->mIsRecording);
     CPPUNIT_ASSERT(4                         == log->mHeadIndex);
-    CPPUNIT_ASSERT(4                         == log->mBuffer[0].mPotentialVector.size());
-    CPPUNIT_ASSERT(4                         == log->mBuffer[4].mPotentialVector.size());
-    CPPUNIT_ASSERT(8                         == log->mBuffer[0].mLinksData.size());
-    CPPUNIT_ASSERT(8                         == log->mBuffer[4].mLinksData.size());
-    CPPUNIT_ASSERT(4                         == log->mBuffer[4].mLinksData[4].mAdmittanceMatrix.size());
-    CPPUNIT_ASSERT(2                         == log->mBuffer[4].mLinksData[4].mSourceVector.size());
+    CPPUNIT_ASSERT(4                         == log->getFrame(0).mPotentialVector.size());
+    CPPUNIT_ASSERT(4                         == log->getFrame(4).mPotentialVector.size());
+    CPPUNIT_ASSERT(8                         == log->getFrame(0).mLinksData.size());
+    CPPUNIT_ASSERT(8                         == log->getFrame(4).mLinksData.size());
+    CPPUNIT_ASSERT(4                         == log->getFrame(4).mLinksData[4].mAdmittanceMatrix.size());
+    CPPUNIT_ASSERT(2                         == log->getFrame(4).mLinksData[4].mSourceVector.size());
 
     /// - Step the network and verify the correct system values.
     tNetwork.step(tDeltaTime);
@@ -1073,35 +1095,35 @@ void UtGunns::testNonLinearStep()
     CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.4027427138927351e-03, tNetwork.mNodesConvergence[3], DBL_EPSILON);
 
     /// - Verify outputs to the minor step log.
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[0].mMajorStep);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[1].mMajorStep);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[2].mMajorStep);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[3].mMajorStep);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[4].mMajorStep);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[0].mMinorStep);
-    CPPUNIT_ASSERT(2                                   == log->mBuffer[1].mMinorStep);
-    CPPUNIT_ASSERT(3                                   == log->mBuffer[2].mMinorStep);
-    CPPUNIT_ASSERT(4                                   == log->mBuffer[3].mMinorStep);
-    CPPUNIT_ASSERT(5                                   == log->mBuffer[4].mMinorStep);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[0].mDecomposition);
-    CPPUNIT_ASSERT(2                                   == log->mBuffer[1].mDecomposition);
-    CPPUNIT_ASSERT(3                                   == log->mBuffer[2].mDecomposition);
-    CPPUNIT_ASSERT(4                                   == log->mBuffer[3].mDecomposition);
-    CPPUNIT_ASSERT(5                                   == log->mBuffer[4].mDecomposition);
-    CPPUNIT_ASSERT(tNetwork.mPotentialVector[0]        == log->mBuffer[4].mPotentialVector[0]);
-    CPPUNIT_ASSERT(tNetwork.mPotentialVector[1]        == log->mBuffer[4].mPotentialVector[1]);
-    CPPUNIT_ASSERT(tNetwork.mPotentialVector[2]        == log->mBuffer[4].mPotentialVector[2]);
-    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[0]       == log->mBuffer[4].mNodesConvergence[0]);
-    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[1]       == log->mBuffer[4].mNodesConvergence[1]);
-    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[2]       == log->mBuffer[4].mNodesConvergence[2]);
-    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->mBuffer[0].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->mBuffer[1].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->mBuffer[2].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->mBuffer[3].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::SUCCESS         == log->mBuffer[4].mSolutionResult);
-    CPPUNIT_ASSERT(tPotential.getAdmittanceMatrix()[0] == log->mBuffer[4].mLinksData[0].mAdmittanceMatrix[0]);
-    CPPUNIT_ASSERT(tConstantLoad2.getSourceVector()[0] == log->mBuffer[4].mLinksData[6].mSourceVector[0]);
-    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM             == log->mBuffer[4].mLinksData[0].mSolutionResult);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(0).mMajorStep);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(1).mMajorStep);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(2).mMajorStep);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(3).mMajorStep);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(4).mMajorStep);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(0).mMinorStep);
+    CPPUNIT_ASSERT(2                                   == log->getFrame(1).mMinorStep);
+    CPPUNIT_ASSERT(3                                   == log->getFrame(2).mMinorStep);
+    CPPUNIT_ASSERT(4                                   == log->getFrame(3).mMinorStep);
+    CPPUNIT_ASSERT(5                                   == log->getFrame(4).mMinorStep);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(0).mDecomposition);
+    CPPUNIT_ASSERT(2                                   == log->getFrame(1).mDecomposition);
+    CPPUNIT_ASSERT(3                                   == log->getFrame(2).mDecomposition);
+    CPPUNIT_ASSERT(4                                   == log->getFrame(3).mDecomposition);
+    CPPUNIT_ASSERT(5                                   == log->getFrame(4).mDecomposition);
+    CPPUNIT_ASSERT(tNetwork.mPotentialVector[0]        == log->getFrame(4).mPotentialVector[0]);
+    CPPUNIT_ASSERT(tNetwork.mPotentialVector[1]        == log->getFrame(4).mPotentialVector[1]);
+    CPPUNIT_ASSERT(tNetwork.mPotentialVector[2]        == log->getFrame(4).mPotentialVector[2]);
+    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[0]       == log->getFrame(4).mNodesConvergence[0]);
+    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[1]       == log->getFrame(4).mNodesConvergence[1]);
+    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[2]       == log->getFrame(4).mNodesConvergence[2]);
+    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->getFrame(0).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->getFrame(1).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->getFrame(2).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->getFrame(3).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::SUCCESS         == log->getFrame(4).mSolutionResult);
+    CPPUNIT_ASSERT(tPotential.getAdmittanceMatrix()[0] == log->getFrame(4).mLinksData[0].mAdmittanceMatrix[0]);
+    CPPUNIT_ASSERT(tConstantLoad2.getSourceVector()[0] == log->getFrame(4).mLinksData[6].mSourceVector[0]);
+    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM             == log->getFrame(4).mLinksData[0].mSolutionResult);
     CPPUNIT_ASSERT(GunnsMinorStepLog::RECORDING_SNAP   == log->mState);
     CPPUNIT_ASSERT(true                                == log->mIsRecording);
     CPPUNIT_ASSERT(4                                   == log->mHeadIndex);
@@ -1211,35 +1233,35 @@ void UtGunns::testNonLinearStep()
     CPPUNIT_ASSERT_EQUAL( 0, tNetwork.mConvergenceFailCount);
 
     /// - Verify outputs to the minor step log.
-    CPPUNIT_ASSERT(2                                   == log->mBuffer[0].mMajorStep);
-    CPPUNIT_ASSERT(2                                   == log->mBuffer[1].mMajorStep);
-    CPPUNIT_ASSERT(2                                   == log->mBuffer[2].mMajorStep);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[3].mMajorStep);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[4].mMajorStep);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[0].mMinorStep);
-    CPPUNIT_ASSERT(2                                   == log->mBuffer[1].mMinorStep);
-    CPPUNIT_ASSERT(3                                   == log->mBuffer[2].mMinorStep);
-    CPPUNIT_ASSERT(4                                   == log->mBuffer[3].mMinorStep);
-    CPPUNIT_ASSERT(5                                   == log->mBuffer[4].mMinorStep);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[0].mDecomposition);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[1].mDecomposition);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[2].mDecomposition);
-    CPPUNIT_ASSERT(4                                   == log->mBuffer[3].mDecomposition);
-    CPPUNIT_ASSERT(5                                   == log->mBuffer[4].mDecomposition);
-    CPPUNIT_ASSERT(tNetwork.mPotentialVector[0]        == log->mBuffer[2].mPotentialVector[0]);
-    CPPUNIT_ASSERT(tNetwork.mPotentialVector[1]        == log->mBuffer[2].mPotentialVector[1]);
-    CPPUNIT_ASSERT(tNetwork.mPotentialVector[2]        == log->mBuffer[2].mPotentialVector[2]);
-    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[0]       == log->mBuffer[2].mNodesConvergence[0]);
-    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[1]       == log->mBuffer[2].mNodesConvergence[1]);
-    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[2]       == log->mBuffer[2].mNodesConvergence[2]);
-    CPPUNIT_ASSERT(GunnsMinorStepData::DELAY           == log->mBuffer[0].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::DELAY           == log->mBuffer[1].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::SUCCESS         == log->mBuffer[2].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->mBuffer[3].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::SUCCESS         == log->mBuffer[4].mSolutionResult);
-    CPPUNIT_ASSERT(tPotential.getAdmittanceMatrix()[0] == log->mBuffer[2].mLinksData[0].mAdmittanceMatrix[0]);
-    CPPUNIT_ASSERT(tConstantLoad2.getSourceVector()[0] == log->mBuffer[2].mLinksData[6].mSourceVector[0]);
-    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM             == log->mBuffer[2].mLinksData[0].mSolutionResult);
+    CPPUNIT_ASSERT(2                                   == log->getFrame(0).mMajorStep);
+    CPPUNIT_ASSERT(2                                   == log->getFrame(1).mMajorStep);
+    CPPUNIT_ASSERT(2                                   == log->getFrame(2).mMajorStep);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(3).mMajorStep);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(4).mMajorStep);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(0).mMinorStep);
+    CPPUNIT_ASSERT(2                                   == log->getFrame(1).mMinorStep);
+    CPPUNIT_ASSERT(3                                   == log->getFrame(2).mMinorStep);
+    CPPUNIT_ASSERT(4                                   == log->getFrame(3).mMinorStep);
+    CPPUNIT_ASSERT(5                                   == log->getFrame(4).mMinorStep);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(0).mDecomposition);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(1).mDecomposition);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(2).mDecomposition);
+    CPPUNIT_ASSERT(4                                   == log->getFrame(3).mDecomposition);
+    CPPUNIT_ASSERT(5                                   == log->getFrame(4).mDecomposition);
+    CPPUNIT_ASSERT(tNetwork.mPotentialVector[0]        == log->getFrame(2).mPotentialVector[0]);
+    CPPUNIT_ASSERT(tNetwork.mPotentialVector[1]        == log->getFrame(2).mPotentialVector[1]);
+    CPPUNIT_ASSERT(tNetwork.mPotentialVector[2]        == log->getFrame(2).mPotentialVector[2]);
+    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[0]       == log->getFrame(2).mNodesConvergence[0]);
+    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[1]       == log->getFrame(2).mNodesConvergence[1]);
+    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[2]       == log->getFrame(2).mNodesConvergence[2]);
+    CPPUNIT_ASSERT(GunnsMinorStepData::DELAY           == log->getFrame(0).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::DELAY           == log->getFrame(1).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::SUCCESS         == log->getFrame(2).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->getFrame(3).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::SUCCESS         == log->getFrame(4).mSolutionResult);
+    CPPUNIT_ASSERT(tPotential.getAdmittanceMatrix()[0] == log->getFrame(2).mLinksData[0].mAdmittanceMatrix[0]);
+    CPPUNIT_ASSERT(tConstantLoad2.getSourceVector()[0] == log->getFrame(2).mLinksData[6].mSourceVector[0]);
+    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM             == log->getFrame(2).mLinksData[0].mSolutionResult);
     CPPUNIT_ASSERT(GunnsMinorStepLog::RECORDING_SNAP   == log->mState);
     CPPUNIT_ASSERT(true                                == log->mIsRecording);
     CPPUNIT_ASSERT(2                                   == log->mHeadIndex);
@@ -1290,18 +1312,18 @@ void UtGunns::testLinearStepExceptions()
 
     /// - Verify outputs to the minor step log.
     FriendlyGunnsMinorStepLog* log = static_cast<FriendlyGunnsMinorStepLog*>(&tNetwork.mStepLog);
-    CPPUNIT_ASSERT(1                              == log->mBuffer[0].mMajorStep);
-    CPPUNIT_ASSERT(1                              == log->mBuffer[0].mMinorStep);
-    CPPUNIT_ASSERT(1                              == log->mBuffer[0].mDecomposition);
-    CPPUNIT_ASSERT(0.0                            == log->mBuffer[0].mPotentialVector[0]);
-    CPPUNIT_ASSERT(0.0                            == log->mBuffer[0].mPotentialVector[1]);
-    CPPUNIT_ASSERT(0.0                            == log->mBuffer[0].mNodesConvergence[0]);
-    CPPUNIT_ASSERT(0.0                            == log->mBuffer[0].mNodesConvergence[1]);
-    CPPUNIT_ASSERT(GunnsMinorStepData::MATH_FAIL  == log->mBuffer[0].mSolutionResult);
-    CPPUNIT_ASSERT(tLink.getAdmittanceMatrix()[0] == log->mBuffer[0].mLinksData[0].mAdmittanceMatrix[0]);
-    CPPUNIT_ASSERT(tLink.getAdmittanceMatrix()[1] == log->mBuffer[0].mLinksData[0].mAdmittanceMatrix[1]);
-    CPPUNIT_ASSERT(tLink.getSourceVector()[0]     == log->mBuffer[0].mLinksData[0].mSourceVector[0]);
-    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM        == log->mBuffer[0].mLinksData[0].mSolutionResult);
+    CPPUNIT_ASSERT(1                              == log->getFrame(0).mMajorStep);
+    CPPUNIT_ASSERT(1                              == log->getFrame(0).mMinorStep);
+    CPPUNIT_ASSERT(1                              == log->getFrame(0).mDecomposition);
+    CPPUNIT_ASSERT(0.0                            == log->getFrame(0).mPotentialVector[0]);
+    CPPUNIT_ASSERT(0.0                            == log->getFrame(0).mPotentialVector[1]);
+    CPPUNIT_ASSERT(0.0                            == log->getFrame(0).mNodesConvergence[0]);
+    CPPUNIT_ASSERT(0.0                            == log->getFrame(0).mNodesConvergence[1]);
+    CPPUNIT_ASSERT(GunnsMinorStepData::MATH_FAIL  == log->getFrame(0).mSolutionResult);
+    CPPUNIT_ASSERT(tLink.getAdmittanceMatrix()[0] == log->getFrame(0).mLinksData[0].mAdmittanceMatrix[0]);
+    CPPUNIT_ASSERT(tLink.getAdmittanceMatrix()[1] == log->getFrame(0).mLinksData[0].mAdmittanceMatrix[1]);
+    CPPUNIT_ASSERT(tLink.getSourceVector()[0]     == log->getFrame(0).mLinksData[0].mSourceVector[0]);
+    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM        == log->getFrame(0).mLinksData[0].mSolutionResult);
 
     /// - Create an system of equations that decomposes fine, but fails in forward/backwards
     ///   substitution, then step and verify an exception is thrown.
@@ -1352,24 +1374,24 @@ void UtGunns::testNonConvergence()
 
     /// - Verify outputs to the minor step log.
     FriendlyGunnsMinorStepLog* log = static_cast<FriendlyGunnsMinorStepLog*>(&tNetwork.mStepLog);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[5].mMajorStep);
-    CPPUNIT_ASSERT(6                                   == log->mBuffer[5].mMinorStep);
-    CPPUNIT_ASSERT(5                                   == log->mBuffer[5].mDecomposition);
-    CPPUNIT_ASSERT(tNetwork.mPotentialVector[0]        == log->mBuffer[5].mPotentialVector[0]);
-    CPPUNIT_ASSERT(tNetwork.mPotentialVector[1]        == log->mBuffer[5].mPotentialVector[1]);
-    CPPUNIT_ASSERT(tNetwork.mPotentialVector[2]        == log->mBuffer[5].mPotentialVector[2]);
-    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[0]       == log->mBuffer[5].mNodesConvergence[0]);
-    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[1]       == log->mBuffer[5].mNodesConvergence[1]);
-    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[2]       == log->mBuffer[5].mNodesConvergence[2]);
-    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->mBuffer[0].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->mBuffer[1].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->mBuffer[2].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->mBuffer[3].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->mBuffer[4].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::DECOMP_LIMIT    == log->mBuffer[5].mSolutionResult);
-    CPPUNIT_ASSERT(tPotential.getAdmittanceMatrix()[0] == log->mBuffer[5].mLinksData[0].mAdmittanceMatrix[0]);
-    CPPUNIT_ASSERT(tConstantLoad2.getSourceVector()[0] == log->mBuffer[5].mLinksData[6].mSourceVector[0]);
-    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM             == log->mBuffer[5].mLinksData[0].mSolutionResult);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(5).mMajorStep);
+    CPPUNIT_ASSERT(6                                   == log->getFrame(5).mMinorStep);
+    CPPUNIT_ASSERT(5                                   == log->getFrame(5).mDecomposition);
+    CPPUNIT_ASSERT(tNetwork.mPotentialVector[0]        == log->getFrame(5).mPotentialVector[0]);
+    CPPUNIT_ASSERT(tNetwork.mPotentialVector[1]        == log->getFrame(5).mPotentialVector[1]);
+    CPPUNIT_ASSERT(tNetwork.mPotentialVector[2]        == log->getFrame(5).mPotentialVector[2]);
+    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[0]       == log->getFrame(5).mNodesConvergence[0]);
+    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[1]       == log->getFrame(5).mNodesConvergence[1]);
+    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[2]       == log->getFrame(5).mNodesConvergence[2]);
+    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->getFrame(0).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->getFrame(1).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->getFrame(2).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->getFrame(3).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM         == log->getFrame(4).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::DECOMP_LIMIT    == log->getFrame(5).mSolutionResult);
+    CPPUNIT_ASSERT(tPotential.getAdmittanceMatrix()[0] == log->getFrame(5).mLinksData[0].mAdmittanceMatrix[0]);
+    CPPUNIT_ASSERT(tConstantLoad2.getSourceVector()[0] == log->getFrame(5).mLinksData[6].mSourceVector[0]);
+    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM             == log->getFrame(5).mLinksData[0].mSolutionResult);
     CPPUNIT_ASSERT(GunnsMinorStepLog::RECORDING_SNAP   == log->mState);
     CPPUNIT_ASSERT(true                                == log->mIsRecording);
     CPPUNIT_ASSERT(5                                   == log->mHeadIndex);
@@ -1534,24 +1556,24 @@ void UtGunns::testSolutionRejection()
 
     /// - Verify outputs to the minor step log.
     FriendlyGunnsMinorStepLog* log = static_cast<FriendlyGunnsMinorStepLog*>(&tNetwork.mStepLog);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[0].mMajorStep);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[1].mMajorStep);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[0].mMinorStep);
-    CPPUNIT_ASSERT(2                                   == log->mBuffer[1].mMinorStep);
-    CPPUNIT_ASSERT(1                                   == log->mBuffer[0].mDecomposition);
-    CPPUNIT_ASSERT(2                                   == log->mBuffer[1].mDecomposition);
-    CPPUNIT_ASSERT(tNetwork.mPotentialVector[0]        == log->mBuffer[1].mPotentialVector[0]);
-    CPPUNIT_ASSERT(tNetwork.mPotentialVector[1]        == log->mBuffer[1].mPotentialVector[1]);
-    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[0]       == log->mBuffer[1].mNodesConvergence[0]);
-    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[1]       == log->mBuffer[1].mNodesConvergence[1]);
-    CPPUNIT_ASSERT(GunnsMinorStepData::REJECT          == log->mBuffer[0].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::REJECT          == log->mBuffer[1].mSolutionResult);
-    CPPUNIT_ASSERT(tLink1.getAdmittanceMatrix()[0]     == log->mBuffer[1].mLinksData[0].mAdmittanceMatrix[0]);
-    CPPUNIT_ASSERT(tLink1.getSourceVector()[0]         == log->mBuffer[1].mLinksData[0].mSourceVector[0]);
-    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM             == log->mBuffer[0].mLinksData[0].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsBasicLink::REJECT              == log->mBuffer[0].mLinksData[1].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM             == log->mBuffer[1].mLinksData[0].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsBasicLink::REJECT              == log->mBuffer[1].mLinksData[1].mSolutionResult);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(0).mMajorStep);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(1).mMajorStep);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(0).mMinorStep);
+    CPPUNIT_ASSERT(2                                   == log->getFrame(1).mMinorStep);
+    CPPUNIT_ASSERT(1                                   == log->getFrame(0).mDecomposition);
+    CPPUNIT_ASSERT(2                                   == log->getFrame(1).mDecomposition);
+    CPPUNIT_ASSERT(tNetwork.mPotentialVector[0]        == log->getFrame(1).mPotentialVector[0]);
+    CPPUNIT_ASSERT(tNetwork.mPotentialVector[1]        == log->getFrame(1).mPotentialVector[1]);
+    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[0]       == log->getFrame(1).mNodesConvergence[0]);
+    CPPUNIT_ASSERT(tNetwork.mNodesConvergence[1]       == log->getFrame(1).mNodesConvergence[1]);
+    CPPUNIT_ASSERT(GunnsMinorStepData::REJECT          == log->getFrame(0).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::REJECT          == log->getFrame(1).mSolutionResult);
+    CPPUNIT_ASSERT(tLink1.getAdmittanceMatrix()[0]     == log->getFrame(1).mLinksData[0].mAdmittanceMatrix[0]);
+    CPPUNIT_ASSERT(tLink1.getSourceVector()[0]         == log->getFrame(1).mLinksData[0].mSourceVector[0]);
+    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM             == log->getFrame(0).mLinksData[0].mSolutionResult);
+    CPPUNIT_ASSERT(GunnsBasicLink::REJECT              == log->getFrame(0).mLinksData[1].mSolutionResult);
+    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM             == log->getFrame(1).mLinksData[0].mSolutionResult);
+    CPPUNIT_ASSERT(GunnsBasicLink::REJECT              == log->getFrame(1).mLinksData[1].mSolutionResult);
     CPPUNIT_ASSERT(GunnsMinorStepLog::RECORDING_SNAP   == log->mState);
     CPPUNIT_ASSERT(true                                == log->mIsRecording);
     CPPUNIT_ASSERT(1                                   == log->mHeadIndex);
@@ -1684,13 +1706,13 @@ void UtGunns::testSolutionDelay()
 
     /// - Verify outputs to the minor step log.
     FriendlyGunnsMinorStepLog* log = static_cast<FriendlyGunnsMinorStepLog*>(&tNetwork.mStepLog);
-    CPPUNIT_ASSERT(5                           == log->mBuffer[4].mMinorStep);
-    CPPUNIT_ASSERT(5                           == log->mBuffer[4].mDecomposition);
-    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM == log->mBuffer[0].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM == log->mBuffer[1].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM == log->mBuffer[2].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM == log->mBuffer[3].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::SUCCESS == log->mBuffer[4].mSolutionResult);
+    CPPUNIT_ASSERT(5                           == log->getFrame(4).mMinorStep);
+    CPPUNIT_ASSERT(5                           == log->getFrame(4).mDecomposition);
+    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM == log->getFrame(0).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM == log->getFrame(1).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM == log->getFrame(2).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::CONFIRM == log->getFrame(3).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::SUCCESS == log->getFrame(4).mSolutionResult);
 
     /// - Now step again, this time tFake1 is set up to delay the solution until the 3rd frame after
     ///   the system converged.
@@ -1705,11 +1727,11 @@ void UtGunns::testSolutionDelay()
     CPPUNIT_ASSERT_EQUAL(4, tFake1.callsToMinorStep);
     CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM     == tNetwork.mLinksConvergence[0]);
     CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM     == tNetwork.mLinksConvergence[7]);
-    CPPUNIT_ASSERT(3                           == log->mBuffer[7].mMinorStep);
-    CPPUNIT_ASSERT(1                           == log->mBuffer[7].mDecomposition);
-    CPPUNIT_ASSERT(GunnsMinorStepData::DELAY   == log->mBuffer[5].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::DELAY   == log->mBuffer[6].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::SUCCESS == log->mBuffer[7].mSolutionResult);
+    CPPUNIT_ASSERT(3                           == log->getFrame(7).mMinorStep);
+    CPPUNIT_ASSERT(1                           == log->getFrame(7).mDecomposition);
+    CPPUNIT_ASSERT(GunnsMinorStepData::DELAY   == log->getFrame(5).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::DELAY   == log->getFrame(6).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::SUCCESS == log->getFrame(7).mSolutionResult);
 
     /// - Now step again, this time tLink1 is set up to delay the solution until the 11th frame
     ///   after the system converged, which is later than the minor step limit.
@@ -1723,11 +1745,11 @@ void UtGunns::testSolutionDelay()
     CPPUNIT_ASSERT_EQUAL(4,  tFake1.callsToMinorStep);
     CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM   == tNetwork.mLinksConvergence[0]);
     CPPUNIT_ASSERT(GunnsBasicLink::DELAY     == tNetwork.mLinksConvergence[7]);
-    CPPUNIT_ASSERT(10                        == log->mBuffer[17].mMinorStep);
-    CPPUNIT_ASSERT(1                         == log->mBuffer[17].mDecomposition);
-    CPPUNIT_ASSERT(GunnsMinorStepData::DELAY == log->mBuffer[15].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::DELAY == log->mBuffer[16].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsMinorStepData::DELAY == log->mBuffer[17].mSolutionResult);
+    CPPUNIT_ASSERT(10                        == log->getFrame(17).mMinorStep);
+    CPPUNIT_ASSERT(1                         == log->getFrame(17).mDecomposition);
+    CPPUNIT_ASSERT(GunnsMinorStepData::DELAY == log->getFrame(15).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::DELAY == log->getFrame(16).mSolutionResult);
+    CPPUNIT_ASSERT(GunnsMinorStepData::DELAY == log->getFrame(17).mSolutionResult);
 
     std::cout << "... Pass";
 }
@@ -1805,6 +1827,24 @@ void UtGunns::testAccessMethods()
     tNetwork.mSolveTime = 1.0;
     CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, tNetwork.getSolveTime(), 0.0);
 
+    tNetwork.mDecomposeTime = 0.5;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, tNetwork.getDecomposeTime(), 0.0);
+
+    tNetwork.mRefinementCount = 3;
+    CPPUNIT_ASSERT_EQUAL(3, tNetwork.getRefinementCount());
+
+    tNetwork.mMaxRefinementCount = 4;
+    CPPUNIT_ASSERT_EQUAL(4, tNetwork.getMaxRefinementCount());
+
+    tNetwork.mRefinementResidual = 1.0E-14;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0E-14, tNetwork.getRefinementResidual(), 0.0);
+
+    tNetwork.mRefinementEscalationCount = 2;
+    CPPUNIT_ASSERT_EQUAL(2, tNetwork.getRefinementEscalationCount());
+
+    tNetwork.mFactorReuseCount = 6;
+    CPPUNIT_ASSERT_EQUAL(6, tNetwork.getFactorReuseCount());
+
     tNetwork.mStepTime = 2.0;
     CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, tNetwork.getStepTime(), 0.0);
 
@@ -2506,6 +2546,175 @@ void UtGunns::testGpuDenseIslands()
     std::cout << "... Pass";
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the Gunns class mixed-precision solution with iterative refinement.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testMixedPrecision()
+{
+    std::cout << "\n UtGunns ................ 36: testMixedPrecision ....................";
+
+    setupNominalNonLinearNetwork(true);
+
+    /// - Verify setting mixed-precision allocates the working arrays and resets invalid controls.
+    tNetwork.setMixedPrecision(true, 0, 0.0);
+    CPPUNIT_ASSERT(true    == tNetwork.mMixedPrecision);
+    CPPUNIT_ASSERT(10      == tNetwork.mRefinementLimit);
+    CPPUNIT_ASSERT(1.0E-13 == tNetwork.mRefinementTolerance);
+    CPPUNIT_ASSERT(true    == tNetwork.mRebuild);
+    CPPUNIT_ASSERT(0       != tNetwork.mAdmittanceMatrixSingle);
+    CPPUNIT_ASSERT(0       != tNetwork.mAdmittanceMatrixSingleIsland);
+    CPPUNIT_ASSERT(0       != tNetwork.mAdmittanceMatrixLdu);
+    CPPUNIT_ASSERT(0       != tNetwork.mRefinementResidualVector);
+    CPPUNIT_ASSERT(0       != tNetwork.mRefinementCorrection);
+
+    /// - Step the network and verify the same solution as testNonLinearStep, to within the
+    ///   refinement tolerance.
+    tNetwork.step(tDeltaTime);
+
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.2499999999999994e+02, tNetwork.mPotentialVector[0], 1.0E-10);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.1955809295177480e+02, tNetwork.mPotentialVector[1], 1.0E-10);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.0993847627749395e+02, tNetwork.mPotentialVector[2], 1.0E-10);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 5.4969238138746974e+01, tNetwork.mPotentialVector[3], 1.0E-10);
+    CPPUNIT_ASSERT_EQUAL( 5, tNetwork.mMinorStepCount);
+    CPPUNIT_ASSERT_EQUAL( 5, tNetwork.mDecompositionCount);
+    CPPUNIT_ASSERT_EQUAL( 0, tNetwork.mConvergenceFailCount);
+    CPPUNIT_ASSERT(tNetwork.getRefinementResidual() <= 1.0E-13);
+    CPPUNIT_ASSERT(tNetwork.getRefinementCount() >= tNetwork.getMaxRefinementCount());
+
+    /// - Verify the double-precision admittance matrix is not decomposed in place.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-1.0, tNetwork.mAdmittanceMatrix[1], 0.0);
+
+    /// - Verify a NaN solution fails the refinement tolerance.
+    const double potential1 = tNetwork.mPotentialVector[1];
+    tNetwork.mPotentialVector[1] = std::numeric_limits<double>::quiet_NaN();
+    CPPUNIT_ASSERT_EQUAL(DBL_MAX, tNetwork.computeRefinementResidual());
+    tNetwork.mPotentialVector[1] = potential1;
+
+    /// - Verify NaN single-precision factors escalate to the double-precision decomposition, which
+    ///   gives a finite solution that meets the tolerance.
+    int escalations = tNetwork.getRefinementEscalationCount();
+    tNetwork.mRefinementEscalated = false;
+    tNetwork.mAdmittanceMatrixSingle[0] = std::numeric_limits<float>::quiet_NaN();
+    tNetwork.solveMixedPrecision();
+    CPPUNIT_ASSERT_EQUAL(escalations + 1, tNetwork.getRefinementEscalationCount());
+    CPPUNIT_ASSERT(true == tNetwork.mRefinementEscalated);
+    for (int i = 0; i < 4; ++i) {
+        CPPUNIT_ASSERT(tNetwork.mPotentialVector[i] == tNetwork.mPotentialVector[i]);
+    }
+    CPPUNIT_ASSERT(tNetwork.getRefinementResidual() <= 1.0E-13);
+
+    /// - Verify refinement stalls on the limit and escalates to a double-precision decomposition,
+    ///   which gives the same solution.
+    escalations = tNetwork.getRefinementEscalationCount();
+    tNetwork.setMixedPrecision(true, 1, 1.0E-300);
+    tNetwork.step(tDeltaTime);
+
+    CPPUNIT_ASSERT(escalations < tNetwork.getRefinementEscalationCount());
+    CPPUNIT_ASSERT(true == tNetwork.mRefinementEscalated);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.2499999999999994e+02, tNetwork.mPotentialVector[0], 1.0E-10);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.1955782756819053e+02, tNetwork.mPotentialVector[1], 1.0E-10);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.0993823224661188e+02, tNetwork.mPotentialVector[2], 1.0E-10);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 5.4969116123305930e+01, tNetwork.mPotentialVector[3], 1.0E-10);
+
+    /// - Verify restart resets the max refinement count.
+    tNetwork.restart();
+    CPPUNIT_ASSERT_EQUAL(0, tNetwork.getMaxRefinementCount());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the Gunns class mixed-precision solution with islands.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testMixedPrecisionIslands()
+{
+    std::cout << "\n UtGunns ................ 37: testMixedPrecisionIslands .............";
+
+    setupIslandNetwork();
+    tNetwork.setMixedPrecision(true);
+    tNetwork.setIslandMode(Gunns::SOLVE);
+
+    /// - Step the network and verify the correct island values.
+    tPotential.mMalfBlockageFlag  = true;
+    tPotential.mMalfBlockageValue = 1.5E-14;
+
+    tNetwork.step(tDeltaTime);
+
+    CPPUNIT_ASSERT_EQUAL(2, tNetwork.mIslandCount);
+    CPPUNIT_ASSERT_EQUAL(5, tNetwork.mIslandMaxSize);
+    CPPUNIT_ASSERT(tNetwork.getRefinementResidual() <= 1.0E-13);
+
+    /// - The refined solution has the same row residuals as the double-precision solution, but the
+    ///   potential source makes this matrix so poorly conditioned that the potentials themselves
+    ///   can differ by more, so we use a larger tolerance than testSolveIslands.
+
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(120.0, tNetwork.mPotentialVector[0],  1.0E-7);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(120.0, tNetwork.mPotentialVector[1],  1.0E-7);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(120.0, tNetwork.mPotentialVector[2],  1.0E-7);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(120.0, tNetwork.mPotentialVector[3],  1.0E-7);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(  0.0, tNetwork.mPotentialVector[4],  1.0E-7);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(120.0, tNetwork.mPotentialVector[5],  1.0E-7);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the Gunns class reuse of factors across minor steps (modified Newton).
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunns::testFactorReuse()
+{
+    std::cout << "\n UtGunns ................ 38: testFactorReuse .......................";
+
+    setupNominalNonLinearNetwork(true);
+
+    /// - Verify setting factor reuse allocates the working arrays and resets invalid controls.
+    tNetwork.setFactorReuse(-1, 1.0);
+    CPPUNIT_ASSERT(0   == tNetwork.mFactorReuseLimit);
+    CPPUNIT_ASSERT(0.5 == tNetwork.mFactorReuseRate);
+    CPPUNIT_ASSERT(0   == tNetwork.mAdmittanceMatrixLdu);
+    tNetwork.setFactorReuse(10, 0.9);
+    CPPUNIT_ASSERT(10   == tNetwork.mFactorReuseLimit);
+    CPPUNIT_ASSERT(0.9  == tNetwork.mFactorReuseRate);
+    CPPUNIT_ASSERT(true == tNetwork.mRebuild);
+    CPPUNIT_ASSERT(0    != tNetwork.mAdmittanceMatrixLdu);
+    CPPUNIT_ASSERT(0    != tNetwork.mRefinementResidualVector);
+    CPPUNIT_ASSERT(0    != tNetwork.mRefinementCorrection);
+    CPPUNIT_ASSERT(0    == tNetwork.mAdmittanceMatrixSingle);
+
+    /// - Step the network and verify it converges to the same solution as testNonLinearStep with
+    ///   fewer decompositions, since only the first minor step decomposes.
+    tNetwork.step(tDeltaTime);
+
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.2499999999999994e+02, tNetwork.mPotentialVector[0], tConvergenceTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.1955809295177480e+02, tNetwork.mPotentialVector[1], tConvergenceTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.0993847627749395e+02, tNetwork.mPotentialVector[2], tConvergenceTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 5.4969238138746974e+01, tNetwork.mPotentialVector[3], tConvergenceTolerance);
+    CPPUNIT_ASSERT_EQUAL( 0, tNetwork.mConvergenceFailCount);
+    CPPUNIT_ASSERT_EQUAL( 1, tNetwork.mDecompositionCount);
+    CPPUNIT_ASSERT_EQUAL( tNetwork.mMinorStepCount - 1, tNetwork.getFactorReuseCount());
+    CPPUNIT_ASSERT(true == tNetwork.mFactorsStale);
+
+    /// - Verify the admittance matrix is not decomposed in place.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-1.0, tNetwork.mAdmittanceMatrix[1], 0.0);
+
+    /// - Verify the stale factors are replaced on the first minor step of the next major step, and
+    ///   a reuse limit of 1 allows only one reused minor step before decomposing again.
+    tNetwork.setFactorReuse(1);
+    const int decompositions = tNetwork.mDecompositionCount;
+    const int reuses         = tNetwork.mFactorReuseCount;
+    tNetwork.mMinorStepCount = 0;
+    tNetwork.step(tDeltaTime);
+
+    CPPUNIT_ASSERT_EQUAL( 0, tNetwork.mConvergenceFailCount);
+    CPPUNIT_ASSERT_EQUAL( tNetwork.mMinorStepCount, tNetwork.mDecompositionCount - decompositions
+                                                  + tNetwork.mFactorReuseCount - reuses);
+    CPPUNIT_ASSERT(tNetwork.mDecompositionCount - decompositions >= tNetwork.mFactorReuseCount - reuses);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.1955782756819053e+02, tNetwork.mPotentialVector[1], tConvergenceTolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.0993823224661188e+02, tNetwork.mPotentialVector[2], tConvergenceTolerance);
+
+    std::cout << "... Pass";
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in] converging (--) When true, network set up to be converging, otherwise non-converging.
 ///
@@ -148,6 +148,9 @@ class UtGunns : public CppUnit::TestFixture
         CPPUNIT_TEST(testGpuDense);
         CPPUNIT_TEST(testGpuSparseIslands);
         CPPUNIT_TEST(testGpuDenseIslands);
+        CPPUNIT_TEST(testMixedPrecision);
+        CPPUNIT_TEST(testMixedPrecisionIslands);
+        CPPUNIT_TEST(testFactorReuse);
 
         CPPUNIT_TEST_SUITE_END();
 
@@ -265,6 +268,9 @@ class UtGunns : public CppUnit::TestFixture
         void testGpuDense();
         void testGpuSparseIslands();
         void testGpuDenseIslands();
+        void testMixedPrecision();
+        void testMixedPrecisionIslands();
+        void testFactorReuse();
 };
 
 ///@}
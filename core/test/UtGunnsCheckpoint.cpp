@@ -0,0 +1,869 @@
+/*
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+*/
+
+#include "UtGunnsCheckpoint.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include "software/exceptions/TsParseException.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsCheckpoint class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsCheckpoint::UtGunnsCheckpoint()
+    :
+    tBuffer(),
+    tBasicNodes(),
+    tBasicNodeList(),
+    tBasicLinks(),
+    tPotential(),
+    tConductor1(),
+    tConductor2(),
+    tCapacitor(),
+    tSource(),
+    tBasicNetwork(),
+    tFluidProperties(),
+    tTcConfig(0),
+    tFluidConfig(0),
+    tFluidNodes(),
+    tFluidNodeList(),
+    tFluidLinks(),
+    tFluidCapacitor0(),
+    tFluidCapacitor1(),
+    tFluidConductor(),
+    tFluidNetwork(),
+    tTimeStep(0.1)
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsCheckpoint class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsCheckpoint::~UtGunnsCheckpoint()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsCheckpoint::tearDown()
+{
+    delete tFluidConfig;
+    delete tTcConfig;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsCheckpoint::setUp()
+{
+    static const ChemicalCompound::Type tcTypes[2] = {ChemicalCompound::CO, ChemicalCompound::H2O};
+    static const FluidProperties::FluidType fluidTypes[2] = {
+        FluidProperties::GUNNS_N2,
+        FluidProperties::GUNNS_O2
+    };
+    tTcConfig    = new GunnsFluidTraceCompoundsConfigData(tcTypes, 2, "tTcConfig");
+    tFluidConfig = new PolyFluidConfigData(&tFluidProperties, fluidTypes, 2, tTcConfig);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Initializes a linear network with a potential source, conductors, a capacitor and a
+///           flux source.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsCheckpoint::setupBasicNetwork()
+{
+    tBasicNodes[0].initialize("UtBasic.Node0");
+    tBasicNodes[1].initialize("UtBasic.Node1");
+    tBasicNodes[2].initialize("UtBasic.Node2");
+    tBasicNodes[3].initialize("UtBasic.Ground");
+    tBasicNodeList.mNumNodes = N_BASIC_NODES;
+    tBasicNodeList.mNodes    = tBasicNodes;
+    tBasicNetwork.initializeNodes(tBasicNodeList);
+
+    GunnsBasicPotentialConfigData potentialConfig("UtBasic.VS", &tBasicNodeList, 1.0E14);
+    GunnsBasicPotentialInputData  potentialInput(false, 0.0, -125.0);
+    GunnsBasicConductorConfigData conductor1Config("UtBasic.R1", &tBasicNodeList, 1.0);
+    GunnsBasicConductorConfigData conductor2Config("UtBasic.R2", &tBasicNodeList, 0.01);
+    GunnsBasicConductorInputData  conductorInput;
+    GunnsBasicCapacitorConfigData capacitorConfig("UtBasic.C", &tBasicNodeList);
+    GunnsBasicCapacitorInputData  capacitorInput(false, 0.0, 0.5, 100.0);
+    GunnsBasicSourceConfigData    sourceConfig("UtBasic.S", &tBasicNodeList);
+    GunnsBasicSourceInputData     sourceInput(false, 0.0, 0.2);
+
+    tPotential .initialize(potentialConfig,  potentialInput, tBasicLinks, 0,            BASIC_GROUND);
+    tConductor1.initialize(conductor1Config, conductorInput, tBasicLinks, 0,            1);
+    tCapacitor .initialize(capacitorConfig,  capacitorInput, tBasicLinks, 1,            BASIC_GROUND);
+    tConductor2.initialize(conductor2Config, conductorInput, tBasicLinks, 1,            2);
+    tSource    .initialize(sourceConfig,     sourceInput,    tBasicLinks, BASIC_GROUND, 2);
+
+    GunnsConfigData networkConfig("UtBasic", 0.01, 1.0, 10, 5);
+    tBasicNetwork.initialize(networkConfig, tBasicLinks);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Initializes a fluid network of two tanks at different pressures with trace compounds,
+///           connected by a conductor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsCheckpoint::setupFluidNetwork()
+{
+    double fractions[2]   = {0.79, 0.21};
+    double tcFractions[2] = {5.0e-5, 6.0e-6};
+    GunnsFluidTraceCompoundsInputData tcInput(tcFractions);
+    PolyFluidInputData highFluid(300.0, 700.0, 0.0, 0.0, fractions, &tcInput);
+    PolyFluidInputData lowFluid (280.0, 100.0, 0.0, 0.0, fractions, &tcInput);
+
+    tFluidNodes[0].initialize("UtFluid.Node0",  tFluidConfig, &highFluid);
+    tFluidNodes[1].initialize("UtFluid.Node1",  tFluidConfig, &lowFluid);
+    tFluidNodes[2].initialize("UtFluid.Ground", tFluidConfig);
+    tFluidNodeList.mNumNodes = N_FLUID_NODES;
+    tFluidNodeList.mNodes    = tFluidNodes;
+    tFluidNetwork.initializeFluidNodes(tFluidNodeList);
+
+    GunnsFluidCapacitorConfigData capacitorConfig("UtFluid.Tank", &tFluidNodeList, 0.5);
+    GunnsFluidCapacitorInputData  capacitor0Input(false, 0.0, 1.0, &highFluid);
+    GunnsFluidCapacitorInputData  capacitor1Input(false, 0.0, 2.0, &lowFluid);
+    GunnsFluidConductorConfigData conductorConfig("UtFluid.Pipe", &tFluidNodeList, 1.0E-5, 0.5);
+    GunnsFluidConductorInputData  conductorInput;
+
+    tFluidCapacitor0.initialize(capacitorConfig, capacitor0Input, tFluidLinks, 0, FLUID_GROUND);
+    tFluidCapacitor1.initialize(capacitorConfig, capacitor1Input, tFluidLinks, 1, FLUID_GROUND);
+    tFluidConductor .initialize(conductorConfig, conductorInput,  tFluidLinks, 0, 1);
+
+    GunnsConfigData networkConfig("UtFluid", 1.0, 1.0, 10, 5);
+    tFluidNetwork.initialize(networkConfig, tFluidLinks);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] buffer (--) Buffer for the corrupted checkpoint.
+/// @param[in]  slot   (--) Index of the value slot to replace.
+/// @param[in]  value  (--) Value to replace it with.
+///
+/// @details  Copies the checkpoint in tBuffer to the given buffer, value by value, replacing the
+///           given one, so the stream itself stays well-formed and only its contents are wrong.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsCheckpoint::corruptCheckpoint(std::vector<unsigned char>& buffer,
+                                          const unsigned long slot, const int value)
+{
+    GunnsCheckpointReader reader("reader");
+    GunnsCheckpointWriter writer("writer");
+    reader.openBuffer(&tBuffer);
+    writer.openBuffer(&buffer);
+    for (unsigned long i = 0; not reader.isAtEnd(); ++i) {
+        double original = 0.0;
+        reader.read(original);
+        if (i == slot) {
+            writer.write(value);
+        } else {
+            writer.write(original);
+        }
+    }
+    writer.close();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests default construction of the writer & reader.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsCheckpoint::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsCheckpoint ...... 01: testDefaultConstruction ...............";
+
+    FriendlyGunnsCheckpointWriter writer("writer");
+    CPPUNIT_ASSERT("writer"                          == writer.mName);
+    CPPUNIT_ASSERT(0                                 == writer.mFile);
+    CPPUNIT_ASSERT(0                                 == writer.mBuffer);
+    CPPUNIT_ASSERT(GunnsCheckpointWriter::BLOCK_SIZE == writer.mRaw.size());
+    CPPUNIT_ASSERT(0                                 == writer.mRawUsed);
+    CPPUNIT_ASSERT(0                                 == writer.getRawSize());
+    CPPUNIT_ASSERT(0                                 == writer.getPackedSize());
+    CPPUNIT_ASSERT(not writer.isOpen());
+
+    FriendlyGunnsCheckpointReader reader("reader");
+    CPPUNIT_ASSERT("reader" == reader.mName);
+    CPPUNIT_ASSERT(0        == reader.mFile);
+    CPPUNIT_ASSERT(0        == reader.mBuffer);
+    CPPUNIT_ASSERT(0        == reader.mRawUsed);
+    CPPUNIT_ASSERT(0        == reader.mRawPos);
+    CPPUNIT_ASSERT(0        == reader.mBlockSize);
+    CPPUNIT_ASSERT(not reader.mEnd);
+    CPPUNIT_ASSERT(not reader.isOpen());
+
+    /// @test  New/delete for code coverage.
+    GunnsCheckpointWriter* article = new GunnsCheckpointWriter();
+    delete article;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the block codec directly: shuffle & unshuffle, compression of runs and of random
+///           bytes, and rejection of corrupt blocks.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsCheckpoint::testCodec()
+{
+    std::cout << "\n UtGunnsCheckpoint ...... 02: testCodec .............................";
+
+    const unsigned int size = 4099;
+    std::vector<unsigned char> raw(size);
+    std::vector<unsigned char> work(size);
+    std::vector<unsigned char> back(size);
+    std::vector<unsigned char> packed(2 * size);
+
+    /// @test  Shuffle gathers the bytes of each word into planes, including a partial last word.
+    for (unsigned int i = 0; i < size; ++i) {
+        raw[i] = static_cast<unsigned char>(i);
+    }
+    GunnsCheckpointCodec::shuffle(&work[0], &raw[0], size);
+    CPPUNIT_ASSERT(0   == work[0]);
+    CPPUNIT_ASSERT(8   == work[1]);
+    CPPUNIT_ASSERT(1   == work[size / 8]);
+    CPPUNIT_ASSERT(raw[size - 1] == work[size - 1]);
+    GunnsCheckpointCodec::unshuffle(&back[0], &work[0], size);
+    CPPUNIT_ASSERT(raw == back);
+
+    /// @test  Data with runs, repeats and literals compresses and decompresses exactly.
+    for (unsigned int i = 0; i < size; ++i) {
+        raw[i] = static_cast<unsigned char>((i / 300) % 2 ? (i * 7) % 13 : 42);
+    }
+    unsigned int packedSize = GunnsCheckpointCodec::compress(&packed[0], size, &raw[0], size);
+    CPPUNIT_ASSERT(packedSize > 0);
+    CPPUNIT_ASSERT(packedSize < size / 4);
+    back.assign(size, 0);
+    CPPUNIT_ASSERT(GunnsCheckpointCodec::decompress(&back[0], size, &packed[0], packedSize));
+    CPPUNIT_ASSERT(raw == back);
+
+    /// @test  Random bytes don't fit in less than the raw size.
+    srand(1);
+    for (unsigned int i = 0; i < size; ++i) {
+        raw[i] = static_cast<unsigned char>(rand() >> 7);
+    }
+    CPPUNIT_ASSERT(0 == GunnsCheckpointCodec::compress(&packed[0], size - 1, &raw[0], size));
+
+    /// @test  But still round trip given enough room, with literal runs longer than 255.
+    packedSize = GunnsCheckpointCodec::compress(&packed[0], 2 * size, &raw[0], size);
+    CPPUNIT_ASSERT(packedSize >= size);
+    CPPUNIT_ASSERT(GunnsCheckpointCodec::decompress(&back[0], size, &packed[0], packedSize));
+    CPPUNIT_ASSERT(raw == back);
+
+    /// @test  Tiny and empty blocks.
+    CPPUNIT_ASSERT(1 == GunnsCheckpointCodec::compress(&packed[0], 8, &raw[0], 0));
+    CPPUNIT_ASSERT(GunnsCheckpointCodec::decompress(&back[0], 0, &packed[0], 1));
+    CPPUNIT_ASSERT(4 == GunnsCheckpointCodec::compress(&packed[0], 8, &raw[0], 3));
+    CPPUNIT_ASSERT(GunnsCheckpointCodec::decompress(&back[0], 3, &packed[0], 4));
+    CPPUNIT_ASSERT(raw[2] == back[2]);
+
+    /// @test  Corrupt blocks are rejected: wrong expected size, offset before the start of the
+    ///        block, truncated, and a literal run past the end of the input.
+    raw.assign(size, 7);
+    packedSize = GunnsCheckpointCodec::compress(&packed[0], size, &raw[0], size);
+    CPPUNIT_ASSERT(packedSize > 0);
+    CPPUNIT_ASSERT(not GunnsCheckpointCodec::decompress(&back[0], size - 1, &packed[0], packedSize));
+    std::vector<unsigned char> bad(packed.begin(), packed.begin() + packedSize);
+    bad[2] = 0xFF;
+    bad[3] = 0xFF;
+    CPPUNIT_ASSERT(not GunnsCheckpointCodec::decompress(&back[0], size, &bad[0], packedSize));
+    CPPUNIT_ASSERT(not GunnsCheckpointCodec::decompress(&back[0], size, &packed[0], packedSize - 2));
+    bad.assign(1, 0xF0);
+    CPPUNIT_ASSERT(not GunnsCheckpointCodec::decompress(&back[0], size, &bad[0], 1));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests writing and reading back all value types through a memory buffer, across
+///           several blocks.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsCheckpoint::testRoundTrip()
+{
+    std::cout << "\n UtGunnsCheckpoint ...... 03: testRoundTrip .........................";
+
+    const int numValues = 20000;
+    std::vector<double> values(numValues);
+    for (int i = 0; i < numValues; ++i) {
+        values[i] = 101.325 + 1.0e-3 * i + sin(0.01 * i);
+    }
+
+    FriendlyGunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&tBuffer);
+    CPPUNIT_ASSERT(writer.isOpen());
+    CPPUNIT_ASSERT(&tBuffer == writer.mBuffer);
+    CPPUNIT_ASSERT(20 == tBuffer.size());
+    writer.write(-42);
+    writer.write(4000000000U);
+    writer.write(true);
+    writer.write(false);
+    for (int i = 0; i < numValues; ++i) {
+        writer.write(values[i]);
+    }
+    writer.write(&values[0], numValues);
+    writer.write(-1.0);
+    CPPUNIT_ASSERT((4 + 2 * numValues + 1) * 8UL == writer.getRawSize());
+    writer.close();
+    CPPUNIT_ASSERT(not writer.isOpen());
+    CPPUNIT_ASSERT(tBuffer.size() == writer.getPackedSize());
+    CPPUNIT_ASSERT(writer.getPackedSize() < writer.getRawSize());
+
+    /// @test  Closing again does nothing.
+    writer.close();
+    CPPUNIT_ASSERT(tBuffer.size() == writer.getPackedSize());
+
+    FriendlyGunnsCheckpointReader reader("reader");
+    reader.openBuffer(&tBuffer);
+    CPPUNIT_ASSERT(reader.isOpen());
+    CPPUNIT_ASSERT(GunnsCheckpointWriter::BLOCK_SIZE == reader.mBlockSize);
+    int          intValue      = 0;
+    unsigned int unsignedValue = 0;
+    bool         boolValue     = false;
+    reader.read(intValue);
+    reader.read(unsignedValue);
+    CPPUNIT_ASSERT(-42         == intValue);
+    CPPUNIT_ASSERT(4000000000U == unsignedValue);
+    reader.read(boolValue);
+    CPPUNIT_ASSERT(boolValue);
+    reader.read(boolValue);
+    CPPUNIT_ASSERT(not boolValue);
+    std::vector<double> readBack(numValues);
+    reader.read(&readBack[0], numValues);
+    CPPUNIT_ASSERT(values == readBack);
+    for (int i = 0; i < numValues; ++i) {
+        double value = 0.0;
+        reader.read(value);
+        CPPUNIT_ASSERT(values[i] == value);
+    }
+    CPPUNIT_ASSERT(not reader.isAtEnd());
+    double last = 0.0;
+    reader.read(last);
+    CPPUNIT_ASSERT(-1.0 == last);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+
+    /// @test  Reading past the end throws.
+    CPPUNIT_ASSERT_THROW(reader.read(last), TsParseException);
+    reader.close();
+    CPPUNIT_ASSERT(not reader.isOpen());
+
+    /// @test  Re-opening the writer on the same buffer replaces the stream.
+    writer.openBuffer(&tBuffer);
+    writer.write(1.0);
+    writer.close();
+    reader.openBuffer(&tBuffer);
+    reader.read(last);
+    CPPUNIT_ASSERT(1.0 == last);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the compression of typical slowly-varying network state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsCheckpoint::testCompression()
+{
+    std::cout << "\n UtGunnsCheckpoint ...... 04: testCompression .......................";
+
+    /// @test  Node-like records of a few nearly equal doubles, flags and counts compress well.
+    GunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&tBuffer);
+    for (int i = 0; i < 10000; ++i) {
+        writer.write(300.0);
+        writer.write(101.325);
+        writer.write(1.5 + ((i % 100) ? 0.0 : 1.0e-6 * i));
+        writer.write(false);
+        writer.write(0.0);
+        writer.write(2);
+    }
+    writer.close();
+    CPPUNIT_ASSERT(writer.getPackedSize() * 10 < writer.getRawSize());
+
+    /// @test  Random doubles don't, but are never stored any bigger than raw plus the overhead.
+    writer.openBuffer(&tBuffer);
+    srand(2);
+    for (int i = 0; i < 20000; ++i) {
+        writer.write(static_cast<double>(rand()) / RAND_MAX * 1.0e6);
+    }
+    writer.close();
+    const unsigned long numBlocks = (writer.getRawSize() + GunnsCheckpointWriter::BLOCK_SIZE - 1)
+                                  / GunnsCheckpointWriter::BLOCK_SIZE;
+    CPPUNIT_ASSERT(writer.getPackedSize() <= writer.getRawSize() + 20 + 8 * (numBlocks + 1));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests writing and reading back a stream through a file.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsCheckpoint::testFile()
+{
+    std::cout << "\n UtGunnsCheckpoint ...... 05: testFile ..............................";
+
+    const std::string fileName = "UtGunnsCheckpoint.ckpt";
+    const int numValues = 10000;
+    GunnsCheckpointWriter writer("writer");
+    writer.openFile(fileName);
+    CPPUNIT_ASSERT(writer.isOpen());
+    for (int i = 0; i < numValues; ++i) {
+        writer.write(0.5 * i);
+    }
+    writer.write(7);
+    writer.close();
+    CPPUNIT_ASSERT(not writer.isOpen());
+
+    FILE* file = fopen(fileName.c_str(), "rb");
+    CPPUNIT_ASSERT(file);
+    fseek(file, 0, SEEK_END);
+    CPPUNIT_ASSERT(writer.getPackedSize() == static_cast<unsigned long>(ftell(file)));
+    fclose(file);
+
+    GunnsCheckpointReader reader("reader");
+    reader.openFile(fileName);
+    CPPUNIT_ASSERT(reader.isOpen());
+    for (int i = 0; i < numValues; ++i) {
+        double value = 0.0;
+        reader.read(value);
+        CPPUNIT_ASSERT(0.5 * i == value);
+    }
+    int count = 0;
+    reader.read(count);
+    CPPUNIT_ASSERT(7 == count);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+    reader.close();
+    remove(fileName.c_str());
+
+    /// @test  Files that can't be opened.
+    CPPUNIT_ASSERT_THROW(writer.openFile("no/such/path/UtGunnsCheckpoint.ckpt"),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(not writer.isOpen());
+    CPPUNIT_ASSERT_THROW(reader.openFile(fileName), TsInitializationException);
+    CPPUNIT_ASSERT(not reader.isOpen());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the exceptions thrown for unopened, foreign, truncated and corrupt streams.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsCheckpoint::testInvalidStreams()
+{
+    std::cout << "\n UtGunnsCheckpoint ...... 06: testInvalidStreams ....................";
+
+    /// @test  Not open and null buffers.
+    GunnsCheckpointWriter writer("writer");
+    GunnsCheckpointReader reader("reader");
+    double value = 0.0;
+    CPPUNIT_ASSERT_THROW(writer.write(1.0),         TsInitializationException);
+    CPPUNIT_ASSERT_THROW(writer.write(&value, 1),   TsInitializationException);
+    CPPUNIT_ASSERT_THROW(reader.read(value),        TsInitializationException);
+    CPPUNIT_ASSERT_THROW(writer.openBuffer(0),      TsInitializationException);
+    CPPUNIT_ASSERT_THROW(reader.openBuffer(0),      TsInitializationException);
+
+    /// @test  Build a valid stream of compressible data for corrupting.
+    writer.openBuffer(&tBuffer);
+    for (int i = 0; i < 1000; ++i) {
+        writer.write(1.0);
+    }
+    writer.close();
+    const std::vector<unsigned char> good(tBuffer);
+
+    /// @test  Bad magic, version, byte order and block size.
+    const int headerOffsets[4] = {0, 8, 12, 16};
+    for (int i = 0; i < 4; ++i) {
+        tBuffer = good;
+        tBuffer[headerOffsets[i]] ^= 0x01;
+        CPPUNIT_ASSERT_THROW(reader.openBuffer(&tBuffer), TsParseException);
+    }
+
+    /// @test  Truncated header and truncated block.
+    tBuffer.assign(good.begin(), good.begin() + 10);
+    CPPUNIT_ASSERT_THROW(reader.openBuffer(&tBuffer), TsParseException);
+    tBuffer.assign(good.begin(), good.end() - 12);
+    reader.openBuffer(&tBuffer);
+    CPPUNIT_ASSERT_THROW(reader.read(value), TsParseException);
+
+    /// @test  Missing end block.
+    tBuffer.assign(good.begin(), good.end() - 8);
+    reader.openBuffer(&tBuffer);
+    for (int i = 0; i < 1000; ++i) {
+        reader.read(value);
+    }
+    CPPUNIT_ASSERT_THROW(reader.read(value), TsParseException);
+
+    /// @test  Malformed block header: raw size not a whole number of slots, and packed bigger than
+    ///        raw.
+    tBuffer = good;
+    tBuffer[20] ^= 0x01;
+    reader.openBuffer(&tBuffer);
+    CPPUNIT_ASSERT_THROW(reader.read(value), TsParseException);
+    tBuffer = good;
+    tBuffer[25] = 0xFF;
+    reader.openBuffer(&tBuffer);
+    CPPUNIT_ASSERT_THROW(reader.read(value), TsParseException);
+
+    /// @test  Corrupt compressed data.
+    tBuffer = good;
+    for (unsigned int i = 28; i < tBuffer.size() - 8; ++i) {
+        tBuffer[i] = 0xFF;
+    }
+    reader.openBuffer(&tBuffer);
+    CPPUNIT_ASSERT_THROW(reader.read(value), TsParseException);
+
+    /// @test  Malformed end block.
+    tBuffer = good;
+    tBuffer[tBuffer.size() - 1] = 0x01;
+    reader.openBuffer(&tBuffer);
+    for (int i = 0; i < 1000; ++i) {
+        reader.read(value);
+    }
+    CPPUNIT_ASSERT_THROW(reader.isAtEnd(), TsParseException);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests rolling back a basic network to a checkpoint: the state is restored and the
+///           network retraces its trajectory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsCheckpoint::testBasicNetworkRollback()
+{
+    std::cout << "\n UtGunnsCheckpoint ...... 07: testBasicNetworkRollback ..............";
+
+    setupBasicNetwork();
+    for (int step = 0; step < N_STEPS; ++step) {
+        tBasicNetwork.step(tTimeStep);
+    }
+
+    /// @test  Save the checkpoint and record the state at the checkpoint.
+    GunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&tBuffer);
+    tBasicNetwork.saveCheckpoint(writer);
+    writer.close();
+    double potentials[N_BASIC_NODES];
+    for (int node = 0; node < N_BASIC_NODES; ++node) {
+        potentials[node] = tBasicNodes[node].getPotential();
+    }
+    const double capacitorFlux = tCapacitor.getFlux();
+    const int    majorSteps    = tBasicNetwork.getMajorStepCount();
+
+    /// @test  Continue, recording the trajectory, then change the inputs and malfunctions.
+    double trajectory[N_STEPS][N_BASIC_NODES];
+    for (int step = 0; step < N_STEPS; ++step) {
+        tBasicNetwork.step(tTimeStep);
+        for (int node = 0; node < N_BASIC_NODES; ++node) {
+            trajectory[step][node] = tBasicNodes[node].getPotential();
+        }
+    }
+    tSource.setFluxDemand(5.0);
+    tPotential.setSourcePotential(-50.0);
+    tConductor1.setMalfBlockage(true, 0.5);
+    tBasicNetwork.step(tTimeStep);
+    CPPUNIT_ASSERT(potentials[1] != tBasicNodes[1].getPotential());
+
+    /// @test  Roll back and verify the state is restored.
+    GunnsCheckpointReader reader("reader");
+    reader.openBuffer(&tBuffer);
+    tBasicNetwork.loadCheckpoint(reader);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+    for (int node = 0; node < N_BASIC_NODES; ++node) {
+        CPPUNIT_ASSERT(potentials[node] == tBasicNodes[node].getPotential());
+        CPPUNIT_ASSERT(BASIC_GROUND == node
+                       or potentials[node] == tBasicNetwork.getPotentialVector()[node]);
+    }
+    CPPUNIT_ASSERT(capacitorFlux == tCapacitor.getFlux());
+    CPPUNIT_ASSERT(majorSteps    == tBasicNetwork.getMajorStepCount());
+    CPPUNIT_ASSERT(0.2           == tSource.getFluxDemand());
+    CPPUNIT_ASSERT(-125.0        == tPotential.getSourcePotential());
+    CPPUNIT_ASSERT(not tConductor1.mMalfBlockageFlag);
+
+    /// @test  The network retraces the same trajectory.
+    for (int step = 0; step < N_STEPS; ++step) {
+        tBasicNetwork.step(tTimeStep);
+        for (int node = 0; node < N_BASIC_NODES; ++node) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(trajectory[step][node], tBasicNodes[node].getPotential(),
+                                         fabs(trajectory[step][node]) * 1.0E-12);
+        }
+    }
+
+    /// @test  A checkpoint from a different network is rejected before changing any state.
+    setupFluidNetwork();
+    tFluidNetwork.step(tTimeStep);
+    writer.openBuffer(&tBuffer);
+    tFluidNetwork.saveCheckpoint(writer);
+    writer.close();
+    const double potential = tBasicNodes[1].getPotential();
+    reader.openBuffer(&tBuffer);
+    CPPUNIT_ASSERT_THROW(tBasicNetwork.loadCheckpoint(reader), TsParseException);
+    CPPUNIT_ASSERT(potential == tBasicNodes[1].getPotential());
+
+    /// @test  An uninitialized network can't save or load.
+    Gunns network;
+    CPPUNIT_ASSERT_THROW(network.saveCheckpoint(writer), TsInitializationException);
+    CPPUNIT_ASSERT_THROW(network.loadCheckpoint(reader), TsInitializationException);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests rolling back a fluid network to a checkpoint through a file: the node contents,
+///           including trace compounds, are restored and the network retraces its trajectory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsCheckpoint::testFluidNetworkRollback()
+{
+    std::cout << "\n UtGunnsCheckpoint ...... 08: testFluidNetworkRollback ..............";
+
+    setupFluidNetwork();
+    for (int step = 0; step < N_STEPS; ++step) {
+        tFluidNetwork.step(tTimeStep);
+    }
+
+    /// @test  Save the checkpoint and record the state at the checkpoint.
+    const std::string fileName = "UtGunnsCheckpointFluid.ckpt";
+    GunnsCheckpointWriter writer("writer");
+    writer.openFile(fileName);
+    tFluidNetwork.saveCheckpoint(writer);
+    writer.close();
+    double pressure[2];
+    double temperature[2];
+    double mass[2];
+    double tcMass[2];
+    for (int node = 0; node < 2; ++node) {
+        pressure[node]    = tFluidNodes[node].getContent()->getPressure();
+        temperature[node] = tFluidNodes[node].getContent()->getTemperature();
+        mass[node]        = tFluidNodes[node].getContent()->getMass();
+        tcMass[node]      = tFluidNodes[node].getContent()->getTraceCompounds()->getMasses()[0];
+    }
+    const double flowRate = tFluidConductor.getFlowRate();
+    CPPUNIT_ASSERT(flowRate > 0.0);
+    CPPUNIT_ASSERT(tcMass[1] > 0.0);
+
+    /// @test  Continue, recording the trajectory.
+    double trajectory[N_STEPS][2];
+    for (int step = 0; step < N_STEPS; ++step) {
+        tFluidNetwork.step(tTimeStep);
+        trajectory[step][0] = tFluidNodes[0].getContent()->getPressure();
+        trajectory[step][1] = tFluidNodes[1].getContent()->getPressure();
+    }
+    CPPUNIT_ASSERT(pressure[0] > trajectory[N_STEPS - 1][0]);
+
+    /// @test  Roll back and verify the state is restored.
+    GunnsCheckpointReader reader("reader");
+    reader.openFile(fileName);
+    tFluidNetwork.loadCheckpoint(reader);
+    CPPUNIT_ASSERT(reader.isAtEnd());
+    reader.close();
+    remove(fileName.c_str());
+    for (int node = 0; node < 2; ++node) {
+        const PolyFluid* content = tFluidNodes[node].getContent();
+        CPPUNIT_ASSERT(pressure[node]    == content->getPressure());
+        CPPUNIT_ASSERT(temperature[node] == content->getTemperature());
+        CPPUNIT_ASSERT(mass[node]        == content->getMass());
+        CPPUNIT_ASSERT(tcMass[node]      == content->getTraceCompounds()->getMasses()[0]);
+    }
+    CPPUNIT_ASSERT(flowRate == tFluidConductor.getFlowRate());
+
+    /// @test  The network retraces the same trajectory.
+    for (int step = 0; step < N_STEPS; ++step) {
+        tFluidNetwork.step(tTimeStep);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(trajectory[step][0],
+                                     tFluidNodes[0].getContent()->getPressure(),
+                                     trajectory[step][0] * 1.0E-10);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(trajectory[step][1],
+                                     tFluidNodes[1].getContent()->getPressure(),
+                                     trajectory[step][1] * 1.0E-10);
+    }
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that a checkpoint whose header matches but whose body is corrupt is rejected,
+///           and leaves the network state as it was, even though the body had already been read
+///           into some of the nodes and links.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsCheckpoint::testCorruptCheckpoint()
+{
+    std::cout << "\n UtGunnsCheckpoint ...... 09: testCorruptCheckpoint .................";
+
+    /// - Basic network checkpoint, then change the state after it.
+    setupBasicNetwork();
+    for (int step = 0; step < N_STEPS; ++step) {
+        tBasicNetwork.step(tTimeStep);
+    }
+    GunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&tBuffer);
+    tBasicNetwork.saveCheckpoint(writer);
+    writer.close();
+    const unsigned long numSlots = writer.getRawSize() / 8;
+    for (int step = 0; step < N_STEPS; ++step) {
+        tBasicNetwork.step(tTimeStep);
+    }
+    tSource.setFluxDemand(5.0);
+    tConductor1.setMalfBlockage(true, 0.5);
+    tBasicNetwork.step(tTimeStep);
+    double potentials[N_BASIC_NODES];
+    for (int node = 0; node < N_BASIC_NODES; ++node) {
+        potentials[node] = tBasicNodes[node].getPotential();
+    }
+    const double capacitorFlux = tCapacitor.getFlux();
+    const int    majorSteps    = tBasicNetwork.getMajorStepCount();
+    const int    minorSteps    = tBasicNetwork.getMinorStepCount();
+
+    /// @test  A trailer out of sync is only found after all the nodes and links have read their
+    ///        state, which is rolled back.
+    std::vector<unsigned char> corrupt;
+    corruptCheckpoint(corrupt, numSlots - 1, 0);
+    GunnsCheckpointReader reader("reader");
+    reader.openBuffer(&corrupt);
+    CPPUNIT_ASSERT_THROW(tBasicNetwork.loadCheckpoint(reader), TsParseException);
+    for (int node = 0; node < N_BASIC_NODES; ++node) {
+        CPPUNIT_ASSERT(potentials[node] == tBasicNodes[node].getPotential());
+    }
+    CPPUNIT_ASSERT(capacitorFlux == tCapacitor.getFlux());
+    CPPUNIT_ASSERT(majorSteps    == tBasicNetwork.getMajorStepCount());
+    CPPUNIT_ASSERT(minorSteps    == tBasicNetwork.getMinorStepCount());
+    CPPUNIT_ASSERT(5.0           == tSource.getFluxDemand());
+    CPPUNIT_ASSERT(tConductor1.mMalfBlockageFlag);
+
+    /// @test  A truncated body is rolled back.
+    std::vector<unsigned char> truncated;
+    GunnsCheckpointReader copyReader("copyReader");
+    copyReader.openBuffer(&tBuffer);
+    writer.openBuffer(&truncated);
+    for (unsigned long i = 0; i < numSlots - 3; ++i) {
+        double value = 0.0;
+        copyReader.read(value);
+        writer.write(value);
+    }
+    writer.close();
+    reader.openBuffer(&truncated);
+    CPPUNIT_ASSERT_THROW(tBasicNetwork.loadCheckpoint(reader), TsParseException);
+    CPPUNIT_ASSERT(potentials[1] == tBasicNodes[1].getPotential());
+    CPPUNIT_ASSERT(majorSteps    == tBasicNetwork.getMajorStepCount());
+    CPPUNIT_ASSERT(5.0           == tSource.getFluxDemand());
+
+    /// @test  The network carries on stepping from its own state.
+    tBasicNetwork.step(tTimeStep);
+    CPPUNIT_ASSERT(majorSteps + 1 == tBasicNetwork.getMajorStepCount());
+
+    /// - Fluid network checkpoint, then change the state after it.
+    setupFluidNetwork();
+    for (int step = 0; step < N_STEPS; ++step) {
+        tFluidNetwork.step(tTimeStep);
+    }
+    writer.openBuffer(&tBuffer);
+    tFluidNetwork.saveCheckpoint(writer);
+    writer.close();
+    for (int step = 0; step < N_STEPS; ++step) {
+        tFluidNetwork.step(tTimeStep);
+    }
+    double pressure[2];
+    double mass[2];
+    for (int node = 0; node < 2; ++node) {
+        pressure[node] = tFluidNodes[node].getContent()->getPressure();
+        mass[node]     = tFluidNodes[node].getContent()->getMass();
+    }
+    const double flowRate = tFluidConductor.getFlowRate();
+
+    /// @test  A node mixture mismatch in the second node, after the first node has been loaded, is
+    ///        rolled back.  The slots are the 3 header values, the 8 step counters, then per node
+    ///        the potential, network capacitance, temperature, pressure, mass and number of types.
+    const unsigned long node1Types = 3 + 8 + 19 + 5;
+    copyReader.openBuffer(&tBuffer);
+    for (unsigned long i = 0; i < node1Types; ++i) {
+        double value = 0.0;
+        copyReader.read(value);
+    }
+    int numTypes = 0;
+    copyReader.read(numTypes);
+    CPPUNIT_ASSERT(2 == numTypes);
+    std::vector<unsigned char> mismatch;
+    corruptCheckpoint(mismatch, node1Types, 3);
+    reader.openBuffer(&mismatch);
+    CPPUNIT_ASSERT_THROW(tFluidNetwork.loadCheckpoint(reader), TsParseException);
+    for (int node = 0; node < 2; ++node) {
+        CPPUNIT_ASSERT(pressure[node] == tFluidNodes[node].getContent()->getPressure());
+        CPPUNIT_ASSERT(mass[node]     == tFluidNodes[node].getContent()->getMass());
+    }
+    CPPUNIT_ASSERT(flowRate == tFluidConductor.getFlowRate());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that run-time edits of the opted-in links are rolled back, and that a network
+///           holding a link that hasn't opted in to native checkpoints can't save or load one.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsCheckpoint::testCheckpointOptIn()
+{
+    std::cout << "\n UtGunnsCheckpoint ...... 10: testCheckpointOptIn ...................";
+
+    /// @test  The core links opt in, but a type derived from one doesn't inherit it.
+    UtGunnsCheckpointDerivedCapacitor derived;
+    CPPUNIT_ASSERT(tPotential.isCheckpointable());
+    CPPUNIT_ASSERT(tConductor1.isCheckpointable());
+    CPPUNIT_ASSERT(tCapacitor.isCheckpointable());
+    CPPUNIT_ASSERT(tSource.isCheckpointable());
+    CPPUNIT_ASSERT(tFluidCapacitor0.isCheckpointable());
+    CPPUNIT_ASSERT(tFluidConductor.isCheckpointable());
+    CPPUNIT_ASSERT(not derived.isCheckpointable());
+
+    /// @test  A capacitance edit is rolled back.
+    setupBasicNetwork();
+    tBasicNetwork.step(tTimeStep);
+    GunnsCheckpointWriter writer("writer");
+    writer.openBuffer(&tBuffer);
+    tBasicNetwork.saveCheckpoint(writer);
+    writer.close();
+    tCapacitor.setCapacitance(5.0);
+    tBasicNetwork.step(tTimeStep);
+    GunnsCheckpointReader reader("reader");
+    reader.openBuffer(&tBuffer);
+    tBasicNetwork.loadCheckpoint(reader);
+    CPPUNIT_ASSERT(0.5 == tCapacitor.getCapacitance());
+
+    /// @test  A fluid capacitor volume edit is rolled back with the node contents.
+    setupFluidNetwork();
+    tFluidNetwork.step(tTimeStep);
+    writer.openBuffer(&tBuffer);
+    tFluidNetwork.saveCheckpoint(writer);
+    writer.close();
+    const double mass = tFluidNodes[0].getContent()->getMass();
+    tFluidCapacitor0.editVolume(true, 2.0);
+    tFluidNetwork.step(tTimeStep);
+    CPPUNIT_ASSERT(2.0 == tFluidCapacitor0.getVolume());
+    reader.openBuffer(&tBuffer);
+    tFluidNetwork.loadCheckpoint(reader);
+    CPPUNIT_ASSERT(1.0  == tFluidCapacitor0.getVolume());
+    CPPUNIT_ASSERT(mass == tFluidNodes[0].getContent()->getMass());
+
+    /// @test  A network holding a link that hasn't opted in can't save or load, and a failed load
+    ///        leaves the network as it was.
+    GunnsBasicNode nodes[2];
+    GunnsNodeList  nodeList;
+    nodes[0].initialize("UtOptIn.Node0", 10.0);
+    nodes[1].initialize("UtOptIn.Ground");
+    nodeList.mNumNodes = 2;
+    nodeList.mNodes    = nodes;
+    Gunns network;
+    network.initializeNodes(nodeList);
+    std::vector<GunnsBasicLink*> links;
+    GunnsBasicCapacitorConfigData capacitorConfig("UtOptIn.C", &nodeList);
+    GunnsBasicCapacitorInputData  capacitorInput(false, 0.0, 0.5, 10.0);
+    derived.initialize(capacitorConfig, capacitorInput, links, 0, 1);
+    GunnsConfigData networkConfig("UtOptIn", 0.01, 1.0, 10, 5);
+    network.initialize(networkConfig, links);
+    network.step(tTimeStep);
+    const double potential = nodes[0].getPotential();
+    writer.openBuffer(&tBuffer);
+    CPPUNIT_ASSERT_THROW(network.saveCheckpoint(writer), TsInitializationException);
+    writer.close();
+    reader.openBuffer(&tBuffer);
+    CPPUNIT_ASSERT_THROW(network.loadCheckpoint(reader), TsInitializationException);
+    CPPUNIT_ASSERT(potential == nodes[0].getPotential());
+    CPPUNIT_ASSERT(0.5       == derived.getCapacitance());
+
+    std::cout << "... Pass";
+}
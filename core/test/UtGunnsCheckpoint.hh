@@ -0,0 +1,167 @@
+#ifndef UtGunnsCheckpoint_EXISTS
+#define UtGunnsCheckpoint_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_CHECKPOINT    Gunns Native Checkpoint Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Gunns Native Checkpoint stream and network save & load.
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <iostream>
+#include <vector>
+
+#include "aspects/fluid/fluid/PolyFluid.hh"
+#include "core/Gunns.hh"
+#include "core/GunnsBasicCapacitor.hh"
+#include "core/GunnsBasicConductor.hh"
+#include "core/GunnsBasicPotential.hh"
+#include "core/GunnsBasicSource.hh"
+#include "core/GunnsCheckpoint.hh"
+#include "core/GunnsFluidCapacitor.hh"
+#include "core/GunnsFluidConductor.hh"
+#include "core/GunnsFluidNode.hh"
+#include "properties/FluidProperties.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsCheckpointWriter and befriend UtGunnsCheckpoint.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsCheckpointWriter : public GunnsCheckpointWriter
+{
+    public:
+        FriendlyGunnsCheckpointWriter(const std::string& name);
+        virtual ~FriendlyGunnsCheckpointWriter();
+        friend class UtGunnsCheckpoint;
+};
+inline FriendlyGunnsCheckpointWriter::FriendlyGunnsCheckpointWriter(const std::string& name)
+    : GunnsCheckpointWriter(name) {};
+inline FriendlyGunnsCheckpointWriter::~FriendlyGunnsCheckpointWriter() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsCheckpointReader and befriend UtGunnsCheckpoint.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsCheckpointReader : public GunnsCheckpointReader
+{
+    public:
+        FriendlyGunnsCheckpointReader(const std::string& name);
+        virtual ~FriendlyGunnsCheckpointReader();
+        friend class UtGunnsCheckpoint;
+};
+inline FriendlyGunnsCheckpointReader::FriendlyGunnsCheckpointReader(const std::string& name)
+    : GunnsCheckpointReader(name) {};
+inline FriendlyGunnsCheckpointReader::~FriendlyGunnsCheckpointReader() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Derived capacitor that hasn't opted in to native checkpoints.
+///
+/// @details  Class derived from an opted-in link type, without its own isCheckpointable override,
+///           for testing that the network rejects it.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsCheckpointDerivedCapacitor : public GunnsBasicCapacitor
+{
+    public:
+        UtGunnsCheckpointDerivedCapacitor();
+        virtual ~UtGunnsCheckpointDerivedCapacitor();
+};
+inline UtGunnsCheckpointDerivedCapacitor::UtGunnsCheckpointDerivedCapacitor()
+    : GunnsBasicCapacitor() {};
+inline UtGunnsCheckpointDerivedCapacitor::~UtGunnsCheckpointDerivedCapacitor() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Native Checkpoint unit tests.
+////
+/// @details  This class provides the unit tests for the GunnsCheckpointCodec,
+///           GunnsCheckpointWriter & GunnsCheckpointReader classes, and the native checkpoint
+///           save & load of basic and fluid networks, within the CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsCheckpoint: public CppUnit::TestFixture
+{
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsCheckpoint(const UtGunnsCheckpoint& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsCheckpoint& operator =(const UtGunnsCheckpoint& that);
+
+        CPPUNIT_TEST_SUITE(UtGunnsCheckpoint);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testCodec);
+        CPPUNIT_TEST(testRoundTrip);
+        CPPUNIT_TEST(testCompression);
+        CPPUNIT_TEST(testFile);
+        CPPUNIT_TEST(testInvalidStreams);
+        CPPUNIT_TEST(testBasicNetworkRollback);
+        CPPUNIT_TEST(testFluidNetworkRollback);
+        CPPUNIT_TEST(testCorruptCheckpoint);
+        CPPUNIT_TEST(testCheckpointOptIn);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief Enumeration of the basic network nodes.
+        enum {N_BASIC_NODES = 4, BASIC_GROUND = 3};
+        /// @brief Enumeration of the fluid network nodes.
+        enum {N_FLUID_NODES = 3, FLUID_GROUND = 2};
+        /// @brief Number of steps in each leg of the rollback tests.
+        enum {N_STEPS = 10};
+
+        std::vector<unsigned char>          tBuffer;             /**< (--) Checkpoint memory buffer */
+        GunnsBasicNode                      tBasicNodes[N_BASIC_NODES]; /**< (--) Basic network nodes */
+        GunnsNodeList                       tBasicNodeList;      /**< (--) Basic network node list */
+        std::vector<GunnsBasicLink*>        tBasicLinks;         /**< (--) Basic network links */
+        GunnsBasicPotential                 tPotential;          /**< (--) Basic network potential source */
+        GunnsBasicConductor                 tConductor1;         /**< (--) Basic network conductor */
+        GunnsBasicConductor                 tConductor2;         /**< (--) Basic network conductor */
+        GunnsBasicCapacitor                 tCapacitor;          /**< (--) Basic network capacitor */
+        GunnsBasicSource                    tSource;             /**< (--) Basic network flux source */
+        Gunns                               tBasicNetwork;       /**< (--) Basic network */
+        DefinedFluidProperties              tFluidProperties;    /**< (--) Defined fluid properties */
+        GunnsFluidTraceCompoundsConfigData* tTcConfig;           /**< (--) Trace compounds config data */
+        PolyFluidConfigData*                tFluidConfig;        /**< (--) Fluid config data */
+        GunnsFluidNode                      tFluidNodes[N_FLUID_NODES]; /**< (--) Fluid network nodes */
+        GunnsNodeList                       tFluidNodeList;      /**< (--) Fluid network node list */
+        std::vector<GunnsBasicLink*>        tFluidLinks;         /**< (--) Fluid network links */
+        GunnsFluidCapacitor                 tFluidCapacitor0;    /**< (--) Fluid network capacitor */
+        GunnsFluidCapacitor                 tFluidCapacitor1;    /**< (--) Fluid network capacitor */
+        GunnsFluidConductor                 tFluidConductor;     /**< (--) Fluid network conductor */
+        Gunns                               tFluidNetwork;       /**< (--) Fluid network */
+        double                              tTimeStep;           /**< (s)  Network time step */
+        /// @brief Initializes the basic network.
+        void setupBasicNetwork();
+        /// @brief Initializes the fluid network.
+        void setupFluidNetwork();
+        /// @brief Copies tBuffer to the given buffer, replacing one value slot with an int.
+        void corruptCheckpoint(std::vector<unsigned char>& buffer, const unsigned long slot,
+                               const int value);
+
+    public:
+        UtGunnsCheckpoint();
+        virtual ~UtGunnsCheckpoint();
+        void tearDown();
+        void setUp();
+        void testDefaultConstruction();
+        void testCodec();
+        void testRoundTrip();
+        void testCompression();
+        void testFile();
+        void testInvalidStreams();
+        void testBasicNetworkRollback();
+        void testFluidNetworkRollback();
+        void testCorruptCheckpoint();
+        void testCheckpointOptIn();
+};
+
+///@}
+
+#endif
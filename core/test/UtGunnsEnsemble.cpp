@@ -0,0 +1,330 @@
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+
+#include "UtGunnsEnsemble.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include "software/exceptions/TsNumericalException.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsEnsemble class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsEnsemble::UtGunnsEnsemble()
+    :
+    tNodes(),
+    tNodeList(),
+    tLinks(),
+    tPotential(),
+    tConductor1(),
+    tLoad(),
+    tConductor2(),
+    tCapacitor(),
+    tConductor3(),
+    tSource(),
+    tNetwork(),
+    tArticle(),
+    tTimeStep(0.1)
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsEnsemble class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsEnsemble::~UtGunnsEnsemble()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::tearDown()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::setUp()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] set  (--) Index of the network set, 0 stepped on their own, 1 in the ensemble.
+/// @param[in] lane (--) Index of the lane, which varies the network parameters.
+///
+/// @details  Initializes a linear network with a potential source, conductors, a capacitor and a
+///           flux source, with conductances, capacitance and source flux varied by lane.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::setupNetwork(const int set, const int lane)
+{
+    std::ostringstream name;
+    name << "UtGunnsEnsemble" << set << "_" << lane;
+    const double scale = 1.0 + 0.25 * lane;
+
+    for (int node = 0; node < N_NODES; ++node) {
+        std::ostringstream nodeName;
+        nodeName << name.str() << ".Node" << node;
+        tNodes[set][lane][node].initialize(nodeName.str());
+    }
+    tNodeList[set][lane].mNumNodes = N_NODES;
+    tNodeList[set][lane].mNodes    = tNodes[set][lane];
+    tNetwork[set][lane].initializeNodes(tNodeList[set][lane]);
+
+    GunnsNodeList* nodeList = &tNodeList[set][lane];
+    GunnsBasicPotentialConfigData  potentialConfig(name.str() + ".VS1", nodeList, 1.0E14);
+    GunnsBasicPotentialInputData   potentialInput(false, 0.0, -125.0);
+    GunnsBasicConductorConfigData  conductor1Config(name.str() + ".R1", nodeList, 1.0 * scale);
+    GunnsBasicConductorConfigData  loadConfig      (name.str() + ".RL", nodeList, 0.02 / scale);
+    GunnsBasicConductorConfigData  conductor2Config(name.str() + ".R2", nodeList, scale / 1750.0);
+    GunnsBasicConductorConfigData  conductor3Config(name.str() + ".R3", nodeList, scale / 100.0);
+    GunnsBasicConductorInputData   conductorInput;
+    GunnsBasicCapacitorConfigData  capacitorConfig(name.str() + ".C1", nodeList);
+    GunnsBasicCapacitorInputData   capacitorInput(false, 0.0, 0.5 * scale, 100.0);
+    GunnsBasicSourceConfigData     sourceConfig(name.str() + ".S1", nodeList);
+    GunnsBasicSourceInputData      sourceInput(false, 0.0, 0.2 * scale);
+
+    std::vector<GunnsBasicLink*>& links = tLinks[set][lane];
+    tPotential [set][lane].initialize(potentialConfig,  potentialInput, links, Node0,  GROUND);
+    tConductor1[set][lane].initialize(conductor1Config, conductorInput, links, Node0,  Node1);
+    tLoad      [set][lane].initialize(loadConfig,       conductorInput, links, Node1,  GROUND);
+    tConductor2[set][lane].initialize(conductor2Config, conductorInput, links, Node1,  Node2);
+    tCapacitor [set][lane].initialize(capacitorConfig,  capacitorInput, links, Node2,  GROUND);
+    tConductor3[set][lane].initialize(conductor3Config, conductorInput, links, Node2,  Node3);
+    tSource    [set][lane].initialize(sourceConfig,     sourceInput,    links, GROUND, Node3);
+
+    /// - Request the network capacitance of a node in one lane.
+    if (1 == lane) {
+        tNodes[set][lane][Node2].setNetworkCapacitanceRequest(1.0);
+    }
+
+    GunnsConfigData networkConfig(name.str(), 0.01, 1.0, 10, 5);
+    tNetwork[set][lane].initialize(networkConfig, links);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Initializes both sets of networks, and the ensemble of the second set.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::setupEnsemble()
+{
+    for (int set = 0; set < 2; ++set) {
+        for (int lane = 0; lane < N_LANES; ++lane) {
+            setupNetwork(set, lane);
+        }
+    }
+    for (int lane = 0; lane < N_LANES; ++lane) {
+        tArticle.addLane(&tNetwork[1][lane]);
+    }
+    tArticle.initialize("tArticle");
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] steps (--) Number of major steps to run.
+///
+/// @details  Steps the ensemble and the networks of the first set on their own, and verifies the
+///           potentials, link fluxes, network capacitances and solver counts are exactly equal,
+///           since the batched decomposition and solution make the same operations in the same
+///           order as the solver.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::verifyIdentical(const int steps)
+{
+    for (int step = 0; step < steps; ++step) {
+        for (int lane = 0; lane < N_LANES; ++lane) {
+            tNetwork[0][lane].step(tTimeStep);
+        }
+        tArticle.step(tTimeStep);
+        for (int lane = 0; lane < N_LANES; ++lane) {
+            for (int node = 0; node < GROUND; ++node) {
+                CPPUNIT_ASSERT_EQUAL(tNetwork[0][lane].getPotentialVector()[node],
+                                     tNetwork[1][lane].getPotentialVector()[node]);
+                CPPUNIT_ASSERT_EQUAL(tNodes[0][lane][node].getPotential(),
+                                     tNodes[1][lane][node].getPotential());
+            }
+            CPPUNIT_ASSERT_EQUAL(tConductor2[0][lane].getFlux(), tConductor2[1][lane].getFlux());
+            CPPUNIT_ASSERT_EQUAL(tCapacitor [0][lane].getFlux(), tCapacitor [1][lane].getFlux());
+            CPPUNIT_ASSERT_EQUAL(tSource    [0][lane].getFlux(), tSource    [1][lane].getFlux());
+            CPPUNIT_ASSERT_EQUAL(tNodes[0][lane][Node2].getNetworkCapacitance(),
+                                 tNodes[1][lane][Node2].getNetworkCapacitance());
+        }
+    }
+    for (int lane = 0; lane < N_LANES; ++lane) {
+        CPPUNIT_ASSERT_EQUAL(tNetwork[0][lane].getMajorStepCount(),
+                             tNetwork[1][lane].getMajorStepCount());
+        CPPUNIT_ASSERT_EQUAL(tNetwork[0][lane].getMinorStepCount(),
+                             tNetwork[1][lane].getMinorStepCount());
+        CPPUNIT_ASSERT_EQUAL(tNetwork[0][lane].getDecompositionCount(),
+                             tNetwork[1][lane].getDecompositionCount());
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the batched lanes give exactly the same solutions as stepping each
+///           network on its own, including when only some of the lanes need decomposition.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::testMatchesSerial()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsEnsemble 01: testMatchesSerial .................................";
+
+    setupEnsemble();
+    CPPUNIT_ASSERT(tArticle.isInitialized());
+    CPPUNIT_ASSERT(N_LANES             == tArticle.getNumLanes());
+    CPPUNIT_ASSERT(&tNetwork[1][2]     == tArticle.getLane(2));
+    CPPUNIT_ASSERT(0                   == tArticle.getLane(N_LANES));
+
+    verifyIdentical(10);
+    CPPUNIT_ASSERT(N_LANES == tArticle.getNumBatched());
+    CPPUNIT_ASSERT(1       == tArticle.getDecompositionCount());
+
+    /// - Verify the lanes are varied, and the capacitors charge from their sources.
+    CPPUNIT_ASSERT(tNodes[1][0][Node2].getPotential() != tNodes[1][2][Node2].getPotential());
+    CPPUNIT_ASSERT(tNodes[1][1][Node2].getPotential() != 100.0);
+    CPPUNIT_ASSERT(tNodes[1][1][Node2].getNetworkCapacitance() > 0.0);
+
+    /// - Change the admittance of one lane, so that only it is decomposed in the batch.
+    tCapacitor[0][1].setCapacitance(2.0);
+    tCapacitor[1][1].setCapacitance(2.0);
+    verifyIdentical(5);
+    CPPUNIT_ASSERT(2 == tArticle.getDecompositionCount());
+
+    /// - Change the admittance of another lane.
+    tConductor3[0][0].setDefaultConductivity(0.5);
+    tConductor3[1][0].setDefaultConductivity(0.5);
+    verifyIdentical(5);
+    CPPUNIT_ASSERT(3 == tArticle.getDecompositionCount());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests lanes that can't be batched are stepped on their own, and rejoin the
+///           batch when they can be batched again.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::testSerialFallback()
+{
+    std::cout << "\n UtGunnsEnsemble 02: testSerialFallback ................................";
+
+    setupEnsemble();
+    verifyIdentical(3);
+
+    /// - Solving islands isn't batched.
+    tNetwork[0][0].setIslandMode(Gunns::SOLVE);
+    tNetwork[1][0].setIslandMode(Gunns::SOLVE);
+    verifyIdentical(3);
+    CPPUNIT_ASSERT(N_LANES - 1 == tArticle.getNumBatched());
+
+    /// - Paused lanes aren't stepped.
+    tNetwork[0][2].setPauseMode();
+    tNetwork[1][2].setPauseMode();
+    verifyIdentical(3);
+    CPPUNIT_ASSERT(N_LANES - 2 == tArticle.getNumBatched());
+
+    /// - The lanes rejoin the batch with a new decomposition.
+    tNetwork[0][0].setIslandMode(Gunns::OFF);
+    tNetwork[1][0].setIslandMode(Gunns::OFF);
+    tNetwork[0][2].setRunMode();
+    tNetwork[1][2].setRunMode();
+    tCapacitor[0][0].setCapacitance(1.0);
+    tCapacitor[1][0].setCapacitance(1.0);
+    tCapacitor[0][2].setCapacitance(1.0);
+    tCapacitor[1][2].setCapacitance(1.0);
+    verifyIdentical(3);
+    CPPUNIT_ASSERT(N_LANES == tArticle.getNumBatched());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests a lane whose admittance matrix can't be decomposed fails as it does
+///           when stepped on its own, while the other lanes in the batch complete their step, and
+///           that it rejoins the batch once it can be decomposed again.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::testSingularLane()
+{
+    std::cout << "\n UtGunnsEnsemble 03: testSingularLane ..................................";
+
+    setupEnsemble();
+    verifyIdentical(3);
+
+    /// - A negative capacitance makes the middle lane's matrix not positive-definite.
+    tCapacitor[0][1].setCapacitance(-1000.0);
+    tCapacitor[1][1].setCapacitance(-1000.0);
+    tNetwork[0][0].step(tTimeStep);
+    CPPUNIT_ASSERT_THROW(tNetwork[0][1].step(tTimeStep), TsNumericalException);
+    tNetwork[0][2].step(tTimeStep);
+    CPPUNIT_ASSERT_THROW(tArticle.step(tTimeStep), TsNumericalException);
+    CPPUNIT_ASSERT(N_LANES - 1 == tArticle.getNumBatched());
+
+    /// - Verify the other lanes completed their step.
+    for (int lane = 0; lane < N_LANES; lane += 2) {
+        for (int node = 0; node < GROUND; ++node) {
+            CPPUNIT_ASSERT_EQUAL(tNodes[0][lane][node].getPotential(),
+                                 tNodes[1][lane][node].getPotential());
+        }
+        CPPUNIT_ASSERT_EQUAL(tCapacitor[0][lane].getFlux(), tCapacitor[1][lane].getFlux());
+    }
+
+    /// - Verify the failed lane matches its failed serial step.
+    for (int lane = 0; lane < N_LANES; ++lane) {
+        CPPUNIT_ASSERT_EQUAL(tNetwork[0][lane].getMajorStepCount(),
+                             tNetwork[1][lane].getMajorStepCount());
+        CPPUNIT_ASSERT_EQUAL(tNetwork[0][lane].getDecompositionCount(),
+                             tNetwork[1][lane].getDecompositionCount());
+    }
+    for (int node = 0; node < GROUND; ++node) {
+        CPPUNIT_ASSERT_EQUAL(tNodes[0][1][node].getPotential(), tNodes[1][1][node].getPotential());
+    }
+
+    /// - The lane rejoins the batch when its matrix is valid again.
+    tCapacitor[0][1].setCapacitance(1.0);
+    tCapacitor[1][1].setCapacitance(1.0);
+    verifyIdentical(3);
+    CPPUNIT_ASSERT(N_LANES == tArticle.getNumBatched());
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests initialization errors.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsEnsemble::testInitErrors()
+{
+    std::cout << "\n UtGunnsEnsemble 04: testInitErrors ....................................";
+
+    /// - Stepping before initialization.
+    CPPUNIT_ASSERT_THROW(tArticle.step(tTimeStep), TsInitializationException);
+
+    /// - Missing name, and no lanes.
+    CPPUNIT_ASSERT_THROW(tArticle.initialize(""),         TsInitializationException);
+    CPPUNIT_ASSERT_THROW(tArticle.initialize("tArticle"), TsInitializationException);
+    CPPUNIT_ASSERT(not tArticle.isInitialized());
+
+    /// - Uninitialized lane.
+    tArticle.addLane(&tNetwork[1][0]);
+    CPPUNIT_ASSERT_THROW(tArticle.initialize("tArticle"), TsInitializationException);
+
+    /// - Lane network size mismatch.
+    setupNetwork(1, 0);
+    Gunns               smallNetwork;
+    GunnsBasicNode      smallNodes[2];
+    GunnsNodeList       smallNodeList;
+    std::vector<GunnsBasicLink*> smallLinks;
+    GunnsBasicConductor smallConductor;
+    smallNodes[0].initialize("smallNodes_0");
+    smallNodes[1].initialize("smallNodes_1");
+    smallNodeList.mNumNodes = 2;
+    smallNodeList.mNodes    = smallNodes;
+    smallNetwork.initializeNodes(smallNodeList);
+    GunnsBasicConductorConfigData smallConfig("smallConductor", &smallNodeList, 1.0);
+    GunnsBasicConductorInputData  smallInput;
+    smallConductor.initialize(smallConfig, smallInput, smallLinks, 0, 1);
+    GunnsConfigData networkConfig("smallNetwork", 0.01, 1.0, 10, 5);
+    smallNetwork.initialize(networkConfig, smallLinks);
+    tArticle.addLane(&smallNetwork);
+    CPPUNIT_ASSERT_THROW(tArticle.initialize("tArticle"), TsInitializationException);
+    CPPUNIT_ASSERT(not tArticle.isInitialized());
+
+    std::cout << "... Pass";
+}
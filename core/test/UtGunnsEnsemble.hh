@@ -0,0 +1,106 @@
+#ifndef UtGunnsEnsemble_EXISTS
+#define UtGunnsEnsemble_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_ENSEMBLE    GUNNS Ensemble Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the GUNNS Ensemble
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <sstream>
+#include <vector>
+
+#include "core/Gunns.hh"
+#include "core/GunnsBasicCapacitor.hh"
+#include "core/GunnsBasicConductor.hh"
+#include "core/GunnsBasicPotential.hh"
+#include "core/GunnsBasicSource.hh"
+#include "core/GunnsEnsemble.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Ensemble Unit Tests.
+///
+/// @details  This class provides the unit tests for the GunnsEnsemble class within the CPPUnit
+///           framework.  Each test builds a set of parameter-varied linear networks stepped by the
+///           ensemble, and an identical set stepped on their own, and compares their solutions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsEnsemble : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this GunnsEnsemble unit test.
+        UtGunnsEnsemble();
+        /// @brief    Default destructs this GunnsEnsemble unit test.
+        virtual ~UtGunnsEnsemble();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests the batched lanes give the same solution as stepping each network.
+        void testMatchesSerial();
+        /// @brief    Tests lanes that can't be batched are stepped on their own.
+        void testSerialFallback();
+        /// @brief    Tests a singular lane fails without stopping the other lanes.
+        void testSingularLane();
+        /// @brief    Tests initialization errors.
+        void testInitErrors();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsEnsemble);
+        CPPUNIT_TEST(testMatchesSerial);
+        CPPUNIT_TEST(testSerialFallback);
+        CPPUNIT_TEST(testSingularLane);
+        CPPUNIT_TEST(testInitErrors);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief    Enumeration of the network nodes.
+        enum Nodes {
+            Node0  = 0,
+            Node1  = 1,
+            Node2  = 2,
+            Node3  = 3,
+            GROUND = 4,
+            N_NODES = 5
+        };
+
+        /// @brief    Enumeration of the test sizes.
+        enum Sizes {
+            N_LANES = 3    ///< Number of lanes in the ensemble.
+        };
+
+        GunnsBasicNode                tNodes[2][N_LANES][N_NODES]; /**< (--) Nodes of the networks. */
+        GunnsNodeList                 tNodeList[2][N_LANES];       /**< (--) Node lists of the networks. */
+        std::vector<GunnsBasicLink*>  tLinks[2][N_LANES];          /**< (--) Links of the networks. */
+        GunnsBasicPotential           tPotential[2][N_LANES];      /**< (--) Potential sources. */
+        GunnsBasicConductor           tConductor1[2][N_LANES];     /**< (--) First conductors. */
+        GunnsBasicConductor           tLoad[2][N_LANES];           /**< (--) Load conductors. */
+        GunnsBasicConductor           tConductor2[2][N_LANES];     /**< (--) Second conductors. */
+        GunnsBasicCapacitor           tCapacitor[2][N_LANES];      /**< (--) Capacitors. */
+        GunnsBasicConductor           tConductor3[2][N_LANES];     /**< (--) Third conductors. */
+        GunnsBasicSource              tSource[2][N_LANES];         /**< (--) Flux sources. */
+        Gunns                         tNetwork[2][N_LANES];        /**< (--) The networks, [1] are the ensemble lanes. */
+        GunnsEnsemble                 tArticle;                    /**< (--) Test article. */
+        double                        tTimeStep;                   /**< (s)  Integration time step. */
+
+        /// @brief    Initializes one of the networks, with parameters varied by lane.
+        void setupNetwork(const int set, const int lane);
+        /// @brief    Initializes all networks and the ensemble.
+        void setupEnsemble();
+        /// @brief    Steps the ensemble and the other networks and verifies identical solutions.
+        void verifyIdentical(const int steps);
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsEnsemble(const UtGunnsEnsemble& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsEnsemble& operator =(const UtGunnsEnsemble& that);
+};
+
+///@}
+
+#endif
@@ -139,6 +139,8 @@ void UtGunnsFluidDistributedIf::testConfig()
     CPPUNIT_ASSERT(false           == tConfigData->mFluidSizesOverride);
     CPPUNIT_ASSERT(0               == tConfigData->mNumFluidOverride);
     CPPUNIT_ASSERT(0               == tConfigData->mNumTcOverride);
+    CPPUNIT_ASSERT(0               == tConfigData->mPredictorOrder);
+    CPPUNIT_ASSERT(4               == tConfigData->mCorrectorFrames);
 
     /// - Check default config construction
     GunnsFluidDistributedIfConfigData defaultConfig;
@@ -155,6 +157,8 @@ void UtGunnsFluidDistributedIf::testConfig()
     CPPUNIT_ASSERT(false           == defaultConfig.mFluidSizesOverride);
     CPPUNIT_ASSERT(0               == defaultConfig.mNumFluidOverride);
     CPPUNIT_ASSERT(0               == defaultConfig.mNumTcOverride);
+    CPPUNIT_ASSERT(0               == defaultConfig.mPredictorOrder);
+    CPPUNIT_ASSERT(4               == defaultConfig.mCorrectorFrames);
 
     /// @test overrideInterfaceMixtureSizes function
     defaultConfig.overrideInterfaceMixtureSizes(5, 4);
@@ -228,6 +232,14 @@ void UtGunnsFluidDistributedIf::testDefaultConstruction()
     CPPUNIT_ASSERT(0     == tArticle->mTempMassFractions);
     CPPUNIT_ASSERT(0     == tArticle->mOtherIfs.size());
     CPPUNIT_ASSERT(0.0   == tArticle->mFluidState.getTemperature());
+    CPPUNIT_ASSERT(0     == tArticle->mTransport);
+    CPPUNIT_ASSERT(0     == tArticle->mPredictorOrder);
+    CPPUNIT_ASSERT(0     == tArticle->mCorrectorFrames);
+    CPPUNIT_ASSERT(true  == tArticle->mSourcePredictor.isEmpty());
+    CPPUNIT_ASSERT(0     == tArticle->mPredictorNumPending);
+    CPPUNIT_ASSERT(0.0   == tArticle->mPredictorDebt);
+    CPPUNIT_ASSERT(0.0   == tArticle->mPredictorLost);
+    CPPUNIT_ASSERT(0.0   == tArticle->getConservationError());
 
     /// @test init flag
     CPPUNIT_ASSERT(!tArticle->mInitFlag);
@@ -279,6 +291,8 @@ void UtGunnsFluidDistributedIf::testNominalInitialization()
     CPPUNIT_ASSERT(1.25            == tArticle->mModingCapacitanceRatio);
     CPPUNIT_ASSERT(1.5             == tArticle->mDemandFilterConstA);
     CPPUNIT_ASSERT(0.75            == tArticle->mDemandFilterConstB);
+    CPPUNIT_ASSERT(0               == tArticle->mPredictorOrder);
+    CPPUNIT_ASSERT(4               == tArticle->mCorrectorFrames);
 
     /// @test internal fluid.
     CPPUNIT_ASSERT(tArticle->mInternalFluid);
@@ -389,6 +403,19 @@ void UtGunnsFluidDistributedIf::testInitializationExceptions()
     tInputData->mForceDemandMode = false;
     tInputData->mForceSupplyMode = false;
 
+    /// @test Exception on invalid predictor order.
+    tConfigData->mPredictorOrder = 3;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0),
+                         TsInitializationException);
+    tConfigData->mPredictorOrder = 2;
+
+    /// @test Exception on invalid corrector frames.
+    tConfigData->mCorrectorFrames = 0;
+    CPPUNIT_ASSERT_THROW(tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0),
+                         TsInitializationException);
+    tConfigData->mCorrectorFrames = 4;
+    CPPUNIT_ASSERT_NO_THROW(tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0));
+
     std::cout << "... Pass";
 }
 
@@ -1302,3 +1329,140 @@ void UtGunnsFluidDistributedIf::testForceModes()
 
     std::cout << "... Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Test for the incoming data predictor and the Supply side mass corrector.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIf::testPredictor()
+{
+    std::cout << "\n UtGunnsFluidDistributedIf 15: testPredictor ........................";
+
+    /// @test Predictor hold, linear and quadratic extrapolation, and interpolation.
+    GunnsFluidDistributedIfPredictor predictor;
+    CPPUNIT_ASSERT(true == predictor.isEmpty());
+    CPPUNIT_ASSERT(0.0  == predictor.predict(5));
+    predictor.initialize(5);
+    predictor.addSample(10, 100.0);
+    CPPUNIT_ASSERT(false == predictor.isEmpty());
+    CPPUNIT_ASSERT(10    == predictor.getNewestFrame());
+    CPPUNIT_ASSERT(100.0 == predictor.predict(14));
+    predictor.addSample(12, 104.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(110.0, predictor.predict(15), DBL_EPSILON * 110.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(102.0, predictor.predict(11), DBL_EPSILON * 110.0);
+    predictor.reset();
+    for (unsigned int frame = 1; frame <= 4; ++frame) {
+        predictor.addSample(frame, static_cast<double>(frame * frame));
+    }
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(36.0, predictor.predict(6), 36.0 * DBL_EPSILON * 10.0);
+    predictor.initialize(0);
+    predictor.addSample(1, 1.0);
+    predictor.addSample(2, 2.0);
+    CPPUNIT_ASSERT(2.0 == predictor.predict(4));
+
+    /// - Supply side, with Demand flow on a ramp and 4 frames of loop latency, so the predictions
+    ///   run 2 frames ahead.
+    tConfigData->mPredictorOrder  = 1;
+    tConfigData->mCorrectorFrames = 2;
+    tInputData->mForceSupplyMode  = true;
+    tArticle->initialize(*tConfigData, *tInputData, tLinks, tPort0);
+    tArticle->mPredictorTimeStep          = tTimeStep;
+    tArticle->mLoopLatency                = 4;
+    tArticle->mInData.mDemandMode         = true;
+    tArticle->mInData.mCapacitance        = 1.0;
+    tArticle->mInData.mEnergy             = 3.0e5;
+    tArticle->mInData.mMoleFractions[0]   = 0.7;
+    tArticle->mInData.mMoleFractions[1]   = 0.3;
+    double appliedSum = 0.0;
+    double owedSum    = 0.0;
+    unsigned int frame = 0;
+    for (int i = 0; i < 20; ++i) {
+        frame = i + 1;
+        tArticle->mInData.mFrameCount    = frame;
+        tArticle->mInData.mFrameLoopback = tArticle->mOutData.mFrameCount - 3;
+        tArticle->mInData.mSource        = 1.0 + 0.1 * frame;
+        owedSum += tArticle->mInData.mSource;
+        tArticle->processInputs();
+        CPPUNIT_ASSERT(4 == tArticle->mLoopLatency);
+        appliedSum -= tArticle->mDemandFlux * 1000.0;
+    }
+
+    /// @test Everything applied is accounted for as owed, pending or unreconciled.
+    CPPUNIT_ASSERT(false == tArticle->mOutData.mDemandMode);
+    CPPUNIT_ASSERT(2     == tArticle->mPredictorNumPending);
+    double pendingSum = tArticle->mPredictorPendingFlows[0] + tArticle->mPredictorPendingFlows[1];
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(owedSum + pendingSum, appliedSum + tArticle->mPredictorDebt, 1.0e-12);
+
+    /// @test The ramp is predicted 2 frames ahead and the start-up error is made up.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0 + 0.1 * (frame + 2), -tArticle->mDemandFlux * 1000.0, 1.0e-4);
+    CPPUNIT_ASSERT(fabs(tArticle->mPredictorDebt) < 1.0e-4);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(tArticle->mPredictorDebt * tTimeStep,
+                                 tArticle->getConservationError(), DBL_EPSILON);
+
+    /// @test Data stalls for 3 frames then resumes with a gap, and the missed frames are owed.
+    for (int i = 0; i < 3; ++i) {
+        tArticle->mInData.mFrameLoopback = tArticle->mOutData.mFrameCount - 3;
+        tArticle->processInputs();
+        appliedSum -= tArticle->mDemandFlux * 1000.0;
+    }
+    CPPUNIT_ASSERT(5 == tArticle->mPredictorNumPending);
+    for (unsigned int missed = frame + 1; missed <= frame + 4; ++missed) {
+        owedSum += 1.0 + 0.1 * missed;
+    }
+    frame += 4;
+    tArticle->mInData.mFrameCount    = frame;
+    tArticle->mInData.mFrameLoopback = tArticle->mOutData.mFrameCount - 3;
+    tArticle->mInData.mSource        = 1.0 + 0.1 * frame;
+    tArticle->processInputs();
+    appliedSum -= tArticle->mDemandFlux * 1000.0;
+    pendingSum = 0.0;
+    for (unsigned int i = 0; i < tArticle->mPredictorNumPending; ++i) {
+        CPPUNIT_ASSERT(tArticle->mPredictorPendingFrames[i] > frame);
+        pendingSum += tArticle->mPredictorPendingFlows[i];
+    }
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(owedSum + pendingSum, appliedSum + tArticle->mPredictorDebt, 1.0e-12);
+
+    /// @test The other side restarting moves the unreconciled flow to the lost total.
+    const double debt = tArticle->mPredictorDebt;
+    tArticle->mInData.mFrameCount = 1;
+    tArticle->processInputs();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(debt, tArticle->mPredictorLost, DBL_EPSILON);
+    CPPUNIT_ASSERT(1 == tArticle->mSourcePredictor.getNewestFrame());
+
+    /// @test Restart resets the predictor.
+    tArticle->restart();
+    CPPUNIT_ASSERT(true == tArticle->mSourcePredictor.isEmpty());
+    CPPUNIT_ASSERT(0    == tArticle->mPredictorNumPending);
+    CPPUNIT_ASSERT(0.0  == tArticle->mPredictorDebt);
+
+    /// - Demand side, with the Supply pressure on a ramp and 4 frames of loop latency.
+    FriendlyGunnsFluidDistributedIf article;
+    tInputData->mForceSupplyMode = false;
+    tInputData->mForceDemandMode = true;
+    article.initialize(*tConfigData, *tInputData, tLinks, tPort0);
+    article.mInData.mDemandMode       = false;
+    article.mInData.mCapacitance      = 1.0;
+    article.mInData.mEnergy           = 3.0e5;
+    article.mInData.mMoleFractions[0] = 0.7;
+    article.mInData.mMoleFractions[1] = 0.3;
+    for (frame = 1; frame <= 3; ++frame) {
+        article.mInData.mFrameCount    = frame;
+        article.mInData.mFrameLoopback = article.mOutData.mFrameCount - 3;
+        article.mInData.mSource        = 1.0e5 + 100.0 * frame;
+        article.processInputs();
+    }
+
+    /// @test The Supply pressure is predicted 2 frames ahead.
+    CPPUNIT_ASSERT(true == article.mOutData.mDemandMode);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(100.5, article.mSourcePressure, 1.0e-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(100.5, tNodes[0].getContent()->getPressure(), 1.0e-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(3.0e5, tNodes[0].getContent()->getSpecificEnthalpy(), FLT_EPSILON);
+
+    /// @test A non-positive prediction falls back to the incoming pressure.
+    article.mInData.mFrameCount = frame;
+    article.mInData.mSource     = 1.0e3;
+    article.processInputs();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, article.mSourcePressure, DBL_EPSILON);
+    CPPUNIT_ASSERT(0.0 == article.getConservationError());
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,366 @@
+/*
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+*/
+
+#include "UtGunnsFluidDistributedIfSerializer.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+#include <cstring>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsFluidDistributedIfSerializer class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidDistributedIfSerializer::UtGunnsFluidDistributedIfSerializer()
+    :
+    tOut(),
+    tIn(),
+    tSender(),
+    tReceiver(),
+    tBuffer()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsFluidDistributedIfSerializer class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidDistributedIfSerializer::~UtGunnsFluidDistributedIfSerializer()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSerializer::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tReceiver;
+    delete tSender;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSerializer::setUp()
+{
+    tOut.initialize("tOut", 3, 10, false, 0, 0);
+    tIn .initialize("tIn",  3, 10, false, 0, 0);
+    tOut.mFrameCount    = 100;
+    tOut.mFrameLoopback = 98;
+    tOut.mDemandMode    = true;
+    tOut.mCapacitance   = 0.012;
+    tOut.mSource        = 101325.0;
+    tOut.mEnergy        = 294.261;
+    tOut.mMoleFractions[0] = 0.78;
+    tOut.mMoleFractions[1] = 0.21;
+    tOut.mMoleFractions[2] = 0.0099;
+    for (unsigned int i = 0; i < 10; ++i) {
+        tOut.mTcMoleFractions[i] = 1.0e-8 * (i + 1);
+    }
+
+    tSender   = new FriendlyGunnsFluidDistributedIfSerializer;
+    tReceiver = new FriendlyGunnsFluidDistributedIfSerializer;
+    memset(tBuffer, 0, sizeof(tBuffer));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSerializer::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsFluidDistributedIfSerializer 01: testDefaultConstruction ....";
+
+    CPPUNIT_ASSERT(""    == tSender->mName);
+    CPPUNIT_ASSERT(0     == tSender->mNumFluid);
+    CPPUNIT_ASSERT(0     == tSender->mNumTc);
+    CPPUNIT_ASSERT(0     == tSender->mKeyFrameInterval);
+    CPPUNIT_ASSERT(0     == tSender->mTxFramesSinceKey);
+    CPPUNIT_ASSERT(true  == tSender->mTxForceKey);
+    CPPUNIT_ASSERT(0     == tSender->mTxKeyFrame);
+    CPPUNIT_ASSERT(0     == tSender->mTxTc);
+    CPPUNIT_ASSERT(false == tSender->mRxHasKey);
+    CPPUNIT_ASSERT(0     == tSender->mRxKeyFrame);
+    CPPUNIT_ASSERT(0     == tSender->mRxTc);
+    CPPUNIT_ASSERT(0     == tSender->getMissedKeyFrames());
+    CPPUNIT_ASSERT(42    == tSender->getMaxSize());
+
+    /// @test New/delete for code coverage.
+    GunnsFluidDistributedIfSerializer* article = new GunnsFluidDistributedIfSerializer();
+    delete article;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests initialization and its errors.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSerializer::testInitialization()
+{
+    std::cout << "\n UtGunnsFluidDistributedIfSerializer 02: testInitialization .........";
+
+    CPPUNIT_ASSERT_NO_THROW(tSender->initialize("tSender", tOut, 4));
+    CPPUNIT_ASSERT("tSender" == tSender->mName);
+    CPPUNIT_ASSERT(3         == tSender->mNumFluid);
+    CPPUNIT_ASSERT(10        == tSender->mNumTc);
+    CPPUNIT_ASSERT(4         == tSender->mKeyFrameInterval);
+    CPPUNIT_ASSERT(true      == tSender->mTxForceKey);
+    CPPUNIT_ASSERT(0         != tSender->mTxTc);
+    CPPUNIT_ASSERT(0         != tSender->mRxTc);
+    CPPUNIT_ASSERT(2         == tSender->maskSize());
+    CPPUNIT_ASSERT(42 + 12 + 2 + 40 == tSender->getMaxSize());
+
+    /// @test Errors.
+    CPPUNIT_ASSERT_THROW(tSender->initialize("tSender", tOut, 0), TsInitializationException);
+    GunnsFluidDistributedIfData big;
+    big.initialize("big", 256, 0, false, 0, 0);
+    CPPUNIT_ASSERT_THROW(tSender->initialize("tSender", big), TsInitializationException);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests packing and unpacking all the data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSerializer::testRoundTrip()
+{
+    std::cout << "\n UtGunnsFluidDistributedIfSerializer 03: testRoundTrip ..............";
+
+    tSender  ->initialize("tSender",   tOut);
+    tReceiver->initialize("tReceiver", tIn);
+
+    /// @test The first message is a key frame with everything.
+    const unsigned int size = tSender->pack(tBuffer, tOut);
+    CPPUNIT_ASSERT(tSender->getMaxSize() - 2 == size);
+    unsigned int frameCount = 0;
+    CPPUNIT_ASSERT(true == tReceiver->peek(tBuffer, size, frameCount));
+    CPPUNIT_ASSERT(100  == frameCount);
+    CPPUNIT_ASSERT(true == tReceiver->unpack(tIn, tBuffer, size));
+    CPPUNIT_ASSERT(100      == tIn.mFrameCount);
+    CPPUNIT_ASSERT(98       == tIn.mFrameLoopback);
+    CPPUNIT_ASSERT(true     == tIn.mDemandMode);
+    CPPUNIT_ASSERT(0.012    == tIn.mCapacitance);
+    CPPUNIT_ASSERT(101325.0 == tIn.mSource);
+    CPPUNIT_ASSERT(294.261  == tIn.mEnergy);
+
+    /// @test Bulk fractions are within the 32-bit quantization step.
+    for (unsigned int i = 0; i < 3; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(tOut.mMoleFractions[i], tIn.mMoleFractions[i], 1.2e-10);
+    }
+
+    /// @test Trace compounds are within float precision.
+    for (unsigned int i = 0; i < 10; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(tOut.mTcMoleFractions[i], tIn.mTcMoleFractions[i],
+                                     tOut.mTcMoleFractions[i] * 1.0e-7);
+    }
+    CPPUNIT_ASSERT(true == tReceiver->mRxHasKey);
+    CPPUNIT_ASSERT(100  == tReceiver->mRxKeyFrame);
+
+    /// @test Quantization limits.
+    CPPUNIT_ASSERT(0          == GunnsFluidDistributedIfSerializer::quantize(-0.1));
+    CPPUNIT_ASSERT(0          == GunnsFluidDistributedIfSerializer::quantize(0.0));
+    CPPUNIT_ASSERT(0xFFFFFFFF == GunnsFluidDistributedIfSerializer::quantize(1.0));
+    CPPUNIT_ASSERT(0xFFFFFFFF == GunnsFluidDistributedIfSerializer::quantize(1.5));
+    CPPUNIT_ASSERT(1.0        == GunnsFluidDistributedIfSerializer::dequantize(0xFFFFFFFF));
+    CPPUNIT_ASSERT(0.0        == GunnsFluidDistributedIfSerializer::dequantize(0));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the packed little-endian byte layout.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSerializer::testByteLayout()
+{
+    std::cout << "\n UtGunnsFluidDistributedIfSerializer 04: testByteLayout .............";
+
+    tSender->initialize("tSender", tOut);
+    tOut.mFrameCount    = 0x01020304;
+    tOut.mFrameLoopback = 0x0A0B0C0D;
+    tOut.mCapacitance   = 1.0;
+    tOut.mMoleFractions[0] = 1.0;
+    tOut.mMoleFractions[1] = 0.5;
+    tOut.mTcMoleFractions[0] = 1.0;
+    tSender->pack(tBuffer, tOut);
+
+    CPPUNIT_ASSERT('G'  == tBuffer[0]);
+    CPPUNIT_ASSERT('F'  == tBuffer[1]);
+    CPPUNIT_ASSERT(1    == tBuffer[2]);
+    CPPUNIT_ASSERT(0x03 == tBuffer[3]);
+    CPPUNIT_ASSERT(3    == tBuffer[4]);
+    CPPUNIT_ASSERT(10   == tBuffer[5]);
+    CPPUNIT_ASSERT(0x04 == tBuffer[6]);
+    CPPUNIT_ASSERT(0x03 == tBuffer[7]);
+    CPPUNIT_ASSERT(0x02 == tBuffer[8]);
+    CPPUNIT_ASSERT(0x01 == tBuffer[9]);
+    CPPUNIT_ASSERT(0x0D == tBuffer[10]);
+    CPPUNIT_ASSERT(0x0A == tBuffer[13]);
+    CPPUNIT_ASSERT(0x04 == tBuffer[14]);
+
+    /// @test 1.0 is 0x3FF0000000000000 as a double, 0x3F800000 as a float.
+    for (unsigned int i = 18; i < 24; ++i) {
+        CPPUNIT_ASSERT(0x00 == tBuffer[i]);
+    }
+    CPPUNIT_ASSERT(0xF0 == tBuffer[24]);
+    CPPUNIT_ASSERT(0x3F == tBuffer[25]);
+    CPPUNIT_ASSERT(0xFF == tBuffer[42]);
+    CPPUNIT_ASSERT(0xFF == tBuffer[45]);
+    CPPUNIT_ASSERT(0x00 == tBuffer[46]);
+    CPPUNIT_ASSERT(0x80 == tBuffer[49]);
+    CPPUNIT_ASSERT(0x00 == tBuffer[55]);
+    CPPUNIT_ASSERT(0x80 == tBuffer[56]);
+    CPPUNIT_ASSERT(0x3F == tBuffer[57]);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that only changed trace compounds are sent between key frames.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSerializer::testTraceCompoundDeltas()
+{
+    std::cout << "\n UtGunnsFluidDistributedIfSerializer 05: testTraceCompoundDeltas ....";
+
+    tSender  ->initialize("tSender",   tOut, 3);
+    tReceiver->initialize("tReceiver", tIn);
+    unsigned int size = tSender->pack(tBuffer, tOut);
+    CPPUNIT_ASSERT(tReceiver->unpack(tIn, tBuffer, size));
+
+    /// @test Nothing changed: just the mask.
+    tOut.mFrameCount = 101;
+    size = tSender->pack(tBuffer, tOut);
+    CPPUNIT_ASSERT(42 + 12 + 2 == size);
+    CPPUNIT_ASSERT(0x01 == tBuffer[3]);
+    CPPUNIT_ASSERT(tReceiver->unpack(tIn, tBuffer, size));
+    CPPUNIT_ASSERT(101 == tIn.mFrameCount);
+
+    /// @test Two changed: mask and two values.
+    tOut.mFrameCount = 102;
+    tOut.mTcMoleFractions[2] = 5.0e-6;
+    tOut.mTcMoleFractions[9] = 6.0e-6;
+    size = tSender->pack(tBuffer, tOut);
+    CPPUNIT_ASSERT(42 + 12 + 2 + 8 == size);
+    CPPUNIT_ASSERT(0x04 == tBuffer[54]);
+    CPPUNIT_ASSERT(0x02 == tBuffer[55]);
+    CPPUNIT_ASSERT(tReceiver->unpack(tIn, tBuffer, size));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(5.0e-6, tIn.mTcMoleFractions[2], 1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(6.0e-6, tIn.mTcMoleFractions[9], 1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0e-8, tIn.mTcMoleFractions[1], 1.0e-14);
+    CPPUNIT_ASSERT(0 == tReceiver->getMissedKeyFrames());
+
+    /// @test Fourth message is the next key frame.
+    tOut.mFrameCount = 103;
+    size = tSender->pack(tBuffer, tOut);
+    CPPUNIT_ASSERT(42 + 12 + 40 == size);
+    CPPUNIT_ASSERT(0x03 == tBuffer[3]);
+    CPPUNIT_ASSERT(103  == tSender->mTxKeyFrame);
+
+    /// @test A receiver that missed that key frame still applies the values it gets, and counts it.
+    tOut.mFrameCount = 104;
+    tOut.mTcMoleFractions[0] = 7.0e-6;
+    size = tSender->pack(tBuffer, tOut);
+    CPPUNIT_ASSERT(42 + 12 + 2 + 4 == size);
+    CPPUNIT_ASSERT(tReceiver->unpack(tIn, tBuffer, size));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(7.0e-6, tIn.mTcMoleFractions[0], 1.0e-12);
+    CPPUNIT_ASSERT(1 == tReceiver->getMissedKeyFrames());
+
+    /// @test Forcing a key frame.
+    tSender->forceKeyFrame();
+    size = tSender->pack(tBuffer, tOut);
+    CPPUNIT_ASSERT(42 + 12 + 40 == size);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that invalid messages are rejected without changing the data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSerializer::testInvalidMessages()
+{
+    std::cout << "\n UtGunnsFluidDistributedIfSerializer 06: testInvalidMessages ........";
+
+    tSender  ->initialize("tSender",   tOut);
+    tReceiver->initialize("tReceiver", tIn);
+    const unsigned int size = tSender->pack(tBuffer, tOut);
+    unsigned int frameCount = 0;
+
+    /// @test Short, long, or truncated in the mask.
+    CPPUNIT_ASSERT(false == tReceiver->unpack(tIn, tBuffer, 10));
+    CPPUNIT_ASSERT(false == tReceiver->unpack(tIn, tBuffer, size - 1));
+    CPPUNIT_ASSERT(false == tReceiver->unpack(tIn, tBuffer, size + 1));
+    tBuffer[3] = 0;
+    CPPUNIT_ASSERT(false == tReceiver->peek(tBuffer, 42 + 12 + 1, frameCount));
+    tBuffer[3] = 0x03;
+
+    /// @test Wrong magic, version or mixture sizes.
+    tBuffer[0] = 'X';
+    CPPUNIT_ASSERT(false == tReceiver->unpack(tIn, tBuffer, size));
+    tBuffer[0] = 'G';
+    tBuffer[2] = 2;
+    CPPUNIT_ASSERT(false == tReceiver->unpack(tIn, tBuffer, size));
+    tBuffer[2] = 1;
+    tBuffer[4] = 4;
+    CPPUNIT_ASSERT(false == tReceiver->unpack(tIn, tBuffer, size));
+    tBuffer[4] = 3;
+    tBuffer[5] = 9;
+    CPPUNIT_ASSERT(false == tReceiver->unpack(tIn, tBuffer, size));
+    tBuffer[5] = 10;
+    CPPUNIT_ASSERT(0 == tIn.mFrameCount);
+    CPPUNIT_ASSERT(0.0 == tIn.mMoleFractions[0]);
+
+    /// @test Restored message is valid again.
+    CPPUNIT_ASSERT(true == tReceiver->unpack(tIn, tBuffer, size));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that a trace compound that changes and then returns to its key frame value is
+///           restored from the receiver's copy of the key frame, since it is no longer sent.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSerializer::testTraceCompoundRevert()
+{
+    std::cout << "\n UtGunnsFluidDistributedIfSerializer 07: testTraceCompoundRevert ....";
+
+    tSender  ->initialize("tSender",   tOut, 8);
+    tReceiver->initialize("tReceiver", tIn);
+    unsigned int size = tSender->pack(tBuffer, tOut);
+    CPPUNIT_ASSERT(tReceiver->unpack(tIn, tBuffer, size));
+    CPPUNIT_ASSERT(static_cast<float>(3.0e-8) == tReceiver->mRxTc[2]);
+
+    /// @test Changed from the key frame: sent and applied.
+    tOut.mFrameCount = 101;
+    tOut.mTcMoleFractions[2] = 5.0e-6;
+    size = tSender->pack(tBuffer, tOut);
+    CPPUNIT_ASSERT(42 + 12 + 2 + 4 == size);
+    CPPUNIT_ASSERT(tReceiver->unpack(tIn, tBuffer, size));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(5.0e-6, tIn.mTcMoleFractions[2], 1.0e-12);
+
+    /// @test Reverted to the key frame value: not sent, and restored from the key frame copy.
+    tOut.mFrameCount = 102;
+    tOut.mTcMoleFractions[2] = 3.0e-8;
+    size = tSender->pack(tBuffer, tOut);
+    CPPUNIT_ASSERT(42 + 12 + 2 == size);
+    CPPUNIT_ASSERT(tReceiver->unpack(tIn, tBuffer, size));
+    for (unsigned int i = 0; i < 10; ++i) {
+        CPPUNIT_ASSERT(static_cast<float>(tOut.mTcMoleFractions[i]) == static_cast<float>(tIn.mTcMoleFractions[i]));
+    }
+    CPPUNIT_ASSERT(0 == tReceiver->getMissedKeyFrames());
+
+    /// @test A receiver that missed the key frame doesn't restore from an older key frame copy.
+    tSender->forceKeyFrame();
+    tOut.mFrameCount = 103;
+    tOut.mTcMoleFractions[4] = 8.0e-6;
+    tSender->pack(tBuffer, tOut);
+    tOut.mFrameCount = 104;
+    tIn.mTcMoleFractions[4] = 9.0e-6;
+    size = tSender->pack(tBuffer, tOut);
+    CPPUNIT_ASSERT(42 + 12 + 2 == size);
+    CPPUNIT_ASSERT(tReceiver->unpack(tIn, tBuffer, size));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(9.0e-6, tIn.mTcMoleFractions[4], 1.0e-12);
+    CPPUNIT_ASSERT(1 == tReceiver->getMissedKeyFrames());
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,87 @@
+#ifndef UtGunnsFluidDistributedIfSerializer_EXISTS
+#define UtGunnsFluidDistributedIfSerializer_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_FLUID_DISTRIBUTED_IF_SERIALIZER    Gunns Fluid Distributed Interface Serializer Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Gunns Fluid Distributed Interface Serializer
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <iostream>
+
+#include "core/GunnsFluidDistributedIf.hh"
+#include "core/GunnsFluidDistributedIfSerializer.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsFluidDistributedIfSerializer and befriend
+///           UtGunnsFluidDistributedIfSerializer.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsFluidDistributedIfSerializer : public GunnsFluidDistributedIfSerializer
+{
+    public:
+        FriendlyGunnsFluidDistributedIfSerializer();
+        virtual ~FriendlyGunnsFluidDistributedIfSerializer();
+        friend class UtGunnsFluidDistributedIfSerializer;
+};
+inline FriendlyGunnsFluidDistributedIfSerializer::FriendlyGunnsFluidDistributedIfSerializer()
+    : GunnsFluidDistributedIfSerializer() {};
+inline FriendlyGunnsFluidDistributedIfSerializer::~FriendlyGunnsFluidDistributedIfSerializer() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Fluid Distributed Interface Serializer unit tests.
+////
+/// @details  This class provides the unit tests for the GunnsFluidDistributedIfSerializer class
+///           within the CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsFluidDistributedIfSerializer: public CppUnit::TestFixture
+{
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsFluidDistributedIfSerializer(const UtGunnsFluidDistributedIfSerializer& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsFluidDistributedIfSerializer& operator =(const UtGunnsFluidDistributedIfSerializer& that);
+
+        CPPUNIT_TEST_SUITE(UtGunnsFluidDistributedIfSerializer);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitialization);
+        CPPUNIT_TEST(testRoundTrip);
+        CPPUNIT_TEST(testByteLayout);
+        CPPUNIT_TEST(testTraceCompoundDeltas);
+        CPPUNIT_TEST(testInvalidMessages);
+        CPPUNIT_TEST(testTraceCompoundRevert);
+        CPPUNIT_TEST_SUITE_END();
+
+        GunnsFluidDistributedIfData                tOut;      /**< (--) Outgoing data */
+        GunnsFluidDistributedIfData                tIn;       /**< (--) Incoming data */
+        FriendlyGunnsFluidDistributedIfSerializer* tSender;   /**< (--) Sending article under test */
+        FriendlyGunnsFluidDistributedIfSerializer* tReceiver; /**< (--) Receiving article under test */
+        unsigned char                              tBuffer[512]; /**< (--) Message buffer */
+
+    public:
+        UtGunnsFluidDistributedIfSerializer();
+        virtual ~UtGunnsFluidDistributedIfSerializer();
+        void tearDown();
+        void setUp();
+        void testDefaultConstruction();
+        void testInitialization();
+        void testRoundTrip();
+        void testByteLayout();
+        void testTraceCompoundDeltas();
+        void testInvalidMessages();
+        void testTraceCompoundRevert();
+};
+
+///@}
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef UtGunnsFluidDistributedIfShm_EXISTS
+#define UtGunnsFluidDistributedIfShm_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_FLUID_DISTRIBUTED_IF_SHM    Gunns Fluid Distributed Interface Shared Memory Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Gunns Fluid Distributed Interface Shared Memory Transport
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <iostream>
+
+#include "core/GunnsFluidDistributedIf.hh"
+#include "core/GunnsFluidDistributedIfShm.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsFluidDistributedIfShm and befriend UtGunnsFluidDistributedIfShm.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsFluidDistributedIfShm : public GunnsFluidDistributedIfShm
+{
+    public:
+        FriendlyGunnsFluidDistributedIfShm();
+        virtual ~FriendlyGunnsFluidDistributedIfShm();
+        friend class UtGunnsFluidDistributedIfShm;
+};
+inline FriendlyGunnsFluidDistributedIfShm::FriendlyGunnsFluidDistributedIfShm()
+    : GunnsFluidDistributedIfShm() {};
+inline FriendlyGunnsFluidDistributedIfShm::~FriendlyGunnsFluidDistributedIfShm() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Fluid Distributed Interface Shared Memory Transport unit tests.
+////
+/// @details  This class provides the unit tests for the GunnsFluidDistributedIfShm class within the
+///           CPPUnit framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsFluidDistributedIfShm: public CppUnit::TestFixture
+{
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsFluidDistributedIfShm(const UtGunnsFluidDistributedIfShm& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsFluidDistributedIfShm& operator =(const UtGunnsFluidDistributedIfShm& that);
+
+        CPPUNIT_TEST_SUITE(UtGunnsFluidDistributedIfShm);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testNominalInitialization);
+        CPPUNIT_TEST(testInitializationExceptions);
+        CPPUNIT_TEST(testReadWrite);
+        CPPUNIT_TEST(testTornRead);
+        CPPUNIT_TEST(testTwoProcesses);
+        CPPUNIT_TEST_SUITE_END();
+
+        std::string                         tName;        /**< (--) Nominal instance name */
+        std::string                         tSegmentName; /**< (--) Nominal segment name */
+        GunnsFluidDistributedIfData         tMasterOut;   /**< (--) Master side outgoing data */
+        GunnsFluidDistributedIfData         tMasterIn;    /**< (--) Master side incoming data */
+        GunnsFluidDistributedIfData         tSlaveOut;    /**< (--) Slave side outgoing data */
+        GunnsFluidDistributedIfData         tSlaveIn;     /**< (--) Slave side incoming data */
+        FriendlyGunnsFluidDistributedIfShm* tMaster;      /**< (--) Master side article under test */
+        FriendlyGunnsFluidDistributedIfShm* tSlave;       /**< (--) Slave side article under test */
+
+    public:
+        UtGunnsFluidDistributedIfShm();
+        virtual ~UtGunnsFluidDistributedIfShm();
+        void tearDown();
+        void setUp();
+        void testDefaultConstruction();
+        void testNominalInitialization();
+        void testInitializationExceptions();
+        void testReadWrite();
+        void testTornRead();
+        void testTwoProcesses();
+};
+
+///@}
+
+#endif
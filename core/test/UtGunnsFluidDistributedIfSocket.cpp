@@ -0,0 +1,392 @@
+/*
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+*/
+
+#include "UtGunnsFluidDistributedIfSocket.hh"
+#include "core/Gunns.hh"
+#include "core/GunnsFluidCapacitor.hh"
+#include "software/exceptions/TsInitializationException.hh"
+
+#include <ctime>
+#include <unistd.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    One side of the link pair test: a network with a single node, its capacitor and the
+///           distributed interface link, talking to the other side through a socket transport.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class SocketTestSide
+{
+    public:
+        DefinedFluidProperties        mFluidProperties;
+        PolyFluidConfigData*          mFluidConfig;
+        GunnsFluidNode                mNodes[2];
+        GunnsNodeList                 mNodeList;
+        std::vector<GunnsBasicLink*>  mLinks;
+        Gunns                         mNetwork;
+        GunnsFluidCapacitor           mCapacitor;
+        GunnsFluidDistributedIf       mLink;
+        GunnsFluidDistributedIfSocket mTransport;
+        SocketTestSide() : mFluidProperties(), mFluidConfig(0), mNodes(), mNodeList(), mLinks(),
+                           mNetwork(), mCapacitor(), mLink(), mTransport() {}
+        ~SocketTestSide() {delete mFluidConfig;}
+        void initialize(const bool isMaster, const double pressure, const unsigned int remotePort);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  isMaster    (--)   This is the master side of the pair.
+/// @param[in]  pressure    (kPa)  Initial node pressure.
+/// @param[in]  remotePort  (--)   Master's UDP port for the slave, or 0 for the master.
+///
+/// @details  Builds and initializes the network and opens the UDP transport.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void SocketTestSide::initialize(const bool isMaster, const double pressure,
+                                const unsigned int remotePort)
+{
+    const std::string name = isMaster ? "Master" : "Slave";
+    FluidProperties::FluidType types[2] = {FluidProperties::GUNNS_N2, FluidProperties::GUNNS_O2};
+    mFluidConfig = new PolyFluidConfigData(&mFluidProperties, types, 2);
+    double fractions[2] = {0.79, 0.21};
+    PolyFluidInputData fluidInput(294.261, pressure, 0.0, 0.0, fractions);
+    mNodes[0].initialize(name + ".mNodes_0", mFluidConfig, &fluidInput);
+    mNodes[1].initialize(name + ".mNodes_1", mFluidConfig);
+    mNodeList.mNumNodes = 2;
+    mNodeList.mNodes    = mNodes;
+    mNetwork.initializeFluidNodes(mNodeList);
+
+    GunnsFluidCapacitorConfigData capConfig(name + ".mCapacitor", &mNodeList);
+    GunnsFluidCapacitorInputData  capInput(false, 0.0, 1.0, &fluidInput);
+    mCapacitor.initialize(capConfig, capInput, mLinks, 0, 1);
+
+    GunnsFluidDistributedIfConfigData ifConfig(name + ".mLink", &mNodeList, isMaster, false,
+                                               false, &mCapacitor);
+    GunnsFluidDistributedIfInputData  ifInput;
+    mLink.initialize(ifConfig, ifInput, mLinks, 0);
+
+    mTransport.initialize(name + ".mTransport", mLink.mOutData, GunnsFluidDistributedIfSocket::UDP,
+                          isMaster, 0, isMaster ? "" : "127.0.0.1", remotePort);
+    mLink.setTransport(&mTransport);
+
+    GunnsConfigData networkConfig(name + ".mNetwork", 1.0e-6, 1.0e-8, 10, 10);
+    mNetwork.initialize(networkConfig, mLinks);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsFluidDistributedIfSocket class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidDistributedIfSocket::UtGunnsFluidDistributedIfSocket()
+    :
+    tName(),
+    tMasterOut(),
+    tMasterIn(),
+    tSlaveOut(),
+    tSlaveIn(),
+    tMaster(),
+    tSlave()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsFluidDistributedIfSocket class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsFluidDistributedIfSocket::~UtGunnsFluidDistributedIfSocket()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSocket::tearDown()
+{
+    /// - Deletes for news in setUp
+    delete tSlave;
+    delete tMaster;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSocket::setUp()
+{
+    tName = "tArticle";
+    tMasterOut.initialize("tMasterOut", 2, 3, false, 0, 0);
+    tMasterIn .initialize("tMasterIn",  2, 3, false, 0, 0);
+    tSlaveOut .initialize("tSlaveOut",  2, 3, false, 0, 0);
+    tSlaveIn  .initialize("tSlaveIn",   2, 3, false, 0, 0);
+    tMasterOut.mMoleFractions[0] = 0.75;
+    tMasterOut.mMoleFractions[1] = 0.25;
+    tSlaveOut .mMoleFractions[0] = 0.5;
+    tSlaveOut .mMoleFractions[1] = 0.5;
+
+    tMaster = new FriendlyGunnsFluidDistributedIfSocket;
+    tSlave  = new FriendlyGunnsFluidDistributedIfSocket;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]  transport  (--)  The transport to wait on.
+///
+/// @returns  bool  (--)  True if a message is waiting, false if we timed out.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UtGunnsFluidDistributedIfSocket::waitForData(GunnsFluidDistributedIfTransport* transport)
+{
+    const time_t deadline = time(0) + 5;
+    while (not transport->isDataPending()) {
+        if (time(0) > deadline) {
+            return false;
+        }
+        usleep(10);
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests default construction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSocket::testDefaultConstruction()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsFluidDistributedIfSocket 01: testDefaultConstruction ........";
+
+    CPPUNIT_ASSERT(""    == tMaster->mName);
+    CPPUNIT_ASSERT(GunnsFluidDistributedIfSocket::UDP == tMaster->mProtocol);
+    CPPUNIT_ASSERT(false == tMaster->mIsPairMaster);
+    CPPUNIT_ASSERT(-1    == tMaster->mSocket);
+    CPPUNIT_ASSERT(-1    == tMaster->mListenSocket);
+    CPPUNIT_ASSERT(false == tMaster->mConnecting);
+    CPPUNIT_ASSERT(false == tMaster->mHasPeer);
+    CPPUNIT_ASSERT(false == tMaster->mLearnPeer);
+    CPPUNIT_ASSERT(0     == tMaster->getLocalPort());
+    CPPUNIT_ASSERT(false == tMaster->isConnected());
+    CPPUNIT_ASSERT(1.0   == tMaster->mStatsWindow);
+    CPPUNIT_ASSERT(0     == tMaster->getStats().mMessagesSent);
+    CPPUNIT_ASSERT(0.0   == tMaster->getStats().mRoundTripAvg);
+
+    /// @test An unopened transport drops what it's given and reads nothing.
+    tMaster->write(tMasterOut);
+    CPPUNIT_ASSERT(1     == tMaster->getStats().mSendDrops);
+    CPPUNIT_ASSERT(false == tMaster->isDataPending());
+    CPPUNIT_ASSERT(false == tMaster->read(tMasterIn));
+
+    /// @test New/delete for code coverage.
+    GunnsFluidDistributedIfSocket* article = new GunnsFluidDistributedIfSocket();
+    delete article;
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests initialization errors.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSocket::testInitializationExceptions()
+{
+    std::cout << "\n UtGunnsFluidDistributedIfSocket 02: testInitializationExceptions ...";
+
+    CPPUNIT_ASSERT_THROW(tMaster->initialize(tName, tMasterOut,
+                                             static_cast<GunnsFluidDistributedIfSocket::Protocols>(2),
+                                             true, 0), TsInitializationException);
+    CPPUNIT_ASSERT_THROW(tMaster->initialize(tName, tMasterOut, GunnsFluidDistributedIfSocket::UDP,
+                                             true, 65536), TsInitializationException);
+    CPPUNIT_ASSERT_THROW(tSlave->initialize(tName, tSlaveOut, GunnsFluidDistributedIfSocket::TCP,
+                                            false, 0), TsInitializationException);
+    CPPUNIT_ASSERT_THROW(tSlave->initialize(tName, tSlaveOut, GunnsFluidDistributedIfSocket::TCP,
+                                            false, 0, "127.0.0.1", 0), TsInitializationException);
+
+    /// @test Port already bound.
+    CPPUNIT_ASSERT_NO_THROW(tMaster->initialize(tName, tMasterOut,
+                                                GunnsFluidDistributedIfSocket::UDP, true, 0));
+    CPPUNIT_ASSERT(0 != tMaster->getLocalPort());
+    CPPUNIT_ASSERT_THROW(tSlave->initialize(tName, tSlaveOut, GunnsFluidDistributedIfSocket::UDP,
+                                            false, tMaster->getLocalPort()),
+                         TsInitializationException);
+    CPPUNIT_ASSERT(-1 == tSlave->mSocket);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests a UDP pair, including peer learning, sequencing and statistics.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSocket::testUdp()
+{
+    std::cout << "\n UtGunnsFluidDistributedIfSocket 03: testUdp ........................";
+
+    tMaster->initialize(tName, tMasterOut, GunnsFluidDistributedIfSocket::UDP, true, 0);
+    tSlave ->initialize(tName, tSlaveOut,  GunnsFluidDistributedIfSocket::UDP, false, 0,
+                        "127.0.0.1", tMaster->getLocalPort());
+    CPPUNIT_ASSERT(true  == tMaster->mLearnPeer);
+    CPPUNIT_ASSERT(false == tMaster->isConnected());
+    CPPUNIT_ASSERT(false == tSlave->mLearnPeer);
+    CPPUNIT_ASSERT(true  == tSlave->isConnected());
+
+    /// @test The master can't send until it hears from the slave.
+    tMaster->write(tMasterOut);
+    CPPUNIT_ASSERT(1 == tMaster->getStats().mSendDrops);
+
+    /// @test Slave to master.
+    tSlaveOut.mFrameCount  = 1;
+    tSlaveOut.mCapacitance = 2.5;
+    tSlaveOut.mTcMoleFractions[1] = 1.0e-6;
+    tSlave->write(tSlaveOut);
+    CPPUNIT_ASSERT(waitForData(tMaster));
+    CPPUNIT_ASSERT(true == tMaster->read(tMasterIn));
+    CPPUNIT_ASSERT(1    == tMasterIn.mFrameCount);
+    CPPUNIT_ASSERT(2.5  == tMasterIn.mCapacitance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5,    tMasterIn.mMoleFractions[1],   1.0e-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0e-6, tMasterIn.mTcMoleFractions[1], 1.0e-13);
+    CPPUNIT_ASSERT(true == tMaster->isConnected());
+    CPPUNIT_ASSERT(false == tMaster->read(tMasterIn));
+
+    /// @test Master replies to the learned peer, echoing the slave's frame, which gives the slave a
+    ///       round trip sample.
+    tMasterOut.mFrameCount    = 1;
+    tMasterOut.mFrameLoopback = 1;
+    tMaster->write(tMasterOut);
+    CPPUNIT_ASSERT(waitForData(tSlave));
+    CPPUNIT_ASSERT(true == tSlave->read(tSlaveIn));
+    CPPUNIT_ASSERT(1    == tSlaveIn.mFrameLoopback);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.75, tSlaveIn.mMoleFractions[0], 1.0e-9);
+    const GunnsFluidDistributedIfSocketStats& slaveStats = tSlave->getStats();
+    CPPUNIT_ASSERT(1    == slaveStats.mRoundTripSamples);
+    CPPUNIT_ASSERT(0.0  <= slaveStats.mRoundTripLast);
+    CPPUNIT_ASSERT(slaveStats.mRoundTripLast == slaveStats.mRoundTripMin);
+    CPPUNIT_ASSERT(slaveStats.mRoundTripLast == slaveStats.mRoundTripAvg);
+    CPPUNIT_ASSERT(0    == slaveStats.mLoopFrames);
+
+    /// @test Late and lost messages: 5 is taken, 3 is late, 7 is taken with 6 lost.
+    tSlaveOut.mFrameCount = 5;
+    tSlave->write(tSlaveOut);
+    tSlaveOut.mFrameCount = 3;
+    tSlave->write(tSlaveOut);
+    tSlaveOut.mFrameCount = 7;
+    tSlave->write(tSlaveOut);
+    const time_t deadline = time(0) + 5;
+    while (tMaster->getStats().mMessagesReceived < 3 and time(0) <= deadline) {
+        tMaster->read(tMasterIn);
+    }
+    const GunnsFluidDistributedIfSocketStats& masterStats = tMaster->getStats();
+    CPPUNIT_ASSERT(7 == tMasterIn.mFrameCount);
+    CPPUNIT_ASSERT(3 == masterStats.mMessagesReceived);
+    CPPUNIT_ASSERT(1 == masterStats.mMessagesLate);
+    CPPUNIT_ASSERT(4 == masterStats.mMessagesLost);
+    CPPUNIT_ASSERT(4 == tSlave->getStats().mMessagesSent);
+    CPPUNIT_ASSERT(tSlave->getStats().mBytesSent == masterStats.mBytesReceived);
+
+    /// @test A frame count of 0 is the other side restarting, and starts a new sequence.
+    tSlaveOut.mFrameCount = 0;
+    tSlave->write(tSlaveOut);
+    CPPUNIT_ASSERT(waitForData(tMaster));
+    CPPUNIT_ASSERT(true == tMaster->read(tMasterIn));
+    CPPUNIT_ASSERT(0    == tMasterIn.mFrameCount);
+
+    /// @test Bandwidth is updated at the end of the window.
+    tMaster->mStatsWindow = 0.0;
+    tMaster->write(tMasterOut);
+    CPPUNIT_ASSERT(0.0 < masterStats.mTxBandwidth);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests a TCP pair, including connection, framing and reconnection.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSocket::testTcp()
+{
+    std::cout << "\n UtGunnsFluidDistributedIfSocket 04: testTcp ........................";
+
+    tMaster->initialize(tName, tMasterOut, GunnsFluidDistributedIfSocket::TCP, true, 0);
+    CPPUNIT_ASSERT(0     <= tMaster->mListenSocket);
+    CPPUNIT_ASSERT(false == tMaster->isConnected());
+    tSlave->initialize(tName, tSlaveOut, GunnsFluidDistributedIfSocket::TCP, false, 0,
+                       "127.0.0.1", tMaster->getLocalPort());
+
+    /// @test Slave writes until the connection is up and the master has its message.
+    tSlaveOut.mFrameCount = 1;
+    tSlaveOut.mEnergy     = 300.0;
+    time_t deadline = time(0) + 5;
+    while (not tMaster->isDataPending() and time(0) <= deadline) {
+        tSlave->write(tSlaveOut);
+        usleep(100);
+    }
+    CPPUNIT_ASSERT(true  == tMaster->isConnected());
+    CPPUNIT_ASSERT(true  == tSlave->isConnected());
+    CPPUNIT_ASSERT(true  == tMaster->read(tMasterIn));
+    CPPUNIT_ASSERT(1     == tMasterIn.mFrameCount);
+    CPPUNIT_ASSERT(300.0 == tMasterIn.mEnergy);
+
+    /// @test Master to slave, several messages in one stream read, the last one wins.
+    for (unsigned int frame = 1; frame <= 3; ++frame) {
+        tMasterOut.mFrameCount = frame;
+        tMaster->write(tMasterOut);
+    }
+    deadline = time(0) + 5;
+    while (tSlave->getStats().mMessagesReceived < 3 and time(0) <= deadline) {
+        tSlave->read(tSlaveIn);
+    }
+    CPPUNIT_ASSERT(3 == tSlaveIn.mFrameCount);
+    CPPUNIT_ASSERT(0 == tSlave->getStats().mMessagesLost);
+    CPPUNIT_ASSERT(0 == tSlave->getStats().mMessagesInvalid);
+
+    /// @test A bad frame length drops the connection, and the slave reconnects.
+    tMaster->mRxQueue.push_back(1);
+    tMaster->mRxQueue.push_back(0);
+    tMaster->read(tMasterIn);
+    CPPUNIT_ASSERT(1     == tMaster->getStats().mMessagesInvalid);
+    CPPUNIT_ASSERT(false == tMaster->isConnected());
+    tSlaveOut.mFrameCount = 2;
+    deadline = time(0) + 5;
+    while (tMaster->getStats().mMessagesReceived < 2 and time(0) <= deadline) {
+        tSlave->write(tSlaveOut);
+        tMaster->read(tMasterIn);
+        usleep(100);
+    }
+    CPPUNIT_ASSERT(true == tMaster->isConnected());
+    CPPUNIT_ASSERT(2    == tMasterIn.mFrameCount);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests a pair of networks stepping in lockstep through UDP over localhost.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsFluidDistributedIfSocket::testLinkPair()
+{
+    std::cout << "\n UtGunnsFluidDistributedIfSocket 05: testLinkPair ...................";
+
+    SocketTestSide master;
+    SocketTestSide slave;
+    master.initialize(true, 100.0, 0);
+    slave .initialize(false, 105.0, master.mTransport.getLocalPort());
+
+    const int steps = 50;
+    for (int i = 0; i < steps; ++i) {
+        CPPUNIT_ASSERT(waitForData(&master.mTransport));
+        master.mNetwork.step(0.1);
+        CPPUNIT_ASSERT(waitForData(&slave.mTransport));
+        slave.mNetwork.step(0.1);
+    }
+
+    /// @test One frame loop latency, no losses, and round trips measured on both sides.
+    const GunnsFluidDistributedIfSocketStats& masterStats = master.mTransport.getStats();
+    const GunnsFluidDistributedIfSocketStats& slaveStats  = slave.mTransport.getStats();
+    CPPUNIT_ASSERT_EQUAL(1, master.mLink.getLoopLatency());
+    CPPUNIT_ASSERT_EQUAL(0, masterStats.mLoopFrames);
+    CPPUNIT_ASSERT(0 == masterStats.mMessagesLost + masterStats.mMessagesLate);
+    CPPUNIT_ASSERT(0 == slaveStats.mMessagesLost + slaveStats.mMessagesLate);
+    CPPUNIT_ASSERT(static_cast<unsigned long>(steps) == masterStats.mMessagesReceived);
+    CPPUNIT_ASSERT(static_cast<unsigned long>(steps) == slaveStats.mMessagesReceived);
+    CPPUNIT_ASSERT(0 < masterStats.mRoundTripSamples);
+    CPPUNIT_ASSERT(0 < slaveStats.mRoundTripSamples);
+    CPPUNIT_ASSERT(masterStats.mRoundTripMin <= masterStats.mRoundTripAvg);
+    CPPUNIT_ASSERT(masterStats.mRoundTripAvg <= masterStats.mRoundTripMax);
+
+    /// @test The pair settles into one Demand and one Supply side, with the Demand node following
+    ///       the Supply pressure.
+    CPPUNIT_ASSERT(master.mLink.mOutData.mDemandMode != slave.mLink.mOutData.mDemandMode);
+    SocketTestSide& demand = master.mLink.mOutData.mDemandMode ? master : slave;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(demand.mLink.mInData.mSource * 0.001,
+                                 demand.mNodes[0].getPotential(), 1.0e-3);
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,87 @@
+#ifndef UtGunnsFluidDistributedIfSocket_EXISTS
+#define UtGunnsFluidDistributedIfSocket_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_FLUID_DISTRIBUTED_IF_SOCKET    Gunns Fluid Distributed Interface Socket Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the Gunns Fluid Distributed Interface Socket Transport
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <iostream>
+
+#include "core/GunnsFluidDistributedIf.hh"
+#include "core/GunnsFluidDistributedIfSocket.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsFluidDistributedIfSocket and befriend
+///           UtGunnsFluidDistributedIfSocket.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsFluidDistributedIfSocket : public GunnsFluidDistributedIfSocket
+{
+    public:
+        FriendlyGunnsFluidDistributedIfSocket();
+        virtual ~FriendlyGunnsFluidDistributedIfSocket();
+        friend class UtGunnsFluidDistributedIfSocket;
+};
+inline FriendlyGunnsFluidDistributedIfSocket::FriendlyGunnsFluidDistributedIfSocket()
+    : GunnsFluidDistributedIfSocket() {};
+inline FriendlyGunnsFluidDistributedIfSocket::~FriendlyGunnsFluidDistributedIfSocket() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Gunns Fluid Distributed Interface Socket Transport unit tests.
+////
+/// @details  This class provides the unit tests for the GunnsFluidDistributedIfSocket class within
+///           the CPPUnit framework.  Both sides of each pair run in this process over localhost.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsFluidDistributedIfSocket: public CppUnit::TestFixture
+{
+    private:
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsFluidDistributedIfSocket(const UtGunnsFluidDistributedIfSocket& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsFluidDistributedIfSocket& operator =(const UtGunnsFluidDistributedIfSocket& that);
+
+        CPPUNIT_TEST_SUITE(UtGunnsFluidDistributedIfSocket);
+        CPPUNIT_TEST(testDefaultConstruction);
+        CPPUNIT_TEST(testInitializationExceptions);
+        CPPUNIT_TEST(testUdp);
+        CPPUNIT_TEST(testTcp);
+        CPPUNIT_TEST(testLinkPair);
+        CPPUNIT_TEST_SUITE_END();
+
+        std::string                            tName;      /**< (--) Nominal instance name */
+        GunnsFluidDistributedIfData            tMasterOut; /**< (--) Master side outgoing data */
+        GunnsFluidDistributedIfData            tMasterIn;  /**< (--) Master side incoming data */
+        GunnsFluidDistributedIfData            tSlaveOut;  /**< (--) Slave side outgoing data */
+        GunnsFluidDistributedIfData            tSlaveIn;   /**< (--) Slave side incoming data */
+        FriendlyGunnsFluidDistributedIfSocket* tMaster;    /**< (--) Master side article under test */
+        FriendlyGunnsFluidDistributedIfSocket* tSlave;     /**< (--) Slave side article under test */
+        /// @brief Spins until the given transport has a message waiting, or times out.
+        bool waitForData(GunnsFluidDistributedIfTransport* transport);
+
+    public:
+        UtGunnsFluidDistributedIfSocket();
+        virtual ~UtGunnsFluidDistributedIfSocket();
+        void tearDown();
+        void setUp();
+        void testDefaultConstruction();
+        void testInitializationExceptions();
+        void testUdp();
+        void testTcp();
+        void testLinkPair();
+};
+
+///@}
+
+#endif
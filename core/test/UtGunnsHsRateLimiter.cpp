@@ -0,0 +1,163 @@
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+
+#include "UtGunnsHsRateLimiter.hh"
+#include "core/GunnsMacros.hh"
+#include "simulation/hs/TsHsMngr.hh"
+#include <unistd.h>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    H&S manager that captures message texts, for the GUNNS_WARNING macro test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsHsRateLimiterMngr : public TsHsMngr
+{
+    public:
+        std::vector<std::string> mTexts; /**< (--) Captured message texts. */
+        UtGunnsHsRateLimiterMngr() : TsHsMngr(), mTexts() {}
+        virtual ~UtGunnsHsRateLimiterMngr() {}
+        virtual void restart() {}
+        virtual void update() {}
+        virtual void shutdown() {}
+        virtual void msg(const std::string&, const int, const std::string&, TS_HS_MSG_TYPE,
+                         const std::string&, const std::string& mtext) {mTexts.push_back(mtext);}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsHsRateLimiter class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsHsRateLimiter::UtGunnsHsRateLimiter()
+    :
+    tSavedLimit(0),
+    tSavedWindow(0.0),
+    mName("tArticle")
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsHsRateLimiter class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsHsRateLimiter::~UtGunnsHsRateLimiter()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsHsRateLimiter::tearDown()
+{
+    GunnsHsRateLimiter::setLimit(tSavedLimit, tSavedWindow);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsHsRateLimiter::setUp()
+{
+    tSavedLimit  = GunnsHsRateLimiter::getLimit();
+    tSavedWindow = GunnsHsRateLimiter::getWindow();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] i (--) Number to put in the message.
+///
+/// @details  Issues a GUNNS_WARNING, always from the same call site.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsHsRateLimiter::warn(const int i)
+{
+    GUNNS_WARNING("warning " << i);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the limit number of messages are allowed in a window, the rest are suppressed,
+///           and the suppressed count is returned with the first message of the next window.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsHsRateLimiter::testLimit()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsHsRateLimiter ... 01: testLimit ...................................";
+
+    GunnsHsRateLimiter::setLimit(3, 0.2);
+    CPPUNIT_ASSERT_EQUAL(3,   GunnsHsRateLimiter::getLimit());
+    CPPUNIT_ASSERT_EQUAL(0.2, GunnsHsRateLimiter::getWindow());
+    CPPUNIT_ASSERT(GunnsHsRateLimiter::getClockMs() > 0);
+
+    GunnsHsRateLimiter article = GUNNS_HS_RATE_LIMITER_INIT;
+    int    suppressed = -1;
+    double window     = -1.0;
+
+    /// - The first 3 messages in the window are allowed, with no summary.
+    for (int i = 0; i < 3; ++i) {
+        CPPUNIT_ASSERT(article.allow(suppressed, window));
+        CPPUNIT_ASSERT_EQUAL(0,   suppressed);
+        CPPUNIT_ASSERT_EQUAL(0.0, window);
+    }
+
+    /// - The rest in the window are suppressed and counted.
+    for (int i = 0; i < 5; ++i) {
+        CPPUNIT_ASSERT(not article.allow(suppressed, window));
+    }
+    CPPUNIT_ASSERT_EQUAL(5, static_cast<int>(article.mSuppressed));
+
+    /// - The first message in the next window carries the summary, and the count starts over.
+    usleep(250000);
+    CPPUNIT_ASSERT(article.allow(suppressed, window));
+    CPPUNIT_ASSERT_EQUAL(5, suppressed);
+    CPPUNIT_ASSERT(window >= 0.2 and window < 2.0);
+    CPPUNIT_ASSERT_EQUAL(0, static_cast<int>(article.mSuppressed));
+    CPPUNIT_ASSERT(article.allow(suppressed, window));
+    CPPUNIT_ASSERT_EQUAL(0, suppressed);
+    CPPUNIT_ASSERT(article.allow(suppressed, window));
+    CPPUNIT_ASSERT(not article.allow(suppressed, window));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests a zero limit allows all messages.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsHsRateLimiter::testNoLimit()
+{
+    std::cout << "\n UtGunnsHsRateLimiter ... 02: testNoLimit .................................";
+
+    GunnsHsRateLimiter::setLimit(0, 60.0);
+    GunnsHsRateLimiter article = GUNNS_HS_RATE_LIMITER_INIT;
+    int    suppressed = 0;
+    double window     = 0.0;
+    for (int i = 0; i < 100; ++i) {
+        CPPUNIT_ASSERT(article.allow(suppressed, window));
+    }
+    CPPUNIT_ASSERT_EQUAL(0, static_cast<int>(article.mSuppressed));
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests the GUNNS_WARNING macro only builds and sends the allowed messages, and appends
+///           the summary of suppressed messages.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsHsRateLimiter::testMacro()
+{
+    std::cout << "\n UtGunnsHsRateLimiter ... 03: testMacro ...................................";
+
+    UtGunnsHsRateLimiterMngr  mngr;
+    TsHsMngr*                 savedMngr = tsGlobalHsMngr;
+    tsGlobalHsMngr = &mngr;
+
+    GunnsHsRateLimiter::setLimit(2, 0.2);
+    for (int i = 0; i < 10; ++i) {
+        warn(i);
+    }
+    usleep(250000);
+    warn(10);
+    tsGlobalHsMngr = savedMngr;
+
+    CPPUNIT_ASSERT_EQUAL(3, static_cast<int>(mngr.mTexts.size()));
+    CPPUNIT_ASSERT(std::string::npos != mngr.mTexts[0].find("tArticle warning 0"));
+    CPPUNIT_ASSERT(std::string::npos != mngr.mTexts[1].find("tArticle warning 1"));
+    CPPUNIT_ASSERT(std::string::npos != mngr.mTexts[2].find("tArticle warning 10 (suppressed 8 repeats in "));
+
+    std::cout << "... Pass";
+}
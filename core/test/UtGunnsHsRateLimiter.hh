@@ -0,0 +1,67 @@
+#ifndef UtGunnsHsRateLimiter_EXISTS
+#define UtGunnsHsRateLimiter_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_HS_RATE_LIMITER    GUNNS H&S Rate Limiter Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the GUNNS H&S Rate Limiter
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <string>
+
+#include "core/GunnsHsRateLimiter.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS H&S Rate Limiter Unit Tests.
+///
+/// @details  This class provides the unit tests for the GunnsHsRateLimiter class within the CPPUnit
+///           framework.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsHsRateLimiter : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this GunnsHsRateLimiter unit test.
+        UtGunnsHsRateLimiter();
+        /// @brief    Default destructs this GunnsHsRateLimiter unit test.
+        virtual ~UtGunnsHsRateLimiter();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests messages over the limit are suppressed and summarized in the next window.
+        void testLimit();
+        /// @brief    Tests a zero limit disables rate limiting.
+        void testNoLimit();
+        /// @brief    Tests the rate limit of the GUNNS_WARNING macro call sites.
+        void testMacro();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsHsRateLimiter);
+        CPPUNIT_TEST(testLimit);
+        CPPUNIT_TEST(testNoLimit);
+        CPPUNIT_TEST(testMacro);
+        CPPUNIT_TEST_SUITE_END();
+
+        int         tSavedLimit;  /**< (--) Rate limit to restore after each test. */
+        double      tSavedWindow; /**< (s)  Rate limit window to restore after each test. */
+        std::string mName;        /**< (--) Name used by the GUNNS message macros. */
+
+        /// @brief    Issues a GUNNS_WARNING from a single call site.
+        void warn(const int i);
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsHsRateLimiter(const UtGunnsHsRateLimiter& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsHsRateLimiter& operator =(const UtGunnsHsRateLimiter& that);
+};
+
+///@}
+
+#endif
@@ -5,6 +5,7 @@
 
 #include "UtGunnsMinorStepLog.hh"
 #include "software/exceptions/TsInitializationException.hh"
+#include <cstring>
 #include <istream>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -229,16 +230,19 @@ void UtGunnsMinorStepLog::testInputData()
     std::cout << "\n UtGunnsMinorStepLog .... 03: testInputData .........................";
 
     /// @test nominal construction.
-    GunnsMinorStepLogInputData nominal(GunnsMinorStepLogInputData::SNAP, 10, "./RUN/");
-    CPPUNIT_ASSERT(GunnsMinorStepLogInputData::SNAP == nominal.mModeCommand);
-    CPPUNIT_ASSERT(10                               == nominal.mLogSteps);
-    CPPUNIT_ASSERT("./RUN/"                         == nominal.mPath);
+    GunnsMinorStepLogInputData nominal(GunnsMinorStepLogInputData::SNAP, 10, "./RUN/",
+                                       GunnsMinorStepLogInputData::BINARY);
+    CPPUNIT_ASSERT(GunnsMinorStepLogInputData::SNAP   == nominal.mModeCommand);
+    CPPUNIT_ASSERT(10                                 == nominal.mLogSteps);
+    CPPUNIT_ASSERT("./RUN/"                           == nominal.mPath);
+    CPPUNIT_ASSERT(GunnsMinorStepLogInputData::BINARY == nominal.mOutputFormat);
 
     /// @test default construction.
     GunnsMinorStepLogInputData def;
     CPPUNIT_ASSERT(GunnsMinorStepLogInputData::PAUSE == def.mModeCommand);
     CPPUNIT_ASSERT(0                                 == def.mLogSteps);
     CPPUNIT_ASSERT(""                                == def.mPath);
+    CPPUNIT_ASSERT(GunnsMinorStepLogInputData::CSV   == def.mOutputFormat);
 
     /// @test new/delete for code coverage
     GunnsMinorStepLogInputData* article = new GunnsMinorStepLogInputData;
@@ -260,7 +264,12 @@ void UtGunnsMinorStepLog::testDefaultConstruction()
     CPPUNIT_ASSERT(""                        == def.mName);
     CPPUNIT_ASSERT(GunnsMinorStepLog::PAUSED == def.mState);
     CPPUNIT_ASSERT(false                     == def.mIsRecording);
-    CPPUNIT_ASSERT(0                         == def.mBuffer.size());
+    CPPUNIT_ASSERT(0                         == def.mArena);
+    CPPUNIT_ASSERT(0                         == def.mNetworkSize);
+    CPPUNIT_ASSERT(0                         == def.mNumLinks);
+    CPPUNIT_ASSERT(0                         == def.mLinkPorts.size());
+    CPPUNIT_ASSERT(0                         == def.mIntsSize);
+    CPPUNIT_ASSERT(0                         == def.mFrameSize);
     CPPUNIT_ASSERT(0                         == def.mSize);
     CPPUNIT_ASSERT(0                         == def.mHeadIndex);
     CPPUNIT_ASSERT(0                         == def.mNumValidSteps);
@@ -289,9 +298,9 @@ void UtGunnsMinorStepLog::testInitialize()
     CPPUNIT_ASSERT(tName                     == tArticle->mName);
     CPPUNIT_ASSERT(GunnsMinorStepLog::PAUSED == tArticle->mState);
     CPPUNIT_ASSERT(true                      == tArticle->mIsRecording);
-    CPPUNIT_ASSERT(tLogSteps                 == tArticle->mBuffer.size());
-    CPPUNIT_ASSERT(tNetworkSize              == tArticle->mBuffer[0].mPotentialVector.size());
-    CPPUNIT_ASSERT(tNumLinks                 == tArticle->mBuffer[0].mLinksData.size());
+    CPPUNIT_ASSERT(tLogSteps                 == tArticle->mSize);
+    CPPUNIT_ASSERT(tNetworkSize              == tArticle->getFrame(0).mPotentialVector.size());
+    CPPUNIT_ASSERT(tNumLinks                 == tArticle->getFrame(0).mLinksData.size());
     CPPUNIT_ASSERT(tLogSteps                 == tArticle->mSize);
     CPPUNIT_ASSERT(tLogSteps - 1             == tArticle->mHeadIndex);
     CPPUNIT_ASSERT(0                         == tArticle->mNumValidSteps);
@@ -464,32 +473,32 @@ void UtGunnsMinorStepLog::testRecord()
     /// @test record functions don't record when recording isn't enabled.
     int index = tLogSteps - 1;
     CPPUNIT_ASSERT(index == tArticle->mHeadIndex);
-    double potentials[2] = {200.0, 300.0};
+    double potentials[5] = {200.0, 300.0, 0.0, 0.0, 0.0};
     tArticle->recordPotential(potentials);
-    CPPUNIT_ASSERT(0.0 == tArticle->mBuffer[index].mPotentialVector[0]);
-    CPPUNIT_ASSERT(0.0 == tArticle->mBuffer[index].mPotentialVector[1]);
+    CPPUNIT_ASSERT(0.0 == tArticle->getFrame(index).mPotentialVector[0]);
+    CPPUNIT_ASSERT(0.0 == tArticle->getFrame(index).mPotentialVector[1]);
 
-    double nodesConvergence[2] = {-1.0, 6.2};
+    double nodesConvergence[5] = {-1.0, 6.2, 0.0, 0.0, 0.0};
     tArticle->recordNodesConvergence(nodesConvergence);
-    CPPUNIT_ASSERT(0.0 == tArticle->mBuffer[index].mNodesConvergence[0]);
-    CPPUNIT_ASSERT(0.0 == tArticle->mBuffer[index].mNodesConvergence[1]);
+    CPPUNIT_ASSERT(0.0 == tArticle->getFrame(index).mNodesConvergence[0]);
+    CPPUNIT_ASSERT(0.0 == tArticle->getFrame(index).mNodesConvergence[1]);
 
     tArticle->recordLinkContributions();
-    CPPUNIT_ASSERT(0.0 == tArticle->mBuffer[index].mLinksData[0].mAdmittanceMatrix[0]);
-    CPPUNIT_ASSERT(0.0 == tArticle->mBuffer[index].mLinksData[0].mSourceVector[0]);
+    CPPUNIT_ASSERT(0.0 == tArticle->getFrame(index).mLinksData[0].mAdmittanceMatrix[0]);
+    CPPUNIT_ASSERT(0.0 == tArticle->getFrame(index).mLinksData[0].mSourceVector[0]);
 
     tArticle->recordLinkResult(0, GunnsBasicLink::DELAY);
-    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM == tArticle->mBuffer[index].mLinksData[0].mSolutionResult);
+    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM == tArticle->getFrame(index).mLinksData[0].mSolutionResult);
 
     tArticle->recordAllLinksResult(GunnsBasicLink::DELAY);
-    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM == tArticle->mBuffer[index].mLinksData[0].mSolutionResult);
+    CPPUNIT_ASSERT(GunnsBasicLink::CONFIRM == tArticle->getFrame(index).mLinksData[0].mSolutionResult);
 
     tArticle->recordStepResult(1, GunnsMinorStepData::MATH_FAIL);
     CPPUNIT_ASSERT(0                           == tArticle->mNumValidSteps);
-    CPPUNIT_ASSERT(0                           == tArticle->mBuffer[index].mMajorStep);
-    CPPUNIT_ASSERT(0                           == tArticle->mBuffer[index].mMinorStep);
-    CPPUNIT_ASSERT(0                           == tArticle->mBuffer[index].mDecomposition);
-    CPPUNIT_ASSERT(GunnsMinorStepData::SUCCESS == tArticle->mBuffer[index].mSolutionResult);
+    CPPUNIT_ASSERT(0                           == tArticle->getFrame(index).mMajorStep);
+    CPPUNIT_ASSERT(0                           == tArticle->getFrame(index).mMinorStep);
+    CPPUNIT_ASSERT(0                           == tArticle->getFrame(index).mDecomposition);
+    CPPUNIT_ASSERT(GunnsMinorStepData::SUCCESS == tArticle->getFrame(index).mSolutionResult);
 
     /// - Switch to a recording mode.
     tArticle->mInputData.mModeCommand = GunnsMinorStepLogInputData::RECORD_SNAP;
@@ -500,31 +509,31 @@ void UtGunnsMinorStepLog::testRecord()
     index = 0;
     CPPUNIT_ASSERT(index == tArticle->mHeadIndex);
     tArticle->recordPotential(potentials);
-    CPPUNIT_ASSERT(potentials[0] == tArticle->mBuffer[index].mPotentialVector[0]);
-    CPPUNIT_ASSERT(potentials[1] == tArticle->mBuffer[index].mPotentialVector[1]);
+    CPPUNIT_ASSERT(potentials[0] == tArticle->getFrame(index).mPotentialVector[0]);
+    CPPUNIT_ASSERT(potentials[1] == tArticle->getFrame(index).mPotentialVector[1]);
 
     tArticle->recordNodesConvergence(nodesConvergence);
-    CPPUNIT_ASSERT(nodesConvergence[0] == tArticle->mBuffer[index].mNodesConvergence[0]);
-    CPPUNIT_ASSERT(nodesConvergence[1] == tArticle->mBuffer[index].mNodesConvergence[1]);
+    CPPUNIT_ASSERT(nodesConvergence[0] == tArticle->getFrame(index).mNodesConvergence[0]);
+    CPPUNIT_ASSERT(nodesConvergence[1] == tArticle->getFrame(index).mNodesConvergence[1]);
 
     tArticle->recordLinkContributions();
-    CPPUNIT_ASSERT(admittance[0] == tArticle->mBuffer[index].mLinksData[0].mAdmittanceMatrix[0]);
-    CPPUNIT_ASSERT(source[0]     == tArticle->mBuffer[index].mLinksData[0].mSourceVector[0]);
+    CPPUNIT_ASSERT(admittance[0] == tArticle->getFrame(index).mLinksData[0].mAdmittanceMatrix[0]);
+    CPPUNIT_ASSERT(source[0]     == tArticle->getFrame(index).mLinksData[0].mSourceVector[0]);
 
     tArticle->recordLinkResult(0, GunnsBasicLink::DELAY);
-    CPPUNIT_ASSERT(GunnsBasicLink::DELAY == tArticle->mBuffer[index].mLinksData[0].mSolutionResult);
+    CPPUNIT_ASSERT(GunnsBasicLink::DELAY == tArticle->getFrame(index).mLinksData[0].mSolutionResult);
 
     tArticle->recordAllLinksResult(GunnsBasicLink::DELAY);
-    CPPUNIT_ASSERT(GunnsBasicLink::DELAY == tArticle->mBuffer[index].mLinksData[0].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsBasicLink::DELAY == tArticle->mBuffer[index].mLinksData[1].mSolutionResult);
-    CPPUNIT_ASSERT(GunnsBasicLink::DELAY == tArticle->mBuffer[index].mLinksData[2].mSolutionResult);
+    CPPUNIT_ASSERT(GunnsBasicLink::DELAY == tArticle->getFrame(index).mLinksData[0].mSolutionResult);
+    CPPUNIT_ASSERT(GunnsBasicLink::DELAY == tArticle->getFrame(index).mLinksData[1].mSolutionResult);
+    CPPUNIT_ASSERT(GunnsBasicLink::DELAY == tArticle->getFrame(index).mLinksData[2].mSolutionResult);
 
     tArticle->recordStepResult(1, GunnsMinorStepData::MATH_FAIL);
     CPPUNIT_ASSERT(1                             == tArticle->mNumValidSteps);
-    CPPUNIT_ASSERT(2                             == tArticle->mBuffer[index].mMajorStep);
-    CPPUNIT_ASSERT(1                             == tArticle->mBuffer[index].mMinorStep);
-    CPPUNIT_ASSERT(1                             == tArticle->mBuffer[index].mDecomposition);
-    CPPUNIT_ASSERT(GunnsMinorStepData::MATH_FAIL == tArticle->mBuffer[index].mSolutionResult);
+    CPPUNIT_ASSERT(2                             == tArticle->getFrame(index).mMajorStep);
+    CPPUNIT_ASSERT(1                             == tArticle->getFrame(index).mMinorStep);
+    CPPUNIT_ASSERT(1                             == tArticle->getFrame(index).mDecomposition);
+    CPPUNIT_ASSERT(GunnsMinorStepData::MATH_FAIL == tArticle->getFrame(index).mSolutionResult);
 
     /// - Remove our link memory hacks.
     tLink0.mAdmittanceMatrix = 0;
@@ -552,19 +561,19 @@ void UtGunnsMinorStepLog::testWraparound()
     tArticle->beginMajorStep();
     tArticle->beginMinorStep(1, 1);
     CPPUNIT_ASSERT(0 == tArticle->mHeadIndex);
-    CPPUNIT_ASSERT(1 == tArticle->mBuffer[0].mMinorStep);
+    CPPUNIT_ASSERT(1 == tArticle->getFrame(0).mMinorStep);
     tArticle->beginMinorStep(1, 2);
     CPPUNIT_ASSERT(1 == tArticle->mHeadIndex);
-    CPPUNIT_ASSERT(2 == tArticle->mBuffer[1].mMinorStep);
+    CPPUNIT_ASSERT(2 == tArticle->getFrame(1).mMinorStep);
     tArticle->beginMinorStep(1, 3);
     CPPUNIT_ASSERT(2 == tArticle->mHeadIndex);
-    CPPUNIT_ASSERT(3 == tArticle->mBuffer[2].mMinorStep);
+    CPPUNIT_ASSERT(3 == tArticle->getFrame(2).mMinorStep);
     tArticle->beginMinorStep(1, 4);
     CPPUNIT_ASSERT(0 == tArticle->mHeadIndex);
-    CPPUNIT_ASSERT(4 == tArticle->mBuffer[0].mMinorStep);
+    CPPUNIT_ASSERT(4 == tArticle->getFrame(0).mMinorStep);
 
     /// @test headOffset method with offset going past the buffer size wraps around to the start.
-    CPPUNIT_ASSERT(2 == tArticle->headOffset(4).mMinorStep);
+    CPPUNIT_ASSERT(2 == tArticle->getFrame(tArticle->headOffset(4)).mMinorStep);
 
     std::cout << "... Pass";
 }
@@ -664,40 +673,166 @@ void UtGunnsMinorStepLog::testUpdateFreeze()
 
     /// @test  updateFreeze does nothing if object hasn't been initialized.
     tArticle->updateFreeze();
-    CPPUNIT_ASSERT(0 == tArticle->mBuffer.size());
+    CPPUNIT_ASSERT(0 == tArticle->mArena);
+    CPPUNIT_ASSERT(0 == tArticle->mSize);
 
     /// - The initialize function already calls updateFreeze, but we need to assert detailed outputs
     ///   and test other logic paths.
     tArticle->initialize(tName, tNetworkSize, tNumLinks, tLinks);
 
     /// @test  Initial buffer size.
-    CPPUNIT_ASSERT(tLogSteps == tArticle->mBuffer.size());
+    const char* arena = tArticle->mArena;
+    CPPUNIT_ASSERT(0 != arena);
     CPPUNIT_ASSERT_EQUAL(tLogSteps, tArticle->mSize);
 
     /// @test  Does nothing if input size = 0.
     tArticle->mInputData.mLogSteps = 0;
     tArticle->updateFreeze();
-    CPPUNIT_ASSERT(tLogSteps == tArticle->mBuffer.size());
+    CPPUNIT_ASSERT(arena == tArticle->mArena);
     CPPUNIT_ASSERT_EQUAL(tLogSteps, tArticle->mSize);
 
     /// @test  Does nothing if input size = current size
     tArticle->mInputData.mLogSteps = tLogSteps;
     tArticle->updateFreeze();
-    CPPUNIT_ASSERT(tLogSteps == tArticle->mBuffer.size());
+    CPPUNIT_ASSERT(arena == tArticle->mArena);
     CPPUNIT_ASSERT_EQUAL(tLogSteps, tArticle->mSize);
 
-    /// @test  new size and logging start on a resize event.
+    /// @test  new size, cleared frames and logging start on a resize event.
     const unsigned int newSize = tLogSteps + 5;
+    tArticle->frameInts(0)[0] = 42;
     tArticle->mHeadIndex     = 2;
     tArticle->mNumValidSteps = 2;
     tArticle->mIsRecording   = false;
     tArticle->mInputData.mLogSteps = newSize;
     tArticle->updateFreeze();
     CPPUNIT_ASSERT(newSize     == tArticle->mSize);
-    CPPUNIT_ASSERT(newSize     == tArticle->mBuffer.size());
+    CPPUNIT_ASSERT(0           == tArticle->getFrame(0).mMajorStep);
+    CPPUNIT_ASSERT(0           == tArticle->getFrame(newSize - 1).mMajorStep);
     CPPUNIT_ASSERT(newSize - 1 == tArticle->mHeadIndex);
     CPPUNIT_ASSERT(0           == tArticle->mNumValidSteps);
     CPPUNIT_ASSERT(true        == tArticle->mIsRecording);
 
     std::cout << "... Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the binary output format of the GunnsMinorStepLog class.  This
+///           creates and deletes file: tArticle_*.bin in the test folder.
+///           If the test fails then the file may be left in the folder.  It can be deleted, and
+///           should not be checked into the CM repository.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsMinorStepLog::testBinaryOutput()
+{
+    std::cout << "\n UtGunnsMinorStepLog .... 11: testBinaryOutput ......................";
+
+    tArticle->mInputData.mOutputFormat = GunnsMinorStepLogInputData::BINARY;
+    tArticle->initialize(tName, tNetworkSize, tNumLinks, tLinks);
+
+    /// - Override the link's [A] and {w} arrays so we don't have to init the links.
+    double admittance[4] = {100.0, 0.0, 0.0, 200.0};
+    double source[2]     = {12.6, -12.6};
+    tLink0.mAdmittanceMatrix = admittance;
+    tLink1.mAdmittanceMatrix = admittance;
+    tLink2.mAdmittanceMatrix = admittance;
+    tLink0.mSourceVector     = source;
+    tLink1.mSourceVector     = source;
+    tLink2.mSourceVector     = source;
+
+    /// - Record two minor steps, the second failing to trigger the automatic dump.
+    const double potential[5]   = {1.0, 2.0, 3.0, 4.0, 5.0};
+    const double convergence[5] = {-0.1, -0.2, -0.3, -0.4, -0.5};
+    tArticle->beginMajorStep();
+    tArticle->beginMinorStep(1, 1);
+    tArticle->recordPotential(potential);
+    tArticle->recordNodesConvergence(convergence);
+    tArticle->recordLinkContributions();
+    tArticle->recordAllLinksResult(GunnsBasicLink::CONFIRM);
+    tArticle->recordStepResult(1, GunnsMinorStepData::SUCCESS);
+    tArticle->beginMinorStep(1, 2);
+    tArticle->recordPotential(potential);
+    tArticle->recordNodesConvergence(convergence);
+    tArticle->recordLinkContributions();
+    tArticle->recordAllLinksResult(GunnsBasicLink::REJECT);
+    tArticle->recordLinkResult(1, GunnsBasicLink::DELAY);
+    tArticle->recordStepResult(2, GunnsMinorStepData::DECOMP_LIMIT);
+    tArticle->endMajorStep();
+
+    /// - Remove our link memory hacks.
+    tLink0.mAdmittanceMatrix = 0;
+    tLink1.mAdmittanceMatrix = 0;
+    tLink2.mAdmittanceMatrix = 0;
+    tLink0.mSourceVector     = 0;
+    tLink1.mSourceVector     = 0;
+    tLink2.mSourceVector     = 0;
+
+    /// @test  The dump file name has the binary extension.
+    const std::string filename = tPath + tName + "_1.bin";
+    CPPUNIT_ASSERT(filename == tArticle->mFilename);
+    remove(filename.c_str());
+
+    /// @test  updateAsync creates the output file, verify its header and frames.
+    tArticle->updateAsync();
+    CPPUNIT_ASSERT(GunnsMinorStepLog::PAUSED == tArticle->mState);
+
+    std::ifstream file(filename.c_str(), std::ifstream::in | std::ifstream::binary);
+    const std::string actual((std::istreambuf_iterator<char>(file)),
+                              std::istreambuf_iterator<char>());
+    file.close();
+
+    /// - Each link has 2 ports, and its name is 6 chars.
+    const unsigned int headerSize = 8 + 5 * sizeof(unsigned int)
+                                  + tNumLinks * (2 * sizeof(unsigned int) + 6);
+    const unsigned int frameSize  = (4 + tNumLinks) * sizeof(int)
+                                  + (2 * tNetworkSize + tNumLinks * 6) * sizeof(double);
+    CPPUNIT_ASSERT_EQUAL(headerSize + 2 * frameSize, static_cast<unsigned int>(actual.size()));
+    CPPUNIT_ASSERT(0 == actual.compare(0, 8, "GUNNSMSL"));
+
+    unsigned int header[5];
+    memcpy(header, actual.data() + 8, sizeof(header));
+    CPPUNIT_ASSERT(1          == header[0]);
+    CPPUNIT_ASSERT(0x01020304 == header[1]);
+    CPPUNIT_ASSERT(5          == header[2]);
+    CPPUNIT_ASSERT(3          == header[3]);
+    CPPUNIT_ASSERT(2          == header[4]);
+
+    unsigned int linkInfo[2];
+    const char* pos = actual.data() + 8 + sizeof(header);
+    memcpy(linkInfo, pos, sizeof(linkInfo));
+    CPPUNIT_ASSERT(2 == linkInfo[0]);
+    CPPUNIT_ASSERT(6 == linkInfo[1]);
+    CPPUNIT_ASSERT("tLink0" == std::string(pos + sizeof(linkInfo), 6));
+
+    /// - Verify the second frame's results and values.
+    pos = actual.data() + headerSize + frameSize;
+    int results[7];
+    memcpy(results, pos, sizeof(results));
+    CPPUNIT_ASSERT(1                                == results[0]);
+    CPPUNIT_ASSERT(2                                == results[1]);
+    CPPUNIT_ASSERT(2                                == results[2]);
+    CPPUNIT_ASSERT(GunnsMinorStepData::DECOMP_LIMIT == results[3]);
+    CPPUNIT_ASSERT(GunnsBasicLink::REJECT           == results[4]);
+    CPPUNIT_ASSERT(GunnsBasicLink::DELAY            == results[5]);
+    CPPUNIT_ASSERT(GunnsBasicLink::REJECT           == results[6]);
+
+    double values[28];
+    memcpy(values, pos + sizeof(results), sizeof(values));
+    CPPUNIT_ASSERT(1.0   == values[0]);
+    CPPUNIT_ASSERT(5.0   == values[4]);
+    CPPUNIT_ASSERT(-0.1  == values[5]);
+    CPPUNIT_ASSERT(-0.5  == values[9]);
+    CPPUNIT_ASSERT(100.0 == values[10]);
+    CPPUNIT_ASSERT(200.0 == values[13]);
+    CPPUNIT_ASSERT(12.6  == values[14]);
+    CPPUNIT_ASSERT(-12.6 == values[27]);
+
+    /// @test  renderBinary writes nothing while recording.
+    std::ostringstream stream;
+    tArticle->mIsRecording = true;
+    tArticle->renderBinary(stream);
+    CPPUNIT_ASSERT(stream.str().empty());
+
+    /// - Delete the test file when we're done.
+    remove(filename.c_str());
+
+    std::cout << "... Pass";
+}
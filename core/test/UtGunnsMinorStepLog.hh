@@ -76,6 +76,8 @@ class UtGunnsMinorStepLog : public CppUnit::TestFixture
         void testUpdateAsync();
         /// @brief    Tests the updateFreeze method.
         void testUpdateFreeze();
+        /// @brief    Tests the binary output format.
+        void testBinaryOutput();
 
     private:
         CPPUNIT_TEST_SUITE(UtGunnsMinorStepLog);
@@ -89,6 +91,7 @@ class UtGunnsMinorStepLog : public CppUnit::TestFixture
         CPPUNIT_TEST(testWraparound);
         CPPUNIT_TEST(testUpdateAsync);
         CPPUNIT_TEST(testUpdateFreeze);
+        CPPUNIT_TEST(testBinaryOutput);
         CPPUNIT_TEST_SUITE_END();
         FriendlyGunnsMinorStepLog*              tArticle;     /**< (--) Test article */
         GunnsMinorStepLogInputData::LogCommands tCommand;     /**< (--) Input data */
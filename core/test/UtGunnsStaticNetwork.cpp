@@ -0,0 +1,245 @@
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+
+#include "UtGunnsStaticNetwork.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default constructor for the UtGunnsStaticNetwork class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsStaticNetwork::UtGunnsStaticNetwork()
+    :
+    tNodes(),
+    tNodeList(),
+    tLinks(),
+    tPotential(),
+    tConductor1(),
+    tLoad(),
+    tConductor2(),
+    tCapacitor(),
+    tConductor3(),
+    tSource(),
+    tNetwork(),
+    tTimeStep(0.1)
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This is the default destructor for the UtGunnsStaticNetwork class.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UtGunnsStaticNetwork::~UtGunnsStaticNetwork()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed after each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsStaticNetwork::tearDown()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Executed before each unit test.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsStaticNetwork::setUp()
+{
+    //do nothing
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] i          (--) Index of the network to set up.
+/// @param[in] dispatcher (--) Link dispatcher to give the solver before initialization, or null.
+///
+/// @details  Initializes a non-linear network with a potential source, conductors, a constant power
+///           load, a capacitor and a flux source, so that the admittance matrix, source vector and
+///           minor steps all get exercised.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsStaticNetwork::setupNetwork(const int i, GunnsLinkDispatcher* dispatcher)
+{
+    std::ostringstream name;
+    name << "UtGunnsStaticNetwork" << i;
+
+    for (int node = 0; node < N_NODES; ++node) {
+        std::ostringstream nodeName;
+        nodeName << name.str() << ".Node" << node;
+        tNodes[i][node].initialize(nodeName.str());
+    }
+    tNodeList[i].mNumNodes = N_NODES;
+    tNodeList[i].mNodes    = tNodes[i];
+    tNetwork[i].initializeNodes(tNodeList[i]);
+
+    GunnsBasicPotentialConfigData  potentialConfig(name.str() + ".VS1", &tNodeList[i], 1.0E14);
+    GunnsBasicPotentialInputData   potentialInput(false, 0.0, -125.0);
+    GunnsBasicConductorConfigData  conductor1Config(name.str() + ".R1", &tNodeList[i], 1.0);
+    GunnsBasicConductorConfigData  conductor2Config(name.str() + ".R2", &tNodeList[i], 1.0 / 1750.0);
+    GunnsBasicConductorConfigData  conductor3Config(name.str() + ".R3", &tNodeList[i], 1.0 / 100.0);
+    GunnsBasicConductorInputData   conductorInput;
+    EpsConstantPowerLoadConfigData loadConfig(name.str() + ".CP1", &tNodeList[i], 0.0192, 300.0, 0.01);
+    EpsConstantPowerLoadInputData  loadInput;
+    GunnsBasicCapacitorConfigData  capacitorConfig(name.str() + ".C1", &tNodeList[i]);
+    GunnsBasicCapacitorInputData   capacitorInput(false, 0.0, 0.5, 100.0);
+    GunnsBasicSourceConfigData     sourceConfig(name.str() + ".S1", &tNodeList[i]);
+    GunnsBasicSourceInputData      sourceInput(false, 0.0, 0.2);
+
+    tPotential[i] .initialize(potentialConfig,  potentialInput, tLinks[i], Node0,  GROUND);
+    tConductor1[i].initialize(conductor1Config, conductorInput, tLinks[i], Node0,  Node1);
+    tLoad[i]      .initialize(loadConfig,       loadInput,      tLinks[i], Node1,  GROUND);
+    tConductor2[i].initialize(conductor2Config, conductorInput, tLinks[i], Node1,  Node2);
+    tCapacitor[i] .initialize(capacitorConfig,  capacitorInput, tLinks[i], Node2,  GROUND);
+    tConductor3[i].initialize(conductor3Config, conductorInput, tLinks[i], Node2,  Node3);
+    tSource[i]    .initialize(sourceConfig,     sourceInput,    tLinks[i], GROUND, Node3);
+
+    GunnsConfigData networkConfig(name.str(), 0.01, 1.0, 10, 5);
+    tNetwork[i].setLinkDispatcher(dispatcher);
+    tNetwork[i].initialize(networkConfig, tLinks[i]);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] steps (--) Number of major steps to run.
+///
+/// @details  Steps both networks and verifies the potentials, link fluxes and solver counts are
+///           exactly equal, since the dispatcher must add the same terms in the same order.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsStaticNetwork::verifyIdentical(const int steps)
+{
+    for (int step = 0; step < steps; ++step) {
+        tNetwork[0].step(tTimeStep);
+        tNetwork[1].step(tTimeStep);
+        for (int node = 0; node < GROUND; ++node) {
+            CPPUNIT_ASSERT_EQUAL(tNetwork[0].getPotentialVector()[node],
+                                 tNetwork[1].getPotentialVector()[node]);
+        }
+        CPPUNIT_ASSERT_EQUAL(tConductor2[0].getFlux(), tConductor2[1].getFlux());
+        CPPUNIT_ASSERT_EQUAL(tCapacitor[0] .getFlux(), tCapacitor[1] .getFlux());
+        CPPUNIT_ASSERT_EQUAL(tSource[0]    .getFlux(), tSource[1]    .getFlux());
+    }
+    CPPUNIT_ASSERT_EQUAL(tNetwork[0].getMinorStepCount(),     tNetwork[1].getMinorStepCount());
+    CPPUNIT_ASSERT_EQUAL(tNetwork[0].getDecompositionCount(), tNetwork[1].getDecompositionCount());
+    CPPUNIT_ASSERT(tNetwork[1].getMinorStepCount() > steps);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the static network dispatcher gives exactly the same solution as the
+///           solver's link loops.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsStaticNetwork::testMatchesDynamic()
+{
+    std::cout << "\n -----------------------------------------------------------------------------";
+    std::cout << "\n UtGunnsStaticNetwork 01: testMatchesDynamic ...........................";
+
+    GunnsStaticNetwork<StaticLinks, GROUND> dispatcher;
+    CPPUNIT_ASSERT(7 == StaticLinks::NUM_LINKS);
+
+    setupNetwork(0, 0);
+    setupNetwork(1, &dispatcher);
+    CPPUNIT_ASSERT(0           == tNetwork[0].getLinkDispatcher());
+    CPPUNIT_ASSERT(&dispatcher == tNetwork[1].getLinkDispatcher());
+
+    verifyIdentical(20);
+
+    /// - Verify the capacitor charged from its source, which shows the source vector and flows
+    ///   are computed through the dispatcher.
+    CPPUNIT_ASSERT(tNodes[1][Node2].getPotential() != 100.0);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the run-time node map element, including following a port command,
+///           and binding the dispatcher after the solver is initialized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsStaticNetwork::testRunTimeNodeMap()
+{
+    std::cout << "\n UtGunnsStaticNetwork 02: testRunTimeNodeMap ...........................";
+
+    GunnsStaticNetwork<StaticLinksN, GROUND> dispatcher;
+
+    setupNetwork(0, 0);
+    setupNetwork(1, 0);
+    tNetwork[1].setLinkDispatcher(&dispatcher);
+    CPPUNIT_ASSERT(&dispatcher == tNetwork[1].getLinkDispatcher());
+
+    verifyIdentical(20);
+
+    /// - Verify the run-time node map element follows a port command and stays bound.
+    for (int i = 0; i < 2; ++i) {
+        FriendlyGunnsStaticNetworkConductor* conductor =
+                static_cast<FriendlyGunnsStaticNetworkConductor*>(&tConductor2[i]);
+        conductor->mUserPortSelect     = 1;
+        conductor->mUserPortSelectNode = Node3;
+        conductor->mUserPortSetControl = GunnsBasicLink::EXECUTE;
+    }
+    verifyIdentical(5);
+    CPPUNIT_ASSERT(Node3 == tConductor2[1].getNodeMap()[1]);
+    CPPUNIT_ASSERT(&dispatcher == tNetwork[1].getLinkDispatcher());
+
+    /// - Verify clearing the dispatcher reverts to the link loops.
+    tNetwork[1].setLinkDispatcher(0);
+    CPPUNIT_ASSERT(0 == tNetwork[1].getLinkDispatcher());
+    verifyIdentical(5);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the solver ignores a dispatcher whose node maps, link types or
+///           number of links don't match the network, or whose network size doesn't match.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsStaticNetwork::testMismatch()
+{
+    std::cout << "\n UtGunnsStaticNetwork 03: testMismatch .................................";
+
+    GunnsStaticNetwork<WrongNodeLinks, GROUND> wrongNode;
+    GunnsStaticNetwork<WrongTypeLinks, GROUND> wrongType;
+    GunnsStaticNetwork<ShortLinks,     GROUND> wrongCount;
+    GunnsStaticNetwork<StaticLinks,    Node3>  wrongSize;
+
+    setupNetwork(0, 0);
+    setupNetwork(1, &wrongNode);
+    CPPUNIT_ASSERT(0 == tNetwork[1].getLinkDispatcher());
+    tNetwork[1].setLinkDispatcher(&wrongType);
+    CPPUNIT_ASSERT(0 == tNetwork[1].getLinkDispatcher());
+    tNetwork[1].setLinkDispatcher(&wrongCount);
+    CPPUNIT_ASSERT(0 == tNetwork[1].getLinkDispatcher());
+    tNetwork[1].setLinkDispatcher(&wrongSize);
+    CPPUNIT_ASSERT(0 == tNetwork[1].getLinkDispatcher());
+
+    /// - Verify the network still solves with the link loops.
+    verifyIdentical(5);
+
+    std::cout << "... Pass";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  This method tests the solver drops the dispatcher and reverts to its link loops when a
+///           link with a compile-time node map re-maps a port from a user port command.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtGunnsStaticNetwork::testPortCommand()
+{
+    std::cout << "\n UtGunnsStaticNetwork 04: testPortCommand ..............................";
+
+    GunnsStaticNetwork<StaticLinks, GROUND> dispatcher;
+
+    setupNetwork(0, 0);
+    setupNetwork(1, &dispatcher);
+    CPPUNIT_ASSERT(&dispatcher == tNetwork[1].getLinkDispatcher());
+    verifyIdentical(5);
+
+    /// - Command the second conductor's port 1 from Node2 to Node3 in both networks.
+    for (int i = 0; i < 2; ++i) {
+        FriendlyGunnsStaticNetworkConductor* conductor =
+                static_cast<FriendlyGunnsStaticNetworkConductor*>(&tConductor2[i]);
+        conductor->mUserPortSelect     = 1;
+        conductor->mUserPortSelectNode = Node3;
+        conductor->mUserPortSetControl = GunnsBasicLink::EXECUTE;
+    }
+
+    /// - Verify the dispatcher is dropped and the solution still matches the link loops.
+    verifyIdentical(5);
+    CPPUNIT_ASSERT(Node3 == tConductor2[1].getNodeMap()[1]);
+    CPPUNIT_ASSERT(0 == tNetwork[1].getLinkDispatcher());
+
+    std::cout << "... Pass";
+}
@@ -0,0 +1,166 @@
+#ifndef UtGunnsStaticNetwork_EXISTS
+#define UtGunnsStaticNetwork_EXISTS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup UT_GUNNS_STATIC_NETWORK    GUNNS Static Network Composition Unit Test
+/// @ingroup  UT_GUNNS
+///
+/// @copyright Copyright 2026 United States Government as represented by the Administrator of the
+///            National Aeronautics and Space Administration.  All Rights Reserved.
+///
+/// @details  Unit Tests for the GUNNS Static Network Composition templates
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <sstream>
+#include <vector>
+
+#include "aspects/electrical/ConstantPowerLoad/EpsConstantPowerLoad.hh"
+#include "core/Gunns.hh"
+#include "core/GunnsBasicCapacitor.hh"
+#include "core/GunnsBasicConductor.hh"
+#include "core/GunnsBasicPotential.hh"
+#include "core/GunnsBasicSource.hh"
+#include "core/GunnsStaticNetwork.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    Inherit from GunnsBasicConductor and befriend UtGunnsStaticNetwork.
+///
+/// @details  Class derived from the unit under test. It just has a constructor with the same
+///           arguments as the parent and a default destructor, but it befriends the unit test case
+///           driver class to allow it access to protected data members.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class FriendlyGunnsStaticNetworkConductor : public GunnsBasicConductor
+{
+    public:
+        FriendlyGunnsStaticNetworkConductor();
+        virtual ~FriendlyGunnsStaticNetworkConductor();
+        friend class UtGunnsStaticNetwork;
+};
+inline FriendlyGunnsStaticNetworkConductor::FriendlyGunnsStaticNetworkConductor()
+    : GunnsBasicConductor() {};
+inline FriendlyGunnsStaticNetworkConductor::~FriendlyGunnsStaticNetworkConductor() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Static Network Composition Unit Tests.
+///
+/// @details  This class provides the unit tests for the GunnsStaticNetwork templates within the
+///           CPPUnit framework.  Each test builds two identical non-linear networks, one with a
+///           static link dispatcher and one without, and compares their solutions.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class UtGunnsStaticNetwork : public CppUnit::TestFixture
+{
+    public:
+        /// @brief    Default constructs this GunnsStaticNetwork unit test.
+        UtGunnsStaticNetwork();
+        /// @brief    Default destructs this GunnsStaticNetwork unit test.
+        virtual ~UtGunnsStaticNetwork();
+        /// @brief    Executes before each test.
+        void setUp();
+        /// @brief    Executes after each test.
+        void tearDown();
+        /// @brief    Tests the static network gives the same solution as the solver's link loops.
+        void testMatchesDynamic();
+        /// @brief    Tests the run-time node map element and setting the dispatcher after init.
+        void testRunTimeNodeMap();
+        /// @brief    Tests the solver reverts to its link loops when the dispatcher doesn't match.
+        void testMismatch();
+        /// @brief    Tests the solver reverts to its link loops when a link re-maps a port.
+        void testPortCommand();
+
+    private:
+        CPPUNIT_TEST_SUITE(UtGunnsStaticNetwork);
+        CPPUNIT_TEST(testMatchesDynamic);
+        CPPUNIT_TEST(testRunTimeNodeMap);
+        CPPUNIT_TEST(testMismatch);
+        CPPUNIT_TEST(testPortCommand);
+        CPPUNIT_TEST_SUITE_END();
+
+        /// @brief    Enumeration of the network nodes.
+        enum Nodes {
+            Node0  = 0,
+            Node1  = 1,
+            Node2  = 2,
+            Node3  = 3,
+            GROUND = 4,
+            N_NODES = 5
+        };
+
+        /// @brief    The network links, composed with compile-time node maps.
+        typedef GunnsStaticLinkList<GunnsStaticLink<GunnsBasicPotential,  Node0,  GROUND>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicConductor,  Node0,  Node1>,
+                GunnsStaticLinkList<GunnsStaticLink<EpsConstantPowerLoad, Node1,  GROUND>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicConductor,  Node1,  Node2>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicCapacitor,  Node2,  GROUND>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicConductor,  Node2,  Node3>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicSource,     GROUND, Node3>
+                > > > > > > > StaticLinks;
+
+        /// @brief    The network links, with a run-time node map element for a conductor.
+        typedef GunnsStaticLinkList<GunnsStaticLink<GunnsBasicPotential,  Node0,  GROUND>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicConductor,  Node0,  Node1>,
+                GunnsStaticLinkList<GunnsStaticLink<EpsConstantPowerLoad, Node1,  GROUND>,
+                GunnsStaticLinkList<GunnsStaticLinkN<GunnsBasicConductor>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicCapacitor,  Node2,  GROUND>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicConductor,  Node2,  Node3>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicSource,     GROUND, Node3>
+                > > > > > > > StaticLinksN;
+
+        /// @brief    The network links with the wrong node on the last link.
+        typedef GunnsStaticLinkList<GunnsStaticLink<GunnsBasicPotential,  Node0,  GROUND>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicConductor,  Node0,  Node1>,
+                GunnsStaticLinkList<GunnsStaticLink<EpsConstantPowerLoad, Node1,  GROUND>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicConductor,  Node1,  Node2>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicCapacitor,  Node2,  GROUND>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicConductor,  Node2,  Node3>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicSource,     GROUND, Node2>
+                > > > > > > > WrongNodeLinks;
+
+        /// @brief    The network links with the wrong type of the second link.
+        typedef GunnsStaticLinkList<GunnsStaticLink<GunnsBasicPotential,  Node0,  GROUND>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicPotential,  Node0,  Node1>,
+                GunnsStaticLinkList<GunnsStaticLink<EpsConstantPowerLoad, Node1,  GROUND>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicConductor,  Node1,  Node2>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicCapacitor,  Node2,  GROUND>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicConductor,  Node2,  Node3>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicSource,     GROUND, Node3>
+                > > > > > > > WrongTypeLinks;
+
+        /// @brief    The network links missing the last link.
+        typedef GunnsStaticLinkList<GunnsStaticLink<GunnsBasicPotential,  Node0,  GROUND>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicConductor,  Node0,  Node1>,
+                GunnsStaticLinkList<GunnsStaticLink<EpsConstantPowerLoad, Node1,  GROUND>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicConductor,  Node1,  Node2>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicCapacitor,  Node2,  GROUND>,
+                GunnsStaticLinkList<GunnsStaticLink<GunnsBasicConductor,  Node2,  Node3>
+                > > > > > > ShortLinks;
+
+        GunnsBasicNode                tNodes[2][N_NODES]; /**< (--) Nodes of the two networks. */
+        GunnsNodeList                 tNodeList[2];       /**< (--) Node lists of the two networks. */
+        std::vector<GunnsBasicLink*>  tLinks[2];          /**< (--) Links of the two networks. */
+        GunnsBasicPotential           tPotential[2];      /**< (--) Potential sources. */
+        GunnsBasicConductor           tConductor1[2];     /**< (--) First conductors. */
+        EpsConstantPowerLoad          tLoad[2];           /**< (--) Non-linear constant power loads. */
+        GunnsBasicConductor           tConductor2[2];     /**< (--) Second conductors. */
+        GunnsBasicCapacitor           tCapacitor[2];      /**< (--) Capacitors. */
+        GunnsBasicConductor           tConductor3[2];     /**< (--) Third conductors. */
+        GunnsBasicSource              tSource[2];         /**< (--) Flux sources. */
+        Gunns                         tNetwork[2];        /**< (--) The solvers, [1] is the test article. */
+        double                        tTimeStep;          /**< (s)  Integration time step. */
+
+        /// @brief    Initializes one of the networks, with the given link dispatcher.
+        void setupNetwork(const int i, GunnsLinkDispatcher* dispatcher);
+        /// @brief    Steps both networks and verifies their solutions are identical.
+        void verifyIdentical(const int steps);
+
+        /// @brief Copy constructor unavailable since declared private and not implemented.
+        UtGunnsStaticNetwork(const UtGunnsStaticNetwork& that);
+        /// @brief Assignment operator unavailable since declared private and not implemented.
+        UtGunnsStaticNetwork& operator =(const UtGunnsStaticNetwork& that);
+};
+
+///@}
+
+#endif
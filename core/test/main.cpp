@@ -46,6 +46,9 @@ LIBRARY DEPENDENCY:
 #include "UtGunnsFluidExternalSupply.hh"
 #include "UtGunnsFluidExternalDemand.hh"
 #include "UtGunnsFluidDistributedIf.hh"
+#include "UtGunnsFluidDistributedIfShm.hh"
+#include "UtGunnsFluidDistributedIfSerializer.hh"
+#include "UtGunnsFluidDistributedIfSocket.hh"
 #include "UtGunnsFluidShadow.hh"
 #include "UtGunnsFluidFlowController.hh"
 #include "UtGunnsFluidIslandAnalyzer.hh"
@@ -54,6 +57,10 @@ LIBRARY DEPENDENCY:
 #include "UtGunnsFluidFlowIntegrator.hh"
 #include "UtGunnsFluidVolumeMonitor.hh"
 #include "UtGunnsSensorAnalogWrapper.hh"
+#include "UtGunnsStaticNetwork.hh"
+#include "UtGunnsEnsemble.hh"
+#include "UtGunnsCheckpoint.hh"
+#include "UtGunnsHsRateLimiter.hh"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param    argc  int     --  not used
@@ -95,6 +102,9 @@ int main(int argc, char** argv) {
     runner.addTest( UtGunnsFluidExternalSupply::suite() );
     runner.addTest( UtGunnsFluidExternalDemand::suite() );
     runner.addTest( UtGunnsFluidDistributedIf::suite() );
+    runner.addTest( UtGunnsFluidDistributedIfShm::suite() );
+    runner.addTest( UtGunnsFluidDistributedIfSerializer::suite() );
+    runner.addTest( UtGunnsFluidDistributedIfSocket::suite() );
     runner.addTest( UtGunnsFluidShadow::suite() );
     runner.addTest( UtGunnsFluidFlowController::suite());
     runner.addTest( UtGunnsFluidIslandAnalyzer::suite() );
@@ -103,6 +113,10 @@ int main(int argc, char** argv) {
     runner.addTest( UtGunnsFluidFlowIntegrator::suite() );
     runner.addTest( UtGunnsFluidVolumeMonitor::suite() );
     runner.addTest( UtGunnsSensorAnalogWrapper::suite() );
+    runner.addTest( UtGunnsStaticNetwork::suite() );
+    runner.addTest( UtGunnsEnsemble::suite() );
+    runner.addTest( UtGunnsCheckpoint::suite() );
+    runner.addTest( UtGunnsHsRateLimiter::suite() );
 
     runner.run();
 
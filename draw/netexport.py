@@ -216,6 +216,22 @@ def getPortMapInitialize(port_map):
             result = result + ', Node' + port + ' + netSuperNodesOffset'
     return result
 
+# Formats the link's element of the static network composition: the link class
+# with its compile-time node map for fixed-port links of up to 4 ports, else the
+# link class with its run-time node map.
+def getStaticLink(link, port_map):
+    linkClass = link.find('./gunns').attrib['subtype'].split("/")[-1]
+    numPorts  = int(link.find('./gunns').attrib['numPorts'])
+    if 0 < numPorts <= 4:
+        nodes = ''
+        for port in port_map:
+            if int(port) < 0:
+                nodes = nodes + ', GROUND'
+            else:
+                nodes = nodes + ', Node' + port
+        return 'GunnsStaticLink<' + linkClass + nodes + '>'
+    return 'GunnsStaticLinkN<' + linkClass + '>'
+
 # Builds the link's initialize call, depending on whether it is a fixed-
 # (numPorts > 0) or variable-port (numPorts == 0) link
 def getLinkInitialize(link, port_map):
@@ -550,12 +566,14 @@ except NameError:
 #   -g only does generation of the output network C++, skips diagram file maintenance
 #   -d looks in the user's ~/Downloads first
 #   -p overrides the default external paths environment variable
+#   -s also generates the static network composition of the links (basic networks only)
 cmd_parser = ArgumentParser(description='Auto-generate the GUNNS network code from a GunnsDraw drawing.')
 cmd_parser.add_argument('FILE', nargs='*', help="The drawing filename.  This is optional; if not supplied, the script will pop up a file selection window.")
 cmd_parser.add_argument("-d", action="store_true", help="Look in ~/Downloads for a newer version", dest="downloads", default="false")
 cmd_parser.add_argument("-m", action="store_true", help="Only do error checks and maintenance updates to the diagram file", dest="maintenance", default="false")
 cmd_parser.add_argument("-g", action="store_true", help="Only do generation of the output network code", dest="generation", default="false")
 cmd_parser.add_argument("-p", action="store",      help="Use the provided environment variable for external paths", dest="ext_paths", default="GUNNS_EXT_PATH")
+cmd_parser.add_argument("-s", action="store_true", help="Also generate the static network composition of the links, for the solver to call them without virtual dispatch (basic networks only)", dest="static", default=False)
 options = cmd_parser.parse_args()
 
 # Use the supplied path/file name, else use a file browser to select the drawing.
@@ -1134,6 +1152,28 @@ for link in links:
     linksData.append(linkData)
     index = index + 1
 
+# This is a list of the static network composition elements for each link, in
+# link order.  It is left empty when not requested or not supported, so the
+# network uses the solver's link loops.  The links' node maps must be fixed at
+# compile time, so this doesn't support jumper plugs, which move link ports.
+# Only the basic network templates emit the composition.
+# Each link nests another template, so this is limited to keep well within the
+# compiler's template instantiation depth.
+staticLinksData = []
+STATIC_LINKS_LIMIT = 500
+if options.static:
+    if fluid_network:
+        print('    ' + console.warn('static network composition skipped, since it is only supported for basic networks.'))
+    elif len(jumperPlugs) > 0:
+        print('    ' + console.warn('static network composition skipped, since jumper plugs can move link ports.'))
+    elif len(links) > STATIC_LINKS_LIMIT:
+        print('    ' + console.warn('static network composition skipped, since the network has more than ' + str(STATIC_LINKS_LIMIT) + ' links.'))
+    else:
+        index = 0
+        for link in links:
+            staticLinksData.append(getStaticLink(link, port_maps[index]))
+            index = index + 1
+
 # This is a list of data for each node: number, initial state, sorted by node number
 nodesData = []
 for node in netNodes:
@@ -1221,6 +1261,7 @@ data_model = dict([('networkName', networkName),
                    ('revline', revline),
                    ('linkSourcePaths', list(sorted(set(link_source_paths)))),
                    ('links', linksData),
+                   ('staticLinks', staticLinksData),
                    ('nodes', nodesData),
                    ('numNodes', numNetNodes),
                    ('spotters', spottersData),
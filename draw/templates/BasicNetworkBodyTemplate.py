@@ -195,8 +195,14 @@ class BasicNetworkBodyTemplate:
     r = r+('    // Links\n')
     for link in self.data['links'][:-1]:
       r = r+('    ' + link[1] + '(),\n')
-    for link in self.data['links'][-1:]:
-      r = r+('    ' + link[1] + '()\n')
+    if len(self.data['staticLinks']) > 0:
+      for link in self.data['links'][-1:]:
+        r = r+('    ' + link[1] + '(),\n')
+      r = r+('    // Static network composition\n'
+        '    netStaticLinks()\n')
+    else:
+      for link in self.data['links'][-1:]:
+        r = r+('    ' + link[1] + '()\n')
     r = r+('{\n'
         '    // Nothing to do\n'
         '}\n'
@@ -251,6 +257,8 @@ class BasicNetworkBodyTemplate:
         '    /// - Initialize the solver, only if this is not a sub-network.\n'
         '    if (!netIsSubNetwork) {\n')
     r = r + self.blockSolverInitializeNodes()
+    if len(self.data['staticLinks']) > 0:
+      r = r+('        netSolver.setLinkDispatcher(&netStaticLinks);\n')
     r = r+('        netSolver.initialize(netConfig.netSolver, netLinks);\n'
         '    }\n'
         '}\n'
@@ -94,6 +94,8 @@ class BasicNetworkHeaderTemplate:
     for path in self.data['linkSourcePaths']:
       r = r + ('#include "' + path + '.hh"\n')
     r = r + self.blockIncludesPostLinks()
+    if len(self.data['staticLinks']) > 0:
+      r = r + ('#include "core/GunnsStaticNetwork.hh"\n')
     if len(self.data['socketLists']) > 0:
       r = r + ('#include "core/Gunns' + self.data['networkType'] + 'JumperPlug.hh"\n')
     # TODO namespace statement
@@ -280,6 +282,15 @@ class BasicNetworkHeaderTemplate:
         '        // Links\n')
     for link in self.data['links']:
       r = r + ('        ' + link[0] + ' ' + link[1] + ';    /**< (--) ' + link[1] + ' instance. */\n')
+    if len(self.data['staticLinks']) > 0:
+      r = r + (
+        '        // Static network composition\n'
+        '        /// @brief  The links\' types and node maps, in link order.\n'
+        '        typedef ')
+      for staticLink in self.data['staticLinks']:
+        r = r + ('GunnsStaticLinkList<' + staticLink + ',\n                ')
+      r = r + ('GunnsStaticLinkListEnd' + (' >' * len(self.data['staticLinks'])) + ' StaticLinks;\n'
+        '        GunnsStaticNetwork<StaticLinks, GROUND> netStaticLinks;    /**< ** (--) trick_chkpnt_io(**) Static link dispatcher for the solver. */\n')
     r = r + (
         '        /// @brief  Default constructs this network.\n'
         '        ' + self.data['networkName'] + '(const std::string& name = "");\n'
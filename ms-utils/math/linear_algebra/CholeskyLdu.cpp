@@ -241,6 +241,109 @@ void CholeskyLdu::Solve(double *LDU, double B[], double x[], int n)
     SolveUnitUpperTriangular(LDU, x, x, n);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] A (--) On input, the pointer to the first element of the single precision matrix
+///                       A[n][n].  On output, the matrix A is replaced by the lower triangular,
+///                       diagonal, and upper triangular matrices of the Cholesky LDL' factorization
+///                       of A.
+/// @param[in]     n (--) The number of rows and/or columns of the matrix A.
+///
+/// @throws  TsNumericalException
+///
+/// @details  This is the same algorithm as Decompose, in single precision.  This halves the memory
+///           traffic and doubles the width of vectorized operations, at the cost of precision in
+///           the factors.  The caller is expected to recover double precision accuracy in the
+///           solution by iterative refinement against the original double precision matrix.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLdu::DecomposeSingle(float *A, int n)
+{
+    float *p_i = A + n;                    // pointer to L[i][0]
+    for (int i = 1; i < n; p_i += n, i++) {
+
+        /// - Calculate elements given by the product L[i][j]*D[j].
+        float *p_j = A;                    // pointer to L[j][0]
+        for (int j = 0; j < i; j++, p_j += n) {
+            const float limit = -1.0E-30f;
+            for (int k = 0; k < j; k++) {
+                /// - Skip operations on zero to save time.
+                if (limit > *(p_i + k) and limit > *(p_j + k)) {
+                    *(p_i + j) -= *(p_i + k) * *(p_j + k);
+                }
+            }
+            /// - Protect for underflow, same as Decompose.
+            if ( (*(p_i + j) > limit) and (*(p_i + j) < -limit) ) {
+                *(p_i + j) = 0.0f;
+            }
+        }
+
+        /// - Calculate the diagonal element D[i] and L[i][j].  Store the transpose L[k][i];
+        float *p_k = A;                    // pointer to L[k][0]
+        for (int k = 0; k < i; p_k += n, k++) {
+            float ld = *(p_i + k) / *(p_k + k);    // temp storage
+            *(p_i + i) -= *(p_i + k) * ld;
+            *(p_i + k) = ld;
+            *(p_k + i) = ld;
+        }
+
+        /// - Return the failing row number to aid debugging.
+        if ( *(p_i + i) <= 0.0f ) {
+            std::ostringstream msg;
+            msg << "failed at row " << i;
+            throw(TsNumericalException("", "CholeskyLdu::DecomposeSingle", msg.str()));
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in]     LDU (--) Pointer to the first element of the single precision matrix whose
+///                         elements form the unit lower triangular, diagonal, and unit upper
+///                         triangular matrix factors of A.
+/// @param[in]     B   (--) Pointer to the column vector, (n x 1) matrix, B.
+/// @param[out]    x   (--) Solution to the equation Ax = B.
+/// @param[in]     n   (--) The number of rows or columns of the matrix LU.
+///
+/// @throws  TsNumericalException
+///
+/// @details  This is the same algorithm as Solve, using single precision factors from
+///           DecomposeSingle.  The substitutions are accumulated in double precision so that the
+///           only loss of precision is from the factors themselves.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void CholeskyLdu::SolveSingle(float *LDU, double B[], double x[], int n)
+{
+    int i, k;
+    float *p_k;
+
+    /// - Solve the linear equation Ly = B for y, where L is a unit lower triangular matrix.
+    x[0] = B[0];
+    for (k = 1, p_k = LDU + n; k < n; p_k += n, k++) {
+        double sum = B[k];
+        for (i = 0; i < k; i++) {
+            sum -= x[i] * *(p_k + i);
+        }
+        x[k] = sum;
+    }
+
+    /// - Solve the linear equation Dz = y for z, where D is the diagonal matrix.
+    for (k = 0, p_k = LDU; k < n; k++, p_k += n) {
+        /// - Return the failing row number to aid debugging.
+        if ( *(p_k + k) == 0.0f ) {
+            std::ostringstream msg;
+            msg << "failed at row " << k;
+            throw(TsNumericalException("", "CholeskyLdu::SolveSingle", msg.str()));
+        }
+        x[k] /= *(p_k + k);
+    }
+
+    /// - Solve the linear equation Ux = z, where U is a unit upper triangular matrix.
+    for (k = n-2, p_k = LDU + n * (n - 2); k >= 0; p_k -= n, k--) {
+        double sum = x[k];
+        for (i = k + 1; i < n; i++) {
+            sum -= x[i] * *(p_k + i);
+        }
+        x[k] = sum;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @param[in,out] LDU (--) Pointer to the first element of the matrix whose elements form the unit
 ///                lower triangular matrix, the diagonal matrix, and the unit upper triangular
@@ -57,6 +57,13 @@ class CholeskyLdu
         /// @brief Uses the decomposed admittance matrix to solve [A]{x} = {b} for {x}.
         virtual void Solve(double *LDU, double B[], double x[], int n);
 
+        /// @brief Decomposes the admittance matrix [A] in single precision.
+        virtual void DecomposeSingle(float *A, int n);
+
+        /// @brief Uses the single precision decomposed admittance matrix to solve [A]{x} = {b} for
+        ///        {x} in double precision.
+        virtual void SolveSingle(float *LDU, double B[], double x[], int n);
+
         /// @brief Uses the decomposed admittance matrix to find the inverse of [A].
         virtual void Invert(double *LDU, int n);
 
@@ -480,3 +480,54 @@ void UtCholeskyLdu::testPosOffDiagSolution()
 
     std::cout << "... Pass";
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Tests that the solution of [A]{x} = {b} using the single precision decomposition
+///           satisfies the original system to single precision, and that the single precision
+///           decomposition and solution throw on bad matrices like the double precision ones.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtCholeskyLdu::testSingleSolution()
+{
+    std::cout << "\n UtCholeskyLdu ..... 08: testSingleSolution .........................";
+
+    double tolerance = 1.0E-6;
+
+    /// - Test the same made-up system as testNormalSolution.
+    double A[16] = {10.0,     -0.001,    -0.002,    0.0,
+                    -0.001,    8.0,      -0.003,   -0.001,
+                    -0.002,   -0.003,    12.0,      0.0,
+                     0.0,     -0.001,     0.0,      9.0};
+    double x[4]  = { 0.0,      0.0,       0.0,      0.0};
+    double b[4]  = {27.0,      0.03,      0.0,     -1.5};
+
+    float S[16];
+    for (int i=0; i<16; ++i) {
+        S[i] = static_cast<float>(A[i]);
+    }
+
+    CPPUNIT_ASSERT_NO_THROW(tArticle.DecomposeSingle(S, 4));
+    CPPUNIT_ASSERT_NO_THROW(tArticle.SolveSingle(S, b, x, 4));
+
+    double result[4];
+    result[0] = A[0]  * x[0] + A[1]  * x[1] + A[2]  * x[2] + A[3]  * x[3];
+    result[1] = A[4]  * x[0] + A[5]  * x[1] + A[6]  * x[2] + A[7]  * x[3];
+    result[2] = A[8]  * x[0] + A[9]  * x[1] + A[10] * x[2] + A[11] * x[3];
+    result[3] = A[12] * x[0] + A[13] * x[1] + A[14] * x[2] + A[15] * x[3];
+
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(b[0], result[0], std::max(b[0] * tolerance, 2.0 * tolerance));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(b[1], result[1], std::max(b[1] * tolerance, 2.0 * tolerance));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(b[2], result[2], std::max(b[2] * tolerance, 2.0 * tolerance));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(b[3], result[3], std::max(b[3] * tolerance, 2.0 * tolerance));
+
+    /// - Test the unconditioned matrix from testUnConditioned.
+    float U[4] = {1.0f, -1.1f,
+                 -1.1f,  1.0f};
+    CPPUNIT_ASSERT_THROW(tArticle.DecomposeSingle(U, 2), TsNumericalException);
+
+    /// - Test a zero diagonal in the solution.
+    float Z[4] = {1.0f, 0.0f,
+                  0.0f, 0.0f};
+    CPPUNIT_ASSERT_THROW(tArticle.SolveSingle(Z, b, x, 2), TsNumericalException);
+
+    std::cout << "... Pass";
+}
@@ -46,6 +46,8 @@ class UtCholeskyLdu : public CppUnit::TestFixture
         void testDecomposeVector();
         /// @brief    Tests [A]{x} = {b} using decomposition for [A] having positive off-diagonals.
         void testPosOffDiagSolution();
+        /// @brief    Tests [A]{x} = {b} using single precision decomposition.
+        void testSingleSolution();
     private:
         CholeskyLdu    tArticle;                /**< (--) Unit under test. */
         CPPUNIT_TEST_SUITE(UtCholeskyLdu);
@@ -56,6 +58,7 @@ class UtCholeskyLdu : public CppUnit::TestFixture
         CPPUNIT_TEST(testInvert);
         CPPUNIT_TEST(testDecomposeVector);
         CPPUNIT_TEST(testPosOffDiagSolution);
+        CPPUNIT_TEST(testSingleSolution);
         CPPUNIT_TEST_SUITE_END();
 
         /// @brief Copy constructor unavailable since declared private and not implemented.
@@ -41,6 +41,10 @@ TsHsConfig::TsHsConfig() :
     mTextPluginBlockingEnabled(1),
     mTextPluginOverwriteEnabled(1),
     mTextPluginPath("../../../logs/TS_Health_and_Status.out"),
+    mTextPluginFlushPeriod(1.0),
+    mTextPluginRotateSize(0),
+    mTextPluginRotatePeriod(0.0),
+    mTextPluginBinaryEnabled(0),
     mSqlitePluginEnabled(1),
     mSqlitePluginBlockingEnabled(1),
     mSqlitePluginOverwriteEnabled(1),
@@ -77,6 +81,10 @@ TsHsConfig::TsHsConfig(const TsHsConfig& config) :
     mTextPluginBlockingEnabled(config.mTextPluginBlockingEnabled),
     mTextPluginOverwriteEnabled(config.mTextPluginOverwriteEnabled),
     mTextPluginPath(config.mTextPluginPath),
+    mTextPluginFlushPeriod(config.mTextPluginFlushPeriod),
+    mTextPluginRotateSize(config.mTextPluginRotateSize),
+    mTextPluginRotatePeriod(config.mTextPluginRotatePeriod),
+    mTextPluginBinaryEnabled(config.mTextPluginBinaryEnabled),
     mSqlitePluginEnabled(config.mSqlitePluginEnabled),
     mSqlitePluginBlockingEnabled(config.mSqlitePluginBlockingEnabled),
     mSqlitePluginOverwriteEnabled(config.mSqlitePluginOverwriteEnabled),
@@ -292,6 +300,10 @@ void TsHsConfig::dumpConfig() const
         << " " << mTextPluginBlockingEnabled
         << " " << mTextPluginOverwriteEnabled
         << " '"<< mTextPluginPath << "'"
+        << " " << mTextPluginFlushPeriod
+        << " " << mTextPluginRotateSize
+        << " " << mTextPluginRotatePeriod
+        << " " << mTextPluginBinaryEnabled
         << endl;
 
    cout << " " << mSqlitePluginEnabled
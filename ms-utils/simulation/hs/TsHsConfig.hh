@@ -72,7 +72,7 @@ public:
    string mTerminationSubsystems;           //    (--) Restricts termination to listed subsystems - only applies if terminations enabled.
 
    // Queue config
-   int    mQueueBlockingEnabled;            //    (--) If non-zero simultaneous attempt to insert into queue will result in threads waiting.
+   int    mQueueBlockingEnabled;            //    (--) If non-zero simultaneous attempt to insert into queue will result in threads waiting. Not used by the lock-free ring.
    int    mQueueCapacity;                   //    (--) The maximum number of logging requests that will fit in the queue without overflow.
 
    // Text plugin
@@ -80,6 +80,10 @@ public:
    int    mTextPluginBlockingEnabled;       //    (--) Enables text plugin blocking.
    int    mTextPluginOverwriteEnabled;      //    (--) Enables overwriting of existing log file verses using time-stamped log file names.
    string mTextPluginPath;                  //    (--) Path and file name to text log file.
+   double mTextPluginFlushPeriod;           //    (s) Longest time a message waits in the text log file buffer. Not read from the config file.
+   long   mTextPluginRotateSize;            //    (--) Text log file size in bytes at which it's rotated, 0 for no limit. Not read from the config file.
+   double mTextPluginRotatePeriod;          //    (s) Time after which the text log file is rotated, 0 for no limit. Not read from the config file.
+   int    mTextPluginBinaryEnabled;         //    (--) Enables compact binary records in the text plugin log file. Not read from the config file.
 
    // Sqlite plugin
    int    mSqlitePluginEnabled;             //    (--) Enables the SQLite plugin.
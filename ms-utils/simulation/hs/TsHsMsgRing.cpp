@@ -0,0 +1,298 @@
+/**
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+- (Lock-free message ring to support HS message thread. Offloads logging I/O from model threads
+   without locking or allocating in them.)
+
+REQUIREMENTS:
+   ()
+
+REFERENCE:
+   ()
+
+ASSUMPTIONS AND LIMITATIONS:
+   ()
+
+LIBRARY DEPENDENCY:
+   ()
+
+PROGRAMMERS:
+   (
+    ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+   )
+*/
+
+#include <cstring>
+#include <string>
+
+#include "TsHsMsgRing.hh"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Default constructor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsMsgRingSlot::TsHsMsgRingSlot() :
+    mSequence(0),
+    mLine(0),
+    mType(TS_HS_DEBUG),
+    mMet(),
+    mTimestamp(0L)
+{
+    mFile[0]     = '\0';
+    mFunction[0] = '\0';
+    mSubsys[0]   = '\0';
+    mText[0]     = '\0';
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Default constructor. The ring must be initialized before use.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsMsgRing::TsHsMsgRing() :
+    mSlots(0),
+    mSize(0),
+    mMask(0),
+    mTail(0),
+    mHead(0),
+    mBatchCount(0),
+    mDropCount(0),
+    mTruncationCount(0),
+    mHighWaterMark(0)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Constructor that takes the ring capacity.
+///
+/// @param[in] capacity (--) The minimum number of messages the ring can hold before dropping.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsMsgRing::TsHsMsgRing(int capacity) :
+    mSlots(0),
+    mSize(0),
+    mMask(0),
+    mTail(0),
+    mHead(0),
+    mBatchCount(0),
+    mDropCount(0),
+    mTruncationCount(0),
+    mHighWaterMark(0)
+{
+    initialize(capacity);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Destructor. Frees ring memory.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TsHsMsgRing::~TsHsMsgRing()
+{
+    delete [] mSlots;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Initializes (or re-initializes) the ring. The capacity is rounded up to a power of
+///            2, with a minimum of 2. Queued messages are discarded, so this should be called
+///            before messages are inserted. The counters are kept.
+///
+/// @param[in] capacity (--) The minimum number of messages the ring can hold before dropping.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgRing::initialize(int capacity)
+{
+    unsigned long size = 2;
+    while (static_cast<long>(size) < capacity) {
+        size <<= 1;
+    }
+
+    if (size != mSize) {
+        delete [] mSlots;
+        mSlots = new TsHsMsgRingSlot[size];
+        mSize  = size;
+        mMask  = size - 1;
+    }
+
+    // Each slot starts ready for the producer of its position in the first lap.
+    for (unsigned long i = 0; i < mSize; ++i) {
+        mSlots[i].mSequence = i;
+    }
+    mTail       = 0;
+    mHead       = 0;
+    mBatchCount = 0;
+    __sync_synchronize();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Copies the string into the fixed-size field, truncating it if necessary.
+///
+/// @param[out] field (--) The slot field to copy to.
+/// @param[in]  value (--) The string to copy.
+/// @param[in]  size  (--) The size of the field, including the null terminator.
+///
+/// @return Returns true if the string was truncated.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsMsgRing::copyField(char* field, const std::string& value, unsigned int size)
+{
+    const bool         truncated = value.size() >= size;
+    const unsigned int length    = truncated ? size - 1 : static_cast<unsigned int>(value.size());
+    memcpy(field, value.data(), length);
+    field[length] = '\0';
+    return truncated;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Inserts a message at the tail of the ring without locking or allocating. Producers
+///            race to claim the tail position with a compare-and-swap. If the ring is full the
+///            message is dropped and counted, rather than waiting for the consumer.
+///
+/// @param[in] file       (--) Source file name invoking 'send'; typically __FILE__ macro is used.
+/// @param[in] line       (--) Line in file invoking 'send'; typically __LINE__ macro is used.
+/// @param[in] function   (--) The name of the function logging the message; typically __func__.
+/// @param[in] type       (--) Enumeration constant that represents the type of message.
+/// @param[in] subsys     (--) The subsystem that is logging the message.
+/// @param[in] mtext      (--) The message text.
+/// @param[in] met        (--) The mission elapsed time.
+/// @param[in] timestamp  (--) The Unix timestamp.
+///
+/// @return Returns true if the message was inserted, false if it was dropped.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsMsgRing::insertMsg(
+    const std::string& file,
+    const int          line,
+    const std::string& function,
+    TS_HS_MSG_TYPE     type,
+    const std::string& subsys,
+    const std::string& mtext,
+    TS_TIMER_TYPE      met,
+    unsigned long      timestamp)
+{
+    if (0 == mSlots) {
+        __sync_fetch_and_add(&mDropCount, 1);
+        return false;
+    }
+
+    // Claim the tail position. A slot whose sequence equals the position is free for it, one that
+    // lags the position by a lap hasn't been read by the consumer yet, so the ring is full.
+    TsHsMsgRingSlot* slot = 0;
+    unsigned long position = mTail;
+    for (;;) {
+        slot = &mSlots[position & mMask];
+        const unsigned long sequence = slot->mSequence;
+        __sync_synchronize();
+        const long diff = static_cast<long>(sequence - position);
+        if (0 == diff) {
+            if (__sync_bool_compare_and_swap(&mTail, position, position + 1)) {
+                break;
+            }
+            position = mTail;
+        } else if (diff < 0) {
+            __sync_fetch_and_add(&mDropCount, 1);
+            return false;
+        } else {
+            position = mTail;
+        }
+    }
+
+    // Fill the claimed slot.
+    bool truncated = copyField(slot->mFile,     file,     TsHsMsgRingSlot::FILE_SIZE);
+    truncated     |= copyField(slot->mFunction, function, TsHsMsgRingSlot::FUNCTION_SIZE);
+    truncated     |= copyField(slot->mSubsys,   subsys,   TsHsMsgRingSlot::SUBSYS_SIZE);
+    truncated     |= copyField(slot->mText,     mtext,    TsHsMsgRingSlot::TEXT_SIZE);
+    slot->mLine      = line;
+    slot->mType      = type;
+    slot->mMet       = met;
+    slot->mTimestamp = timestamp;
+    if (truncated) {
+        __sync_fetch_and_add(&mTruncationCount, 1);
+    }
+
+    // Publish the slot to the consumer.
+    __sync_synchronize();
+    slot->mSequence = position + 1;
+
+    // Update the high-water mark with the number of claimed slots.
+    unsigned long used = position + 1 - mHead;
+    if (used > mSize) {
+        used = mSize;
+    }
+    int highWater = mHighWaterMark;
+    while (static_cast<int>(used) > highWater) {
+        if (__sync_bool_compare_and_swap(&mHighWaterMark, highWater, static_cast<int>(used))) {
+            break;
+        }
+        highWater = mHighWaterMark;
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Acquires the consecutive published messages at the head of the ring, up to the given
+///            number. They stay valid until releaseBatch. Only one thread may be the consumer.
+///
+/// @param[in] maxCount (--) The maximum number of messages to acquire.
+///
+/// @return Returns the number of messages acquired, which may be zero.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int TsHsMsgRing::acquireBatch(int maxCount)
+{
+    mBatchCount = 0;
+    if (0 == mSlots) {
+        return 0;
+    }
+    const unsigned long head = mHead;
+    while (mBatchCount < maxCount and mBatchCount < static_cast<int>(mSize)) {
+        const unsigned long position = head + mBatchCount;
+        if (mSlots[position & mMask].mSequence != position + 1) {
+            break;
+        }
+        ++mBatchCount;
+    }
+    __sync_synchronize();
+    return mBatchCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Returns a message of the acquired batch.
+///
+/// @param[in] index (--) Index of the message in the batch, from 0 to the acquired count - 1.
+///
+/// @return Returns the message slot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const TsHsMsgRingSlot& TsHsMsgRing::getBatchMsg(int index) const
+{
+    return mSlots[(mHead + index) & mMask];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Releases the acquired batch, making its slots free for the producers' next lap.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsMsgRing::releaseBatch()
+{
+    const unsigned long head = mHead;
+    __sync_synchronize();
+    for (int i = 0; i < mBatchCount; ++i) {
+        mSlots[(head + i) & mMask].mSequence = head + i + mSize;
+    }
+    mHead       = head + mBatchCount;
+    mBatchCount = 0;
+    __sync_synchronize();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Returns true if there is no published message at the head of the ring. A message
+///            being filled by a producer is not yet published.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsMsgRing::isEmpty() const
+{
+    if (0 == mSlots) {
+        return true;
+    }
+    const unsigned long head = mHead;
+    return mSlots[head & mMask].mSequence != head + 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details   Returns the number of slots claimed by producers and not yet released by the
+///            consumer, including any being filled.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int TsHsMsgRing::getSize() const
+{
+    return static_cast<int>(mTail - mHead);
+}
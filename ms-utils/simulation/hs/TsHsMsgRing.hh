@@ -0,0 +1,164 @@
+#ifndef TsHsMsgRing_EXISTS
+#define TsHsMsgRing_EXISTS
+
+/**
+@defgroup  TSM_UTILITIES_SIMULATION_HS_MESSAGE_RING Message Ring
+@ingroup   TSM_UTILITIES_SIMULATION_HS
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+@details
+PURPOSE:
+- (Health and Status lock-free message ring. Allows log messages to be queued by any number of
+   model threads without locking or allocating, and later output in batches by a helper thread.)
+
+REQUIREMENTS:
+- (TBD)
+
+REFERENCE:
+- (D. Vyukov, "Bounded MPMC queue", 1024cores.net.)
+
+ASSUMPTIONS AND LIMITATIONS:
+- (Multiple producers, single consumer: only one thread at a time may drain the ring.)
+- (Message fields longer than the fixed slot fields are truncated, and counted.)
+- (On overflow the new message is dropped, and counted, since the producers can't reclaim slots
+   from the consumer without locking.)
+- (initialize is not thread-safe and must not be called while messages are being inserted.)
+- (Uses the GCC __sync atomic builtins, since this code is C++98.)
+
+LIBRARY DEPENDENCY:
+- ((TsHsMsgRing.o))
+
+PROGRAMMERS:
+- (
+    ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+  )
+
+@{
+*/
+
+#include <string>
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include "TS_hs_msg_types.h"
+#include "simulation/timer/TS_timer.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief   Preallocated message slot used by TsHsMsgRing. The text fields are fixed-size,
+///          null-terminated character arrays so that inserting a message never allocates.
+//////////////////////////////////////////////////////////////////////////////////////////////////
+class TsHsMsgRingSlot
+{
+    TS_MAKE_SIM_COMPATIBLE(TsHsMsgRingSlot);
+public:
+    /// @brief Sizes of the fixed text fields, including the null terminator.
+    enum FieldSizes {
+        FILE_SIZE     = 128,
+        FUNCTION_SIZE = 64,
+        SUBSYS_SIZE   = 16,
+        TEXT_SIZE     = 512
+    };
+    TsHsMsgRingSlot();
+    volatile unsigned long mSequence;                // ** (--) Ring position this slot is ready for
+    char                   mFile[FILE_SIZE];         // ** (--) Name of file logging the message
+    int                    mLine;                    // ** (--) Number of line logging the message
+    char                   mFunction[FUNCTION_SIZE]; // ** (--) Name of function logging the message
+    TS_HS_MSG_TYPE         mType;                    // ** (--) Severity of message, e.g. warning, error, info, etc.
+    char                   mSubsys[SUBSYS_SIZE];     // ** (--) Subsystem issuing message
+    char                   mText[TEXT_SIZE];         // ** (--) The text to log, e.g. description of the error
+    TS_TIMER_TYPE          mMet;                     // ** (--) MET time related to logging event
+    unsigned long          mTimestamp;               // ** (--) Unix time stamp related to logging event
+private:
+    TsHsMsgRingSlot(const TsHsMsgRingSlot&);
+    const TsHsMsgRingSlot& operator=(const TsHsMsgRingSlot&);
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief   A lock-free multi-producer, single-consumer ring of preallocated message slots.
+///
+/// @details Producers claim the next slot by compare-and-swap of the tail position, copy their
+///          message into it, then publish it by advancing the slot's sequence number. The
+///          consumer reads the published slots in order from the head, in batches, and returns
+///          them to the producers by advancing their sequence numbers by the ring size. Producers
+///          never wait on each other or on the consumer: if the ring is full the message is
+///          dropped and counted. The ring also tracks its high-water mark.
+///
+///          The capacity is rounded up to a power of 2, so positions map to slots with a mask.
+//////////////////////////////////////////////////////////////////////////////////////////////////
+class TsHsMsgRing
+{
+public:
+    TS_MAKE_SIM_COMPATIBLE(TsHsMsgRing);
+
+    /// @brief Default constructor.
+    TsHsMsgRing();
+
+    /// @brief Constructor that takes the ring capacity.
+    explicit TsHsMsgRing(int capacity);
+
+    /// @brief Destructor.
+    virtual ~TsHsMsgRing();
+
+    /// @brief Initializes (or re-initializes) the ring capacity, discarding queued messages.
+    void initialize(int capacity);
+
+    /// @brief Inserts a message at the tail of the ring, returns false if it was dropped.
+    bool insertMsg(
+            const std::string& file,
+            const int          line,
+            const std::string& function,
+            TS_HS_MSG_TYPE     type,
+            const std::string& subsys,
+            const std::string& mtext,
+            TS_TIMER_TYPE      met,
+            unsigned long      timestamp);
+
+    /// @brief Acquires up to the given number of messages at the head of the ring.
+    int acquireBatch(int maxCount);
+
+    /// @brief Returns a message of the acquired batch.
+    const TsHsMsgRingSlot& getBatchMsg(int index) const;
+
+    /// @brief Releases the acquired batch back to the producers.
+    void releaseBatch();
+
+    /// @brief Returns true if there is no published message at the head of the ring.
+    bool isEmpty() const;
+
+    /// @brief Returns the capacity of the ring.
+    int getCapacity() const { return static_cast<int>(mSize); }
+
+    /// @brief Returns the number of claimed slots in the ring.
+    int getSize() const;
+
+    /// @brief Returns the number of messages dropped due to a full ring.
+    int getDrops() const { return mDropCount; }
+
+    /// @brief Returns the number of messages with fields truncated to fit the slots.
+    int getTruncations() const { return mTruncationCount; }
+
+    /// @brief Returns the highest number of claimed slots.
+    int getHighWaterMark() const { return mHighWaterMark; }
+
+protected:
+    /// @brief Copies a string into a fixed slot field, returns true if it was truncated.
+    static bool copyField(char* field, const std::string& value, unsigned int size);
+
+    TsHsMsgRingSlot*       mSlots;           // ** (--) The preallocated message slots
+    unsigned long          mSize;            // *o (--) trick_chkpnt_io(*io) Number of slots, a power of 2
+    unsigned long          mMask;            // ** (--) Mask of a position to its slot index
+    volatile unsigned long mTail;            // ** (--) Next position to be claimed by a producer
+    volatile unsigned long mHead;            // ** (--) Next position to be read by the consumer
+    int                    mBatchCount;      // ** (--) Number of messages in the acquired batch
+    volatile int           mDropCount;       // *o (--) trick_chkpnt_io(*io) Number of messages dropped due to a full ring
+    volatile int           mTruncationCount; // *o (--) trick_chkpnt_io(*io) Number of messages with truncated fields
+    volatile int           mHighWaterMark;   // *o (--) trick_chkpnt_io(*io) Highest number of claimed slots
+
+private:
+    TsHsMsgRing(const TsHsMsgRing&);
+    const TsHsMsgRing& operator=(const TsHsMsgRing&);
+};
+/// @}
+
+#endif /* TsHsMsgRing_EXISTS */
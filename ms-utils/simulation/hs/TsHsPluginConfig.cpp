@@ -29,6 +29,12 @@ TsHsPluginConfig::TsHsPluginConfig() :
     mEnabled(false),
     mOverwrite(true),
     mPath(""),
-    mBlocking(false)
+    mBlocking(false),
+    mGroupCommitCount(0),
+    mGroupCommitPeriod(0.5),
+    mFlushPeriod(1.0),
+    mRotateSize(0),
+    mRotatePeriod(0.0),
+    mBinary(false)
 {
 }
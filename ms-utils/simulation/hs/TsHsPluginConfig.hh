@@ -44,6 +44,12 @@ struct TsHsPluginConfig
     bool        mOverwrite;     //    (--) Reuse plugin target (e.g. overwrite file vs. create a new timestamped one)
     std::string mPath;          //    (--) Path to file to which the plugin writes
     bool        mBlocking;      //    (--) This plugin will wait when needed resources are busy
+    int         mGroupCommitCount;  //    (--) Messages per transaction for plugins that group them, 0 for one transaction per message
+    double      mGroupCommitPeriod; //    (s)  Longest time a message waits in an open transaction before it's committed
+    double      mFlushPeriod;       //    (s)  Longest time a message waits in a file buffer before it's flushed
+    long        mRotateSize;        //    (--) File size in bytes at which the file is rotated, 0 for no size limit
+    double      mRotatePeriod;      //    (s)  Time after which the file is rotated, 0 for no time limit
+    bool        mBinary;            //    (--) Write compact binary records instead of text lines
 };
 
 /// @}
@@ -21,6 +21,7 @@ PROGRAMMERS:
    (
      ((Jeffrey Middleton) (L3) (January 2010) (Initial version))
      ((Wesley A. White) (Tietronix Software) (August 2011))
+     ((GUNNS Development Team) (CACI) (October 2026) (Group commit with prepared statements))
    )
 **************************************************************************************************/
 
@@ -29,6 +30,7 @@ PROGRAMMERS:
 #include <cstdlib>
 #include <cstring>
 #include <cmath>
+#include <ctime>
 #include <sqlite3.h>
 #include "sim_services/Message/include/message_proto.h"
 #include "simulation/timer/TS_timer.h"
@@ -48,7 +50,14 @@ TsHsSqlitePlugin::TsHsSqlitePlugin(int id) :
     mDatabaseHandle(0),
     mTryLockFailures(0),
     mResourceLock(),
-    mBlocking(false)
+    mBlocking(false),
+    mGroupCommitCount(0),
+    mGroupCommitPeriod(0.0),
+    mPendingCount(0),
+    mTransactionStart(0.0),
+    mUpdateStatement(0),
+    mInsertStatement(0),
+    mTimeStatement(0)
 {
     pthread_mutex_init(&mResourceLock, NULL);
 }
@@ -71,6 +80,8 @@ void TsHsSqlitePlugin::configure(const TsHsPluginConfig& configData)
     mFilename  = configData.mPath;
     mOverwrite = configData.mOverwrite;
     mBlocking  = configData.mBlocking;
+    mGroupCommitCount  = configData.mGroupCommitCount;
+    mGroupCommitPeriod = configData.mGroupCommitPeriod;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -91,6 +102,7 @@ void TsHsSqlitePlugin::handleSqlError(const std::string& file __attribute__((unu
 
         if (fatal)
         {
+            finalizeStatements();
             sqlite3_close(mDatabaseHandle);
             mTransactionOpen = false;
             mDatabaseHandle = 0;
@@ -174,9 +186,90 @@ bool TsHsSqlitePlugin::init(void)
         handleSqlError(__FILE__, __LINE__, &sql_error, true);
     }
 
+    // Prepare for group commit
+    if (mDatabaseHandle and mGroupCommitCount > 0)
+    {
+        return prepareStatements();
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Switches the database to write-ahead logging, so that a commit appends to the log
+///          instead of rewriting the database, and prepares the statements that write a message so
+///          they aren't compiled for every message. On failure the database is closed.
+///
+/// @return  True if the statements were prepared, else false.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsSqlitePlugin::prepareStatements()
+{
+    char* sql_error = 0;
+    sqlite3_exec(mDatabaseHandle, "PRAGMA journal_mode=WAL; PRAGMA synchronous=NORMAL;", NULL, NULL, &sql_error);
+    handleSqlError(__FILE__, __LINE__, &sql_error, false);
+
+    const char* update_command =
+            "UPDATE messages SET count = count + 1, last_time = ?1 WHERE id = ?2;";
+    const char* insert_command =
+            "INSERT INTO messages VALUES (?1, ?2, ?3, ?4, ?5, ?6, 1, ?7);";
+    const char* time_command =
+            "INSERT INTO timestamps VALUES (?1, ?2, ?3);";
+
+    if (sqlite3_prepare_v2(mDatabaseHandle, update_command, -1, &mUpdateStatement, NULL) != SQLITE_OK or
+        sqlite3_prepare_v2(mDatabaseHandle, insert_command, -1, &mInsertStatement, NULL) != SQLITE_OK or
+        sqlite3_prepare_v2(mDatabaseHandle, time_command,   -1, &mTimeStatement,   NULL) != SQLITE_OK)
+    {
+        message_publish(MSG_ERROR, "TsHsSqlitePlugin error preparing statements: %s\n", sqlite3_errmsg(mDatabaseHandle));
+        finalizeStatements();
+        sqlite3_close(mDatabaseHandle);
+        mDatabaseHandle = 0;
+        return false;
+    }
+
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Finalizes the cached prepared statements, which must be done before the database can be
+///          closed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsSqlitePlugin::finalizeStatements()
+{
+    sqlite3_finalize(mUpdateStatement);
+    sqlite3_finalize(mInsertStatement);
+    sqlite3_finalize(mTimeStatement);
+    mUpdateStatement = 0;
+    mInsertStatement = 0;
+    mTimeStatement   = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Commits the open group transaction, if any. The caller must hold the resource lock.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsSqlitePlugin::commitTransaction()
+{
+    if (mTransactionOpen and mDatabaseHandle)
+    {
+        char* sql_error = 0;
+        sqlite3_exec(mDatabaseHandle, "COMMIT;", NULL, NULL, &sql_error);
+        handleSqlError(__FILE__, __LINE__, &sql_error, false);
+    }
+    mTransactionOpen = false;
+    mPendingCount    = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Returns the monotonic clock time, used to age the open group transaction.
+///
+/// @return  The clock time in seconds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double TsHsSqlitePlugin::getClockTime()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<double>(now.tv_sec) + 1.0e-9 * static_cast<double>(now.tv_nsec);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Restarts a plugin.
 ///
@@ -213,6 +306,17 @@ bool TsHsSqlitePlugin::update(void)
         return false;
     }
 
+    // Commit the open group transaction if it's been waiting too long for more messages. Don't wait
+    // on the helper thread if it's writing, since it will check the age itself.
+    if (mTransactionOpen and getClockTime() - mTransactionStart >= mGroupCommitPeriod)
+    {
+        if (pthread_mutex_trylock(&mResourceLock) == 0) // 0 means lock granted
+        {
+            commitTransaction();
+            pthread_mutex_unlock(&mResourceLock);
+        }
+    }
+
     return true;
 }
 
@@ -235,6 +339,8 @@ void TsHsSqlitePlugin::shutdown(void)
 
     if (pthread_mutex_lock(&mResourceLock) == 0) // 0 means lock granted
     {
+        commitTransaction();
+        finalizeStatements();
         sqlite3_close(mDatabaseHandle);
         pthread_mutex_unlock(&mResourceLock);
     }
@@ -310,6 +416,35 @@ bool TsHsSqlitePlugin::msg(
     msg_hash = hashString(msg_hash, subsys);
     msg_hash = hashString(msg_hash, mtext);
 
+    int met_seconds = static_cast<int> (floor(met.seconds));
+
+    if (mGroupCommitCount > 0)
+    {
+        if (mBlocking)
+        {
+            // We will wait if necessary, no messages will be lost.
+            if (pthread_mutex_lock(&mResourceLock) == 0) // 0 means lock granted
+            {
+                insertPrepared(msg_hash, file, line, type, subsys, mtext, met_seconds, timestamp);
+                pthread_mutex_unlock(&mResourceLock);
+            }
+        }
+        else
+        {
+            // Don't wait. Discard message if resource conflict.
+            if (pthread_mutex_trylock(&mResourceLock) == 0) // 0 means lock granted
+            {
+                insertPrepared(msg_hash, file, line, type, subsys, mtext, met_seconds, timestamp);
+                pthread_mutex_unlock(&mResourceLock);
+            }
+            else
+            {
+                mTryLockFailures++;
+            }
+        }
+        return true;
+    }
+
     // This is not optimal - for new entries, we should just insert (skip the update)
     const char* insert_command_template =
             // insert the hash-message entry (if it's already there, carry on)
@@ -321,8 +456,6 @@ bool TsHsSqlitePlugin::msg(
 
     // Fill-in the command template to produce a complete SQL command
 
-    int met_seconds = static_cast<int> (floor(met.seconds));
-
     char* insert_command = sqlite3_mprintf(insert_command_template,
             msg_hash, file.c_str(), line, type, subsys.c_str(), mtext.c_str(), met_seconds, // INSERT
             met_seconds, msg_hash,                                  // UPDATE
@@ -336,6 +469,7 @@ bool TsHsSqlitePlugin::msg(
             insertMessage(insert_command);
             pthread_mutex_unlock(&mResourceLock);
         }
+        sqlite3_free(insert_command);
     }
     else
     {
@@ -348,6 +482,7 @@ bool TsHsSqlitePlugin::msg(
         }
         else
         {
+            sqlite3_free(insert_command);
             mTryLockFailures++;
         }
     }
@@ -373,3 +508,88 @@ bool TsHsSqlitePlugin::insertMessage(char* insertCommand)
     return true;
 }
 
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Writes a health and status message with the cached prepared statements, in the open
+///          group transaction, beginning one if needed. A repeated message only has its count
+///          updated; a new one is inserted. The transaction is committed once it holds the group
+///          commit count of messages or has been open for the group commit period. The caller
+///          must hold the resource lock.
+///
+/// @param[in] msgHash    (--) The database key of the message.
+/// @param[in] file       (--) name of file which initiated logging the message.
+/// @param[in] line       (--) line of file which initiated logging the message.
+/// @param[in] type       (--) the type of message (e.g. info, warning, etc.).
+/// @param[in] subsys     (--) the subsystem from which the message originated.
+/// @param[in] mtext      (--) the message text.
+/// @param[in] metSeconds (s)  the whole mission-elapsed seconds that the message was sent.
+/// @param[in] timestamp  (--) the unix timestamp that the message was sent.
+///
+/// @return  True if successful, or false on failure.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsSqlitePlugin::insertPrepared(
+   long long int      msgHash,
+   const std::string& file,
+   int                line,
+   TS_HS_MSG_TYPE     type,
+   const std::string& subsys,
+   const std::string& mtext,
+   int                metSeconds,
+   unsigned long      timestamp)
+{
+    if (!mDatabaseHandle or !mUpdateStatement)
+    {
+        return false;
+    }
+
+    if (!mTransactionOpen)
+    {
+        char* sql_error = 0;
+        sqlite3_exec(mDatabaseHandle, "BEGIN TRANSACTION;", NULL, NULL, &sql_error);
+        handleSqlError(__FILE__, __LINE__, &sql_error, false);
+        mTransactionOpen  = true;
+        mTransactionStart = getClockTime();
+    }
+
+    // Count the message if it's already in the table, else insert it.
+    sqlite3_bind_int  (mUpdateStatement, 1, metSeconds);
+    sqlite3_bind_int64(mUpdateStatement, 2, msgHash);
+    bool ok = (sqlite3_step(mUpdateStatement) == SQLITE_DONE);
+    sqlite3_reset(mUpdateStatement);
+
+    if (ok and sqlite3_changes(mDatabaseHandle) == 0)
+    {
+        sqlite3_bind_int64(mInsertStatement, 1, msgHash);
+        sqlite3_bind_text (mInsertStatement, 2, file.c_str(),   static_cast<int>(file.size()),   SQLITE_STATIC);
+        sqlite3_bind_int  (mInsertStatement, 3, line);
+        sqlite3_bind_int  (mInsertStatement, 4, type);
+        sqlite3_bind_text (mInsertStatement, 5, subsys.c_str(), static_cast<int>(subsys.size()), SQLITE_STATIC);
+        sqlite3_bind_text (mInsertStatement, 6, mtext.c_str(),  static_cast<int>(mtext.size()),  SQLITE_STATIC);
+        sqlite3_bind_int  (mInsertStatement, 7, metSeconds);
+        ok = (sqlite3_step(mInsertStatement) == SQLITE_DONE);
+        sqlite3_reset(mInsertStatement);
+        sqlite3_clear_bindings(mInsertStatement);
+    }
+
+    if (ok)
+    {
+        sqlite3_bind_int64(mTimeStatement, 1, msgHash);
+        sqlite3_bind_int  (mTimeStatement, 2, metSeconds);
+        sqlite3_bind_int64(mTimeStatement, 3, static_cast<sqlite3_int64>(timestamp));
+        ok = (sqlite3_step(mTimeStatement) == SQLITE_DONE);
+        sqlite3_reset(mTimeStatement);
+    }
+
+    if (!ok)
+    {
+        message_publish(MSG_ERROR, "TsHsSqlitePlugin sqlite error: %s\n", sqlite3_errmsg(mDatabaseHandle));
+    }
+
+    ++mPendingCount;
+    if (mPendingCount >= mGroupCommitCount or getClockTime() - mTransactionStart >= mGroupCommitPeriod)
+    {
+        commitTransaction();
+    }
+
+    return ok;
+}
@@ -11,12 +11,17 @@
 @details
 PURPOSE:
 - (Component of the Health & Status message framework. An output plugin that outputs to an sqlite database.)
+- (By default each message is written in its own transaction, which waits on the disk for every
+   message. With a group commit count configured, the database uses write-ahead logging, messages
+   are written with cached prepared statements, and a transaction is committed every group commit
+   count messages, or when the oldest uncommitted message is older than the group commit period.)
 
 REFERENCE:
 - (TBD)
 
 ASSUMPTIONS AND LIMITATIONS:
-- (TBD)
+- (With group commit, messages in the open transaction are lost if the process dies before it is
+   committed.)
 
 LIBRARY DEPENDENCY:
 - (
@@ -24,7 +29,10 @@ LIBRARY DEPENDENCY:
   )
 
 PROGRAMMERS:
-- ((Jeffrey Middleton) (L3) (January 2010) (Initial version))
+- (
+    ((Jeffrey Middleton) (L3) (January 2010) (Initial version))
+    ((GUNNS Development Team) (CACI) (October 2026) (Group commit with prepared statements))
+  )
 
 @{
 */
@@ -72,6 +80,23 @@ protected:
 
     bool insertMessage(char* insertCommand);
 
+    /// @brief Writes a message with the prepared statements in the open group transaction.
+    bool insertPrepared(long long int msgHash, const std::string& file, int line, TS_HS_MSG_TYPE type,
+                        const std::string& subsys, const std::string& mtext, int metSeconds,
+                        unsigned long timestamp);
+
+    /// @brief Prepares the cached statements and enables write-ahead logging for group commit.
+    bool prepareStatements();
+
+    /// @brief Finalizes the cached prepared statements.
+    void finalizeStatements();
+
+    /// @brief Commits the open group transaction, if any.
+    void commitTransaction();
+
+    /// @brief Returns the monotonic clock time.
+    static double getClockTime();
+
     /// @brief Displays the error message and, if fatal, close the database.
     void handleSqlError(const std::string&, int, char**, bool);
 
@@ -91,6 +116,13 @@ protected:
     int             mTryLockFailures;  // ** (--) Number of times trylock failed to get the lock (== number of dropped messages)
     pthread_mutex_t mResourceLock;     // ** (--) Mutex which controls access to database files
     bool            mBlocking;         // ** (--) Wait on mutex if true, else skip message
+    int             mGroupCommitCount; // ** (--) Messages per transaction, 0 for one transaction per message
+    double          mGroupCommitPeriod;// ** (s)  Longest time a message waits in an open transaction
+    int             mPendingCount;     // ** (--) Number of messages in the open transaction
+    double          mTransactionStart; // ** (s)  Clock time the open transaction was begun
+    sqlite3_stmt*   mUpdateStatement;  // ** (--) Prepared statement to count a repeated message
+    sqlite3_stmt*   mInsertStatement;  // ** (--) Prepared statement to insert a new message
+    sqlite3_stmt*   mTimeStatement;    // ** (--) Prepared statement to insert a message timestamp
 
 private:
 
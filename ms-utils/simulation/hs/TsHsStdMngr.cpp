@@ -25,7 +25,7 @@ LIBRARY DEPENDENCY:
      (simulation/hs/TsHsMsgStdFilter.o)
      (simulation/hs/TsHsMngr.o)
      (simulation/timer/TS_timer.o)
-     (simulation/hs/TsHsMsgQueue.o)
+     (simulation/hs/TsHsMsgRing.o)
      (simulation/hs/TsHsConfig.o)
    )
 
@@ -58,12 +58,15 @@ PROGRAMMERS:
 TsHsStdMngr::TsHsStdMngr() :
     mConfig(),
     mMsgFilter(),
-    mMsgQueue(4000, false),
+    mMsgRing(4000),
     mRequestCount(0),
     mImmediateMode(true),
     mUseHelperThread(true),
-    mPluginMngr()
+    mPluginMngr(),
+    mConsumerLock()
 {
+    pthread_mutex_init(&mConsumerLock, NULL);
+
     // Get configuration information
     mConfig.getConfigInfo();
 
@@ -77,12 +80,14 @@ TsHsStdMngr::TsHsStdMngr() :
 TsHsStdMngr::TsHsStdMngr(const TsHsConfig& config) :
     mConfig(config),
     mMsgFilter(),
-    mMsgQueue(4000, false),
+    mMsgRing(4000),
     mRequestCount(0),
     mImmediateMode(true),
     mUseHelperThread(true),
-    mPluginMngr()
+    mPluginMngr(),
+    mConsumerLock()
 {
+    pthread_mutex_init(&mConsumerLock, NULL);
     configure();
 }
 
@@ -99,10 +104,14 @@ void TsHsStdMngr::configure()
     TsHsTermination::setEnabled(mConfig.mTerminationEnabled);
 
     // Set up text plugin config
-    mPluginConfig[TS_HS_TEXT].mEnabled     = mConfig.mTextPluginEnabled;
-    mPluginConfig[TS_HS_TEXT].mOverwrite   = mConfig.mTextPluginOverwriteEnabled;
-    mPluginConfig[TS_HS_TEXT].mBlocking    = mConfig.mTextPluginBlockingEnabled;
-    mPluginConfig[TS_HS_TEXT].mPath        = mConfig.mTextPluginPath;
+    mPluginConfig[TS_HS_TEXT].mEnabled      = mConfig.mTextPluginEnabled;
+    mPluginConfig[TS_HS_TEXT].mOverwrite    = mConfig.mTextPluginOverwriteEnabled;
+    mPluginConfig[TS_HS_TEXT].mBlocking     = mConfig.mTextPluginBlockingEnabled;
+    mPluginConfig[TS_HS_TEXT].mPath         = mConfig.mTextPluginPath;
+    mPluginConfig[TS_HS_TEXT].mFlushPeriod  = mConfig.mTextPluginFlushPeriod;
+    mPluginConfig[TS_HS_TEXT].mRotateSize   = mConfig.mTextPluginRotateSize;
+    mPluginConfig[TS_HS_TEXT].mRotatePeriod = mConfig.mTextPluginRotatePeriod;
+    mPluginConfig[TS_HS_TEXT].mBinary       = mConfig.mTextPluginBinaryEnabled;
 
     // Set up sqlite plugin config
 //    mPluginConfig[TS_HS_SQLITE].mEnabled   = mConfig.mSqlitePluginEnabled;
@@ -154,8 +163,9 @@ void TsHsStdMngr::configure()
     // Initialize the message filter
     mMsgFilter.init();
 
-    // Configure the message queue
-    mMsgQueue.initialize(mConfig.mQueueCapacity, mConfig.mQueueBlockingEnabled);
+    // Configure the message ring. Producers never block on the ring, so the queue blocking config
+    // doesn't apply.
+    mMsgRing.initialize(mConfig.mQueueCapacity);
 
     // Sets the global tsGlobalHsMngr pointer to point to the manager. If more than one manager is
     // created (which should never happen), the pointer will point to the most recent one created.
@@ -169,7 +179,10 @@ void TsHsStdMngr::configure()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Default destructor.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-TsHsStdMngr::~TsHsStdMngr() {}
+TsHsStdMngr::~TsHsStdMngr()
+{
+    pthread_mutex_destroy(&mConsumerLock);
+}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Creates the plugins using config data. Adds plugins to plugin manager and causes it
@@ -191,19 +204,15 @@ void TsHsStdMngr::post_init()
     mImmediateMode = false;
 
     // Debug
-    //    std::cout << "queue size at post init = " << mMsgQueue.getSize() << std::endl;
+    //    std::cout << "queue size at post init = " << mMsgRing.getSize() << std::endl;
     //
     //    int lock_failures = mMsgFilter.getLockFailures();
     //    if (lock_failures > 0)
     //        message_publish(MSG_WARNING, "TsHsMsgStdFilter skipped %d messages due to mutex conflicts\n", lock_failures);
     //
-    //    lock_failures = mMsgQueue.getLockFailures();
-    //    if (lock_failures > 0)
-    //        message_publish(MSG_WARNING, "TsHsMsgQueue skipped %d messages due to mutex conflicts\n", lock_failures);
-    //
-    //    int queue_overwrites = mMsgQueue.getOverflows();
-    //    if (queue_overwrites > 0)
-    //        message_publish(MSG_WARNING, "TsHsMsgQueue overwrote %d messages due to queue overflow\n", queue_overwrites);
+    //    int queue_drops = mMsgRing.getDrops();
+    //    if (queue_drops > 0)
+    //        message_publish(MSG_WARNING, "TsHsMsgRing dropped %d messages due to ring overflow\n", queue_drops);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -224,12 +233,12 @@ void TsHsStdMngr::freeze()
     // Some models run even when in freeze, so queue processing must continue in freeze. It's
     // tempting to invoke inputOutputThread() here. This would work, but would be kludgy. The helper
     // thread job would compete with the freeze job until the former ran out of nodes to process.
-    // There might still be a cycle of overlap, but the queue is thread safe.
+    // There might still be a cycle of overlap, in which the helper thread finishes its last batch.
+    // The message ring only supports a single consumer, so processQueueBatch holds the consumer
+    // lock and the freeze job waits for that batch.
 
-    TsHsMsgQueueNode node;
-    while (!mMsgQueue.isEmpty())
+    while (processQueueBatch() > 0)
     {
-        processQueueNode(node);
     }
 }
 
@@ -326,8 +335,8 @@ void TsHsStdMngr::msg(
     }
     else
     {
-        // Queue the message
-        mMsgQueue.insertMsg(file, line, function, type, truncatedSubsys, mtext, met, timestamp);
+        // Queue the message. If the ring is full the message is dropped and counted.
+        mMsgRing.insertMsg(file, line, function, type, truncatedSubsys, mtext, met, timestamp);
     }
 }
 
@@ -336,33 +345,44 @@ void TsHsStdMngr::msg(
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void TsHsStdMngr::inputOutputThread()
 {
-    TsHsMsgQueueNode node;
-
     // The loop variable is kept true until shutdown. Then it's used to terminate the thread. Trick will
     // not restart an asynchronous thread that terminates during shutdown.
     
     // We let the loop terminate if there is no work to do. Trick will restart it. We do this in hopes that
     // the free up some cpu cycles for other jobs, otherwise we'd spin and burn-up everything.
-    while (mUseHelperThread && !mMsgQueue.isEmpty())
+    while (mUseHelperThread && processQueueBatch() > 0)
     {
-        // Process a queue node, if any. It's okay if the queue is empty.
-        processQueueNode(node);
     }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details Processes an individual message request queue node.
+/// @details Processes a batch of message requests from the head of the message ring. The batch is
+///          released back to the producers only after all of its messages are output. The ring's
+///          batches are single-consumer, so the helper thread, freeze and shutdown jobs take turns
+///          with the consumer lock.
+///
+/// @return Returns the number of message requests processed, zero if the ring was empty.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-void TsHsStdMngr::processQueueNode(TsHsMsgQueueNode& node)
+int TsHsStdMngr::processQueueBatch()
 {
-    if (mMsgQueue.removeMsg(node) != false)
+    pthread_mutex_lock(&mConsumerLock);
+    const int count = mMsgRing.acquireBatch(QUEUE_BATCH_SIZE);
+    for (int i = 0; i < count; ++i)
     {
+        const TsHsMsgRingSlot& node = mMsgRing.getBatchMsg(i);
+
         // Present the message to the filter, and pass it through to mPluginMngr if okay.
-        if (mMsgFilter.shouldSendMessage(node.mMet.seconds, node.mFile, node.mLine, node.mType, node.mSubsys, node.mText))
+        const std::string file(node.mFile);
+        const std::string subsys(node.mSubsys);
+        const std::string text(node.mText);
+        if (mMsgFilter.shouldSendMessage(node.mMet.seconds, file, node.mLine, node.mType, subsys, text))
         {
-            mPluginMngr.msg(node.mFile, node.mLine, node.mFunction, node.mType, node.mSubsys, node.mMet, node.mTimestamp, node.mText);
+            mPluginMngr.msg(file, node.mLine, node.mFunction, node.mType, subsys, node.mMet, node.mTimestamp, text);
         }
     }
+    mMsgRing.releaseBatch();
+    pthread_mutex_unlock(&mConsumerLock);
+    return count;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -383,13 +403,13 @@ void TsHsStdMngr::shutdown()
     // terminates.
     mUseHelperThread = false;
 
-    // It's okay if there is some overlap in which both the helper and shutdown are trying to
-    // process the queue. The queue is thread safe.
+    // The helper thread is a Trick job that we don't own, so we can't join it here. Instead, it
+    // may still be finishing a batch while shutdown starts to process the queue. The message ring
+    // only supports a single consumer, so processQueueBatch holds the consumer lock and shutdown
+    // waits for the helper's batch before draining the rest.
 
-    TsHsMsgQueueNode node;
-    while (!mMsgQueue.isEmpty())
+    while (processQueueBatch() > 0)
     {
-        processQueueNode(node);
     }
 
     int lock_failures = mMsgFilter.getLockFailures();
@@ -399,16 +419,17 @@ void TsHsStdMngr::shutdown()
         message_publish(MSG_WARNING, "TsHsMsgStdFilter skipped %d messages due to mutex conflicts\n", lock_failures);
     }
 
-    lock_failures = mMsgQueue.getLockFailures();
-    if (lock_failures > 0)
+    int queue_drops = mMsgRing.getDrops();
+    if (queue_drops > 0)
     {
-        message_publish(MSG_WARNING, "TsHsMsgQueue skipped %d messages due to mutex conflicts\n", lock_failures);
+        message_publish(MSG_WARNING, "TsHsMsgRing dropped %d messages due to ring overflow, high-water mark %d of %d\n",
+                        queue_drops, mMsgRing.getHighWaterMark(), mMsgRing.getCapacity());
     }
 
-    int queue_overwrites = mMsgQueue.getOverflows();
-    if (queue_overwrites > 0)
+    int queue_truncations = mMsgRing.getTruncations();
+    if (queue_truncations > 0)
     {
-        message_publish(MSG_WARNING, "TsHsMsgQueue overwrote %d messages due to queue overflow\n", queue_overwrites);
+        message_publish(MSG_WARNING, "TsHsMsgRing truncated %d messages to fit its slots\n", queue_truncations);
     }
 
     mPluginMngr.shutdown();
@@ -34,10 +34,11 @@ PROGRAMMERS:
 @{
 */
 
+#include <pthread.h>
 #include "software/SimCompatibility/TsSimCompatibility.hh"
 #include "TsHsMngr.hh"
 #include "TsHsMsgStdFilter.hh"
-#include "TsHsMsgQueue.hh"
+#include "TsHsMsgRing.hh"
 #include "TsHsOutputPlugin.hh"
 #include "TsHsPluginConfig.hh"
 #include "TsHsConfig.hh"
@@ -65,6 +66,9 @@ public:
         TS_HS_CONSOLE = 2
     };
 
+    /// @brief Maximum number of message requests output per batch from the message ring.
+    enum { QUEUE_BATCH_SIZE = 64 };
+
     /// @brief Default constructor.
     TsHsStdMngr();
 
@@ -101,8 +105,8 @@ public:
     /// @brief Processes messages on the message request queue.
     void inputOutputThread();
 
-    /// @brief Processes an individual message request queue node.
-    void processQueueNode(TsHsMsgQueueNode& node);
+    /// @brief Processes a batch of message requests from the message ring.
+    int processQueueBatch();
 
     /// @brief Should be called once to shut down the manager.
     virtual void shutdown();
@@ -115,7 +119,7 @@ public:
     TsHsConfig       mConfig;                        //    (--) Collects configuration info
     TsHsPluginConfig mPluginConfig[HS_NUM_PLUGINS];  //    (--) Plugin status and path info
     TsHsMsgStdFilter mMsgFilter;                     //    (--) The message filter
-    TsHsMsgQueue     mMsgQueue;                      //    (--) The message queue
+    TsHsMsgRing      mMsgRing;                       //    (--) The lock-free message ring
     int              mRequestCount;                  //    (--) The total number of logging request attempts
     bool             mImmediateMode;                 //    (--) Process messages immediately, i.e. do not queue.
     bool             mUseHelperThread;               //    (--) Flag used to stop helper thread during shutdown.
@@ -126,6 +130,7 @@ protected:
     void configure();
 
     TsHsOutputPluginMngr mPluginMngr;                // ** (--) The plugin manager
+    pthread_mutex_t      mConsumerLock;              // ** (--) Serializes the consumers of the message ring
 
 private:
 
@@ -21,13 +21,17 @@ PROGRAMMERS:
    (
      ((Jeffrey Middleton) (L3) (January 2010) (Initial version))
      ((Wesley A. White) (Tietronix Software) (August 2011))
+     ((GUNNS Development Team) (CACI) (October 2026) (Buffered output, rotation and binary records))
    )
 **************************************************************************************************/
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <fstream>
 #include <iomanip>
+#include <cstring>
+#include <ctime>
 #include "sim_services/Message/include/message_proto.h"
 #include "simulation/timer/TS_timer.h"
 #include "TS_hs_msg_types.h"
@@ -61,6 +65,23 @@ static std::string message_timestamp(time_t* unix_time)
    return timestamp.str();
 }
 
+/// @details Binary file header magic.
+const char TsHsTextPlugin::BINARY_MAGIC[8] = {'T', 'S', 'H', 'S', 'L', 'O', 'G', '\0'};
+const int  TsHsTextPlugin::BUFFER_SIZE;
+const int  TsHsTextPlugin::BINARY_VERSION;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Appends the bytes of a value to a binary record, in host byte order.
+///
+/// @param[out] record (--) The record to append to.
+/// @param[in]  value  (--) The value to append.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+static void appendBytes(std::string& record, const T value)
+{
+    record.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Constructor
 ///
@@ -73,7 +94,17 @@ TsHsTextPlugin::TsHsTextPlugin(int id) :
     mOverwrite(true),
     mTryLockFailures(0),
     mResourceLock(),
-    mBlocking(false)
+    mBlocking(false),
+    mFlushPeriod(1.0),
+    mRotateSize(0),
+    mRotatePeriod(0.0),
+    mBinary(false),
+    mFile(0),
+    mBuffer(0),
+    mFileSize(0),
+    mFileOpenTime(0.0),
+    mLastFlushTime(0.0),
+    mRotateCount(0)
 {
     pthread_mutex_init(&mResourceLock, NULL);
 }
@@ -83,7 +114,8 @@ TsHsTextPlugin::TsHsTextPlugin(int id) :
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TsHsTextPlugin::~TsHsTextPlugin()
 {
-    // nothing to do
+    closeFile();
+    delete [] mBuffer;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +129,10 @@ void TsHsTextPlugin::configure(const TsHsPluginConfig& configData)
     mFilename  = configData.mPath;
     mOverwrite = configData.mOverwrite;
     mBlocking  = configData.mBlocking;
+    mFlushPeriod  = configData.mFlushPeriod;
+    mRotateSize   = configData.mRotateSize;
+    mRotatePeriod = configData.mRotatePeriod;
+    mBinary       = configData.mBinary;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -122,9 +158,7 @@ bool TsHsTextPlugin::init(void)
             mFilename += tsHsFileTimestamp();
         }
 
-        FILE* fp = fopen(mFilename.c_str(), "w");
-
-        if (!fp)
+        if (!openFile(true))
         {
             message_publish(MSG_ERROR, "H&S: unable to open '%s' for appending", mFilename.c_str());
             return false;
@@ -132,13 +166,131 @@ bool TsHsTextPlugin::init(void)
         else
         {
             mFirstpass = false;
-            fclose(fp);
         }
     }
+    else if (!mFile and !openFile(false))
+    {
+        message_publish(MSG_ERROR, "H&S: unable to open '%s' for appending", mFilename.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Opens the log file with a large buffer, so that messages are written to the disk in
+///          large blocks. A binary file starts with a header of the magic, the format version and a
+///          byte order marker.
+///
+/// @param[in] truncate (--) Truncate the file if true, else append to it.
+///
+/// @return  True if successful, or false if the file couldn't be opened.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsTextPlugin::openFile(bool truncate)
+{
+    closeFile();
+
+    mFile = fopen(mFilename.c_str(), truncate ? "w" : "a");
+    if (!mFile)
+    {
+        return false;
+    }
+
+    if (!mBuffer)
+    {
+        mBuffer = new char[BUFFER_SIZE];
+    }
+    setvbuf(mFile, mBuffer, _IOFBF, BUFFER_SIZE);
 
+    fseek(mFile, 0, SEEK_END);
+    mFileSize = ftell(mFile);
+    if (mBinary and 0 == mFileSize)
+    {
+        std::string header(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+        appendBytes(header, static_cast<unsigned int>(BINARY_VERSION));
+        appendBytes(header, static_cast<unsigned int>(0x01020304));
+        fwrite(header.data(), 1, header.size(), mFile);
+        mFileSize = static_cast<long>(header.size());
+    }
+
+    mFileOpenTime  = getClockTime();
+    mLastFlushTime = mFileOpenTime;
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Flushes and closes the log file, if open.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsTextPlugin::closeFile()
+{
+    if (mFile)
+    {
+        fclose(mFile);
+        mFile = 0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Closes the log file and renames it with the next sequence number, e.g. name.1, name.2,
+///          then starts a new file under the configured name, so the current log is always found
+///          under the same name.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsTextPlugin::rotateFile()
+{
+    closeFile();
+
+    std::ostringstream rotated;
+    rotated << mFilename << "." << ++mRotateCount;
+    if (0 != rename(mFilename.c_str(), rotated.str().c_str()))
+    {
+        message_publish(MSG_ERROR, "H&S: unable to rotate '%s' to '%s'\n", mFilename.c_str(), rotated.str().c_str());
+    }
+
+    if (!openFile(true))
+    {
+        message_publish(MSG_ERROR, "H&S: unable to open '%s' for appending", mFilename.c_str());
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Returns the monotonic clock time, used to time the flushes and rotations.
+///
+/// @return  The clock time in seconds.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double TsHsTextPlugin::getClockTime()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<double>(now.tv_sec) + 1.0e-9 * static_cast<double>(now.tv_nsec);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Flushes the file buffer if the flush period has elapsed, so that messages reach the file
+///          during quiet periods. Doesn't wait on the helper thread if it's writing, since it will
+///          check the period itself.
+///
+/// @return  True if successful, or false if the file isn't open.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TsHsTextPlugin::update(void)
+{
+    if (!mEnabled)
+    {
+        return true;
+    }
+
+    if (pthread_mutex_trylock(&mResourceLock) == 0) // 0 means lock granted
+    {
+        if (mFile and getClockTime() - mLastFlushTime >= mFlushPeriod)
+        {
+            fflush(mFile);
+            mLastFlushTime = getClockTime();
+        }
+        pthread_mutex_unlock(&mResourceLock);
+    }
+
+    return 0 != mFile;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @details Restarts a plugin.
 ///
@@ -169,8 +321,8 @@ bool TsHsTextPlugin::restart(void)
 ///
 /// @return  True if successful, or false on failure.
 ///
-/// @note    This method opens and closes the log file each time it logs a message. Not very
-///          efficient, but perhaps more robust in multi-threaded sims - TBD?
+/// @note    The message is buffered, and is flushed to the file every flush period. Fatal messages
+///          are flushed immediately since the sim may be terminated.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 bool TsHsTextPlugin::msg(
    const std::string&   file,
@@ -187,6 +339,76 @@ bool TsHsTextPlugin::msg(
         return true;
     }
 
+    // Format the message outside of the lock.
+    std::string entry;
+    if (mBinary)
+    {
+        formatBinary(entry, file, line, function, type, subsys, met, timestamp, mtext);
+    }
+    else
+    {
+        entry = formatText(file, line, function, type, subsys, met, timestamp, mtext);
+        entry += '\n';
+    }
+
+    if (mBlocking)
+    {
+        // We will wait if necessary, no messages will be lost.
+        if (pthread_mutex_lock(&mResourceLock) == 0) // 0 means lock granted
+        {
+            insertMessage(entry);
+            if (TS_HS_FATAL == type and mFile)
+            {
+                fflush(mFile);
+            }
+            pthread_mutex_unlock(&mResourceLock);
+        }
+    }
+    else
+    {
+        // Don't wait. Discard message if resource conflict.
+        if (pthread_mutex_trylock(&mResourceLock) == 0) // 0 means lock granted
+        {
+            insertMessage(entry);
+            if (TS_HS_FATAL == type and mFile)
+            {
+                fflush(mFile);
+            }
+            pthread_mutex_unlock(&mResourceLock);
+        }
+        else
+        {
+            mTryLockFailures++;
+        }
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Formats a health and status message as a text log line, without the newline.
+///
+/// @param   [in] file      (--) name of file which initiated logging the message.
+/// @param   [in] line      (--) line of file which initiated logging the message.
+/// @param   [in] function  (--) The name of the function logging the message.
+/// @param   [in] type      (--) the type of message (e.g. info, warning, etc.).
+/// @param   [in] subsys    (--) the subsystem from which the message originated.
+/// @param   [in] met       (--) the mission-elapsed time that the message was sent.
+/// @param   [in] timestamp (--) the unix timestamp that the message was sent.
+/// @param   [in] mtext     (--) the message text.
+///
+/// @return  The text line.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string TsHsTextPlugin::formatText(
+   const std::string&   file,
+   const int            line,
+   const std::string&   function,
+   TS_HS_MSG_TYPE       type,
+   const std::string&   subsys,
+   const TS_TIMER_TYPE& met,
+   unsigned long        timestamp,
+   const std::string&   mtext)
+{
     // Use some std things to make the code more readable
     using std::setw;
     using std::setfill;
@@ -234,51 +456,96 @@ bool TsHsTextPlugin::msg(
     // Print user message
     logentry << mtext; // << std::endl;
 
-    if (mBlocking)
-    {
-        // We will wait if necessary, no messages will be lost.
-        if (pthread_mutex_lock(&mResourceLock) == 0) // 0 means lock granted
-        {
-            insertMessage(logentry.str());
-            pthread_mutex_unlock(&mResourceLock);
-        }
-    }
-    else
-    {
-        // Don't wait. Discard message if resource conflict.
-        if (pthread_mutex_trylock(&mResourceLock) == 0) // 0 means lock granted
-        {
-            insertMessage(logentry.str());
-            pthread_mutex_unlock(&mResourceLock);
-        }
-        else
-        {
-            mTryLockFailures++;
-        }
-    }
+    return logentry.str();
+}
 
-    return true;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Encodes a health and status message as a compact binary record, in host byte order:
+///          the record length after this field (uint32), type, line, MET pre, day, hour, min and
+///          sec (int32 each), timestamp (uint64), the subsystem, file and function lengths
+///          (uint16 each) and text length (uint32), followed by those strings without terminators.
+///
+/// @param   [out] record   (--) the encoded record, reusing its storage.
+/// @param   [in] file      (--) name of file which initiated logging the message.
+/// @param   [in] line      (--) line of file which initiated logging the message.
+/// @param   [in] function  (--) The name of the function logging the message.
+/// @param   [in] type      (--) the type of message (e.g. info, warning, etc.).
+/// @param   [in] subsys    (--) the subsystem from which the message originated.
+/// @param   [in] met       (--) the mission-elapsed time that the message was sent.
+/// @param   [in] timestamp (--) the unix timestamp that the message was sent.
+/// @param   [in] mtext     (--) the message text.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TsHsTextPlugin::formatBinary(
+   std::string&         record,
+   const std::string&   file,
+   const int            line,
+   const std::string&   function,
+   TS_HS_MSG_TYPE       type,
+   const std::string&   subsys,
+   const TS_TIMER_TYPE& met,
+   unsigned long        timestamp,
+   const std::string&   mtext)
+{
+    // Strings longer than their length fields are truncated.
+    const unsigned short subsysLength   = static_cast<unsigned short>(std::min<size_t>(subsys.size(),   0xFFFF));
+    const unsigned short fileLength     = static_cast<unsigned short>(std::min<size_t>(file.size(),     0xFFFF));
+    const unsigned short functionLength = static_cast<unsigned short>(std::min<size_t>(function.size(), 0xFFFF));
+    const unsigned int   textLength     = static_cast<unsigned int>(mtext.size());
+
+    record.clear();
+    appendBytes(record, static_cast<unsigned int>(0));
+    appendBytes(record, static_cast<int>(type));
+    appendBytes(record, static_cast<int>(line));
+    appendBytes(record, static_cast<int>(met.pre));
+    appendBytes(record, static_cast<int>(met.day));
+    appendBytes(record, static_cast<int>(met.hour));
+    appendBytes(record, static_cast<int>(met.min));
+    appendBytes(record, static_cast<int>(met.sec));
+    appendBytes(record, static_cast<unsigned long long>(timestamp));
+    appendBytes(record, subsysLength);
+    appendBytes(record, fileLength);
+    appendBytes(record, functionLength);
+    appendBytes(record, textLength);
+    record.append(subsys.data(),   subsysLength);
+    record.append(file.data(),     fileLength);
+    record.append(function.data(), functionLength);
+    record.append(mtext.data(),    textLength);
+
+    const unsigned int length = static_cast<unsigned int>(record.size() - sizeof(unsigned int));
+    memcpy(&record[0], &length, sizeof(length));
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// @details Shutdown the text plugin
+/// @details Writes a formatted message to the log file buffer, then flushes the buffer if the flush
+///          period has elapsed, and rotates the file if it has reached the rotation size or age.
+///
+/// @param[in] message (--) The formatted text line or binary record.
+///
+/// @return  True if successful, or false if the file isn't open.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 bool TsHsTextPlugin::insertMessage(const std::string& message)
 {
-    // Open the file in append mode
-    std::ofstream logfile(mFilename.c_str(), std::ios::out | std::ios::app);
-
-    if (!logfile)
+    if (!mFile)
     {
         // The following would be a useful messages, but it might be displayed many times - for now turn it off.
         //message_publish(MSG_ERROR, "H&S: unable to open '%s' for appending", mFilename);
         return false;
     }
 
-    logfile << message << std::endl;
+    fwrite(message.data(), 1, message.size(), mFile);
+    mFileSize += static_cast<long>(message.size());
 
-    // Close logfile
-    logfile.close();
+    const double now = getClockTime();
+    if ((mRotateSize > 0 and mFileSize >= mRotateSize) or
+        (mRotatePeriod > 0.0 and now - mFileOpenTime >= mRotatePeriod))
+    {
+        rotateFile();
+    }
+    else if (now - mLastFlushTime >= mFlushPeriod)
+    {
+        fflush(mFile);
+        mLastFlushTime = now;
+    }
 
     return true;
 }
@@ -288,6 +555,13 @@ bool TsHsTextPlugin::insertMessage(const std::string& message)
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void TsHsTextPlugin::shutdown(void)
 {
+    // Wait on any threads that may still be logging messages
+    if (pthread_mutex_lock(&mResourceLock) == 0) // 0 means lock granted
+    {
+        closeFile();
+        pthread_mutex_unlock(&mResourceLock);
+    }
+
     if (mTryLockFailures > 0)
     {
         message_publish(MSG_WARNING, "TsHsTextPlugin skipped %d messages due to mutex conflicts\n", mTryLockFailures);
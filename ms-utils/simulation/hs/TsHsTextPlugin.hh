@@ -11,12 +11,18 @@
 @details
 PURPOSE:
 - (Component of the Health & Status message framework. An output plugin that outputs to a text file.)
+- (The file is kept open with a large buffer, which is flushed every flush period, on a fatal
+   message, and at shutdown. The file can be rotated when it reaches a size or age: it's renamed
+   with a sequence number suffix and a new file is started under the configured name.)
+- (Optionally, compact binary records are written instead of text lines, to save formatting time
+   and file size. The bin/utils/hs_log_convert.py script converts them to the text lines.)
 
 REFERENCE:
 - (TBD)
 
 ASSUMPTIONS AND LIMITATIONS:
-- (TBD)
+- (Messages still in the buffer are lost if the process dies before a flush.)
+- (Binary records are in host byte order; the file header marks the order for the converter.)
 
 LIBRARY DEPENDENCY:
 - (
@@ -27,11 +33,14 @@ PROGRAMMERS:
 - (
      ((Jeffrey Middleton) (L3) (January 2010) (Initial version))
      ((Wesley A. White) (Tietronix Software) (August 2011))
+     ((GUNNS Development Team) (CACI) (October 2026) (Buffered output, rotation and binary records))
   )
 
 @{
 */
 
+#include <cstdio>
+#include <pthread.h>
 #include <string>
 #include "TsHsOutputPlugin.hh"
 #include "TsHsPluginConfig.hh"
@@ -58,22 +67,61 @@ public:
     /// @brief Restarts a plugin
     virtual bool restart(void);
 
+    /// @brief Flushes the file buffer if the flush period has elapsed.
+    virtual bool update(void);
+
     /// @brief Logs a message to a text file
     virtual bool msg(const std::string& file, const int line, const std::string& function, TS_HS_MSG_TYPE type, const std::string& subsys,
                      const TS_TIMER_TYPE& met, unsigned long timestamp, const std::string& hsmsg);
 
     virtual void shutdown(void);
 
+    /// @brief Size of the file buffer in bytes.
+    static const int  BUFFER_SIZE = 1048576;
+    /// @brief Binary file header magic, and format version.
+    static const char BINARY_MAGIC[8];
+    static const int  BINARY_VERSION = 1;
+
 protected:
 
     bool insertMessage(const std::string& message);
 
+    /// @brief Formats a message as a text line, without the newline.
+    static std::string formatText(const std::string& file, const int line, const std::string& function, TS_HS_MSG_TYPE type,
+                                  const std::string& subsys, const TS_TIMER_TYPE& met, unsigned long timestamp, const std::string& mtext);
+
+    /// @brief Encodes a message as a binary record.
+    static void formatBinary(std::string& record, const std::string& file, const int line, const std::string& function, TS_HS_MSG_TYPE type,
+                             const std::string& subsys, const TS_TIMER_TYPE& met, unsigned long timestamp, const std::string& mtext);
+
+    /// @brief Opens the log file, truncating it or appending to it.
+    bool openFile(bool truncate);
+
+    /// @brief Flushes and closes the log file.
+    void closeFile();
+
+    /// @brief Renames the log file with the next sequence number and starts a new one.
+    void rotateFile();
+
+    /// @brief Returns the monotonic clock time.
+    static double getClockTime();
+
     std::string     mFilename;        // ** (--) Output file name
     bool            mFirstpass;       // ** (--) Used to determine when to create a new file
     bool            mOverwrite;       // ** (--) Overwrite file or use multiple files with timestamps
     int             mTryLockFailures; // ** (--) Number of times trylock failed to get the lock (== number of dropped messages)
     pthread_mutex_t mResourceLock;    // ** (--) Mutex which controls access to database files
     bool            mBlocking;        // ** (--) Wait on mutex if true, else skip message
+    double          mFlushPeriod;     // ** (s)  Longest time a message waits in the file buffer
+    long            mRotateSize;      // ** (--) File size in bytes at which the file is rotated, 0 for no limit
+    double          mRotatePeriod;    // ** (s)  Time after which the file is rotated, 0 for no limit
+    bool            mBinary;          // ** (--) Write binary records instead of text lines
+    FILE*           mFile;            // ** (--) The open log file
+    char*           mBuffer;          // ** (--) The log file buffer
+    long            mFileSize;        // ** (--) Number of bytes written to the open log file
+    double          mFileOpenTime;    // ** (s)  Clock time the open log file was started
+    double          mLastFlushTime;   // ** (s)  Clock time the log file was last flushed
+    int             mRotateCount;     // ** (--) Number of times the log file was rotated
 
 private:
 
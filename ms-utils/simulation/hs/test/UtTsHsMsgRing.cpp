@@ -0,0 +1,245 @@
+/********************************* TRICK HEADER *******************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Unit test class for TsHsMsgRing class)
+
+LIBRARY DEPENDENCY:
+(
+    (simulation/hs/TsHsMsgRing.o)
+)
+
+PROGRAMMERS:
+(
+    ((GUNNS Development Team) (CACI) (October 2026))
+)
+*******************************************************************************/
+
+#include <cstdlib>
+#include <pthread.h>
+#include <sstream>
+#include <string>
+#include "UtTsHsMsgRing.hh"
+
+const int UtTsHsMsgRing::NUM_PRODUCERS;
+const int UtTsHsMsgRing::NUM_MESSAGES;
+
+/// @brief Arguments for a producer thread in the multiple producer test.
+struct UtTsHsMsgRingProducer
+{
+    TsHsMsgRing* ring;     // Ring to insert into
+    int          id;       // Producer number, used as the message line number
+    int          dropped;  // Number of the producer's messages that were dropped
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Producer thread for the multiple producer test. Inserts numbered messages as fast as it
+///          can, retrying dropped messages so that every message eventually gets through.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void* utTsHsMsgRingProduce(void* arg)
+{
+    UtTsHsMsgRingProducer* producer = static_cast<UtTsHsMsgRingProducer*>(arg);
+    TS_TIMER_TYPE met = {0, 0, 0, 0, 0, 0.0, 0};
+    for (int i = 0; i < UtTsHsMsgRing::NUM_MESSAGES; ++i) {
+        std::ostringstream text;
+        text << i;
+        while (!producer->ring->insertMsg(__FILE__, producer->id, __func__, TS_HS_INFO,
+                                          TS_HS_GENERIC, text.str(), met, 0)) {
+            producer->dropped++;
+        }
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Required by cppunit. Called at the beginning of each testXXX method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgRing::setUp()
+{
+    // Initially start with capacity for 4 messages.
+    msgRing = new TsHsMsgRing(4);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Required by cppunit. Called at the end of each testXXX method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgRing::tearDown()
+{
+    delete msgRing;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Inserts a message with the given text into the test ring.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UtTsHsMsgRing::insert(const std::string& text)
+{
+    TS_TIMER_TYPE met = {0, 0, 0, 0, 0, 0.0, 0};
+    return msgRing->insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, text, met, 1L);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test construction of the message ring object, and rounding of its capacity.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgRing::testConstructors()
+{
+    CPPUNIT_ASSERT_EQUAL(4,     msgRing->getCapacity());
+    CPPUNIT_ASSERT_EQUAL(0,     msgRing->getSize());
+    CPPUNIT_ASSERT_EQUAL(0,     msgRing->getDrops());
+    CPPUNIT_ASSERT_EQUAL(0,     msgRing->getTruncations());
+    CPPUNIT_ASSERT_EQUAL(0,     msgRing->getHighWaterMark());
+    CPPUNIT_ASSERT_EQUAL(true,  msgRing->isEmpty());
+    CPPUNIT_ASSERT_EQUAL(0,     msgRing->acquireBatch(10));
+
+    // Capacity is rounded up to a power of 2.
+    msgRing->initialize(5);
+    CPPUNIT_ASSERT_EQUAL(8,     msgRing->getCapacity());
+    msgRing->initialize(0);
+    CPPUNIT_ASSERT_EQUAL(2,     msgRing->getCapacity());
+
+    // A default constructed ring drops messages until it's initialized.
+    TsHsMsgRing ring;
+    TS_TIMER_TYPE met = {0, 0, 0, 0, 0, 0.0, 0};
+    CPPUNIT_ASSERT_EQUAL(0,     ring.getCapacity());
+    CPPUNIT_ASSERT_EQUAL(true,  ring.isEmpty());
+    CPPUNIT_ASSERT_EQUAL(false, ring.insertMsg(__FILE__, __LINE__, __func__, TS_HS_INFO, TS_HS_GENERIC, "x", met, 0));
+    CPPUNIT_ASSERT_EQUAL(1,     ring.getDrops());
+    CPPUNIT_ASSERT_EQUAL(0,     ring.acquireBatch(1));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test messages are drained in batches in the order they're inserted, and the fields are
+///          copied into the slots.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgRing::testBatches()
+{
+    CPPUNIT_ASSERT_EQUAL(true,  insert("this is message 1"));
+    CPPUNIT_ASSERT_EQUAL(true,  insert("this is message 2"));
+    CPPUNIT_ASSERT_EQUAL(true,  insert("this is message 3"));
+    CPPUNIT_ASSERT_EQUAL(3,     msgRing->getSize());
+    CPPUNIT_ASSERT_EQUAL(3,     msgRing->getHighWaterMark());
+    CPPUNIT_ASSERT_EQUAL(false, msgRing->isEmpty());
+
+    // Acquire a partial batch.
+    CPPUNIT_ASSERT_EQUAL(2,     msgRing->acquireBatch(2));
+    const TsHsMsgRingSlot& slot = msgRing->getBatchMsg(0);
+    CPPUNIT_ASSERT_EQUAL(std::string("this is message 1"), std::string(slot.mText));
+    CPPUNIT_ASSERT_EQUAL(std::string(__FILE__),            std::string(slot.mFile));
+    CPPUNIT_ASSERT_EQUAL(std::string("insert"),            std::string(slot.mFunction));
+    CPPUNIT_ASSERT_EQUAL(std::string(TS_HS_GENERIC),       std::string(slot.mSubsys));
+    CPPUNIT_ASSERT_EQUAL(TS_HS_INFO,                       slot.mType);
+    CPPUNIT_ASSERT_EQUAL(1UL,                              slot.mTimestamp);
+    CPPUNIT_ASSERT_EQUAL(std::string("this is message 2"), std::string(msgRing->getBatchMsg(1).mText));
+    msgRing->releaseBatch();
+    CPPUNIT_ASSERT_EQUAL(1,     msgRing->getSize());
+
+    // Wrap around the ring.
+    CPPUNIT_ASSERT_EQUAL(true,  insert("this is message 4"));
+    CPPUNIT_ASSERT_EQUAL(true,  insert("this is message 5"));
+    CPPUNIT_ASSERT_EQUAL(true,  insert("this is message 6"));
+    CPPUNIT_ASSERT_EQUAL(4,     msgRing->getHighWaterMark());
+    CPPUNIT_ASSERT_EQUAL(4,     msgRing->acquireBatch(10));
+    for (int i = 0; i < 4; ++i) {
+        std::ostringstream text;
+        text << "this is message " << i + 3;
+        CPPUNIT_ASSERT_EQUAL(text.str(), std::string(msgRing->getBatchMsg(i).mText));
+    }
+    msgRing->releaseBatch();
+    CPPUNIT_ASSERT_EQUAL(true,  msgRing->isEmpty());
+    CPPUNIT_ASSERT_EQUAL(0,     msgRing->acquireBatch(10));
+    msgRing->releaseBatch();
+    CPPUNIT_ASSERT_EQUAL(0,     msgRing->getDrops());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details See what happens when the number of messages inserted exceeds the ring's capacity.
+///          What should happen is that the newer messages are dropped and counted, since producers
+///          don't take slots back from the consumer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgRing::testOverflow()
+{
+    CPPUNIT_ASSERT_EQUAL(true,  insert("this is message 1"));
+    CPPUNIT_ASSERT_EQUAL(true,  insert("this is message 2"));
+    CPPUNIT_ASSERT_EQUAL(true,  insert("this is message 3"));
+    CPPUNIT_ASSERT_EQUAL(true,  insert("this is message 4"));
+    CPPUNIT_ASSERT_EQUAL(false, insert("this is message 5"));
+    CPPUNIT_ASSERT_EQUAL(false, insert("this is message 6"));
+    CPPUNIT_ASSERT_EQUAL(2,     msgRing->getDrops());
+    CPPUNIT_ASSERT_EQUAL(4,     msgRing->getHighWaterMark());
+
+    CPPUNIT_ASSERT_EQUAL(4,     msgRing->acquireBatch(10));
+    CPPUNIT_ASSERT_EQUAL(std::string("this is message 1"), std::string(msgRing->getBatchMsg(0).mText));
+    CPPUNIT_ASSERT_EQUAL(std::string("this is message 4"), std::string(msgRing->getBatchMsg(3).mText));
+
+    // The ring stays full until the batch is released.
+    CPPUNIT_ASSERT_EQUAL(false, insert("this is message 7"));
+    msgRing->releaseBatch();
+    CPPUNIT_ASSERT_EQUAL(true,  insert("this is message 8"));
+    CPPUNIT_ASSERT_EQUAL(3,     msgRing->getDrops());
+
+    // Re-initialization discards queued messages but keeps the counters.
+    msgRing->initialize(4);
+    CPPUNIT_ASSERT_EQUAL(true,  msgRing->isEmpty());
+    CPPUNIT_ASSERT_EQUAL(3,     msgRing->getDrops());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test messages too long for the slot fields are truncated and counted.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgRing::testTruncation()
+{
+    const std::string fits(TsHsMsgRingSlot::TEXT_SIZE - 1, 'a');
+    const std::string tooLong(TsHsMsgRingSlot::TEXT_SIZE, 'b');
+    CPPUNIT_ASSERT_EQUAL(true,  insert(fits));
+    CPPUNIT_ASSERT_EQUAL(0,     msgRing->getTruncations());
+    CPPUNIT_ASSERT_EQUAL(true,  insert(tooLong));
+    CPPUNIT_ASSERT_EQUAL(1,     msgRing->getTruncations());
+
+    CPPUNIT_ASSERT_EQUAL(2,     msgRing->acquireBatch(2));
+    CPPUNIT_ASSERT_EQUAL(fits,  std::string(msgRing->getBatchMsg(0).mText));
+    CPPUNIT_ASSERT_EQUAL(tooLong.substr(0, TsHsMsgRingSlot::TEXT_SIZE - 1),
+                         std::string(msgRing->getBatchMsg(1).mText));
+    msgRing->releaseBatch();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test several producer threads inserting concurrently while this thread drains the ring
+///          in batches. Every message must come through exactly once, in order per producer.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsMsgRing::testMultipleProducers()
+{
+    msgRing->initialize(64);
+
+    UtTsHsMsgRingProducer producers[NUM_PRODUCERS];
+    pthread_t             threads[NUM_PRODUCERS];
+    for (int p = 0; p < NUM_PRODUCERS; ++p) {
+        producers[p].ring    = msgRing;
+        producers[p].id      = p;
+        producers[p].dropped = 0;
+        CPPUNIT_ASSERT_EQUAL(0, pthread_create(&threads[p], 0, utTsHsMsgRingProduce, &producers[p]));
+    }
+
+    int next[NUM_PRODUCERS] = {0};
+    int received = 0;
+    while (received < NUM_PRODUCERS * NUM_MESSAGES) {
+        const int count = msgRing->acquireBatch(16);
+        for (int i = 0; i < count; ++i) {
+            const TsHsMsgRingSlot& slot = msgRing->getBatchMsg(i);
+            CPPUNIT_ASSERT(slot.mLine >= 0 and slot.mLine < NUM_PRODUCERS);
+            CPPUNIT_ASSERT_EQUAL(next[slot.mLine], atoi(slot.mText));
+            next[slot.mLine]++;
+        }
+        msgRing->releaseBatch();
+        received += count;
+    }
+
+    int dropped = 0;
+    for (int p = 0; p < NUM_PRODUCERS; ++p) {
+        pthread_join(threads[p], 0);
+        CPPUNIT_ASSERT_EQUAL(NUM_MESSAGES, next[p]);
+        dropped += producers[p].dropped;
+    }
+    CPPUNIT_ASSERT_EQUAL(true,    msgRing->isEmpty());
+    CPPUNIT_ASSERT_EQUAL(dropped, msgRing->getDrops());
+    CPPUNIT_ASSERT(msgRing->getHighWaterMark() <= 64);
+}
@@ -0,0 +1,71 @@
+/********************************* TRICK HEADER *******************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Unit test class for TsHsMsgRing class)
+
+LIBRARY DEPENDENCY:
+(
+    (simulation/hs/TsHsMsgRing.o)
+)
+
+PROGRAMMERS:
+(
+    ((GUNNS Development Team) (CACI) (October 2026))
+)
+*******************************************************************************/
+#ifndef UtTsHsMsgRing_EXISTS
+#define UtTsHsMsgRing_EXISTS
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+
+#include "TsHsMsgRing.hh"
+
+/// @brief Unit test for TsHsMsgRing, i.e. the health and status lock-free message ring
+class UtTsHsMsgRing: public CppUnit::TestFixture
+{
+public:
+
+    // Ctor not really needed here, but gets rid of some compiler warnings
+    UtTsHsMsgRing() : CppUnit::TestFixture(), msgRing(0) {}
+
+    void setUp();
+    void tearDown();
+
+    void testConstructors();
+    void testBatches();
+    void testOverflow();
+    void testTruncation();
+    void testMultipleProducers();
+
+    /// @brief Number of producer threads in the multiple producer test.
+    static const int NUM_PRODUCERS = 4;
+    /// @brief Number of messages each producer inserts in the multiple producer test.
+    static const int NUM_MESSAGES  = 5000;
+
+private:
+
+    CPPUNIT_TEST_SUITE(UtTsHsMsgRing);
+
+    CPPUNIT_TEST(testConstructors);
+    CPPUNIT_TEST(testBatches);
+    CPPUNIT_TEST(testOverflow);
+    CPPUNIT_TEST(testTruncation);
+    CPPUNIT_TEST(testMultipleProducers);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    /// @brief Inserts a message with the given text.
+    bool insert(const std::string& text);
+
+    // Data members
+    TsHsMsgRing* msgRing;
+
+    // Disable these to prevent compiler warnings about them being not implemented
+    UtTsHsMsgRing(const UtTsHsMsgRing&);
+    const UtTsHsMsgRing& operator=(const UtTsHsMsgRing&);
+};
+
+#endif /* UtTsHsMsgRing_EXISTS */
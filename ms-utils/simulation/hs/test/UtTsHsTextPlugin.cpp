@@ -0,0 +1,293 @@
+/********************************* TRICK HEADER *******************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Unit test class for TsHsTextPlugin class)
+
+LIBRARY DEPENDENCY:
+(
+    (simulation/hs/TsHsTextPlugin.o)
+)
+
+PROGRAMMERS:
+(
+    ((GUNNS Development Team) (CACI) (October 2026))
+)
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include "UtTsHsTextPlugin.hh"
+
+const int UtTsHsTextPlugin::MAX_ROTATIONS;
+
+/// @brief Log file name used by the tests, in the test directory.
+static const char* const UT_TS_HS_TEXT_PLUGIN_FILE = "UtTsHsTextPlugin.log";
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Reads a value from the given position of a binary record, in host byte order, and
+///          advances the position.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+static T utTsHsTextPluginRead(const std::string& data, size_t& pos)
+{
+    T value;
+    memcpy(&value, data.data() + pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Required by cppunit. Called at the beginning of each testXXX method.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsTextPlugin::setUp()
+{
+    config            = TsHsPluginConfig();
+    config.mEnabled   = true;
+    config.mBlocking  = true;
+    config.mOverwrite = true;
+    config.mPath      = UT_TS_HS_TEXT_PLUGIN_FILE;
+    plugin = new FriendlyTsHsTextPlugin();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Required by cppunit. Called at the end of each testXXX method. Removes the log files.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsTextPlugin::tearDown()
+{
+    delete plugin;
+    for (int rotation = 0; rotation <= MAX_ROTATIONS; ++rotation)
+    {
+        remove(rotatedName(rotation).c_str());
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Logs a numbered message to the test plugin. The message texts are all the same length,
+///          so each text line is the same length.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsTextPlugin::logMessage(const int number)
+{
+    std::ostringstream text;
+    text << "message " << std::setw(2) << std::setfill('0') << number;
+    TS_TIMER_TYPE met = {1, 2, 3, 4, number, 0.0, 0};
+    plugin->msg("file.cpp", number, "function", TS_HS_WARNING, TS_HS_GENERIC, met, 1700000000UL, text.str());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Returns the text line the plugin writes for the given numbered message.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string UtTsHsTextPlugin::messageLine(const int number) const
+{
+    std::ostringstream text;
+    text << "message " << std::setw(2) << std::setfill('0') << number;
+    TS_TIMER_TYPE met = {1, 2, 3, 4, number, 0.0, 0};
+    return TsHsTextPlugin::formatText("file.cpp", number, "function", TS_HS_WARNING, TS_HS_GENERIC, met, 1700000000UL, text.str());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Returns the name of the given rotated log file, name.1, name.2, etc., or the current
+///          log file name for rotation zero.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string UtTsHsTextPlugin::rotatedName(const int rotation) const
+{
+    std::ostringstream name;
+    name << UT_TS_HS_TEXT_PLUGIN_FILE;
+    if (rotation > 0)
+    {
+        name << "." << rotation;
+    }
+    return name.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Returns the whole contents of the given file.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string UtTsHsTextPlugin::readFile(const std::string& name)
+{
+    std::ifstream file(name.c_str(), std::ios::in | std::ios::binary);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Returns whether the given file exists.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UtTsHsTextPlugin::fileExists(const std::string& name)
+{
+    std::ifstream file(name.c_str());
+    return file.good();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test the log file is rotated when it reaches the rotation size, and not before.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsTextPlugin::testRotateSize()
+{
+    // Rotate when the file holds 3 lines.
+    const long lineSize = static_cast<long>(messageLine(0).size()) + 1;
+    config.mRotateSize  = 3 * lineSize;
+    plugin->configure(config);
+    CPPUNIT_ASSERT_EQUAL(true, plugin->init());
+
+    // The file isn't rotated below the limit.
+    logMessage(0);
+    logMessage(1);
+    CPPUNIT_ASSERT_EQUAL(0,            plugin->mRotateCount);
+    CPPUNIT_ASSERT_EQUAL(2 * lineSize, plugin->mFileSize);
+    CPPUNIT_ASSERT_EQUAL(false,        fileExists(rotatedName(1)));
+
+    // The file is rotated when a message reaches the limit, and a new empty file is started.
+    logMessage(2);
+    CPPUNIT_ASSERT_EQUAL(1,            plugin->mRotateCount);
+    CPPUNIT_ASSERT_EQUAL(0L,           plugin->mFileSize);
+    CPPUNIT_ASSERT_EQUAL(true,         fileExists(rotatedName(1)));
+    CPPUNIT_ASSERT_EQUAL(std::string(""), readFile(rotatedName(0)));
+
+    const std::string rotated = readFile(rotatedName(1));
+    CPPUNIT_ASSERT_EQUAL(3 * lineSize, static_cast<long>(rotated.size()));
+    CPPUNIT_ASSERT_EQUAL(messageLine(0) + "\n" + messageLine(1) + "\n" + messageLine(2) + "\n", rotated);
+
+    // A size of zero never rotates.
+    delete plugin;
+    plugin = new FriendlyTsHsTextPlugin();
+    config.mRotateSize = 0;
+    plugin->configure(config);
+    CPPUNIT_ASSERT_EQUAL(true, plugin->init());
+    for (int i = 0; i < 10; ++i)
+    {
+        logMessage(i);
+    }
+    CPPUNIT_ASSERT_EQUAL(0,             plugin->mRotateCount);
+    CPPUNIT_ASSERT_EQUAL(10 * lineSize, plugin->mFileSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test the rotated files are named with increasing sequence numbers, oldest first, the
+///          number of rotated files, and that no messages are lost or reordered across them.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsTextPlugin::testRotateNaming()
+{
+    // Rotate every 3 lines, and log 10 messages, for 3 rotated files and 1 line in the current file.
+    const long lineSize = static_cast<long>(messageLine(0).size()) + 1;
+    config.mRotateSize  = 3 * lineSize;
+    plugin->configure(config);
+    CPPUNIT_ASSERT_EQUAL(true, plugin->init());
+    for (int i = 0; i < 10; ++i)
+    {
+        logMessage(i);
+    }
+    plugin->shutdown();
+
+    CPPUNIT_ASSERT_EQUAL(3,     plugin->mRotateCount);
+    CPPUNIT_ASSERT_EQUAL(true,  fileExists(rotatedName(1)));
+    CPPUNIT_ASSERT_EQUAL(true,  fileExists(rotatedName(2)));
+    CPPUNIT_ASSERT_EQUAL(true,  fileExists(rotatedName(3)));
+    CPPUNIT_ASSERT_EQUAL(false, fileExists(rotatedName(4)));
+
+    // The rotated files in order, followed by the current file, have all the messages in order.
+    std::string expected;
+    for (int i = 0; i < 10; ++i)
+    {
+        expected += messageLine(i) + "\n";
+    }
+    std::string actual;
+    for (int rotation = 1; rotation <= 3; ++rotation)
+    {
+        const std::string contents = readFile(rotatedName(rotation));
+        CPPUNIT_ASSERT_EQUAL(3 * lineSize, static_cast<long>(contents.size()));
+        actual += contents;
+    }
+    const std::string current = readFile(rotatedName(0));
+    CPPUNIT_ASSERT_EQUAL(messageLine(9) + "\n", current);
+    actual += current;
+    CPPUNIT_ASSERT_EQUAL(expected, actual);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details Test binary records are written with the file header and decode back to the logged
+///          message fields, which format to the same text lines as the text log.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UtTsHsTextPlugin::testBinaryRoundTrip()
+{
+    config.mBinary = true;
+    plugin->configure(config);
+    CPPUNIT_ASSERT_EQUAL(true, plugin->init());
+
+    // Messages with varied fields, including a pre-launch MET and an empty function name.
+    const int            numMessages = 3;
+    const char*          files[numMessages]     = {"file.cpp", "other/path/file2.hh", "x.c"};
+    const int            lines[numMessages]     = {12, 3456, 0};
+    const char*          functions[numMessages] = {"function", "", "f"};
+    const TS_HS_MSG_TYPE types[numMessages]     = {TS_HS_INFO, TS_HS_ERROR, TS_HS_FATAL};
+    const char*          subsys[numMessages]    = {TS_HS_GENERIC, "THERMAL", "a subsystem"};
+    const TS_TIMER_TYPE  mets[numMessages]      = {{ 1, 0,  0,  0,  1,     1.0, 0},
+                                                   {-1, 3, 23, 59, 58, -345598.0, 0},
+                                                   { 1, 9,  8,  7,  6,     0.0, 0}};
+    const unsigned long  stamps[numMessages]    = {0UL, 1700000000UL, 4000000000UL};
+    const char*          texts[numMessages]     = {"first message", "second | message\twith tab", ""};
+    for (int i = 0; i < numMessages; ++i)
+    {
+        plugin->msg(files[i], lines[i], functions[i], types[i], subsys[i], mets[i], stamps[i], texts[i]);
+    }
+    plugin->shutdown();
+
+    // Verify the file header.
+    const std::string data = readFile(rotatedName(0));
+    size_t pos = sizeof(TsHsTextPlugin::BINARY_MAGIC);
+    CPPUNIT_ASSERT(data.size() > pos + 2 * sizeof(unsigned int));
+    CPPUNIT_ASSERT_EQUAL(0, memcmp(data.data(), TsHsTextPlugin::BINARY_MAGIC, sizeof(TsHsTextPlugin::BINARY_MAGIC)));
+    CPPUNIT_ASSERT_EQUAL(static_cast<unsigned int>(TsHsTextPlugin::BINARY_VERSION), utTsHsTextPluginRead<unsigned int>(data, pos));
+    CPPUNIT_ASSERT_EQUAL(0x01020304U, utTsHsTextPluginRead<unsigned int>(data, pos));
+
+    // Decode each record and verify its fields.
+    for (int i = 0; i < numMessages; ++i)
+    {
+        const unsigned int length = utTsHsTextPluginRead<unsigned int>(data, pos);
+        const size_t       end    = pos + length;
+        CPPUNIT_ASSERT(end <= data.size());
+
+        TS_TIMER_TYPE met = {0, 0, 0, 0, 0, 0.0, 0};
+        const TS_HS_MSG_TYPE type = static_cast<TS_HS_MSG_TYPE>(utTsHsTextPluginRead<int>(data, pos));
+        const int line       = utTsHsTextPluginRead<int>(data, pos);
+        met.pre              = utTsHsTextPluginRead<int>(data, pos);
+        met.day              = utTsHsTextPluginRead<int>(data, pos);
+        met.hour             = utTsHsTextPluginRead<int>(data, pos);
+        met.min              = utTsHsTextPluginRead<int>(data, pos);
+        met.sec              = utTsHsTextPluginRead<int>(data, pos);
+        const unsigned long stamp = static_cast<unsigned long>(utTsHsTextPluginRead<unsigned long long>(data, pos));
+        const unsigned short subsysLength   = utTsHsTextPluginRead<unsigned short>(data, pos);
+        const unsigned short fileLength     = utTsHsTextPluginRead<unsigned short>(data, pos);
+        const unsigned short functionLength = utTsHsTextPluginRead<unsigned short>(data, pos);
+        const unsigned int   textLength     = utTsHsTextPluginRead<unsigned int>(data, pos);
+        CPPUNIT_ASSERT_EQUAL(end, pos + subsysLength + fileLength + functionLength + textLength);
+        const std::string subsysOut  (data, pos, subsysLength);   pos += subsysLength;
+        const std::string fileOut    (data, pos, fileLength);     pos += fileLength;
+        const std::string functionOut(data, pos, functionLength); pos += functionLength;
+        const std::string textOut    (data, pos, textLength);     pos += textLength;
+
+        CPPUNIT_ASSERT_EQUAL(types[i],                  type);
+        CPPUNIT_ASSERT_EQUAL(lines[i],                  line);
+        CPPUNIT_ASSERT_EQUAL(mets[i].pre,               met.pre);
+        CPPUNIT_ASSERT_EQUAL(mets[i].day,               met.day);
+        CPPUNIT_ASSERT_EQUAL(mets[i].hour,              met.hour);
+        CPPUNIT_ASSERT_EQUAL(mets[i].min,               met.min);
+        CPPUNIT_ASSERT_EQUAL(mets[i].sec,               met.sec);
+        CPPUNIT_ASSERT_EQUAL(stamps[i],                 stamp);
+        CPPUNIT_ASSERT_EQUAL(std::string(subsys[i]),    subsysOut);
+        CPPUNIT_ASSERT_EQUAL(std::string(files[i]),     fileOut);
+        CPPUNIT_ASSERT_EQUAL(std::string(functions[i]), functionOut);
+        CPPUNIT_ASSERT_EQUAL(std::string(texts[i]),     textOut);
+
+        // The decoded record formats to the same text line as the original message.
+        CPPUNIT_ASSERT_EQUAL(
+                TsHsTextPlugin::formatText(files[i], lines[i], functions[i], types[i], subsys[i], mets[i], stamps[i], texts[i]),
+                TsHsTextPlugin::formatText(fileOut, line, functionOut, type, subsysOut, met, stamp, textOut));
+    }
+    CPPUNIT_ASSERT_EQUAL(data.size(), pos);
+}
@@ -0,0 +1,84 @@
+/********************************* TRICK HEADER *******************************
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+PURPOSE:
+    (Unit test class for TsHsTextPlugin class)
+
+LIBRARY DEPENDENCY:
+(
+    (simulation/hs/TsHsTextPlugin.o)
+)
+
+PROGRAMMERS:
+(
+    ((GUNNS Development Team) (CACI) (October 2026))
+)
+*******************************************************************************/
+#ifndef UtTsHsTextPlugin_EXISTS
+#define UtTsHsTextPlugin_EXISTS
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <string>
+
+#include "TsHsTextPlugin.hh"
+
+/// @brief Inherit from TsHsTextPlugin and befriend UtTsHsTextPlugin.
+class FriendlyTsHsTextPlugin : public TsHsTextPlugin
+{
+public:
+    FriendlyTsHsTextPlugin() : TsHsTextPlugin(0) {}
+    virtual ~FriendlyTsHsTextPlugin() {}
+    friend class UtTsHsTextPlugin;
+};
+
+/// @brief Unit test for TsHsTextPlugin, i.e. the health and status text and binary log plugin
+class UtTsHsTextPlugin: public CppUnit::TestFixture
+{
+public:
+
+    // Ctor not really needed here, but gets rid of some compiler warnings
+    UtTsHsTextPlugin() : CppUnit::TestFixture(), plugin(0), config() {}
+
+    void setUp();
+    void tearDown();
+
+    void testRotateSize();
+    void testRotateNaming();
+    void testBinaryRoundTrip();
+
+    /// @brief Number of rotated files the tests clean up.
+    static const int MAX_ROTATIONS = 8;
+
+private:
+
+    CPPUNIT_TEST_SUITE(UtTsHsTextPlugin);
+
+    CPPUNIT_TEST(testRotateSize);
+    CPPUNIT_TEST(testRotateNaming);
+    CPPUNIT_TEST(testBinaryRoundTrip);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    /// @brief Logs a numbered message with a fixed length text line.
+    void logMessage(const int number);
+    /// @brief Returns the text line of a numbered message, without the newline.
+    std::string messageLine(const int number) const;
+    /// @brief Returns the name of the given rotated file, or the current file for zero.
+    std::string rotatedName(const int rotation) const;
+    /// @brief Returns the contents of the given file, or an empty string if it doesn't exist.
+    static std::string readFile(const std::string& name);
+    /// @brief Returns whether the given file exists.
+    static bool fileExists(const std::string& name);
+
+    // Data members
+    FriendlyTsHsTextPlugin* plugin;
+    TsHsPluginConfig        config;
+
+    // Disable these to prevent compiler warnings about them being not implemented
+    UtTsHsTextPlugin(const UtTsHsTextPlugin&);
+    const UtTsHsTextPlugin& operator=(const UtTsHsTextPlugin&);
+};
+
+#endif /* UtTsHsTextPlugin_EXISTS */
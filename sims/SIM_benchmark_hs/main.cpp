@@ -0,0 +1,134 @@
+/*
+ * @copyright Copyright 2026 United States Government as represented by the Administrator of the
+ *            National Aeronautics and Space Administration.  All Rights Reserved.
+ *
+ * H&S SQLite output plugin benchmark.  Writes a burst of messages, like a failure cascade of
+ * repeated GUNNS warnings, to a local database through TsHsSqlitePlugin with each group commit
+ * count, where 0 is the original one transaction per message, and writes the message rates as JSON.
+ *
+ * Run with --help for usage.
+ */
+
+#include "TsHsSqlitePlugin.hh"
+#include "TsHsPluginConfig.hh"
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+/// @details  Stands in for the Trick message_publish, which the plugin reports errors with.
+extern "C" int message_publish(int level, const char* format, ...)
+{
+    (void) level;
+    va_list args;
+    va_start(args, format);
+    const int result = vfprintf(stderr, format, args);
+    va_end(args);
+    return result;
+}
+
+static void usage(const char* program)
+{
+    std::cerr
+        << "usage: " << program << " [options]\n"
+        << "  --messages <n>              messages per case (default 20000)\n"
+        << "  --distinct <n>              distinct message texts, repeated in turn (default 100)\n"
+        << "  --group-commit <n[,n...]>   group commit counts, 0 for per-message (default 0,64,256)\n"
+        << "  --period <s>                group commit period (default 0.5)\n"
+        << "  --db <file>                 database file (default hs_benchmark.sqlite)\n";
+}
+
+static double clockTime()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<double>(now.tv_sec) + 1.0e-9 * static_cast<double>(now.tv_nsec);
+}
+
+static std::vector<int> parseList(const char* arg)
+{
+    std::vector<int> values;
+    std::stringstream ss(arg);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        values.push_back(std::atoi(item.c_str()));
+    }
+    return values;
+}
+
+int main(int argc, char** argv)
+{
+    int              messages = 20000;
+    int              distinct = 100;
+    std::vector<int> groups   = parseList("0,64,256");
+    double           period   = 0.5;
+    std::string      db       = "hs_benchmark.sqlite";
+
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = (i + 1 < argc);
+        if (0 == std::strcmp(argv[i], "--messages") and hasValue) {
+            messages = std::atoi(argv[++i]);
+        } else if (0 == std::strcmp(argv[i], "--distinct") and hasValue) {
+            distinct = std::max(1, std::atoi(argv[++i]));
+        } else if (0 == std::strcmp(argv[i], "--group-commit") and hasValue) {
+            groups = parseList(argv[++i]);
+        } else if (0 == std::strcmp(argv[i], "--period") and hasValue) {
+            period = std::atof(argv[++i]);
+        } else if (0 == std::strcmp(argv[i], "--db") and hasValue) {
+            db = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    // Pre-build the message texts so only the plugin is timed.
+    std::vector<std::string> texts(distinct);
+    for (int i = 0; i < distinct; ++i) {
+        std::ostringstream text;
+        text << "GunnsFluidConductor conductor" << i << " flow rate exceeds limit, clamping.";
+        texts[i] = text.str();
+    }
+
+    std::cout << "{\n  \"messages\": " << messages << ",\n  \"distinct\": " << distinct
+              << ",\n  \"cases\": [\n";
+    for (unsigned int g = 0; g < groups.size(); ++g) {
+        TsHsPluginConfig config;
+        config.mEnabled           = true;
+        config.mOverwrite         = true;
+        config.mBlocking          = true;
+        config.mPath              = db;
+        config.mGroupCommitCount  = groups[g];
+        config.mGroupCommitPeriod = period;
+
+        TsHsSqlitePlugin plugin(0);
+        plugin.configure(config);
+        if (not plugin.init()) {
+            std::cerr << "failed to open " << db << "\n";
+            return 1;
+        }
+
+        TS_TIMER_TYPE met;
+        std::memset(&met, 0, sizeof(met));
+        const double start = clockTime();
+        for (int i = 0; i < messages; ++i) {
+            met.seconds = 0.01 * i;
+            plugin.msg(__FILE__, 100 + i % distinct, __func__, TS_HS_WARNING, TS_HS_GENERIC, met,
+                       static_cast<unsigned long>(time(0)), texts[i % distinct]);
+        }
+        plugin.shutdown();
+        const double elapsed = clockTime() - start;
+
+        std::cout << "    {\"group_commit\": " << groups[g]
+                  << ", \"seconds\": " << elapsed
+                  << ", \"messages_per_second\": " << (elapsed > 0.0 ? messages / elapsed : 0.0)
+                  << "}" << (g + 1 < groups.size() ? "," : "") << "\n";
+    }
+    std::cout << "  ]\n}\n";
+    return 0;
+}
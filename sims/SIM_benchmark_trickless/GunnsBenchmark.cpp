@@ -0,0 +1,150 @@
+/**
+@file
+@brief    GUNNS Solver Benchmark implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+ ((core/Gunns.o))
+*/
+
+#include "GunnsBenchmark.hh"
+#include <cfloat>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Benchmark Stats with no samples.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBenchmarkStats::GunnsBenchmarkStats()
+    :
+    mCount(0),
+    mTotal(0.0),
+    mMin(DBL_MAX),
+    mMax(0.0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] sample (s) The sample to add.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBenchmarkStats::add(const double sample)
+{
+    mCount++;
+    mTotal += sample;
+    if (sample < mMin) {
+        mMin = sample;
+    }
+    if (sample > mMax) {
+        mMax = sample;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (s) Mean of the samples, or zero if there are none.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsBenchmarkStats::getAvg() const
+{
+    return (mCount > 0) ? mTotal / mCount : 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] out (--) Stream to write to.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBenchmarkStats::writeJson(std::ostream& out) const
+{
+    out << "{\"total\": " << mTotal
+        << ", \"avg\": "  << getAvg()
+        << ", \"min\": "  << ((mCount > 0) ? mMin : 0.0)
+        << ", \"max\": "  << mMax << "}";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default constructs this Benchmark Result.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBenchmarkResult::GunnsBenchmarkResult()
+    :
+    mName(),
+    mType(),
+    mNumNodes(0),
+    mNumLinks(0),
+    mNumIslands(0),
+    mLinksPerNode(0),
+    mNonLinearFraction(0.0),
+    mTimeStep(0.0),
+    mInitTime(0.0),
+    mFrame(),
+    mStep(),
+    mDecompose(),
+    mSolve(),
+    mMajorSteps(0),
+    mMinorSteps(0),
+    mDecompositions(0),
+    mConvergenceFails(0),
+    mMaxRefinements(0),
+    mEscalations(0),
+    mFactorReuses(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] solver (--) The network solver.
+///
+/// @details  The solver's solve time includes its decomposition time, so the decomposition is
+///           subtracted out to give the time spent in the remaining solution phases.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBenchmarkResult::record(const Gunns& solver)
+{
+    mStep.add(solver.getStepTime());
+    mDecompose.add(solver.getDecomposeTime());
+    mSolve.add(solver.getSolveTime() - solver.getDecomposeTime());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] solver (--) The network solver.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBenchmarkResult::finish(const Gunns& solver)
+{
+    mNumNodes         = solver.getNetworkSize();
+    mNumLinks         = solver.getNumLinks();
+    mMajorSteps       = solver.getMajorStepCount();
+    mMinorSteps       = solver.getMinorStepCount();
+    mDecompositions   = solver.getDecompositionCount();
+    mConvergenceFails = solver.getConvergenceFailCount();
+    mMaxRefinements   = solver.getMaxRefinementCount();
+    mEscalations      = solver.getRefinementEscalationCount();
+    mFactorReuses     = solver.getFactorReuseCount();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] out (--) Stream to write to.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBenchmarkResult::writeJson(std::ostream& out) const
+{
+    out << "{\"name\": \""              << mName << "\""
+        << ", \"type\": \""             << mType << "\""
+        << ", \"nodes\": "              << mNumNodes
+        << ", \"links\": "              << mNumLinks
+        << ", \"islands\": "            << mNumIslands
+        << ", \"links_per_node\": "     << mLinksPerNode
+        << ", \"non_linear_fraction\": " << mNonLinearFraction
+        << ", \"time_step\": "          << mTimeStep
+        << ", \"major_steps\": "        << mMajorSteps
+        << ", \"minor_steps\": "        << mMinorSteps
+        << ", \"decompositions\": "     << mDecompositions
+        << ", \"convergence_fails\": "  << mConvergenceFails
+        << ", \"max_refinements\": "    << mMaxRefinements
+        << ", \"escalations\": "        << mEscalations
+        << ", \"factor_reuses\": "      << mFactorReuses
+        << ", \"init_time\": "          << mInitTime
+        << ", \"frame_time\": ";
+    mFrame.writeJson(out);
+    out << ", \"step_time\": ";
+    mStep.writeJson(out);
+    out << ", \"decompose_time\": ";
+    mDecompose.writeJson(out);
+    out << ", \"solve_time\": ";
+    mSolve.writeJson(out);
+    out << "}";
+}
@@ -0,0 +1,125 @@
+#ifndef GunnsBenchmark_EXISTS
+#define GunnsBenchmark_EXISTS
+
+/**
+@file
+@brief    GUNNS Solver Benchmark declarations
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ PURPOSE:
+ (Times the initialization, step, matrix decomposition and solution phases of a GUNNS network
+  outside of Trick, and reports the results as JSON.)
+
+ REQUIREMENTS:
+ ()
+
+ REFERENCE:
+ ()
+
+ ASSUMPTIONS AND LIMITATIONS:
+ ((The network's solver must be publicly accessible as netSolver.)
+  (Solution time excludes decomposition time, and both are measured by the solver itself with the
+   monotonic clock.))
+
+ LIBRARY DEPENDENCY:
+ ((GunnsBenchmark.o))
+
+ PROGRAMMERS:
+ ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+*/
+
+#include "core/Gunns.hh"
+#include "core/GunnsInfraMacros.hh"
+#include <ostream>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Benchmark Timing Statistics
+///
+/// @details  Accumulates count, total, minimum and maximum of a timing sample.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsBenchmarkStats
+{
+    public:
+        int    mCount; /**< (--) Number of samples. */
+        double mTotal; /**< (s)  Sum of the samples. */
+        double mMin;   /**< (s)  Smallest sample. */
+        double mMax;   /**< (s)  Largest sample. */
+        /// @brief  Default constructs this Benchmark Stats.
+        GunnsBenchmarkStats();
+        /// @brief  Adds a sample.
+        void   add(const double sample);
+        /// @brief  Returns the mean of the samples.
+        double getAvg() const;
+        /// @brief  Writes the stats as a JSON object.
+        void   writeJson(std::ostream& out) const;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Benchmark Result
+///
+/// @details  Holds the timing results and solver counts of one benchmark run.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsBenchmarkResult
+{
+    public:
+        std::string         mName;               /**< (--) Name of the benchmark case. */
+        std::string         mType;               /**< (--) Aspect type of the network. */
+        int                 mNumNodes;           /**< (--) Number of solvable network nodes, not including ground. */
+        int                 mNumLinks;           /**< (--) Number of network links. */
+        int                 mNumIslands;         /**< (--) Number of configured islands, or 0 if not applicable. */
+        int                 mLinksPerNode;       /**< (--) Extra conductors per node, or 0 if not applicable. */
+        double              mNonLinearFraction;  /**< (--) Fraction of non-linear conductors. */
+        double              mTimeStep;           /**< (s)  Network integration time step. */
+        double              mInitTime;           /**< (s)  Wall time to initialize the network. */
+        GunnsBenchmarkStats mFrame;              /**< (s)  Network update time per major step, including work outside the solver. */
+        GunnsBenchmarkStats mStep;               /**< (s)  Total solver step time per major step. */
+        GunnsBenchmarkStats mDecompose;          /**< (s)  Matrix decomposition time per major step. */
+        GunnsBenchmarkStats mSolve;              /**< (s)  Solution time excluding decomposition per major step. */
+        int                 mMajorSteps;         /**< (--) Number of major steps. */
+        int                 mMinorSteps;         /**< (--) Total number of minor steps. */
+        int                 mDecompositions;     /**< (--) Total number of matrix decompositions. */
+        int                 mConvergenceFails;   /**< (--) Number of convergence failures. */
+        int                 mMaxRefinements;     /**< (--) Most mixed-precision refinement iterations in a solution. */
+        int                 mEscalations;        /**< (--) Number of mixed-precision escalations to double precision. */
+        int                 mFactorReuses;       /**< (--) Number of minor steps solved with reused factors. */
+        /// @brief  Default constructs this Benchmark Result.
+        GunnsBenchmarkResult();
+        /// @brief  Records the solver timing of the last major step.
+        void record(const Gunns& solver);
+        /// @brief  Copies the solver's total counts.
+        void finish(const Gunns& solver);
+        /// @brief  Writes the result as a JSON object.
+        void writeJson(std::ostream& out) const;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in,out] network  (--) The network to benchmark, with initialize, update and netSolver.
+/// @param[in]     name     (--) Instance name to initialize the network with.
+/// @param[in]     steps    (--) Number of major steps to run.
+/// @param[in]     timeStep (s)  Integration time step.
+/// @param[in,out] result   (--) The benchmark result.
+///
+/// @details  Initializes the network, then steps it the given number of times, recording the
+///           network's update time and the solver timing of each major step.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename NetworkT>
+void gunnsBenchmarkRun(NetworkT& network, const std::string& name, const int steps,
+                       const double timeStep, GunnsBenchmarkResult& result)
+{
+    const double initStart = CLOCK_TIME;
+    network.initialize(name);
+    result.mInitTime = CLOCK_TIME - initStart;
+    result.mTimeStep = timeStep;
+    for (int step = 0; step < steps; ++step) {
+        const double frameStart = CLOCK_TIME;
+        network.update(timeStep);
+        result.mFrame.add(CLOCK_TIME - frameStart);
+        result.record(network.netSolver);
+    }
+    result.finish(network.netSolver);
+}
+
+#endif
@@ -0,0 +1,461 @@
+/**
+@file
+@brief    GUNNS Synthetic Benchmark Network implementation
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ LIBRARY DEPENDENCY:
+ ((core/Gunns.o)
+  (core/GunnsBasicCapacitor.o)
+  (core/GunnsBasicConductor.o)
+  (core/GunnsBasicPotential.o)
+  (core/GunnsFluidCapacitor.o)
+  (core/GunnsFluidConductor.o)
+  (core/GunnsFluidPotential.o)
+  (aspects/electrical/resistive/GunnsResistorPowerFunction.o)
+  (aspects/thermal/GunnsThermalCapacitor.o)
+  (aspects/thermal/GunnsThermalPotential.o)
+  (aspects/thermal/GunnsThermalRadiation.o)
+  (aspects/thermal/GunnsThermalRadiationBlock.o))
+*/
+
+#include "GunnsBenchmarkNetwork.hh"
+#include "core/GunnsMacros.hh"
+#include "software/exceptions/TsInitializationException.hh"
+#include <sstream>
+
+/// @details  Constituents of the fluid network's internal fluid.
+static FluidProperties::FluidType benchmarkFluidTypes[2] = {
+    FluidProperties::GUNNS_N2,
+    FluidProperties::GUNNS_O2
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name (--) Instance name for messages.
+///
+/// @details  Default constructs this Benchmark Network with a small linear basic network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBenchmarkNetwork::GunnsBenchmarkNetwork(const std::string& name)
+    :
+    mType(BASIC),
+    mNumNodes(10),
+    mLinksPerNode(1),
+    mNonLinearFraction(0.0),
+    mNumIslands(1),
+    mSeed(1),
+    mMinorStepLimit(1),
+    mIslandMode(Gunns::OFF),
+    mWorstCaseTiming(false),
+    netSolver(),
+    mName(name),
+    mRandom(1),
+    mNumLinear(0),
+    mNumNonLinear(0),
+    mGround(0),
+    netSolverConfig(name + ".netSolver", 1.0, 1.0E-6, 1, 1),
+    netNodeList(),
+    netLinks(),
+    mBasicNodes(0),
+    mFluidNodes(0),
+    mFluidProperties(),
+    mFluidConfig(0),
+    mCond(0),
+    mPowerCond(0),
+    mRadCond(0),
+    mRadBlock(name + ".mRadBlock"),
+    mCap(0),
+    mThermalCap(0),
+    mPot(0),
+    mThermalPot(0),
+    mFluidCond(0),
+    mFluidCap(0),
+    mFluidPot(0)
+{
+    // nothing to do
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Default destructs this Benchmark Network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+GunnsBenchmarkNetwork::~GunnsBenchmarkNetwork()
+{
+    cleanup();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @details  Deletes all dynamic arrays, so the network can be re-initialized.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBenchmarkNetwork::cleanup()
+{
+    TS_DELETE_ARRAY(mFluidPot);
+    TS_DELETE_ARRAY(mFluidCap);
+    TS_DELETE_ARRAY(mFluidCond);
+    TS_DELETE_ARRAY(mThermalPot);
+    TS_DELETE_ARRAY(mPot);
+    TS_DELETE_ARRAY(mThermalCap);
+    TS_DELETE_ARRAY(mCap);
+    TS_DELETE_ARRAY(mRadCond);
+    TS_DELETE_ARRAY(mPowerCond);
+    TS_DELETE_ARRAY(mCond);
+    TS_DELETE_ARRAY(mFluidNodes);
+    TS_DELETE_ARRAY(mBasicNodes);
+    delete mFluidConfig;
+    mFluidConfig = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] name (--) Instance name for messages.
+///
+/// @throws   TsInitializationException
+///
+/// @details  Generates the network topology from the configuration attributes, then allocates and
+///           initializes the nodes, links and solver, and sets the solver's island & timing modes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBenchmarkNetwork::initialize(const std::string& name)
+{
+    mName = name;
+    validate();
+    cleanup();
+    netLinks.clear();
+
+    std::vector<Connection> connections;
+    buildConnections(connections);
+
+    mGround               = mNumNodes;
+    netNodeList.mNumNodes = mNumNodes + 1;
+    netSolverConfig.mName               = name + ".netSolver";
+    netSolverConfig.mMinorStepLimit     = mMinorStepLimit;
+    netSolverConfig.mDecompositionLimit = mMinorStepLimit;
+    if (FLUID == mType) {
+        initFluid(connections);
+    } else {
+        initBasic(connections);
+    }
+    netSolver.initialize(netSolverConfig, netLinks);
+    netSolver.setIslandMode(mIslandMode);
+    netSolver.setWorstCaseTiming(mWorstCaseTiming);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @throws   TsInitializationException
+///
+/// @details  Validates the configuration attributes.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBenchmarkNetwork::validate() const
+{
+    /// - Throw an exception if number of nodes < 1.
+    if (mNumNodes < 1) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "number of nodes < 1.");
+    }
+
+    /// - Throw an exception if number of islands < 1 or > number of nodes.
+    if (mNumIslands < 1 or mNumIslands > mNumNodes) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "number of islands not in (1, number of nodes).");
+    }
+
+    /// - Throw an exception if links per node < 0.
+    if (mLinksPerNode < 0) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "links per node < 0.");
+    }
+
+    /// - Throw an exception if non-linear fraction not in (0-1).
+    if (mNonLinearFraction < 0.0 or mNonLinearFraction > 1.0) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "non-linear fraction not in (0-1).");
+    }
+
+    /// - Throw an exception if minor step limit < 1.
+    if (mMinorStepLimit < 1) {
+        GUNNS_ERROR(TsInitializationException, "Invalid Configuration Data",
+                    "minor step limit < 1.");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  double (--) Next random number in the range [0, 1).
+///
+/// @details  A linear congruential generator, so the sequence is identical on all platforms.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+double GunnsBenchmarkNetwork::random()
+{
+    mRandom = 1664525u * mRandom + 1013904223u;
+    return static_cast<double>(mRandom >> 8) / 16777216.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] island (--) Island index, or the number of islands for the end of the last island.
+///
+/// @returns  int (--) The first node index of the island.
+///
+/// @details  Nodes are split into contiguous islands of roughly equal size.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int GunnsBenchmarkNetwork::islandStart(const int island) const
+{
+    return static_cast<int>(static_cast<long>(island) * mNumNodes / mNumIslands);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[out] connections (--) The generated conductor connections.
+///
+/// @details  Generates the chain, random and leak conductor connections of each island, and counts
+///           the linear & non-linear conductors.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBenchmarkNetwork::buildConnections(std::vector<Connection>& connections)
+{
+    mRandom       = mSeed;
+    mNumLinear    = 0;
+    mNumNonLinear = 0;
+    connections.clear();
+    for (int island = 0; island < mNumIslands; ++island) {
+        const int start = islandStart(island);
+        const int size  = islandStart(island + 1) - start;
+
+        /// - Chain conductors between adjacent nodes in the island.
+        for (int node = start; node < start + size - 1; ++node) {
+            Connection connection = {node, node + 1, false};
+            connections.push_back(connection);
+        }
+
+        /// - Extra conductors between random pairs of nodes in the island.
+        if (size > 1) {
+            for (int node = start; node < start + size; ++node) {
+                for (int link = 0; link < mLinksPerNode; ++link) {
+                    int other = start + static_cast<int>(random() * (size - 1));
+                    if (other >= node) {
+                        other++;
+                    }
+                    Connection connection = {node, other, random() < mNonLinearFraction};
+                    connections.push_back(connection);
+                }
+            }
+        }
+
+        /// - Leak conductor from the last node in the island to ground.
+        Connection connection = {start + size - 1, mNumNodes, false};
+        connections.push_back(connection);
+    }
+
+    for (unsigned int i = 0; i < connections.size(); ++i) {
+        if (connections[i].mNonLinear) {
+            mNumNonLinear++;
+        } else {
+            mNumLinear++;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] array (--) Name of the link array.
+/// @param[in] index (--) Index of the link in the array.
+///
+/// @returns  std::string (--) Unique link instance name.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string GunnsBenchmarkNetwork::linkName(const char* array, const int index) const
+{
+    std::ostringstream name;
+    name << mName << "." << array << "_" << index;
+    return name.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] connections (--) The conductor connections.
+///
+/// @details  Allocates and initializes the nodes and links of a basic or thermal network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBenchmarkNetwork::initBasic(const std::vector<Connection>& connections)
+{
+    const bool   thermal     = (THERMAL == mType);
+    const double temperature = 300.0;
+
+    /// - Allocate and initialize the nodes.
+    TS_NEW_CLASS_ARRAY_EXT(mBasicNodes, mNumNodes + 1, GunnsBasicNode, (), mName + ".mBasicNodes");
+    netNodeList.mNodes = mBasicNodes;
+    for (int i = 0; i < mNumNodes + 1; ++i) {
+        std::ostringstream nodeName;
+        nodeName << mName << ".mBasicNodes_" << i;
+        mBasicNodes[i].initialize(nodeName.str(), temperature);
+    }
+    netSolver.initializeNodes(netNodeList);
+
+    /// - Allocate the links.
+    TS_NEW_CLASS_ARRAY_EXT(mCond, mNumLinear, GunnsBasicConductor, (), mName + ".mCond");
+    if (thermal) {
+        TS_NEW_CLASS_ARRAY_EXT(mRadCond,    mNumNonLinear, GunnsThermalRadiation, (), mName + ".mRadCond");
+        TS_NEW_CLASS_ARRAY_EXT(mThermalCap, mNumNodes,     GunnsThermalCapacitor, (), mName + ".mThermalCap");
+        TS_NEW_CLASS_ARRAY_EXT(mThermalPot, mNumIslands,   GunnsThermalPotential, (), mName + ".mThermalPot");
+    } else {
+        TS_NEW_CLASS_ARRAY_EXT(mPowerCond,  mNumNonLinear, GunnsResistorPowerFunction, (), mName + ".mPowerCond");
+        TS_NEW_CLASS_ARRAY_EXT(mCap,        mNumNodes,     GunnsBasicCapacitor,   (), mName + ".mCap");
+        TS_NEW_CLASS_ARRAY_EXT(mPot,        mNumIslands,   GunnsBasicPotential,   (), mName + ".mPot");
+    }
+
+    /// - Initialize the conductors.
+    GunnsBasicConductorConfigData        condConfig ("", &netNodeList, 1.0);
+    GunnsBasicConductorInputData         condInput  (false, 0.0);
+    GunnsResistorPowerFunctionConfigData powerConfig("", &netNodeList, 1.0, 1.5, true);
+    GunnsResistorPowerFunctionInputData  powerInput (false, 0.0);
+    GunnsThermalRadiationConfigData      radConfig  ("", &netNodeList, 0.1);
+    GunnsThermalRadiationInputData       radInput   (false, 0.0, 1.0);
+    int nLinear    = 0;
+    int nNonLinear = 0;
+    for (unsigned int i = 0; i < connections.size(); ++i) {
+        const Connection& c = connections[i];
+        if (not c.mNonLinear) {
+            condConfig.mName = linkName("mCond", nLinear);
+            mCond[nLinear++].initialize(condConfig, condInput, netLinks, c.mPort0, c.mPort1);
+        } else if (thermal) {
+            radConfig.mName = linkName("mRadCond", nNonLinear);
+            mRadCond[nNonLinear++].initialize(radConfig, radInput, netLinks, c.mPort0, c.mPort1);
+        } else {
+            powerConfig.mName = linkName("mPowerCond", nNonLinear);
+            mPowerCond[nNonLinear++].initialize(powerConfig, powerInput, netLinks, c.mPort0, c.mPort1);
+        }
+    }
+
+    /// - Gather the radiation links into a block.
+    if (thermal) {
+        mRadBlock.initialize(netNodeList, mRadCond, mNumNonLinear);
+    }
+
+    /// - Initialize the capacitors.
+    if (thermal) {
+        GunnsThermalCapacitorConfigData config("", &netNodeList);
+        GunnsThermalCapacitorInputData  input (false, 0.0, 1000.0, temperature);
+        for (int i = 0; i < mNumNodes; ++i) {
+            config.mName = linkName("mThermalCap", i);
+            mThermalCap[i].initialize(config, input, netLinks, i, mGround);
+        }
+    } else {
+        GunnsBasicCapacitorConfigData config("", &netNodeList);
+        GunnsBasicCapacitorInputData  input (false, 0.0, 1.0, temperature);
+        for (int i = 0; i < mNumNodes; ++i) {
+            config.mName = linkName("mCap", i);
+            mCap[i].initialize(config, input, netLinks, i, mGround);
+        }
+    }
+
+    /// - Initialize a potential source from ground to the first node in each island.  Each island
+    ///   has a different source potential.
+    if (thermal) {
+        GunnsThermalPotentialConfigData config("", &netNodeList, 1.0);
+        GunnsThermalPotentialInputData  input (false, 0.0, temperature);
+        for (int i = 0; i < mNumIslands; ++i) {
+            config.mName          = linkName("mThermalPot", i);
+            input.mSourcePotential = temperature + 10.0 * (i + 1);
+            mThermalPot[i].initialize(config, input, netLinks, mGround, islandStart(i));
+        }
+    } else {
+        GunnsBasicPotentialConfigData config("", &netNodeList, 1.0);
+        GunnsBasicPotentialInputData  input (false, 0.0, temperature);
+        for (int i = 0; i < mNumIslands; ++i) {
+            config.mName           = linkName("mPot", i);
+            input.mSourcePotential = temperature + 10.0 * (i + 1);
+            mPot[i].initialize(config, input, netLinks, mGround, islandStart(i));
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] connections (--) The conductor connections.
+///
+/// @details  Allocates and initializes the nodes and links of a fluid network.  All conductors are
+///           fluid conductors regardless of their non-linear flag, since fluid flow is non-linear.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBenchmarkNetwork::initFluid(const std::vector<Connection>& connections)
+{
+    const double pressure = 101.325;
+
+    /// - Allocate and initialize the nodes.  The ground node is vacuum.
+    mFluidConfig = new PolyFluidConfigData(&mFluidProperties, benchmarkFluidTypes, 2);
+    double fractions[2] = {0.77, 0.23};
+    PolyFluidInputData fluidInput(294.261, pressure, 0.0, 0.0, fractions, 0);
+
+    TS_NEW_CLASS_ARRAY_EXT(mFluidNodes, mNumNodes + 1, GunnsFluidNode, (), mName + ".mFluidNodes");
+    netNodeList.mNodes = mFluidNodes;
+    for (int i = 0; i < mNumNodes; ++i) {
+        std::ostringstream nodeName;
+        nodeName << mName << ".mFluidNodes_" << i;
+        mFluidNodes[i].initialize(nodeName.str(), mFluidConfig, &fluidInput);
+    }
+    mFluidNodes[mGround].initialize(mName + ".GROUND", mFluidConfig, 0);
+    netSolver.initializeFluidNodes(netNodeList);
+
+    /// - Allocate the links.
+    const int nConductors = static_cast<int>(connections.size());
+    TS_NEW_CLASS_ARRAY_EXT(mFluidCond, nConductors, GunnsFluidConductor, (), mName + ".mFluidCond");
+    TS_NEW_CLASS_ARRAY_EXT(mFluidCap,  mNumNodes,   GunnsFluidCapacitor, (), mName + ".mFluidCap");
+    TS_NEW_CLASS_ARRAY_EXT(mFluidPot,  mNumIslands, GunnsFluidPotential, (), mName + ".mFluidPot");
+
+    /// - Initialize the conductors.
+    {
+        GunnsFluidConductorConfigData config("", &netNodeList, 1.0E-4, 0.0);
+        GunnsFluidConductorInputData  input (false, 0.0);
+        for (int i = 0; i < nConductors; ++i) {
+            config.mName = linkName("mFluidCond", i);
+            mFluidCond[i].initialize(config, input, netLinks,
+                                     connections[i].mPort0, connections[i].mPort1);
+        }
+    }
+
+    /// - Initialize the capacitors.
+    {
+        GunnsFluidCapacitorConfigData config("", &netNodeList, 0.0);
+        GunnsFluidCapacitorInputData  input (false, 0.0, 1.0, &fluidInput);
+        for (int i = 0; i < mNumNodes; ++i) {
+            config.mName = linkName("mFluidCap", i);
+            mFluidCap[i].initialize(config, input, netLinks, i, mGround);
+        }
+    }
+
+    /// - Initialize a pressure source from ground to the first node in each island.  Each island
+    ///   has a different source pressure.
+    {
+        GunnsFluidPotentialConfigData config("", &netNodeList, 1.0E-4, 0.0);
+        GunnsFluidPotentialInputData  input (false, 0.0, pressure);
+        for (int i = 0; i < mNumIslands; ++i) {
+            config.mName          = linkName("mFluidPot", i);
+            input.mSourcePressure = pressure + (i + 1);
+            mFluidPot[i].initialize(config, input, netLinks, mGround, islandStart(i));
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] timeStep (s) Integration time step.
+///
+/// @details  Updates the thermal radiation block from the last node temperatures, then steps the
+///           network solver.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void GunnsBenchmarkNetwork::update(const double timeStep)
+{
+    if (THERMAL == mType) {
+        mRadBlock.update();
+    }
+    netSolver.step(timeStep);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @returns  int (--) Number of links in the network.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int GunnsBenchmarkNetwork::getNumLinks() const
+{
+    return static_cast<int>(netLinks.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @param[in] type (--) The network type.
+///
+/// @returns  const char* (--) Aspect name of the network type.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const char* GunnsBenchmarkNetwork::getTypeName(const NetworkType type)
+{
+    switch (type) {
+        case FLUID:   return "fluid";
+        case THERMAL: return "thermal";
+        default:      return "basic";
+    }
+}
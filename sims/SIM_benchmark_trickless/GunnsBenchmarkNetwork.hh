@@ -0,0 +1,160 @@
+#ifndef GunnsBenchmarkNetwork_EXISTS
+#define GunnsBenchmarkNetwork_EXISTS
+
+/**
+@file
+@brief    GUNNS Synthetic Benchmark Network declarations
+
+@copyright Copyright 2026 United States Government as represented by the Administrator of the
+           National Aeronautics and Space Administration.  All Rights Reserved.
+
+ PURPOSE:
+ (This is a synthetic GUNNS network of configurable size, sparsity, non-linearity and island count,
+  for benchmarking the solver outside of Trick.)
+
+ REQUIREMENTS:
+ ()
+
+ REFERENCE:
+ ()
+
+ ASSUMPTIONS AND LIMITATIONS:
+ ((The network is built from the basic, thermal or fluid core link types only.)
+  (Fluid networks are always non-linear, so the non-linear fraction is ignored for them.)
+  (Thermal networks evaluate their radiation links in a GunnsThermalRadiationBlock, as
+   ThermalNetwork does.))
+
+ LIBRARY DEPENDENCY:
+ ((GunnsBenchmarkNetwork.o))
+
+ PROGRAMMERS:
+ ((GUNNS Development Team) (CACI) (October 2026) (Initial))
+*/
+
+#include "software/SimCompatibility/TsSimCompatibility.hh"
+#include "core/Gunns.hh"
+#include "core/GunnsBasicCapacitor.hh"
+#include "core/GunnsBasicConductor.hh"
+#include "core/GunnsBasicPotential.hh"
+#include "core/GunnsFluidCapacitor.hh"
+#include "core/GunnsFluidConductor.hh"
+#include "core/GunnsFluidPotential.hh"
+#include "aspects/electrical/resistive/GunnsResistorPowerFunction.hh"
+#include "aspects/thermal/GunnsThermalCapacitor.hh"
+#include "aspects/thermal/GunnsThermalPotential.hh"
+#include "aspects/thermal/GunnsThermalRadiation.hh"
+#include "aspects/thermal/GunnsThermalRadiationBlock.hh"
+#include "properties/FluidProperties.hh"
+#include <string>
+#include <vector>
+
+/*  Example of a 9-node, 2-island network with 1 extra link per node:
+ *
+ *   Island 0:  P0 -> 0 --- 1 --- 2 --- 3 -> L0    P: potential link from GND
+ *                    \_________/ \____/           L: leak conductor to GND
+ *   Island 1:  P1 -> 4 --- 5 --- 6 --- 7 --- 8 -> L1
+ *                    \_______________/
+ *
+ *  Every node also has a capacitor to GND.  Nodes are split into contiguous islands of roughly
+ *  equal size.  Each island is a chain of conductors, with a number of extra conductors per node
+ *  connecting random pairs of nodes within the same island.  The extra conductors are non-linear
+ *  with the given probability (power-function resistors in basic networks, radiation links in
+ *  thermal networks).
+ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief    GUNNS Synthetic Benchmark Network
+///
+/// @details  Generates a network of the given aspect & topology at initialization, from a
+///           deterministic random number sequence so that runs are repeatable for a given seed.
+///           The configuration attributes must be set before calling initialize.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+class GunnsBenchmarkNetwork
+{
+    TS_MAKE_SIM_COMPATIBLE(GunnsBenchmarkNetwork);
+
+    public:
+        /// @brief  Enumeration of the network aspect types.
+        enum NetworkType {
+            BASIC   = 0, ///< Basic links & nodes.
+            FLUID   = 1, ///< Fluid links & nodes.
+            THERMAL = 2  ///< Thermal links on basic nodes.
+        };
+        NetworkType                   mType;              /**< (--) trick_chkpnt_io(**) Aspect type of the generated network. */
+        int                           mNumNodes;          /**< (--) trick_chkpnt_io(**) Number of network nodes, not including ground. */
+        int                           mLinksPerNode;      /**< (--) trick_chkpnt_io(**) Number of extra random conductors per node (sparsity). */
+        double                        mNonLinearFraction; /**< (--) trick_chkpnt_io(**) Fraction (0-1) of extra conductors that are non-linear. */
+        int                           mNumIslands;        /**< (--) trick_chkpnt_io(**) Number of isolated islands the nodes are split into. */
+        unsigned int                  mSeed;              /**< (--) trick_chkpnt_io(**) Seed for the topology random number generator. */
+        int                           mMinorStepLimit;    /**< (--) trick_chkpnt_io(**) Solver minor step & decomposition limit, for non-linear networks. */
+        Gunns::IslandMode             mIslandMode;        /**< (--) trick_chkpnt_io(**) Solver island mode. */
+        bool                          mWorstCaseTiming;   /**< (--) trick_chkpnt_io(**) Forces the solver to decompose every minor step. */
+        Gunns                         netSolver;          /**< (--) trick_chkpnt_io(**) The network solver. */
+        /// @brief  Default constructs this Benchmark Network.
+        GunnsBenchmarkNetwork(const std::string& name = "");
+        /// @brief  Default destructs this Benchmark Network.
+        virtual ~GunnsBenchmarkNetwork();
+        /// @brief  Builds and initializes the network.
+        void initialize(const std::string& name);
+        /// @brief  Updates the network.
+        void update(const double timeStep);
+        /// @brief  Returns the number of links in the network.
+        int getNumLinks() const;
+        /// @brief  Returns the aspect name of the given network type.
+        static const char* getTypeName(const NetworkType type);
+
+    protected:
+        /// @brief  Describes a conductor connection between two nodes.
+        struct Connection {
+            int  mPort0;     /**< (--) Node index of port 0. */
+            int  mPort1;     /**< (--) Node index of port 1. */
+            bool mNonLinear; /**< (--) This connection is a non-linear link. */
+        };
+        std::string                   mName;              /**< (--) trick_chkpnt_io(**) Instance name for messages. */
+        unsigned int                  mRandom;            /**< (--) trick_chkpnt_io(**) Current state of the random number generator. */
+        int                           mNumLinear;         /**< (--) trick_chkpnt_io(**) Number of linear conductors. */
+        int                           mNumNonLinear;      /**< (--) trick_chkpnt_io(**) Number of non-linear conductors. */
+        int                           mGround;            /**< (--) trick_chkpnt_io(**) Node index of the ground node. */
+        GunnsConfigData               netSolverConfig;    /**< (--) trick_chkpnt_io(**) Solver config data. */
+        GunnsNodeList                 netNodeList;        /**< (--) trick_chkpnt_io(**) Network node list. */
+        std::vector<GunnsBasicLink*>  netLinks;           /**< (--) trick_chkpnt_io(**) Network links vector. */
+        GunnsBasicNode*               mBasicNodes;        /**< (--) trick_chkpnt_io(**) Basic & thermal network nodes. */
+        GunnsFluidNode*               mFluidNodes;        /**< (--) trick_chkpnt_io(**) Fluid network nodes. */
+        const DefinedFluidProperties  mFluidProperties;   /**< (--) trick_chkpnt_io(**) Defined fluid properties. */
+        PolyFluidConfigData*          mFluidConfig;       /**< (--) trick_chkpnt_io(**) Network internal fluid config. */
+        GunnsBasicConductor*          mCond;              /**< (--) trick_chkpnt_io(**) Basic & thermal linear conductors. */
+        GunnsResistorPowerFunction*   mPowerCond;         /**< (--) trick_chkpnt_io(**) Basic non-linear conductors. */
+        GunnsThermalRadiation*        mRadCond;           /**< (--) trick_chkpnt_io(**) Thermal non-linear conductors. */
+        GunnsThermalRadiationBlock    mRadBlock;          /**< (--) trick_chkpnt_io(**) Evaluates the thermal non-linear conductors together. */
+        GunnsBasicCapacitor*          mCap;               /**< (--) trick_chkpnt_io(**) Basic capacitors. */
+        GunnsThermalCapacitor*        mThermalCap;        /**< (--) trick_chkpnt_io(**) Thermal capacitors. */
+        GunnsBasicPotential*          mPot;               /**< (--) trick_chkpnt_io(**) Basic potentials. */
+        GunnsThermalPotential*        mThermalPot;        /**< (--) trick_chkpnt_io(**) Thermal potentials. */
+        GunnsFluidConductor*          mFluidCond;         /**< (--) trick_chkpnt_io(**) Fluid conductors. */
+        GunnsFluidCapacitor*          mFluidCap;          /**< (--) trick_chkpnt_io(**) Fluid capacitors. */
+        GunnsFluidPotential*          mFluidPot;          /**< (--) trick_chkpnt_io(**) Fluid potentials. */
+        /// @brief  Validates the configuration attributes.
+        void validate() const;
+        /// @brief  Generates the conductor connections.
+        void buildConnections(std::vector<Connection>& connections);
+        /// @brief  Returns the next number in the random sequence, in the range [0, 1).
+        double random();
+        /// @brief  Returns the first node of the given island.
+        int islandStart(const int island) const;
+        /// @brief  Builds the basic or thermal network.
+        void initBasic(const std::vector<Connection>& connections);
+        /// @brief  Builds the fluid network.
+        void initFluid(const std::vector<Connection>& connections);
+        /// @brief  Creates a unique link instance name.
+        std::string linkName(const char* array, const int index) const;
+        /// @brief  Deletes all dynamic arrays.
+        void cleanup();
+
+    private:
+        /// @details  Copy constructor unavailable since declared private and not implemented.
+        GunnsBenchmarkNetwork(const GunnsBenchmarkNetwork& rhs);
+        /// @details  Assignment operator unavailable since declared private and not implemented.
+        GunnsBenchmarkNetwork& operator =(const GunnsBenchmarkNetwork& rhs);
+};
+
+#endif
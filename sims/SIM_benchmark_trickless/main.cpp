@@ -0,0 +1,258 @@
+/*
+ * @copyright Copyright 2026 United States Government as represented by the Administrator of the
+ *            National Aeronautics and Space Administration.  All Rights Reserved.
+ *
+ * Trick-less GUNNS solver benchmark.  Builds synthetic networks of configurable size, sparsity,
+ * non-linearity and island count, times their initialization, step, decomposition and solution
+ * phases, and writes the results as JSON.  With the example vehicle build (make vehicle), it can
+ * also replay the example space vehicle networks from sims/networks/example_space_vehicle.
+ *
+ * Run with --help for usage.
+ */
+
+#include "GunnsBenchmark.hh"
+#include "GunnsBenchmarkNetwork.hh"
+#ifdef GUNNS_BENCHMARK_EXAMPLE_VEHICLE
+#include "sims/networks/example_space_vehicle/ExampleCabinFluid.hh"
+#include "sims/networks/example_space_vehicle/ExampleCoolantLoopFluid.hh"
+#include "sims/networks/example_space_vehicle/ExampleHxThermal.hh"
+#include "sims/networks/example_space_vehicle/ExamplePassiveThermal.hh"
+#include "sims/networks/example_space_vehicle/ExamplePowerElect.hh"
+#endif
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+static void usage(const char* program)
+{
+    std::cerr
+        << "usage: " << program << " [options]\n"
+        << "  --type <basic|fluid|thermal|all>  synthetic network aspect (default all)\n"
+        << "  --nodes <n[,n...]>                node counts to sweep (default 10,100,500)\n"
+        << "  --links-per-node <n>              extra random conductors per node (default 2)\n"
+        << "  --nonlinear <fraction>            fraction of non-linear conductors (default 0)\n"
+        << "  --islands <n>                     number of islands (default 1)\n"
+        << "  --island-mode <off|find|solve>    solver island mode (default off)\n"
+        << "  --minor-steps <n>                 solver minor step limit (default 1)\n"
+        << "  --seed <n>                        topology random seed (default 1)\n"
+        << "  --steps <n>                       major steps per case (default 100)\n"
+        << "  --dt <s>                          time step (default 0.1)\n"
+        << "  --worst-case                      force a decomposition every minor step\n"
+        << "  --mixed-precision                 single-precision factors with refinement\n"
+        << "  --factor-reuse <n>                reuse factors for up to n minor steps (default 0)\n"
+        << "  --vehicle                         replay the example space vehicle networks\n"
+        << "  --output <file>                   write JSON to file instead of stdout\n";
+}
+
+#ifdef GUNNS_BENCHMARK_EXAMPLE_VEHICLE
+/// @details  Pre-initialization setup of the example space vehicle networks, mirroring the sim's
+///           RUN_test/input.py.  Timed events from the input file are not replayed, except that
+///           the ammonia boiler valve starts open since the sim opens it after 1 second.
+static void setupVehicle(ExamplePowerElect& network)
+{
+    network.loadSwitch3.addUserLoad(&network.fwdShellHeater);
+    network.loadSwitch4.addUserLoad(&network.aftShellHeater);
+    network.loadSwitch5.addUserLoad(&network.cabinFan);
+    network.loadSwitch6.addUserLoad(&network.pump);
+    network.loadSwitch7.addUserLoad(&network.tcv);
+    network.loadSwitch8.addUserLoad(&network.radBypassVlv);
+    network.loadSwitch9.addUserLoad(&network.gasSelectValve);
+}
+
+static void setupVehicle(ExampleHxThermal& network)
+{
+    network.netSolver.setDummyMode();
+}
+
+static void setupVehicle(ExampleCabinFluid& network)
+{
+    network.netConfig.scrubbers.addCompound(ChemicalCompound::CO2, 10.0, 0.095, 0.0, 0.0, 0.0, -189.9);
+    network.netConfig.scrubbers.addCompound(ChemicalCompound::H2O, 10.0, 0.065, 0.0, 0.0, 0.0, -200.0);
+    network.netInput.tcv.mPosition                = 0.15;
+    network.netInput.gasSelectValve.mPosition     = 1.0;
+    network.netInput.cabinLeak.mMalfLeakHoleFlag  = true;
+    network.netInput.cabinLeak.mMalfLeakHoleValue = 2.8e-10;
+}
+
+static void setupVehicle(ExampleCoolantLoopFluid& network)
+{
+    network.netInput.nh3ControlVlv.mPosition = 1.0;
+}
+
+static void setupVehicle(ExamplePassiveThermal&)
+{
+    // nothing to do
+}
+
+/// @details  Runs one example space vehicle network at the rate it's scheduled in the sim.
+template <typename NetworkT>
+static void runVehicle(const std::string& name, const std::string& type, const int steps,
+                       const double dt, std::vector<GunnsBenchmarkResult>& results)
+{
+    NetworkT network(name);
+    setupVehicle(network);
+    GunnsBenchmarkResult result;
+    result.mName = name;
+    result.mType = type;
+    gunnsBenchmarkRun(network, name, steps, dt, result);
+    results.push_back(result);
+}
+#endif
+
+int main(int argc, char** argv)
+{
+    std::string        types       = "all";
+    std::vector<int>   nodeCounts;
+    int                linksPerNode = 2;
+    double             nonLinear    = 0.0;
+    int                islands      = 1;
+    Gunns::IslandMode  islandMode   = Gunns::OFF;
+    int                minorSteps   = 1;
+    unsigned int       seed         = 1;
+    int                steps        = 100;
+    double             dt           = 0.1;
+    bool               worstCase    = false;
+    bool               mixed        = false;
+    int                factorReuse  = 0;
+    bool               vehicle      = false;
+    std::string        output;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg   = argv[i];
+        const char*       value = (i + 1 < argc) ? argv[i + 1] : "";
+        if ("--worst-case" == arg) {
+            worstCase = true;
+        } else if ("--mixed-precision" == arg) {
+            mixed = true;
+        } else if ("--vehicle" == arg) {
+            vehicle = true;
+        } else if ("--help" == arg or "-h" == arg) {
+            usage(argv[0]);
+            return 0;
+        } else if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        } else {
+            ++i;
+            if ("--type" == arg) {
+                types = value;
+            } else if ("--nodes" == arg) {
+                std::istringstream list(value);
+                std::string item;
+                while (std::getline(list, item, ',')) {
+                    nodeCounts.push_back(std::atoi(item.c_str()));
+                }
+            } else if ("--links-per-node" == arg) {
+                linksPerNode = std::atoi(value);
+            } else if ("--nonlinear" == arg) {
+                nonLinear = std::atof(value);
+            } else if ("--islands" == arg) {
+                islands = std::atoi(value);
+            } else if ("--island-mode" == arg) {
+                const std::string mode = value;
+                islandMode = ("solve" == mode) ? Gunns::SOLVE
+                           : ("find"  == mode) ? Gunns::FIND : Gunns::OFF;
+            } else if ("--minor-steps" == arg) {
+                minorSteps = std::atoi(value);
+            } else if ("--factor-reuse" == arg) {
+                factorReuse = std::atoi(value);
+            } else if ("--seed" == arg) {
+                seed = static_cast<unsigned int>(std::atol(value));
+            } else if ("--steps" == arg) {
+                steps = std::atoi(value);
+            } else if ("--dt" == arg) {
+                dt = std::atof(value);
+            } else if ("--output" == arg) {
+                output = value;
+            } else {
+                usage(argv[0]);
+                return 1;
+            }
+        }
+    }
+    if (nodeCounts.empty()) {
+        nodeCounts.push_back(10);
+        nodeCounts.push_back(100);
+        nodeCounts.push_back(500);
+    }
+
+    std::vector<GunnsBenchmarkResult> results;
+    try {
+        if (vehicle) {
+#ifdef GUNNS_BENCHMARK_EXAMPLE_VEHICLE
+            runVehicle<ExamplePowerElect>      ("vehicle.powerElect",       "basic",   steps, 0.1, results);
+            runVehicle<ExamplePassiveThermal>  ("vehicle.passiveThermal",   "thermal", steps, 1.0, results);
+            runVehicle<ExampleHxThermal>       ("vehicle.hxThermal",        "thermal", steps, 0.1, results);
+            runVehicle<ExampleCabinFluid>      ("vehicle.cabinFluid",       "fluid",   steps, 0.1, results);
+            runVehicle<ExampleCoolantLoopFluid>("vehicle.coolantLoopFluid", "fluid",   steps, 0.1, results);
+#else
+            std::cerr << "--vehicle requires the example vehicle build: make vehicle" << std::endl;
+            return 1;
+#endif
+        } else {
+            const GunnsBenchmarkNetwork::NetworkType allTypes[3] = {
+                GunnsBenchmarkNetwork::BASIC,
+                GunnsBenchmarkNetwork::FLUID,
+                GunnsBenchmarkNetwork::THERMAL
+            };
+            for (int t = 0; t < 3; ++t) {
+                const char* typeName = GunnsBenchmarkNetwork::getTypeName(allTypes[t]);
+                if ("all" != types and typeName != types) {
+                    continue;
+                }
+                for (unsigned int n = 0; n < nodeCounts.size(); ++n) {
+                    std::ostringstream name;
+                    name << typeName << "_" << nodeCounts[n];
+                    GunnsBenchmarkNetwork network(name.str());
+                    network.mType              = allTypes[t];
+                    network.mNumNodes          = nodeCounts[n];
+                    network.mLinksPerNode      = linksPerNode;
+                    network.mNonLinearFraction = nonLinear;
+                    network.mNumIslands        = islands;
+                    network.mIslandMode        = islandMode;
+                    network.mMinorStepLimit    = minorSteps;
+                    network.mSeed              = seed;
+                    network.mWorstCaseTiming   = worstCase;
+                    network.netSolver.setMixedPrecision(mixed);
+                    network.netSolver.setFactorReuse(factorReuse);
+
+                    GunnsBenchmarkResult result;
+                    result.mName              = name.str();
+                    result.mType              = typeName;
+                    result.mNumIslands        = islands;
+                    result.mLinksPerNode      = linksPerNode;
+                    result.mNonLinearFraction = nonLinear;
+                    gunnsBenchmarkRun(network, name.str(), steps, dt, result);
+                    results.push_back(result);
+                }
+            }
+        }
+    } catch (std::exception& e) {
+        std::cerr << "benchmark failed: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "benchmark failed." << std::endl;
+        return 1;
+    }
+
+    std::ofstream file;
+    if (not output.empty()) {
+        file.open(output.c_str());
+        if (not file) {
+            std::cerr << "can't open " << output << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& out = output.empty() ? std::cout : file;
+    out << "{\"benchmark\": \"gunns\", \"results\": [\n";
+    for (unsigned int i = 0; i < results.size(); ++i) {
+        out << "  ";
+        results[i].writeJson(out);
+        out << ((i + 1 < results.size()) ? ",\n" : "\n");
+    }
+    out << "]}" << std::endl;
+    return 0;
+}
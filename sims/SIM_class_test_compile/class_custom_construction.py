@@ -42,6 +42,16 @@ class_custom_construction[type]['declare']   = '        GunnsThermalCapacitor
 class_custom_construction[type]['construct'] = '            :\n' \
                                              + '            code(link)\n'
 
+#
+type = 'GunnsThermalNetworkHeatQueues'
+class_custom_construction[type] = {}
+class_custom_construction[type]['include']   = '##include "aspects/thermal/GunnsThermalNetworkHeatQueues.hh"\n'
+class_custom_construction[type]['declare']   = '        GunnsNodeList                 nodes; /**< (1) argument to code under test */\n' \
+                                             + '        std::vector<GunnsBasicLink*>  links; /**< (1) argument to code under test */\n' \
+                                             + '        GunnsThermalNetworkHeatQueues code;  /**< (1) code under test */\n'
+class_custom_construction[type]['construct'] = '            :\n' \
+                                             + '            code(nodes, links)\n'
+
 #
 type = 'GunnsBasicFlowOrchestrator'
 class_custom_construction[type] = {}